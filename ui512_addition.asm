@@ -209,5 +209,100 @@ add_u_wc		ENDP
 
 	ENDIF				
 add_uT64		ENDP												; end of proc
+
+;--------------------------------------------------------------------------------------------------------------------------------------------------------------
+; Acc_Fold MACRO
+;		Ripple an accumulator's pending 128 bits, and extra ( 0 or 1, at bit 128 ), into its 512 bit value; pending set to zero
+;		A carry out of the value sets the accumulator's overflow. Uses and destroys RAX
+;
+Acc_Fold		MACRO			acc, extra
+				MOV				RAX, ui512_acc.lo [ acc ]
+				ADD				Q_PTR ui512_acc.value [ acc ] [ 7 * 8 ], RAX
+				MOV				RAX, ui512_acc.hi [ acc ]
+				ADC				Q_PTR ui512_acc.value [ acc ] [ 6 * 8 ], RAX
+				ADC				Q_PTR ui512_acc.value [ acc ] [ 5 * 8 ], extra
+				FOR				idx, < 4, 3, 2, 1, 0 >
+				ADC				Q_PTR ui512_acc.value [ acc ] [ idx * 8 ], 0
+				ENDM
+				SBB				RAX, RAX
+				AND				EAX, 1
+				OR				ui512_acc.ovf [ acc ], RAX
+				XOR				EAX, EAX
+				MOV				ui512_acc.lo [ acc ], RAX
+				MOV				ui512_acc.hi [ acc ], RAX
+				ENDM
+
+;--------------------------------------------------------------------------------------------------------------------------------------------------------------
+;			acc_init_u	-	set a deferred carry accumulator to zero
+;			Prototype:		extern "C" s32 acc_init_u( ui512_acc* acc )
+;			acc			-	Address of 64 byte aligned accumulator, 16 QWORDS (in RCX)
+;			returns		-	zero
+;			Note: the accumulator is a 512 bit value plus 128 pending bits ( a low QWORD, and a count of its carries ). Adds go to the
+;			pending bits, with a single ADD / ADC; they ripple into the value only when the carry count reaches 2^63, or on flush.
+;
+				Leaf_Entry		acc_init_u
+				CheckAlign		RCX									; (OUT) accumulator
+				Zero512Q		RCX
+				MOV				ui512_acc.lo [ RCX ], RAX
+				MOV				ui512_acc.hi [ RCX ], RAX
+				MOV				ui512_acc.ovf [ RCX ], RAX
+				RET
+acc_init_u		ENDP
+
+;--------------------------------------------------------------------------------------------------------------------------------------------------------------
+;			acc_add_uT64	-	add a 64bit QWORD to a deferred carry accumulator
+;			Prototype:		extern "C" s32 acc_add_uT64( ui512_acc* acc, u64 addend )
+;			acc			-	Address of 64 byte aligned accumulator (in RCX)
+;			addend		-	The 64-bit value in RDX
+;			returns		-	zero (a carry out of 512 bits is reported by acc_flush_u)
+;			Note: not aligned checked, for speed: called for every prime in a sum of primes
+;
+				Leaf_Entry		acc_add_uT64
+				ADD				ui512_acc.lo [ RCX ], RDX
+				ADC				ui512_acc.hi [ RCX ], 0
+				JS				@@fold								; carry count reached 2^63
+				XOR				EAX, EAX
+				RET
+@@fold:			Acc_Fold		RCX, 0
+				RET
+acc_add_uT64	ENDP
+
+;--------------------------------------------------------------------------------------------------------------------------------------------------------------
+;			acc_add_uT128	-	add a 128bit value ( two QWORDS ) to a deferred carry accumulator
+;			Prototype:		extern "C" s32 acc_add_uT128( ui512_acc* acc, u64 addend_lo, u64 addend_hi )
+;			acc			-	Address of 64 byte aligned accumulator (in RCX)
+;			addend_lo	-	The less significant 64 bits in RDX
+;			addend_hi	-	The more significant 64 bits in R8
+;			returns		-	zero (a carry out of 512 bits is reported by acc_flush_u)
+;
+				Leaf_Entry		acc_add_uT128
+				ADD				ui512_acc.lo [ RCX ], RDX
+				ADC				ui512_acc.hi [ RCX ], R8
+				JC				@@carry								; pending bits passed 2^128
+				JS				@@fold
+				XOR				EAX, EAX
+				RET
+@@carry:		Acc_Fold		RCX, 1
+				RET
+@@fold:			Acc_Fold		RCX, 0
+				RET
+acc_add_uT128	ENDP
+
+;--------------------------------------------------------------------------------------------------------------------------------------------------------------
+;			acc_flush_u	-	ripple a deferred carry accumulator's pending bits into its value, and copy the value out
+;			Prototype:		extern "C" s32 acc_flush_u( u64* sum, ui512_acc* acc )
+;			sum			-	Address of 64 byte aligned array of 8 64-bit words (QWORDS) 512 bits (in RCX)
+;			acc			-	Address of 64 byte aligned accumulator (in RDX)
+;			returns		-	zero for no carry, 1 for carry (overflow) out of 512 bits, since acc_init_u
+;			Note: the accumulator keeps its value; adds may continue
+;
+				Leaf_Entry		acc_flush_u
+				CheckAlign		RCX									; (OUT) 8 QWORD sum
+				CheckAlign		RDX									; (IN/OUT) accumulator
+				Acc_Fold		RDX, 0
+				Copy512			RCX, RDX
+				MOV				RAX, ui512_acc.ovf [ RDX ]
+				RET
+acc_flush_u		ENDP
 ui512_addition	ENDS												; end of section
 				END													; end of module
\ No newline at end of file
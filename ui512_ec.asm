@@ -0,0 +1,1823 @@
+;
+;			ui512_ec
+;
+;--------------------------------------------------------------------------------------------------------------------------------------------------------------
+;
+;			File:			ui512_ec.asm
+;			Author:			John G. Lynch
+;			Legal:			Copyright @2025, per MIT License below
+;			Date:			October 19, 2026
+;
+;			Elliptic curve point arithmetic, short Weierstrass curves y^2 = x^3 + a x + b (mod p), a = 0 or a = -3.
+;			Points are Jacobian ( X, Y, Z ), affine x = X / Z^2, y = Y / Z^3, each coordinate a 64 byte aligned ui512 in Montgomery form
+;			for the curve's prime (see mont_mul_u). The point at infinity has Z = 0. Affine points ( x, y ), as used in precomputed tables,
+;			are also in Montgomery form; ec_from_affine_u and ec_to_affine_u convert to and from ordinary values.
+;
+;			Curve parameters are in a constant context (ec_curve): the Montgomery context for p, a, b, the generator, and its order.
+;			Contexts for secp256k1, P-256 and P-384 are provided, others are built by ec_curve_init_u.
+;
+;			The formulas call mont_mul_u directly, with the curve context in RBX throughout, and all temporaries in one aligned local frame.
+;			Operands are copied into the frame first, so the result may be the same point as either operand.
+;				double, a = 0:		dbl-2009-l		2M + 5S
+;				double, a = -3:		dbl-2001-b		3M + 5S
+;				add:				add-2007-bl		11M + 5S
+;				mixed add:			madd-2007-bl	7M + 4S		(second operand affine)
+;			(Bernstein, Lange, "Explicit-Formulas Database", hyperelliptic.org/EFD/g1p/auto-shortw-jacobian.html)
+
+				INCLUDE			ui512_legalnotes.inc
+				INCLUDE			ui512_compile_time_options.inc
+				INCLUDE			ui512_macros.inc
+				INCLUDE			ui512_externs.inc
+.NOLISTIF
+				OPTION			CASEMAP:NONE
+
+;--------------------------------------------------------------------------------------------------------------------------------------------------------------
+;			Curve contexts (ec_curve), aligned 64. Field values in Montgomery form, R = 2^( 64 * n ), n the number of significant QWORDS of p
+;
+ui512_ec_data	SEGMENT			READONLY ALIGN(64) 'CONST'
+
+				PUBLIC			curve_secp256k1
+				PUBLIC			curve_p256
+				PUBLIC			curve_p384
+
+				ALIGN			64
+curve_secp256k1	QWORD			0, 0, 0, 0, 0FFFFFFFFFFFFFFFFh, 0FFFFFFFFFFFFFFFFh, 0FFFFFFFFFFFFFFFFh, 0FFFFFFFEFFFFFC2Fh	; ctx.m: p
+				QWORD			0, 0, 0, 0, 0, 0, 00000000000000001h, 0000007A2000E90A1h	; ctx.r2, R^2 mod p
+				QWORD			0, 0, 0, 0, 0, 0, 0, 000000001000003D1h	; ctx.one, R mod p
+				QWORD			0D838091DD2253531h, 4, 6 dup (0)	; ctx.minv: -p^-1 mod 2^64, ctx.klo, pad
+				QWORD			0, 0, 0, 0, 0, 0, 0, 0	; a (Montgomery form)
+				QWORD			0, 0, 0, 0, 0, 0, 0, 00000000700001AB7h	; b (Montgomery form)
+				QWORD			0, 0, 0, 0, 09981E643E9089F48h, 0979F48C033FD129Ch, 0231E295329BC66DBh, 0D7362E5A487E2097h	; generator x (Montgomery form)
+				QWORD			0, 0, 0, 0, 0CF3F851FD4A582D6h, 070B6B59AAC19C136h, 08DFC5D5D1F1DC64Dh, 0B15EA6D2D3DBABE2h	; generator y (Montgomery form)
+				QWORD			0, 0, 0, 0, 0FFFFFFFFFFFFFFFFh, 0FFFFFFFFFFFFFFFEh, 0BAAEDCE6AF48A03Bh, 0BFD25E8CD0364141h	; order of generator
+				QWORD			0, 7 dup (0)	; kind, pad
+
+				ALIGN			64
+curve_p256	QWORD			0, 0, 0, 0, 0FFFFFFFF00000001h, 0, 000000000FFFFFFFFh, 0FFFFFFFFFFFFFFFFh	; ctx.m: p
+				QWORD			0, 0, 0, 0, 000000004FFFFFFFDh, 0FFFFFFFFFFFFFFFEh, 0FFFFFFFBFFFFFFFFh, 00000000000000003h	; ctx.r2, R^2 mod p
+				QWORD			0, 0, 0, 0, 000000000FFFFFFFEh, 0FFFFFFFFFFFFFFFFh, 0FFFFFFFF00000000h, 00000000000000001h	; ctx.one, R mod p
+				QWORD			00000000000000001h, 4, 6 dup (0)	; ctx.minv: -p^-1 mod 2^64, ctx.klo, pad
+				QWORD			0, 0, 0, 0, 0FFFFFFFC00000004h, 0, 000000003FFFFFFFFh, 0FFFFFFFFFFFFFFFCh	; a (Montgomery form)
+				QWORD			0, 0, 0, 0, 0DC30061D04874834h, 0E5A220ABF7212ED6h, 0ACF005CD78843090h, 0D89CDF6229C4BDDFh	; b (Montgomery form)
+				QWORD			0, 0, 0, 0, 018905F76A53755C6h, 079FB732B77622510h, 075BA95FC5FEDB601h, 079E730D418A9143Ch	; generator x (Montgomery form)
+				QWORD			0, 0, 0, 0, 08571FF1825885D85h, 0D2E88688DD21F325h, 08B4AB8E4BA19E45Ch, 0DDF25357CE95560Ah	; generator y (Montgomery form)
+				QWORD			0, 0, 0, 0, 0FFFFFFFF00000000h, 0FFFFFFFFFFFFFFFFh, 0BCE6FAADA7179E84h, 0F3B9CAC2FC632551h	; order of generator
+				QWORD			1, 7 dup (0)	; kind, pad
+
+				ALIGN			64
+curve_p384	QWORD			0, 0, 0FFFFFFFFFFFFFFFFh, 0FFFFFFFFFFFFFFFFh, 0FFFFFFFFFFFFFFFFh, 0FFFFFFFFFFFFFFFEh, 0FFFFFFFF00000000h, 000000000FFFFFFFFh	; ctx.m: p
+				QWORD			0, 0, 0, 00000000000000001h, 00000000200000000h, 0FFFFFFFE00000000h, 00000000200000000h, 0FFFFFFFE00000001h	; ctx.r2, R^2 mod p
+				QWORD			0, 0, 0, 0, 0, 00000000000000001h, 000000000FFFFFFFFh, 0FFFFFFFF00000001h	; ctx.one, R mod p
+				QWORD			00000000100000001h, 2, 6 dup (0)	; ctx.minv: -p^-1 mod 2^64, ctx.klo, pad
+				QWORD			0, 0, 0FFFFFFFFFFFFFFFFh, 0FFFFFFFFFFFFFFFFh, 0FFFFFFFFFFFFFFFFh, 0FFFFFFFFFFFFFFFBh, 0FFFFFFFC00000000h, 000000003FFFFFFFCh	; a (Montgomery form)
+				QWORD			0, 0, 0CD08114B604FBFF9h, 0B62B21F41F022094h, 0E3374BEE94938AE2h, 077F2209B1920022Eh, 0F729ADD87A4C32ECh, 0081188719D412DCCh	; b (Montgomery form)
+				QWORD			0, 0, 04D3AADC2299E1513h, 0812FF723614EDE2Bh, 06454868459A30EFFh, 0879C3AFC541B4D6Eh, 020E378E2A0D6CE38h, 03DD0756649C0B528h	; generator x (Montgomery form)
+				QWORD			0, 0, 02B78ABC25A15C5E9h, 0DD8002263969A840h, 0C6C3521968F4FFD9h, 08BADE7562E83B050h, 0A1BFA8BF7BB4A9ACh, 023043DAD4B03A4FEh	; generator y (Montgomery form)
+				QWORD			0, 0, 0FFFFFFFFFFFFFFFFh, 0FFFFFFFFFFFFFFFFh, 0FFFFFFFFFFFFFFFFh, 0C7634D81F4372DDFh, 0581A0DB248B0A77Ah, 0ECEC196ACCC52973h	; order of generator
+				QWORD			1, 7 dup (0)	; kind, pad
+
+;			secp256k1 endomorphism ( GLV ): phi ( x, y ) = ( beta x, y ) = lambda ( x, y ); beta a cube root of one mod p, lambda mod n.
+;			Lattice basis ( a1, b1 ), ( a2, b2 = a1 ) of { ( x, y ) : x + y lambda = 0 mod n }, and g1 = round( 2^384 b2 / n ), g2 = round( 2^384 ( -b1 ) / n )
+;			(Gallant, Lambert, Vanstone, "Faster Point Multiplication on Elliptic Curves with Efficient Endomorphisms", CRYPTO 2001)
+				ALIGN			64
+glv_beta		QWORD			0, 0, 0, 0, 07A4A36AEBCBB3D53h, 0F8E98978D02E3905h, 003FDE1631C4B80AFh, 058A4361C8E81894Eh	; beta (Montgomery form)
+glv_g1			QWORD			0, 0, 0, 0, 03086D221A7D46BCDh, 0E86C90E49284EB15h, 03DAA8A1471E8CA7Fh, 0E893209A45DBB031h
+glv_g2			QWORD			0, 0, 0, 0, 0E4437ED6010E8828h, 06F547FA90ABFE4C4h, 0221208AC9DF506C6h, 01571B4AE8AC47F71h
+glv_a1			QWORD			0, 0, 0, 0, 0, 0, 03086D221A7D46BCDh, 0E86C90E49284EB15h	; a1 = b2
+glv_mb1			QWORD			0, 0, 0, 0, 0, 0, 0E4437ED6010E8828h, 06F547FA90ABFE4C3h	; -b1
+glv_a2			QWORD			0, 0, 0, 0, 0, 1, 014CA50F7A8E2F3F6h, 057C1108D9D44CFD8h
+
+ui512_ec_data	ENDS
+
+;--------------------------------------------------------------------------------------------------------------------------------------------------------------
+;			Field operations on locals, curve context (and so the modulus, at offset zero) in RBX
+;			Note: RAX, RCX, RDX, R8 thru R11 are used and not restored
+;
+F_Mul			MACRO			dest:REQ, a:REQ, b:REQ
+				LEA				RCX, dest
+				LEA				RDX, a
+				LEA				R8, b
+				MOV				R9, RBX
+				CALL			mont_mul_u
+				ENDM
+
+F_Sqr			MACRO			dest:REQ, a:REQ
+				F_Mul			dest, a, a
+				ENDM
+
+F_Copy			MACRO			dest:REQ, src:REQ
+				LEA				RCX, dest
+				LEA				RDX, src
+				Copy512			RCX, RDX
+				ENDM
+
+F_Add			MACRO			dest:REQ, src:REQ
+				LEA				RCX, dest
+				LEA				RDX, src
+				AddModMem512	RCX, RDX, RBX
+				ENDM
+
+F_Sub			MACRO			dest:REQ, src:REQ
+				LEA				RCX, dest
+				LEA				RDX, src
+				SubModMem512	RCX, RDX, RBX
+				ENDM
+
+F_Dbl			MACRO			dest:REQ
+				LEA				RCX, dest
+				AddModMem512	RCX, RCX, RBX
+				ENDM
+
+;			Copy a point (three ui512 coordinates) from address in src to address in dest; R10, R11, RAX used
+Copy_Point		MACRO			dest:REQ, src:REQ
+				FOR				off, < 0, 64, 128 >
+				LEA				R10, [ dest + off ]
+				LEA				R11, [ src + off ]
+				Copy512			R10, R11
+				ENDM
+				ENDM
+
+;			Set point at address in dest to infinity (all zero)
+Infinity_Point	MACRO			dest:REQ
+				FOR				off, < 0, 64, 128 >
+				LEA				R10, [ dest + off ]
+				Zero512Q		R10
+				ENDM
+				ENDM
+
+ui512_ec		SEGMENT			PARA 'CODE'
+
+;--------------------------------------------------------------------------------------------------------------------------------------------------------------
+;			EXTERNDEF		ec_curve_init_u:PROC		; s16 ec_curve_init_u( ec_curve* curve, u64* params );
+;			ec_curve_init_u	-	build a curve context
+;			Prototype:		-	s16 ec_curve_init_u( ec_curve* curve, u64* params );
+;			curve			-	Address of 80 QWORDS (ec_curve) to receive the context (in RCX)
+;			params			-	Address of six consecutive 8 QWORD values: p, a, b, generator x, generator y, order (in RDX)
+;			returns			-	(0) for success, (-1) if p is even or one, or a is neither 0 nor -3 mod p, (GP_Fault) for mis-aligned parameter address
+;
+cinit_Locals	STRUCT
+t				QWORD			8 dup (?)
+cinit_Locals	ENDS
+
+				Proc_w_Local	ec_curve_init_u, cinit_Locals, RBX, RSI
+
+				CheckAlign		RCX, @@exit							; (out) Curve
+				CheckAlign		RDX, @@exit							; (in) Parameters
+				MOV				RBX, RCX
+				MOV				RSI, RDX
+
+				MOV				RDX, RSI							; Montgomery context for p
+				CALL			mont_init_u
+				TEST			EAX, EAX
+				JNZ				@@exit
+
+				MOV				ec_curve.kind [ RBX ], 0			; a = 0 or a = p - 3?
+				LEA				RCX, [ RSI + 1 * 64 ]
+				TestZero512		RCX
+				JZ				@@conv
+				MOV				ec_curve.kind [ RBX ], 1
+				LEA				RCX, l_Ptr.t
+				Copy512			RCX, RSI
+				SUB				Q_PTR [ RCX ] [ 7 * 8 ], 3			; t = p - 3
+				FOR				idx, < 6, 5, 4, 3, 2, 1, 0 >
+				SBB				Q_PTR [ RCX ] [ idx * 8 ], 0
+				ENDM
+				LEA				RDX, [ RSI + 1 * 64 ]
+				TestEqual512	RCX, RDX
+				JNE				@@err
+
+@@conv:			FOR				idx, < 1, 2, 3, 4 >					; a, b, generator x and y into Montgomery form
+				LEA				RCX, [ RBX + ec_curve.a + ( idx - 1 ) * 64 ]
+				LEA				RDX, [ RSI + idx * 64 ]
+				LEA				R8, mont_ctx.r2 [ RBX ]
+				MOV				R9, RBX
+				CALL			mont_mul_u
+				ENDM
+				LEA				RCX, ec_curve.n [ RBX ]				; order
+				LEA				RDX, [ RSI + 5 * 64 ]
+				Copy512			RCX, RDX
+				XOR				RAX, RAX
+				FOR				idx, < 1, 2, 3, 4, 5, 6, 7 >
+				MOV				ec_curve.pad [ RBX ] [ ( idx - 1 ) * 8 ], RAX
+				ENDM
+				XOR				EAX, EAX							; return zero
+				JMP				@@exit
+
+@@err:			MOV				EAX, retcode_neg_one
+@@exit:			Local_Exit		RSI, RBX
+ec_curve_init_u	ENDP
+
+;--------------------------------------------------------------------------------------------------------------------------------------------------------------
+;			EXTERNDEF		ec_from_affine_u:PROC		; s16 ec_from_affine_u( ec_point* P, u64* x, u64* y, ec_curve* curve );
+;			ec_from_affine_u -	Jacobian point ( x, y, 1 ), in Montgomery form, from ordinary affine coordinates
+;			Prototype:		-	s16 ec_from_affine_u( ec_point* P, u64* x, u64* y, ec_curve* curve );
+;			P				-	Address of 24 QWORDS (ec_point) to receive the point (in RCX)
+;			x				-	Address of 8 QWORDS affine x, less than p (in RDX)
+;			y				-	Address of 8 QWORDS affine y, less than p (in R8)
+;			curve			-	Address of curve context (in R9)
+;			returns			-	(0) for success, (GP_Fault) for mis-aligned parameter address
+;
+				Proc_w_Local	ec_from_affine_u, cinit_Locals, RBX, RSI
+
+				CheckAlign		RCX, @@exit							; (out) P
+				CheckAlign		RDX, @@exit							; (in) x
+				CheckAlign		R8, @@exit							; (in) y
+				CheckAlign		R9, @@exit							; (in) Curve
+				MOV				RBX, R9
+				MOV				RSI, RCX
+				MOV				R8Home, R8
+
+				LEA				RCX, l_Ptr.t						; x (through t, in case x overlays P.y)
+				LEA				R8, mont_ctx.r2 [ RBX ]
+				MOV				R9, RBX
+				CALL			mont_mul_u
+				LEA				RCX, ec_point.y [ RSI ]
+				MOV				RDX, R8Home
+				LEA				R8, mont_ctx.r2 [ RBX ]
+				MOV				R9, RBX
+				CALL			mont_mul_u
+				LEA				RCX, ec_point.x [ RSI ]
+				LEA				RDX, l_Ptr.t
+				Copy512			RCX, RDX
+				LEA				RCX, ec_point.z [ RSI ]
+				LEA				RDX, mont_ctx.one [ RBX ]
+				Copy512			RCX, RDX
+				XOR				EAX, EAX							; return zero
+@@exit:			Local_Exit		RSI, RBX
+ec_from_affine_u ENDP
+
+;--------------------------------------------------------------------------------------------------------------------------------------------------------------
+;			EXTERNDEF		ec_to_affine_u:PROC			; s16 ec_to_affine_u( u64* x, u64* y, ec_point* P, ec_curve* curve );
+;			ec_to_affine_u	-	ordinary affine coordinates x = X / Z^2, y = Y / Z^3 of a Jacobian point
+;			Prototype:		-	s16 ec_to_affine_u( u64* x, u64* y, ec_point* P, ec_curve* curve );
+;			x				-	Address of 8 QWORDS to receive x (in RCX)
+;			y				-	Address of 8 QWORDS to receive y (in RDX)
+;			P				-	Address of point (in R8)
+;			curve			-	Address of curve context (in R9)
+;			returns			-	(0) for success, (-1) if P is the point at infinity, (GP_Fault) for mis-aligned parameter address
+;
+;			Note: one inversion (invmod_u) of Z taken out of Montgomery form; 1 / Z is put back in, then X / Z^2 and Y / Z^3 come out
+;
+toaff_Locals	STRUCT
+x				QWORD			8 dup (?)
+y				QWORD			8 dup (?)
+zi				QWORD			8 dup (?)
+zi2				QWORD			8 dup (?)
+one				QWORD			8 dup (?)
+toaff_Locals	ENDS
+
+				Proc_w_Local	ec_to_affine_u, toaff_Locals, RBX, RSI
+
+				CheckAlign		RCX, @@exit							; (out) x
+				CheckAlign		RDX, @@exit							; (out) y
+				CheckAlign		R8, @@exit							; (in) P
+				CheckAlign		R9, @@exit							; (in) Curve
+				MOV				RDXHome, RDX
+				MOV				RBX, R9
+				MOV				RSI, R8
+
+				LEA				RCX, ec_point.z [ RSI ]
+				TestZero512		RCX
+				JZ				@@inf
+				LEA				RCX, l_Ptr.one
+				Zero512Q		RCX
+				MOV				Q_PTR [ RCX ] [ 7 * 8 ], 1
+				LEA				RCX, l_Ptr.zi						; Z out of Montgomery form, inverted, back in
+				LEA				RDX, ec_point.z [ RSI ]
+				LEA				R8, l_Ptr.one
+				MOV				R9, RBX
+				CALL			mont_mul_u
+				LEA				RCX, l_Ptr.zi
+				MOV				RDX, RCX
+				MOV				R8, RBX
+				CALL			invmod_u
+				F_Mul			l_Ptr.zi, l_Ptr.zi, < mont_ctx.r2 [ RBX ] >
+				F_Sqr			l_Ptr.zi2, l_Ptr.zi					; 1 / Z^2
+				F_Mul			l_Ptr.x, < ec_point.x [ RSI ] >, l_Ptr.zi2
+				F_Mul			l_Ptr.zi, l_Ptr.zi, l_Ptr.zi2		; 1 / Z^3
+				F_Mul			l_Ptr.y, < ec_point.y [ RSI ] >, l_Ptr.zi
+				F_Mul			l_Ptr.x, l_Ptr.x, l_Ptr.one			; out of Montgomery form
+				F_Mul			l_Ptr.y, l_Ptr.y, l_Ptr.one
+				MOV				RCX, RCXHome
+				LEA				RDX, l_Ptr.x
+				Copy512			RCX, RDX
+				MOV				RCX, RDXHome
+				LEA				RDX, l_Ptr.y
+				Copy512			RCX, RDX
+				XOR				EAX, EAX							; return zero
+				JMP				@@exit
+
+@@inf:			MOV				EAX, retcode_neg_one
+@@exit:			Local_Exit		RSI, RBX
+ec_to_affine_u	ENDP
+
+;--------------------------------------------------------------------------------------------------------------------------------------------------------------
+;			EXTERNDEF		ec_double_u:PROC			; s16 ec_double_u( ec_point* R, ec_point* P, ec_curve* curve );
+;			ec_double_u		-	point doubling, R = 2P
+;			Prototype:		-	s16 ec_double_u( ec_point* R, ec_point* P, ec_curve* curve );
+;			R				-	Address of 24 QWORDS (ec_point) to receive the result (in RCX), may be the same as P
+;			P				-	Address of point (in RDX)
+;			curve			-	Address of curve context (in R8)
+;			returns			-	(0) for success, (GP_Fault) for mis-aligned parameter address
+;
+dbl_Locals		STRUCT
+x1				QWORD			8 dup (?)
+y1				QWORD			8 dup (?)
+z1				QWORD			8 dup (?)
+x3				QWORD			8 dup (?)
+y3				QWORD			8 dup (?)
+z3				QWORD			8 dup (?)
+t0				QWORD			8 dup (?)
+t1				QWORD			8 dup (?)
+t2				QWORD			8 dup (?)
+t3				QWORD			8 dup (?)
+t4				QWORD			8 dup (?)
+dbl_Locals		ENDS
+
+				Proc_w_Local	ec_double_u, dbl_Locals, RBX, RSI
+
+				CheckAlign		RCX, @@exit							; (out) R
+				CheckAlign		RDX, @@exit							; (in) P
+				CheckAlign		R8, @@exit							; (in) Curve
+				MOV				RBX, R8
+				LEA				RSI, l_Ptr.x1
+				Copy_Point		RSI, RDX
+
+				LEA				RCX, l_Ptr.z1						; 2 * infinity, or 2 * point of order two ( y = 0 ), is infinity
+				TestZero512		RCX
+				JZ				@@inf
+				LEA				RCX, l_Ptr.y1
+				TestZero512		RCX
+				JZ				@@inf
+				CMP				ec_curve.kind [ RBX ], 0
+				JNE				@@am3
+
+; a = 0: A = X1^2, B = Y1^2, C = B^2, D = 2 ( ( X1 + B )^2 - A - C ), E = 3A, F = E^2, X3 = F - 2D, Y3 = E ( D - X3 ) - 8C, Z3 = 2 Y1 Z1
+				F_Sqr			l_Ptr.t0, l_Ptr.x1					; t0 = A
+				F_Sqr			l_Ptr.t1, l_Ptr.y1					; t1 = B
+				F_Sqr			l_Ptr.t2, l_Ptr.t1					; t2 = C
+				F_Add			l_Ptr.t1, l_Ptr.x1					; t1 = D
+				F_Sqr			l_Ptr.t1, l_Ptr.t1
+				F_Sub			l_Ptr.t1, l_Ptr.t0
+				F_Sub			l_Ptr.t1, l_Ptr.t2
+				F_Dbl			l_Ptr.t1
+				F_Copy			l_Ptr.t3, l_Ptr.t0					; t3 = E
+				F_Dbl			l_Ptr.t3
+				F_Add			l_Ptr.t3, l_Ptr.t0
+				F_Sqr			l_Ptr.x3, l_Ptr.t3					; X3
+				F_Sub			l_Ptr.x3, l_Ptr.t1
+				F_Sub			l_Ptr.x3, l_Ptr.t1
+				F_Mul			l_Ptr.z3, l_Ptr.y1, l_Ptr.z1		; Z3
+				F_Dbl			l_Ptr.z3
+				F_Sub			l_Ptr.t1, l_Ptr.x3					; Y3
+				F_Mul			l_Ptr.y3, l_Ptr.t3, l_Ptr.t1
+				F_Dbl			l_Ptr.t2
+				F_Dbl			l_Ptr.t2
+				F_Dbl			l_Ptr.t2
+				F_Sub			l_Ptr.y3, l_Ptr.t2
+				JMP				@@store
+
+; a = -3: delta = Z1^2, gamma = Y1^2, beta = X1 gamma, alpha = 3 ( X1 - delta ) ( X1 + delta ), X3 = alpha^2 - 8 beta,
+;	Z3 = ( Y1 + Z1 )^2 - gamma - delta, Y3 = alpha ( 4 beta - X3 ) - 8 gamma^2
+@@am3:			F_Sqr			l_Ptr.t0, l_Ptr.z1					; t0 = delta
+				F_Sqr			l_Ptr.t1, l_Ptr.y1					; t1 = gamma
+				F_Mul			l_Ptr.t2, l_Ptr.x1, l_Ptr.t1		; t2 = beta
+				F_Copy			l_Ptr.t3, l_Ptr.x1					; t3 = alpha
+				F_Sub			l_Ptr.t3, l_Ptr.t0
+				F_Copy			l_Ptr.t4, l_Ptr.x1
+				F_Add			l_Ptr.t4, l_Ptr.t0
+				F_Mul			l_Ptr.t3, l_Ptr.t3, l_Ptr.t4
+				F_Copy			l_Ptr.t4, l_Ptr.t3
+				F_Dbl			l_Ptr.t3
+				F_Add			l_Ptr.t3, l_Ptr.t4
+				F_Copy			l_Ptr.z3, l_Ptr.y1					; Z3
+				F_Add			l_Ptr.z3, l_Ptr.z1
+				F_Sqr			l_Ptr.z3, l_Ptr.z3
+				F_Sub			l_Ptr.z3, l_Ptr.t1
+				F_Sub			l_Ptr.z3, l_Ptr.t0
+				F_Dbl			l_Ptr.t2							; t2 = 4 beta
+				F_Dbl			l_Ptr.t2
+				F_Sqr			l_Ptr.x3, l_Ptr.t3					; X3
+				F_Sub			l_Ptr.x3, l_Ptr.t2
+				F_Sub			l_Ptr.x3, l_Ptr.t2
+				F_Sub			l_Ptr.t2, l_Ptr.x3					; Y3
+				F_Mul			l_Ptr.y3, l_Ptr.t3, l_Ptr.t2
+				F_Sqr			l_Ptr.t1, l_Ptr.t1
+				F_Dbl			l_Ptr.t1
+				F_Dbl			l_Ptr.t1
+				F_Dbl			l_Ptr.t1
+				F_Sub			l_Ptr.y3, l_Ptr.t1
+
+@@store:		MOV				RCX, RCXHome
+				LEA				RDX, l_Ptr.x3
+				Copy_Point		RCX, RDX
+				XOR				EAX, EAX							; return zero
+				JMP				@@exit
+
+@@inf:			MOV				RCX, RCXHome
+				Infinity_Point	RCX
+				XOR				EAX, EAX							; return zero
+@@exit:			Local_Exit		RSI, RBX
+ec_double_u		ENDP
+
+;--------------------------------------------------------------------------------------------------------------------------------------------------------------
+;			EXTERNDEF		ec_add_u:PROC				; s16 ec_add_u( ec_point* R, ec_point* P, ec_point* Q, ec_curve* curve );
+;			ec_add_u		-	point addition, R = P + Q
+;			Prototype:		-	s16 ec_add_u( ec_point* R, ec_point* P, ec_point* Q, ec_curve* curve );
+;			R				-	Address of 24 QWORDS (ec_point) to receive the result (in RCX), may be the same as P or Q
+;			P				-	Address of point (in RDX)
+;			Q				-	Address of point (in R8)
+;			curve			-	Address of curve context (in R9)
+;			returns			-	(0) for success, (GP_Fault) for mis-aligned parameter address
+;
+;			Note: Z1Z1 = Z1^2, Z2Z2 = Z2^2, U1 = X1 Z2Z2, U2 = X2 Z1Z1, S1 = Y1 Z2 Z2Z2, S2 = Y2 Z1 Z1Z1, H = U2 - U1, I = ( 2H )^2,
+;			J = H I, r = 2 ( S2 - S1 ), V = U1 I, X3 = r^2 - J - 2V, Y3 = r ( V - X3 ) - 2 S1 J, Z3 = ( ( Z1 + Z2 )^2 - Z1Z1 - Z2Z2 ) H
+;			H = 0 means the same x: r = 0 too, P = Q, so double; otherwise P = -Q, infinity.
+;
+add_Locals		STRUCT
+x1				QWORD			8 dup (?)
+y1				QWORD			8 dup (?)
+z1				QWORD			8 dup (?)
+x2				QWORD			8 dup (?)
+y2				QWORD			8 dup (?)
+z2				QWORD			8 dup (?)
+x3				QWORD			8 dup (?)
+y3				QWORD			8 dup (?)
+z3				QWORD			8 dup (?)
+z1z1			QWORD			8 dup (?)
+z2z2			QWORD			8 dup (?)
+u1				QWORD			8 dup (?)
+u2				QWORD			8 dup (?)
+s1				QWORD			8 dup (?)
+s2				QWORD			8 dup (?)
+h				QWORD			8 dup (?)
+i				QWORD			8 dup (?)
+j				QWORD			8 dup (?)
+rr				QWORD			8 dup (?)
+v				QWORD			8 dup (?)
+add_Locals		ENDS
+
+				Proc_w_Local	ec_add_u, add_Locals, RBX, RSI
+
+				CheckAlign		RCX, @@exit							; (out) R
+				CheckAlign		RDX, @@exit							; (in) P
+				CheckAlign		R8, @@exit							; (in) Q
+				CheckAlign		R9, @@exit							; (in) Curve
+				MOV				RBX, R9
+				LEA				RSI, l_Ptr.x1
+				Copy_Point		RSI, RDX
+				LEA				RSI, l_Ptr.x2
+				Copy_Point		RSI, R8
+
+				LEA				RCX, l_Ptr.z1						; P at infinity: R = Q
+				TestZero512		RCX
+				JNZ				@F
+				LEA				RDX, l_Ptr.x2
+				JMP				@@copy
+@@:				LEA				RCX, l_Ptr.z2						; Q at infinity: R = P
+				TestZero512		RCX
+				JNZ				@F
+				LEA				RDX, l_Ptr.x1
+				JMP				@@copy
+
+@@:				F_Sqr			l_Ptr.z1z1, l_Ptr.z1
+				F_Sqr			l_Ptr.z2z2, l_Ptr.z2
+				F_Mul			l_Ptr.u1, l_Ptr.x1, l_Ptr.z2z2
+				F_Mul			l_Ptr.u2, l_Ptr.x2, l_Ptr.z1z1
+				F_Mul			l_Ptr.s1, l_Ptr.y1, l_Ptr.z2
+				F_Mul			l_Ptr.s1, l_Ptr.s1, l_Ptr.z2z2
+				F_Mul			l_Ptr.s2, l_Ptr.y2, l_Ptr.z1
+				F_Mul			l_Ptr.s2, l_Ptr.s2, l_Ptr.z1z1
+				F_Copy			l_Ptr.h, l_Ptr.u2
+				F_Sub			l_Ptr.h, l_Ptr.u1
+				F_Copy			l_Ptr.rr, l_Ptr.s2
+				F_Sub			l_Ptr.rr, l_Ptr.s1
+				LEA				RCX, l_Ptr.h
+				TestZero512		RCX
+				JNZ				@@general
+				LEA				RCX, l_Ptr.rr
+				TestZero512		RCX
+				JNZ				@@inf
+				MOV				RCX, RCXHome						; P = Q: double
+				LEA				RDX, l_Ptr.x1
+				MOV				R8, RBX
+				CALL			ec_double_u
+				JMP				@@exit
+
+@@general:		F_Dbl			l_Ptr.rr
+				F_Copy			l_Ptr.i, l_Ptr.h
+				F_Dbl			l_Ptr.i
+				F_Sqr			l_Ptr.i, l_Ptr.i
+				F_Mul			l_Ptr.j, l_Ptr.h, l_Ptr.i
+				F_Mul			l_Ptr.v, l_Ptr.u1, l_Ptr.i
+				F_Sqr			l_Ptr.x3, l_Ptr.rr					; X3
+				F_Sub			l_Ptr.x3, l_Ptr.j
+				F_Sub			l_Ptr.x3, l_Ptr.v
+				F_Sub			l_Ptr.x3, l_Ptr.v
+				F_Sub			l_Ptr.v, l_Ptr.x3					; Y3
+				F_Mul			l_Ptr.y3, l_Ptr.rr, l_Ptr.v
+				F_Mul			l_Ptr.s1, l_Ptr.s1, l_Ptr.j
+				F_Dbl			l_Ptr.s1
+				F_Sub			l_Ptr.y3, l_Ptr.s1
+				F_Copy			l_Ptr.z3, l_Ptr.z1					; Z3
+				F_Add			l_Ptr.z3, l_Ptr.z2
+				F_Sqr			l_Ptr.z3, l_Ptr.z3
+				F_Sub			l_Ptr.z3, l_Ptr.z1z1
+				F_Sub			l_Ptr.z3, l_Ptr.z2z2
+				F_Mul			l_Ptr.z3, l_Ptr.z3, l_Ptr.h
+				LEA				RDX, l_Ptr.x3
+
+@@copy:			MOV				RCX, RCXHome
+				Copy_Point		RCX, RDX
+				XOR				EAX, EAX							; return zero
+				JMP				@@exit
+
+@@inf:			MOV				RCX, RCXHome
+				Infinity_Point	RCX
+				XOR				EAX, EAX							; return zero
+@@exit:			Local_Exit		RSI, RBX
+ec_add_u		ENDP
+
+;--------------------------------------------------------------------------------------------------------------------------------------------------------------
+;			EXTERNDEF		ec_add_mixed_u:PROC			; s16 ec_add_mixed_u( ec_point* R, ec_point* P, ec_affine* Q, ec_curve* curve );
+;			ec_add_mixed_u	-	mixed point addition, R = P + Q, Q affine ( Z = 1 )
+;			Prototype:		-	s16 ec_add_mixed_u( ec_point* R, ec_point* P, ec_affine* Q, ec_curve* curve );
+;			R				-	Address of 24 QWORDS (ec_point) to receive the result (in RCX), may be the same as P
+;			P				-	Address of point (in RDX)
+;			Q				-	Address of 16 QWORDS (ec_affine) affine point, x and y in Montgomery form (in R8)
+;			curve			-	Address of curve context (in R9)
+;			returns			-	(0) for success, (GP_Fault) for mis-aligned parameter address
+;
+;			Note: Z1Z1 = Z1^2, U2 = X2 Z1Z1, S2 = Y2 Z1 Z1Z1, H = U2 - X1, HH = H^2, I = 4 HH, J = H I, r = 2 ( S2 - Y1 ), V = X1 I,
+;			X3 = r^2 - J - 2V, Y3 = r ( V - X3 ) - 2 Y1 J, Z3 = ( Z1 + H )^2 - Z1Z1 - HH
+;
+				Proc_w_Local	ec_add_mixed_u, add_Locals, RBX, RSI
+
+				CheckAlign		RCX, @@exit							; (out) R
+				CheckAlign		RDX, @@exit							; (in) P
+				CheckAlign		R8, @@exit							; (in) Q
+				CheckAlign		R9, @@exit							; (in) Curve
+				MOV				RBX, R9
+				LEA				RSI, l_Ptr.x1
+				Copy_Point		RSI, RDX
+				LEA				RCX, l_Ptr.x2						; Q as a Jacobian point, Z = one
+				Copy512			RCX, R8
+				LEA				RCX, l_Ptr.y2
+				LEA				RDX, ec_affine.y [ R8 ]
+				Copy512			RCX, RDX
+				LEA				RCX, l_Ptr.z2
+				LEA				RDX, mont_ctx.one [ RBX ]
+				Copy512			RCX, RDX
+
+				LEA				RCX, l_Ptr.z1						; P at infinity: R = Q
+				TestZero512		RCX
+				JNZ				@F
+				LEA				RDX, l_Ptr.x2
+				JMP				@@copy
+
+@@:				F_Sqr			l_Ptr.z1z1, l_Ptr.z1
+				F_Mul			l_Ptr.u2, l_Ptr.x2, l_Ptr.z1z1
+				F_Mul			l_Ptr.s2, l_Ptr.y2, l_Ptr.z1
+				F_Mul			l_Ptr.s2, l_Ptr.s2, l_Ptr.z1z1
+				F_Copy			l_Ptr.h, l_Ptr.u2
+				F_Sub			l_Ptr.h, l_Ptr.x1
+				F_Copy			l_Ptr.rr, l_Ptr.s2
+				F_Sub			l_Ptr.rr, l_Ptr.y1
+				LEA				RCX, l_Ptr.h
+				TestZero512		RCX
+				JNZ				@@general
+				LEA				RCX, l_Ptr.rr
+				TestZero512		RCX
+				JNZ				@@inf
+				MOV				RCX, RCXHome						; P = Q: double
+				LEA				RDX, l_Ptr.x1
+				MOV				R8, RBX
+				CALL			ec_double_u
+				JMP				@@exit
+
+@@general:		F_Dbl			l_Ptr.rr
+				F_Sqr			l_Ptr.z2z2, l_Ptr.h					; z2z2 = HH
+				F_Copy			l_Ptr.i, l_Ptr.z2z2
+				F_Dbl			l_Ptr.i
+				F_Dbl			l_Ptr.i
+				F_Mul			l_Ptr.j, l_Ptr.h, l_Ptr.i
+				F_Mul			l_Ptr.v, l_Ptr.x1, l_Ptr.i
+				F_Sqr			l_Ptr.x3, l_Ptr.rr					; X3
+				F_Sub			l_Ptr.x3, l_Ptr.j
+				F_Sub			l_Ptr.x3, l_Ptr.v
+				F_Sub			l_Ptr.x3, l_Ptr.v
+				F_Sub			l_Ptr.v, l_Ptr.x3					; Y3
+				F_Mul			l_Ptr.y3, l_Ptr.rr, l_Ptr.v
+				F_Mul			l_Ptr.s1, l_Ptr.y1, l_Ptr.j
+				F_Dbl			l_Ptr.s1
+				F_Sub			l_Ptr.y3, l_Ptr.s1
+				F_Copy			l_Ptr.z3, l_Ptr.z1					; Z3
+				F_Add			l_Ptr.z3, l_Ptr.h
+				F_Sqr			l_Ptr.z3, l_Ptr.z3
+				F_Sub			l_Ptr.z3, l_Ptr.z1z1
+				F_Sub			l_Ptr.z3, l_Ptr.z2z2
+				LEA				RDX, l_Ptr.x3
+
+@@copy:			MOV				RCX, RCXHome
+				Copy_Point		RCX, RDX
+				XOR				EAX, EAX							; return zero
+				JMP				@@exit
+
+@@inf:			MOV				RCX, RCXHome
+				Infinity_Point	RCX
+				XOR				EAX, EAX							; return zero
+@@exit:			Local_Exit		RSI, RBX
+ec_add_mixed_u	ENDP
+
+;--------------------------------------------------------------------------------------------------------------------------------------------------------------
+;			EXTERNDEF		ec_on_curve_u:PROC			; s16 ec_on_curve_u( ec_point* P, ec_curve* curve );
+;			ec_on_curve_u	-	check a Jacobian point is on the curve: Y^2 = X^3 + a X Z^4 + b Z^6
+;			Prototype:		-	s16 ec_on_curve_u( ec_point* P, ec_curve* curve );
+;			P				-	Address of point (in RCX)
+;			curve			-	Address of curve context (in RDX)
+;			returns			-	(0) on the curve (or infinity), (-1) not on the curve, (GP_Fault) for mis-aligned parameter address
+;
+				Proc_w_Local	ec_on_curve_u, dbl_Locals, RBX, RSI
+
+				CheckAlign		RCX, @@exit							; (in) P
+				CheckAlign		RDX, @@exit							; (in) Curve
+				MOV				RBX, RDX
+				LEA				RSI, l_Ptr.x1
+				Copy_Point		RSI, RCX
+				LEA				RCX, l_Ptr.z1
+				TestZero512		RCX
+				JZ				@@on
+
+				F_Sqr			l_Ptr.t0, l_Ptr.z1					; t0 = Z^2
+				F_Sqr			l_Ptr.t1, l_Ptr.t0					; t1 = Z^4
+				F_Mul			l_Ptr.t2, l_Ptr.t1, l_Ptr.t0		; t2 = Z^6
+				F_Mul			l_Ptr.t2, l_Ptr.t2, < ec_curve.b [ RBX ] >	; b Z^6
+				F_Mul			l_Ptr.t1, l_Ptr.t1, < ec_curve.a [ RBX ] >	; a Z^4
+				F_Sqr			l_Ptr.t3, l_Ptr.x1					; X^2 + a Z^4
+				F_Add			l_Ptr.t3, l_Ptr.t1
+				F_Mul			l_Ptr.t3, l_Ptr.t3, l_Ptr.x1		; X^3 + a X Z^4
+				F_Add			l_Ptr.t3, l_Ptr.t2
+				F_Sqr			l_Ptr.t4, l_Ptr.y1
+				LEA				RCX, l_Ptr.t3
+				LEA				RDX, l_Ptr.t4
+				TestEqual512	RCX, RDX
+				JNE				@@off
+@@on:			XOR				EAX, EAX							; return zero
+				JMP				@@exit
+@@off:			MOV				EAX, retcode_neg_one
+@@exit:			Local_Exit		RSI, RBX
+ec_on_curve_u	ENDP
+
+;--------------------------------------------------------------------------------------------------------------------------------------------------------------
+;			EXTERNDEF		ec_scalar_mul_u:PROC		; s16 ec_scalar_mul_u( ec_point* R, u64* k, ec_point* P, ec_curve* curve );
+;			ec_scalar_mul_u	-	variable base scalar multiplication, R = k P
+;			Prototype:		-	s16 ec_scalar_mul_u( ec_point* R, u64* k, ec_point* P, ec_curve* curve );
+;			R				-	Address of 24 QWORDS (ec_point) to receive the result (in RCX), may be the same as P
+;			k				-	Address of 8 QWORDS scalar, any 512 bit value (in RDX)
+;			P				-	Address of point (in R8)
+;			curve			-	Address of curve context (in R9)
+;			returns			-	(0) for success, (GP_Fault) for mis-aligned parameter address
+;
+;			Note: k is recoded to width-w NAF: odd digits, -2^(w-1) < d < 2^(w-1), each followed by at least w - 1 zeros. The runs of zeros
+;			are skipped with lsb_u and shr_u, so only the non-zero digits are stored, with their bit positions. The odd multiples P, 3P, ..
+;			( 2^(w-1) - 1 ) P are precomputed into an aligned table in the local frame, negatives are taken from the table by negating Y.
+;			About one add per w + 1 doubles. Run time depends on k: this is for public scalars (verification), not secret ones.
+;
+wnaf_w			EQU				5									; NAF window width
+wnaf_tbl		EQU				1 SHL ( wnaf_w - 2 )				; table entries: P, 3P, .. ( 2^(w-1) - 1 ) P
+wnaf_max		EQU				112									; stored digits, at most ( 512 + 1 ) / w + 1
+
+smul_Locals		STRUCT
+tbl				ec_point		wnaf_tbl dup (<>)
+acc				ec_point		<>
+tmp				ec_point		<>
+ny				QWORD			8 dup (?)
+k				QWORD			8 dup (?)
+naf				QWORD			wnaf_max dup (?)					; digit in low byte (signed), bit position above
+smul_Locals		ENDS
+
+;			Copy signed table entry for digit entry in RAX to local point "dest"; R12 used
+Signed_Entry	MACRO			dest:REQ
+				LOCAL			done
+				MOVSX			R12, AL								; digit
+				MOV				RCX, R12
+				NEG				RCX
+				CMOVS			RCX, R12							; | d |
+				SHR				RCX, 1								; table index
+				IMUL			RCX, RCX, SIZEOF ec_point
+				LEA				RDX, l_Ptr.tbl
+				ADD				RDX, RCX
+				LEA				RCX, dest
+				Copy_Point		RCX, RDX
+				TEST			R12, R12
+				JNS				done
+				LEA				RCX, dest + ec_point.y				; negative: Y = p - Y ( Y of zero stays zero )
+				TestZero512		RCX
+				JZ				done
+				LEA				RCX, l_Ptr.ny
+				Copy512			RCX, RBX
+				LEA				RDX, dest + ec_point.y
+				SubMem512		RCX, RDX
+				Copy512			RDX, RCX
+done:
+				ENDM
+
+				Proc_w_Local	ec_scalar_mul_u, smul_Locals, RBX, RSI, RDI, R12
+
+				CheckAlign		RCX, @@exit							; (out) R
+				CheckAlign		RDX, @@exit							; (in) k
+				CheckAlign		R8, @@exit							; (in) P
+				CheckAlign		R9, @@exit							; (in) Curve
+				MOV				RBX, R9
+				MOV				R8Home, R8
+				LEA				RCX, ec_point.z [ R8 ]				; infinity times anything is infinity
+				TestZero512		RCX
+				JZ				@@inf
+				LEA				RCX, l_Ptr.k
+				Copy512			RCX, RDX
+
+; recode: skip to the next set bit, take the low w bits as a signed digit, subtract it (low w bits now zero), shift by w
+				XOR				ESI, ESI							; digit count
+				XOR				EDI, EDI							; bit position
+@@recode:		LEA				RCX, l_Ptr.k
+				CALL			lsb_u
+				MOVSX			RAX, AX
+				TEST			RAX, RAX
+				JS				@@recoded							; k now zero
+				ADD				RDI, RAX
+				LEA				RCX, l_Ptr.k
+				MOV				RDX, RCX
+				MOV				R8, RAX
+				CALL			shr_u
+				LEA				RCX, l_Ptr.k
+				MOV				RAX, Q_PTR [ RCX ] [ 7 * 8 ]
+				AND				EAX, ( 1 SHL wnaf_w ) - 1
+				XOR				R12D, R12D							; carry out of the top, for negative digits
+				CMP				EAX, 1 SHL ( wnaf_w - 1 )
+				JAE				@@neg
+				AND				Q_PTR [ RCX ] [ 7 * 8 ], NOT ( ( 1 SHL wnaf_w ) - 1 )	; k = k - d
+				JMP				@@digit
+@@neg:			MOV				EDX, 1 SHL wnaf_w					; k = k + | d |
+				SUB				EDX, EAX
+				ADD				Q_PTR [ RCX ] [ 7 * 8 ], RDX
+				FOR				idx, < 6, 5, 4, 3, 2, 1, 0 >
+				ADC				Q_PTR [ RCX ] [ idx * 8 ], 0
+				ENDM
+				SETC			R12B
+				SUB				EAX, 1 SHL wnaf_w					; d, negative
+@@digit:		MOV				RDX, RDI
+				SHL				RDX, 8
+				MOVZX			EAX, AL
+				OR				RDX, RAX
+				LEA				RCX, l_Ptr.naf
+				MOV				[ RCX + RSI * 8 ], RDX
+				INC				RSI
+				LEA				RCX, l_Ptr.k
+				MOV				RDX, RCX
+				MOV				R8D, wnaf_w
+				CALL			shr_u
+				ADD				RDI, wnaf_w
+				TEST			R12, R12
+				JZ				@@recode
+				BTS				l_Ptr.k, 64 - wnaf_w				; carry out of bit 511, now at bit 512 - w
+				JMP				@@recode
+
+@@recoded:		TEST			RSI, RSI							; zero times anything is infinity
+				JZ				@@inf
+
+; table of odd multiples: tbl [ i ] = ( 2i + 1 ) P
+				LEA				RCX, l_Ptr.tbl
+				MOV				RDX, R8Home
+				Copy_Point		RCX, RDX
+				LEA				RCX, l_Ptr.tmp						; 2P
+				LEA				RDX, l_Ptr.tbl
+				MOV				R8, RBX
+				CALL			ec_double_u
+				FOR				idx, < 1, 2, 3, 4, 5, 6, 7 >
+				IF				idx LT wnaf_tbl
+				LEA				RCX, l_Ptr.tbl + idx * SIZEOF ec_point
+				LEA				RDX, l_Ptr.tbl + ( idx - 1 ) * SIZEOF ec_point
+				LEA				R8, l_Ptr.tmp
+				MOV				R9, RBX
+				CALL			ec_add_u
+				ENDIF
+				ENDM
+
+; double and add, from the top digit down
+				DEC				RSI
+				LEA				RCX, l_Ptr.naf
+				MOV				RAX, [ RCX + RSI * 8 ]
+				MOV				RDI, RAX
+				SHR				RDI, 8								; position of accumulator
+				Signed_Entry	l_Ptr.acc
+@@next:			XOR				EAX, EAX							; next position, zero after the last digit
+				TEST			RSI, RSI
+				JZ				@@dbl
+				LEA				RCX, l_Ptr.naf
+				MOV				RAX, [ RCX + RSI * 8 - 8 ]
+				SHR				RAX, 8
+@@dbl:			CMP				RDI, RAX
+				JBE				@@add
+				LEA				RCX, l_Ptr.acc
+				MOV				RDX, RCX
+				MOV				R8, RBX
+				CALL			ec_double_u
+				DEC				RDI
+				JMP				@@next
+@@add:			TEST			RSI, RSI
+				JZ				@@store
+				DEC				RSI
+				LEA				RCX, l_Ptr.naf
+				MOV				RAX, [ RCX + RSI * 8 ]
+				Signed_Entry	l_Ptr.tmp
+				LEA				RCX, l_Ptr.acc
+				MOV				RDX, RCX
+				LEA				R8, l_Ptr.tmp
+				MOV				R9, RBX
+				CALL			ec_add_u
+				JMP				@@next
+
+@@store:		MOV				RCX, RCXHome
+				LEA				RDX, l_Ptr.acc
+				Copy_Point		RCX, RDX
+				XOR				EAX, EAX							; return zero
+				JMP				@@exit
+
+@@inf:			MOV				RCX, RCXHome
+				Infinity_Point	RCX
+				XOR				EAX, EAX							; return zero
+@@exit:			Local_Exit		R12, RDI, RSI, RBX
+ec_scalar_mul_u	ENDP
+
+;--------------------------------------------------------------------------------------------------------------------------------------------------------------
+;			Fixed base comb (Lim-Lee) tables for the generator
+;
+;			The scalar, reduced mod n, is written as 8 rows ( teeth ) of a bits each, a = ceil( bits of n / 8 ), and each row is split into v
+;			blocks of b = ceil( a / v ) bits. Block j has 255 precomputed affine points: entry ( j, u ) = sum over bits r set in u of 2^( r a + j b ) G.
+;			One pass over the b columns does b - 1 doubles and up to v * b mixed adds: for P-256 with v = 2, 15 doubles and 32 adds.
+;
+;			The table is one flat block, 64 byte aligned: the header (ec_comb) then v * 255 ec_affine entries, coordinates in Montgomery form.
+;			It has no pointers: it can be written to a file as is and mapped back at any address, with no fixups.
+;			Size is 64 + v * 255 * 128 bytes: 32 KB for v = 1, 64 KB for v = 2, up to 255 KB for v = 8.
+;
+comb_teeth		EQU				8
+comb_entries	EQU				( 1 SHL comb_teeth ) - 1
+comb_magic		EQU				0EC0C0B0512000001h					; identifies a comb table, version one
+
+;			Address of entry ( j, u ) into dest register, table address in RSI
+Comb_Entry		MACRO			dest:REQ, jj:REQ, uu:REQ
+				IMUL			dest, jj, comb_entries
+				ADD				dest, uu
+				SHL				dest, 7								; SIZEOF ec_affine
+				LEA				dest, [ RSI + dest + SIZEOF ec_comb - SIZEOF ec_affine ]
+				ENDM
+
+;--------------------------------------------------------------------------------------------------------------------------------------------------------------
+;			EXTERNDEF		ec_comb_build_u:PROC		; s16 ec_comb_build_u( ec_comb* table, u64 blocks, ec_curve* curve );
+;			ec_comb_build_u	-	build the fixed base comb table for the curve's generator
+;			Prototype:		-	s16 ec_comb_build_u( ec_comb* table, u64 blocks, ec_curve* curve );
+;			table			-	Address of 64 + blocks * 255 * 128 bytes to receive the table (in RCX)
+;			blocks			-	v, number of blocks per row, 1 to 8: more blocks, fewer doubles, larger table (in RDX)
+;			curve			-	Address of curve context (in R8)
+;			returns			-	(0) for success, (-1) for blocks out of range, (GP_Fault) for mis-aligned parameter address
+;
+;			Note: built once; each entry costs one mixed add and one inversion. The header is written last, so a partly built table is not valid.
+;
+cbld_Locals		STRUCT
+cur				ec_point		<>
+colbase			ec_point		<>
+tmp				ec_point		<>
+x				QWORD			8 dup (?)
+y				QWORD			8 dup (?)
+cbld_Locals		ENDS
+
+;			Jacobian point in local tmp, into affine entry at address in RDI, Montgomery form
+Store_Entry		MACRO			src:REQ
+				LEA				RCX, l_Ptr.x
+				LEA				RDX, l_Ptr.y
+				LEA				R8, src
+				MOV				R9, RBX
+				CALL			ec_to_affine_u
+				LEA				RCX, ec_affine.x [ RDI ]
+				LEA				RDX, l_Ptr.x
+				LEA				R8, mont_ctx.r2 [ RBX ]
+				MOV				R9, RBX
+				CALL			mont_mul_u
+				LEA				RCX, ec_affine.y [ RDI ]
+				LEA				RDX, l_Ptr.y
+				LEA				R8, mont_ctx.r2 [ RBX ]
+				MOV				R9, RBX
+				CALL			mont_mul_u
+				ENDM
+
+;			Double local point "pt", count times, count in memory or register; R14 used
+Double_N		MACRO			pt:REQ, count:REQ
+				LOCAL			again, done
+				MOV				R14, count
+again:			TEST			R14, R14
+				JZ				done
+				LEA				RCX, pt
+				MOV				RDX, RCX
+				MOV				R8, RBX
+				CALL			ec_double_u
+				DEC				R14
+				JMP				again
+done:
+				ENDM
+
+				Proc_w_Local	ec_comb_build_u, cbld_Locals, RBX, RSI, RDI, R12, R13, R14
+
+				CheckAlign		RCX, @@exit							; (out) Table
+				CheckAlign		R8, @@exit							; (in) Curve
+				MOV				RSI, RCX
+				MOV				RBX, R8
+				LEA				RAX, [ RDX - 1 ]
+				CMP				RAX, 7
+				JA				@@err
+				MOV				ec_comb.magic [ RSI ], 0
+				MOV				ec_comb.teeth [ RSI ], comb_teeth
+				MOV				ec_comb.blocks [ RSI ], RDX
+				IMUL			RAX, RDX, comb_entries * SIZEOF ec_affine
+				ADD				RAX, SIZEOF ec_comb
+				MOV				ec_comb.bytes [ RSI ], RAX
+				MOV				RAX, Q_PTR mont_ctx.m [ RBX ] [ 7 * 8 ]
+				MOV				ec_comb.pcheck [ RSI ], RAX
+				MOV				RAX, Q_PTR ec_curve.n [ RBX ] [ 7 * 8 ]
+				MOV				ec_comb.ncheck [ RSI ], RAX
+				LEA				RCX, ec_curve.n [ RBX ]				; a = ceil( bits of n / 8 ), b = ceil( a / v )
+				CALL			msb_u
+				MOVSX			RAX, AX
+				ADD				RAX, 1 + comb_teeth - 1				; bits + 7, over 8 teeth
+				SHR				RAX, 3
+				MOV				ec_comb.spacing [ RSI ], RAX
+				MOV				RCX, ec_comb.blocks [ RSI ]
+				LEA				RAX, [ RAX + RCX - 1 ]
+				XOR				EDX, EDX
+				DIV				RCX
+				MOV				ec_comb.bsize [ RSI ], RAX
+
+				LEA				RCX, l_Ptr.colbase					; colbase = G, 2^( j b ) G for block j
+				LEA				RDX, ec_curve.gx [ RBX ]
+				Copy512			RCX, RDX
+				LEA				RCX, l_Ptr.colbase + ec_point.y
+				LEA				RDX, ec_curve.gy [ RBX ]
+				Copy512			RCX, RDX
+				LEA				RCX, l_Ptr.colbase + ec_point.z
+				LEA				RDX, mont_ctx.one [ RBX ]
+				Copy512			RCX, RDX
+
+				XOR				R12D, R12D							; block j
+@@block:		LEA				RCX, l_Ptr.cur
+				LEA				RDX, l_Ptr.colbase
+				Copy_Point		RCX, RDX
+				XOR				R13D, R13D							; tooth r: entry ( j, 2^r ) = 2^( r a + j b ) G
+@@tooth:		MOV				EAX, 1
+				MOV				ECX, R13D
+				SHL				EAX, CL
+				Comb_Entry		RDI, R12, RAX
+				Store_Entry		l_Ptr.cur
+				Double_N		l_Ptr.cur, ec_comb.spacing [ RSI ]
+				INC				R13
+				CMP				R13, comb_teeth
+				JB				@@tooth
+
+				MOV				R13D, 3								; other entries: entry ( j, u ) = entry ( j, u - low bit ) + entry ( j, low bit )
+@@comb:			LEA				RAX, [ R13 - 1 ]
+				AND				RAX, R13							; u without its low bit
+				JZ				@@nextu								; power of two, done above
+				Comb_Entry		RDX, R12, RAX
+				LEA				RCX, l_Ptr.tmp
+				Copy512			RCX, RDX
+				LEA				RCX, l_Ptr.tmp + ec_point.y
+				LEA				RDX, ec_affine.y [ RDX ]
+				Copy512			RCX, RDX
+				LEA				RCX, l_Ptr.tmp + ec_point.z
+				LEA				RDX, mont_ctx.one [ RBX ]
+				Copy512			RCX, RDX
+				LEA				RAX, [ R13 - 1 ]
+				AND				RAX, R13
+				MOV				RDX, R13
+				SUB				RDX, RAX							; low bit
+				Comb_Entry		R8, R12, RDX
+				LEA				RCX, l_Ptr.tmp
+				MOV				RDX, RCX
+				MOV				R9, RBX
+				CALL			ec_add_mixed_u
+				Comb_Entry		RDI, R12, R13
+				Store_Entry		l_Ptr.tmp
+@@nextu:		INC				R13
+				CMP				R13, comb_entries
+				JBE				@@comb
+
+				Double_N		l_Ptr.colbase, ec_comb.bsize [ RSI ]
+				INC				R12
+				CMP				R12, ec_comb.blocks [ RSI ]
+				JB				@@block
+
+				MOV				RAX, comb_magic						; valid now
+				MOV				ec_comb.magic [ RSI ], RAX
+				XOR				EAX, EAX							; return zero
+				JMP				@@exit
+
+@@err:			MOV				EAX, retcode_neg_one
+@@exit:			Local_Exit		R14, R13, R12, RDI, RSI, RBX
+ec_comb_build_u	ENDP
+
+;--------------------------------------------------------------------------------------------------------------------------------------------------------------
+;			EXTERNDEF		ec_comb_mul_u:PROC			; s16 ec_comb_mul_u( ec_point* R, u64* k, ec_comb* table, ec_curve* curve );
+;			ec_comb_mul_u	-	fixed base scalar multiplication, R = k G, using a comb table
+;			Prototype:		-	s16 ec_comb_mul_u( ec_point* R, u64* k, ec_comb* table, ec_curve* curve );
+;			R				-	Address of 24 QWORDS (ec_point) to receive the result (in RCX)
+;			k				-	Address of 8 QWORDS scalar, any 512 bit value (in RDX)
+;			table			-	Address of comb table, from ec_comb_build_u, or a saved copy of one mapped at any address (in R8)
+;			curve			-	Address of curve context (in R9)
+;			returns			-	(0) for success, (-1) if the table is not a comb table for this curve, (GP_Fault) for mis-aligned parameter address
+;
+;			Note: scalar bits are picked up in place with BT, no shifting. Scalars wider than the comb are reduced mod n first.
+;			Run time depends on the number of zero columns in k.
+;
+cmul_Locals		STRUCT
+acc				ec_point		<>
+khi				QWORD			8 dup (?)							; zero: bit positions past 511 (8 a can be up to 519) read here
+k				QWORD			8 dup (?)
+q				QWORD			8 dup (?)
+cmul_Locals		ENDS
+
+				Proc_w_Local	ec_comb_mul_u, cmul_Locals, RBX, RSI, RDI, R12, R13, R14
+
+				CheckAlign		RCX, @@exit							; (out) R
+				CheckAlign		RDX, @@exit							; (in) k
+				CheckAlign		R8, @@exit							; (in) Table
+				CheckAlign		R9, @@exit							; (in) Curve
+				MOV				RBX, R9
+				MOV				RSI, R8
+				MOV				RDXHome, RDX
+				MOV				RAX, comb_magic						; a complete comb table, for this curve?
+				CMP				ec_comb.magic [ RSI ], RAX
+				JNE				@@err
+				CMP				ec_comb.teeth [ RSI ], comb_teeth
+				JNE				@@err
+				MOV				RAX, Q_PTR mont_ctx.m [ RBX ] [ 7 * 8 ]
+				CMP				ec_comb.pcheck [ RSI ], RAX
+				JNE				@@err
+				MOV				RAX, Q_PTR ec_curve.n [ RBX ] [ 7 * 8 ]
+				CMP				ec_comb.ncheck [ RSI ], RAX
+				JNE				@@err
+
+				MOV				RCX, RDX							; scalar fits the comb? else reduce mod n
+				CALL			msb_u
+				MOVSX			RAX, AX
+				IMUL			RCX, ec_comb.spacing [ RSI ], comb_teeth
+				CMP				RAX, RCX
+				JL				@@fits
+				LEA				RCX, l_Ptr.q
+				LEA				RDX, l_Ptr.k
+				MOV				R8, RDXHome
+				LEA				R9, ec_curve.n [ RBX ]
+				CALL			div_u
+				JMP				@@go
+@@fits:			LEA				RCX, l_Ptr.k
+				MOV				RDX, RDXHome
+				Copy512			RCX, RDX
+
+@@go:			LEA				RCX, l_Ptr.khi
+				Zero512Q		RCX
+				LEA				RCX, l_Ptr.acc
+				Infinity_Point	RCX
+				MOV				RDI, ec_comb.bsize [ RSI ]			; column i, b - 1 down to zero
+@@column:		DEC				RDI
+				LEA				RCX, l_Ptr.acc
+				MOV				RDX, RCX
+				MOV				R8, RBX
+				CALL			ec_double_u
+				XOR				R12D, R12D							; block j
+@@block:		MOV				R13, R12							; bit offset in row: j b + i, past the row end in the last block?
+				IMUL			R13, ec_comb.bsize [ RSI ]
+				ADD				R13, RDI
+				CMP				R13, ec_comb.spacing [ RSI ]
+				JAE				@@nextblock
+				LEA				R10, l_Ptr.k						; u: bit r is scalar bit r a + j b + i, gathered from row 7 down
+				MOV				R11, ec_comb.spacing [ RSI ]
+				IMUL			RAX, R11, comb_teeth - 1
+				ADD				RAX, R13
+				XOR				R14D, R14D
+				MOV				ECX, comb_teeth
+@@bit:			MOV				RDX, RAX
+				SHR				RDX, 6
+				NEG				RDX
+				MOV				RDX, [ R10 + RDX * 8 + 7 * 8 ]		; QWORD holding the bit
+				BT				RDX, RAX
+				ADC				R14, R14
+				SUB				RAX, R11
+				DEC				ECX
+				JNZ				@@bit
+				TEST			R14, R14
+				JZ				@@nextblock
+				Comb_Entry		R8, R12, R14
+				LEA				RCX, l_Ptr.acc
+				MOV				RDX, RCX
+				MOV				R9, RBX
+				CALL			ec_add_mixed_u
+@@nextblock:	INC				R12
+				CMP				R12, ec_comb.blocks [ RSI ]
+				JB				@@block
+				TEST			RDI, RDI
+				JNZ				@@column
+
+				MOV				RCX, RCXHome
+				LEA				RDX, l_Ptr.acc
+				Copy_Point		RCX, RDX
+				XOR				EAX, EAX							; return zero
+				JMP				@@exit
+
+@@err:			MOV				EAX, retcode_neg_one
+@@exit:			Local_Exit		R14, R13, R12, RDI, RSI, RBX
+ec_comb_mul_u	ENDP
+
+;--------------------------------------------------------------------------------------------------------------------------------------------------------------
+;			Multi-scalar multiplication, Pippenger's bucket method: R = sum k_i P_i
+;
+;			Scalars are cut into windows of c bits. For each window, from the top: the sum so far is doubled c times, each P_i is added
+;			(mixed add) to bucket d_i, its c bit digit, then the buckets are summed with a running sum, 2^c - 1 buckets in two adds each:
+;			sum over d of d * bucket d. About ( n + 2^( c + 1 ) ) adds per window, against about ( bits / 5 ) adds and bits doubles per term
+;			for separate multiplies.
+;
+;			A job (ec_msm) names a slice of the work: a range of terms (scalars and points addresses, count) and a range of windows.
+;			The result of a slice carries the full weight of its windows, so slices that cover the terms and windows once each can be run
+;			on separate threads, each with its own buckets, and their results added with ec_add_u. When splitting by windows, set the
+;			window size in each job (ec_msm_window_u of the total count), so all jobs cut the scalars the same way.
+;
+;			Windows above the highest digit in use are passed over with one digit extraction per term, so 512 bit windows cost little
+;			for shorter scalars.
+;
+msm_max_window	EQU				16
+
+;--------------------------------------------------------------------------------------------------------------------------------------------------------------
+;			EXTERNDEF		ec_msm_window_u:PROC		; s16 ec_msm_window_u( u64 count );
+;			ec_msm_window_u	-	window size for a multi-scalar multiply of count terms: log2( count ) - 2, from 2 to 12
+;			Prototype:		-	s16 ec_msm_window_u( u64 count );
+;			count			-	number of terms (in RCX)
+;			returns			-	window size, in bits. Buckets needed: ( 2^window - 1 ) ec_points, at most 786 KB
+;
+				Leaf_Entry		ec_msm_window_u
+				MOV				EDX, 2
+				BSR				RAX, RCX
+				CMOVZ			EAX, EDX							; count of zero
+				SUB				EAX, 2
+				CMP				EAX, EDX
+				CMOVL			EAX, EDX
+				MOV				EDX, 12
+				CMP				EAX, EDX
+				CMOVG			EAX, EDX
+				RET
+ec_msm_window_u	ENDP
+
+;--------------------------------------------------------------------------------------------------------------------------------------------------------------
+;			EXTERNDEF		ec_msm_u:PROC				; s16 ec_msm_u( ec_point* R, ec_msm* job );
+;			ec_msm_u		-	multi-scalar multiplication of a slice of terms and windows, R = sum over the slice of k_i P_i
+;			Prototype:		-	s16 ec_msm_u( ec_point* R, ec_msm* job );
+;			R				-	Address of 24 QWORDS (ec_point) to receive the result (in RCX)
+;			job				-	Address of 8 QWORDS (ec_msm) describing the slice (in RDX):
+;								scalars: 8 QWORDS each, points: ec_affine (Montgomery form, not infinity), count, curve,
+;								buckets: ( 2^window - 1 ) * 192 bytes of scratch, window: 1 to 16 bits, zero for ec_msm_window_u( count ),
+;								wfirst: first window (zero is the least significant), wcount: number of windows, zero for all from wfirst
+;			returns			-	(0) for success, (-1) for window out of range, (GP_Fault) for mis-aligned parameter address
+;
+msm_Locals		STRUCT
+acc				ec_point		<>
+run				ec_point		<>
+tot				ec_point		<>
+c				QWORD			?									; window size
+wend			QWORD			?									; window past the last one in the slice
+maxb			QWORD			?									; highest bucket used in this window
+pad				QWORD			5 dup (?)
+msm_Locals		ENDS
+
+				Proc_w_Local	ec_msm_u, msm_Locals, RBX, RSI, RDI, R12, R13, R14
+
+				CheckAlign		RCX, @@exit							; (out) R
+				CheckAlign		RDX, @@exit							; (in) Job
+				MOV				RSI, RDX
+				MOV				RBX, ec_msm.curve [ RSI ]
+				LEA				RCX, l_Ptr.acc
+				Infinity_Point	RCX
+				MOV				RAX, ec_msm.window [ RSI ]
+				TEST			RAX, RAX
+				JNZ				@F
+				MOV				RCX, ec_msm.count [ RSI ]
+				CALL			ec_msm_window_u
+				MOVSX			RAX, AX
+@@:				LEA				RCX, [ RAX - 1 ]
+				CMP				RCX, msm_max_window - 1
+				JA				@@err
+				MOV				l_Ptr.c, RAX
+				MOV				RCX, RAX							; windows in 512 bits: ceil( 512 / c )
+				LEA				RAX, [ RAX + 512 - 1 ]
+				XOR				EDX, EDX
+				DIV				RCX
+				MOV				RCX, ec_msm.wcount [ RSI ]			; last window: wfirst + wcount, or all
+				ADD				RCX, ec_msm.wfirst [ RSI ]
+				CMP				ec_msm.wcount [ RSI ], 0
+				CMOVE			RCX, RAX
+				CMP				RCX, RAX
+				CMOVA			RCX, RAX
+				MOV				l_Ptr.wend, RCX
+				MOV				RDI, RCX
+				CMP				RDI, ec_msm.wfirst [ RSI ]
+				JBE				@@store								; no windows: infinity
+
+@@window:		DEC				RDI									; window w, from the top
+				Double_N		l_Ptr.acc, l_Ptr.c
+				MOV				R13, ec_msm.buckets [ RSI ]			; empty the buckets (Z = 0 is infinity)
+				MOV				RCX, l_Ptr.c
+				MOV				R14D, 1
+				SHL				R14, CL
+				DEC				R14
+@@:				LEA				RCX, ec_point.z [ R13 ]
+				Zero512Q		RCX
+				ADD				R13, SIZEOF ec_point
+				DEC				R14
+				JNZ				@B
+				MOV				l_Ptr.maxb, 0
+
+				XOR				R12D, R12D							; term i
+@@term:			CMP				R12, ec_msm.count [ RSI ]
+				JAE				@@sum
+				MOV				RAX, RDI							; digit: c bits of k_i from bit w c
+				IMUL			RAX, l_Ptr.c
+				MOV				ECX, EAX
+				AND				ECX, 63
+				SHR				RAX, 6
+				NEG				RAX
+				ADD				RAX, 7								; QWORD holding the low bit
+				MOV				R8, R12
+				SHL				R8, 6
+				ADD				R8, ec_msm.scalars [ RSI ]
+				MOV				RDX, [ R8 + RAX * 8 ]
+				XOR				R9D, R9D
+				TEST			RAX, RAX
+				JZ				@F
+				MOV				R9, [ R8 + RAX * 8 - 8 ]			; and the next more significant
+@@:				SHRD			RDX, R9, CL
+				MOV				RCX, l_Ptr.c
+				MOV				R9D, 1
+				SHL				R9, CL
+				DEC				R9
+				AND				RDX, R9
+				JZ				@@nextterm
+				CMP				RDX, l_Ptr.maxb
+				JBE				@F
+				MOV				l_Ptr.maxb, RDX
+@@:				LEA				RCX, [ RDX - 1 ]					; bucket d += P_i
+				IMUL			RCX, RCX, SIZEOF ec_point
+				ADD				RCX, ec_msm.buckets [ RSI ]
+				MOV				RDX, RCX
+				MOV				R8, R12
+				SHL				R8, 7								; SIZEOF ec_affine
+				ADD				R8, ec_msm.points [ RSI ]
+				MOV				R9, RBX
+				CALL			ec_add_mixed_u
+@@nextterm:		INC				R12
+				JMP				@@term
+
+@@sum:			MOV				R13, l_Ptr.maxb						; running sum, from the highest bucket used down
+				TEST			R13, R13
+				JZ				@@nextwindow
+				LEA				RCX, l_Ptr.run
+				Infinity_Point	RCX
+				LEA				RCX, l_Ptr.tot
+				Infinity_Point	RCX
+@@bucket:		LEA				R8, [ R13 - 1 ]
+				IMUL			R8, R8, SIZEOF ec_point
+				ADD				R8, ec_msm.buckets [ RSI ]
+				LEA				RCX, l_Ptr.run
+				MOV				RDX, RCX
+				MOV				R9, RBX
+				CALL			ec_add_u
+				LEA				RCX, l_Ptr.tot
+				MOV				RDX, RCX
+				LEA				R8, l_Ptr.run
+				MOV				R9, RBX
+				CALL			ec_add_u
+				DEC				R13
+				JNZ				@@bucket
+				LEA				RCX, l_Ptr.acc
+				MOV				RDX, RCX
+				LEA				R8, l_Ptr.tot
+				MOV				R9, RBX
+				CALL			ec_add_u
+@@nextwindow:	CMP				RDI, ec_msm.wfirst [ RSI ]
+				JA				@@window
+
+				MOV				RAX, RDI							; weight of the lowest window in the slice: 2^( c wfirst )
+				IMUL			RAX, l_Ptr.c
+				Double_N		l_Ptr.acc, RAX
+
+@@store:		MOV				RCX, RCXHome
+				LEA				RDX, l_Ptr.acc
+				Copy_Point		RCX, RDX
+				XOR				EAX, EAX							; return zero
+				JMP				@@exit
+
+@@err:			MOV				EAX, retcode_neg_one
+@@exit:			Local_Exit		R14, R13, R12, RDI, RSI, RBX
+ec_msm_u		ENDP
+
+;--------------------------------------------------------------------------------------------------------------------------------------------------------------
+;			EXTERNDEF		ec_dual_mul_u:PROC			; s16 ec_dual_mul_u( ec_point* R, u64* u, ec_point* PQ, ec_curve* curve );
+;			ec_dual_mul_u	-	double scalar multiplication, R = u1 P + u2 Q
+;			Prototype:		-	s16 ec_dual_mul_u( ec_point* R, u64* u, ec_point* PQ, ec_curve* curve );
+;			R				-	Address of 24 QWORDS (ec_point) to receive the result (in RCX), may be the same as P or Q
+;			u				-	Address of 16 QWORDS: u1, then u2 (in RDX)
+;			PQ				-	Address of 48 QWORDS: point P, then point Q (in R8)
+;			curve			-	Address of curve context (in R9)
+;			returns			-	(0) for success, (GP_Fault) for mis-aligned parameter address
+;
+;			Note: Shamir's trick (Straus), two bits of each scalar at a time: one pass of doubles shared by both scalars, one add of
+;			i P + j Q ( i, j in 0 .. 3, 15 points precomputed ) per two bit column. For 256 bit scalars, 256 doubles and about 120 adds,
+;			against 512 doubles and about 170 adds for two separate width-5 NAF multiplies. The doubles run only from the highest
+;			set bit of either scalar, so half length scalars (as from ec_glv_mul_u) take half the doubles.
+;
+shm_Locals		STRUCT
+tbl				ec_point		15 dup (<>)							; tbl [ i + 4 j - 1 ] = i P + j Q
+acc				ec_point		<>
+shm_Locals		ENDS
+
+				Proc_w_Local	ec_dual_mul_u, shm_Locals, RBX, RSI, RDI, R12
+
+				CheckAlign		RCX, @@exit							; (out) R
+				CheckAlign		RDX, @@exit							; (in) u1, u2
+				CheckAlign		R8, @@exit							; (in) P, Q
+				CheckAlign		R9, @@exit							; (in) Curve
+				MOV				RBX, R9
+				MOV				RSI, RDX
+				LEA				RCX, l_Ptr.tbl						; P
+				Copy_Point		RCX, R8
+				LEA				RCX, l_Ptr.tbl + 3 * SIZEOF ec_point	; Q
+				LEA				RDX, [ R8 + SIZEOF ec_point ]
+				Copy_Point		RCX, RDX
+				LEA				RCX, l_Ptr.tbl + 1 * SIZEOF ec_point	; 2P, 3P, 2Q, 3Q
+				LEA				RDX, l_Ptr.tbl
+				MOV				R8, RBX
+				CALL			ec_double_u
+				LEA				RCX, l_Ptr.tbl + 2 * SIZEOF ec_point
+				LEA				RDX, l_Ptr.tbl + 1 * SIZEOF ec_point
+				LEA				R8, l_Ptr.tbl
+				MOV				R9, RBX
+				CALL			ec_add_u
+				LEA				RCX, l_Ptr.tbl + 7 * SIZEOF ec_point
+				LEA				RDX, l_Ptr.tbl + 3 * SIZEOF ec_point
+				MOV				R8, RBX
+				CALL			ec_double_u
+				LEA				RCX, l_Ptr.tbl + 11 * SIZEOF ec_point
+				LEA				RDX, l_Ptr.tbl + 7 * SIZEOF ec_point
+				LEA				R8, l_Ptr.tbl + 3 * SIZEOF ec_point
+				MOV				R9, RBX
+				CALL			ec_add_u
+				FOR				jj, < 1, 2, 3 >						; i P + j Q
+				FOR				ii, < 1, 2, 3 >
+				LEA				RCX, l_Ptr.tbl + ( ii + 4 * jj - 1 ) * SIZEOF ec_point
+				LEA				RDX, l_Ptr.tbl + ( 4 * jj - 1 ) * SIZEOF ec_point
+				LEA				R8, l_Ptr.tbl + ( ii - 1 ) * SIZEOF ec_point
+				MOV				R9, RBX
+				CALL			ec_add_u
+				ENDM
+				ENDM
+
+				MOV				RCX, RSI							; top column: highest set bit of either scalar, rounded to even
+				CALL			msb_u
+				MOVSX			RDI, AX
+				LEA				RCX, [ RSI + 64 ]
+				CALL			msb_u
+				MOVSX			RAX, AX
+				CMP				RAX, RDI
+				CMOVG			RDI, RAX
+				LEA				RCX, l_Ptr.acc
+				Infinity_Point	RCX
+				TEST			RDI, RDI
+				JS				@@store								; both zero
+				AND				RDI, -2
+
+@@column:		LEA				RCX, l_Ptr.acc						; acc = 4 acc
+				MOV				RDX, RCX
+				MOV				R8, RBX
+				CALL			ec_double_u
+				LEA				RCX, l_Ptr.acc
+				MOV				RDX, RCX
+				MOV				R8, RBX
+				CALL			ec_double_u
+				MOV				RCX, RDI							; two bits of each at bit RDI (even: never split across QWORDS)
+				MOV				RAX, RDI
+				SHR				RAX, 6
+				NEG				RAX
+				MOV				R12, [ RSI + RAX * 8 + 7 * 8 + 64 ]	; u2
+				SHR				R12, CL
+				AND				R12, 3
+				SHL				R12, 2
+				MOV				RDX, [ RSI + RAX * 8 + 7 * 8 ]		; u1
+				SHR				RDX, CL
+				AND				RDX, 3
+				OR				R12, RDX							; i + 4 j
+				JZ				@@next
+				LEA				R8, [ R12 - 1 ]
+				IMUL			R8, R8, SIZEOF ec_point
+				LEA				RCX, l_Ptr.tbl
+				ADD				R8, RCX
+				LEA				RCX, l_Ptr.acc
+				MOV				RDX, RCX
+				MOV				R9, RBX
+				CALL			ec_add_u
+@@next:			SUB				RDI, 2
+				JNS				@@column
+
+@@store:		MOV				RCX, RCXHome
+				LEA				RDX, l_Ptr.acc
+				Copy_Point		RCX, RDX
+				XOR				EAX, EAX							; return zero
+@@exit:			Local_Exit		R12, RDI, RSI, RBX
+ec_dual_mul_u	ENDP
+
+;--------------------------------------------------------------------------------------------------------------------------------------------------------------
+;			EXTERNDEF		ec_shamir_mul_u:PROC		; s16 ec_shamir_mul_u( ec_point* R, u64* u, ec_point* Q, ec_curve* curve );
+;			ec_shamir_mul_u	-	double scalar multiplication, R = u1 G + u2 Q, G the curve's generator
+;			Prototype:		-	s16 ec_shamir_mul_u( ec_point* R, u64* u, ec_point* Q, ec_curve* curve );
+;			R				-	Address of 24 QWORDS (ec_point) to receive the result (in RCX), may be the same as Q
+;			u				-	Address of 16 QWORDS: u1, then u2 (in RDX)
+;			Q				-	Address of point (in R8)
+;			curve			-	Address of curve context (in R9)
+;			returns			-	(0) for success, (GP_Fault) for mis-aligned parameter address
+;
+;			Note: the generator and Q side by side in the frame, then ec_dual_mul_u
+;
+gq_Locals		STRUCT
+pq				ec_point		2 dup (<>)
+gq_Locals		ENDS
+
+				Proc_w_Local	ec_shamir_mul_u, gq_Locals, RBX, RSI
+
+				CheckAlign		RCX, @@exit							; (out) R
+				CheckAlign		R8, @@exit							; (in) Q
+				CheckAlign		R9, @@exit							; (in) Curve
+				MOV				RBX, R9
+				MOV				RSI, RDX
+				LEA				RCX, l_Ptr.pq + SIZEOF ec_point		; Q
+				Copy_Point		RCX, R8
+				LEA				RCX, l_Ptr.pq						; G
+				LEA				RDX, ec_curve.gx [ RBX ]
+				Copy512			RCX, RDX
+				LEA				RCX, l_Ptr.pq + ec_point.y
+				LEA				RDX, ec_curve.gy [ RBX ]
+				Copy512			RCX, RDX
+				LEA				RCX, l_Ptr.pq + ec_point.z
+				LEA				RDX, mont_ctx.one [ RBX ]
+				Copy512			RCX, RDX
+				MOV				RCX, RCXHome
+				MOV				RDX, RSI
+				LEA				R8, l_Ptr.pq
+				MOV				R9, RBX
+				CALL			ec_dual_mul_u
+@@exit:			Local_Exit		RSI, RBX
+ec_shamir_mul_u	ENDP
+
+;--------------------------------------------------------------------------------------------------------------------------------------------------------------
+;			EXTERNDEF		ec_glv_mul_u:PROC			; s16 ec_glv_mul_u( ec_point* R, u64* k, ec_point* P, ec_curve* curve );
+;			ec_glv_mul_u	-	secp256k1 scalar multiplication by the GLV endomorphism, R = k P
+;			Prototype:		-	s16 ec_glv_mul_u( ec_point* R, u64* k, ec_point* P, ec_curve* curve );
+;			R				-	Address of 24 QWORDS (ec_point) to receive the result (in RCX), may be the same as P
+;			k				-	Address of 8 QWORDS, scalar, any 512 bit value (in RDX)
+;			P				-	Address of point (in R8)
+;			curve			-	Address of curve context (in R9), secp256k1
+;			returns			-	(0) for success, (-1) if the curve is not secp256k1, (GP_Fault) for mis-aligned parameter address
+;
+;			Note: k mod n is split as k1 + k2 lambda, | k1 |, | k2 | < 2^128: c1 = round( k g1 / 2^384 ), c2 = round( k g2 / 2^384 )
+;			(the high QWORDS of one mult_u each, rounded by bit 383), k1 = k - c1 a1 - c2 a2, k2 = c1 ( -b1 ) - c2 a1, exact in 512 bits.
+;			A negative half takes its magnitude, and the negated point. Then ec_dual_mul_u of k1, k2 over P, phi ( P ):
+;			128 doubles, against 256 for ec_scalar_mul_u.
+;
+glv_Locals		STRUCT
+u				QWORD			16 dup (?)							; | k1 |, | k2 |
+pq				ec_point		2 dup (<>)							; +- P, +- phi ( P )
+kk				QWORD			8 dup (?)							; k mod n
+c1				QWORD			8 dup (?)
+c2				QWORD			8 dup (?)
+prod			QWORD			8 dup (?)
+ovf				QWORD			8 dup (?)
+t				QWORD			8 dup (?)
+glv_Locals		ENDS
+
+;			c = round( product / 2^384 ), from the high QWORDS of product (128 bits at most)
+Round384		MACRO			c:REQ
+				LEA				RCX, c
+				Zero512Q		RCX
+				MOV				RAX, Q_PTR l_Ptr.prod [ 2 * 8 ]
+				SHR				RAX, 63
+				ADD				RAX, Q_PTR l_Ptr.prod [ 1 * 8 ]
+				MOV				Q_PTR [ RCX ] [ 7 * 8 ], RAX
+				MOV				RAX, Q_PTR l_Ptr.prod [ 0 * 8 ]
+				ADC				RAX, 0
+				MOV				Q_PTR [ RCX ] [ 6 * 8 ], RAX
+				ENDM
+
+;			Product of two locals, or local and constant, into prod (or dest)
+Mul_To			MACRO			dest:REQ, a:REQ, b:REQ
+				LEA				RCX, dest
+				LEA				RDX, l_Ptr.ovf
+				LEA				R8, a
+				LEA				R9, b
+				CALL			mult_u
+				ENDM
+
+				Proc_w_Local	ec_glv_mul_u, glv_Locals, RBX, RSI, RDI, R12
+
+				CheckAlign		RCX, @@exit							; (out) R
+				CheckAlign		RDX, @@exit							; (in) k
+				CheckAlign		R8, @@exit							; (in) P
+				CheckAlign		R9, @@exit							; (in) Curve
+				MOV				RBX, R9
+				MOV				RSI, RDX
+				MOV				RDI, R8
+				LEA				RCX, curve_secp256k1				; secp256k1 only: same p, same n
+				TestEqual512	RBX, RCX
+				JNE				@@err
+				LEA				RCX, curve_secp256k1 + ec_curve.n
+				LEA				RDX, ec_curve.n [ RBX ]
+				TestEqual512	RCX, RDX
+				JNE				@@err
+				LEA				RCX, ec_point.z [ RDI ]				; P at infinity: so is R
+				TestZero512		RCX
+				JNZ				@F
+				MOV				RCX, RCXHome
+				Infinity_Point	RCX
+				XOR				EAX, EAX
+				JMP				@@exit
+
+@@:				LEA				RCX, l_Ptr.kk						; k mod n
+				MOV				RDX, RSI
+				Copy512			RCX, RDX
+				MOV				RCX, RSI
+				LEA				RDX, ec_curve.n [ RBX ]
+				CALL			compare_u
+				CMP				AX, 0
+				JL				@F
+				LEA				RCX, l_Ptr.prod
+				LEA				RDX, l_Ptr.kk
+				MOV				R8, RSI
+				LEA				R9, ec_curve.n [ RBX ]
+				CALL			div_u
+
+@@:				Mul_To			l_Ptr.prod, l_Ptr.kk, glv_g1		; c1, c2
+				Round384		l_Ptr.c1
+				Mul_To			l_Ptr.prod, l_Ptr.kk, glv_g2
+				Round384		l_Ptr.c2
+				Mul_To			l_Ptr.prod, l_Ptr.c1, glv_a1		; k1 = k - c1 a1 - c2 a2
+				LEA				RCX, l_Ptr.u
+				LEA				RDX, l_Ptr.kk
+				LEA				R8, l_Ptr.prod
+				CALL			sub_u
+				Mul_To			l_Ptr.prod, l_Ptr.c2, glv_a2
+				LEA				RCX, l_Ptr.u
+				MOV				RDX, RCX
+				LEA				R8, l_Ptr.prod
+				CALL			sub_u
+				Mul_To			l_Ptr.t, l_Ptr.c1, glv_mb1			; k2 = c1 ( -b1 ) - c2 a1
+				Mul_To			l_Ptr.prod, l_Ptr.c2, glv_a1
+				LEA				RCX, l_Ptr.u + 64
+				LEA				RDX, l_Ptr.t
+				LEA				R8, l_Ptr.prod
+				CALL			sub_u
+
+				LEA				RCX, l_Ptr.pq						; P, and phi ( P ) = ( beta X, Y, Z )
+				Copy_Point		RCX, RDI
+				LEA				RCX, l_Ptr.pq + SIZEOF ec_point + ec_point.y
+				LEA				RDX, ec_point.y [ RDI ]
+				Copy512			RCX, RDX
+				LEA				RCX, l_Ptr.pq + SIZEOF ec_point + ec_point.z
+				LEA				RDX, ec_point.z [ RDI ]
+				Copy512			RCX, RDX
+				F_Mul			< l_Ptr.pq + SIZEOF ec_point >, ec_point.x [ RDI ], glv_beta
+
+				XOR				R12D, R12D							; negative halves: magnitude, and the point negated ( Y = p - Y )
+@@sign:			LEA				RCX, l_Ptr.u
+				ADD				RCX, R12
+				CMP				Q_PTR [ RCX ], 0
+				JGE				@@positive
+				LEA				RDX, l_Ptr.t
+				Zero512Q		RDX
+				MOV				R8, RCX
+				CALL			sub_u
+				MOV				RAX, R12							; u offset 0, 64: point offset 0, SIZEOF ec_point
+				IMUL			RAX, RAX, SIZEOF ec_point / 64
+				LEA				RCX, l_Ptr.pq + ec_point.y
+				ADD				RCX, RAX
+				LEA				RDX, l_Ptr.t
+				Copy512			RDX, RBX
+				SubMem512		RDX, RCX
+				Copy512			RCX, RDX
+@@positive:		ADD				R12, 64
+				CMP				R12, 128
+				JB				@@sign
+
+				MOV				RCX, RCXHome
+				LEA				RDX, l_Ptr.u
+				LEA				R8, l_Ptr.pq
+				MOV				R9, RBX
+				CALL			ec_dual_mul_u
+				JMP				@@exit
+
+@@err:			MOV				EAX, retcode_neg_one
+@@exit:			Local_Exit		R12, RDI, RSI, RBX
+ec_glv_mul_u	ENDP
+
+;--------------------------------------------------------------------------------------------------------------------------------------------------------------
+;			EXTERNDEF		ec_ecdsa_verify_u:PROC		; s16 ec_ecdsa_verify_u( s16* results, ecdsa_sig* sigs, u64 count, ec_curve* curve );
+;			ec_ecdsa_verify_u	-	verify a batch of ECDSA signatures, each with its own hash and public key
+;			Prototype:		-	s16 ec_ecdsa_verify_u( s16* results, ecdsa_sig* sigs, u64 count, ec_curve* curve );
+;			results			-	Address of count WORDS to receive (0) valid, or (-1) invalid, for each signature (in RCX)
+;			sigs			-	Address of count ecdsa_sig, 40 QWORDS each: e ( hash, as an integer ), r, s, public key x, y, ordinary values (in RDX)
+;			count			-	number of signatures (in R8)
+;			curve			-	Address of curve context (in R9)
+;			returns			-	(0) for success, (-1) if the curve's order is even or one, (GP_Fault) for mis-aligned parameter address
+;
+;			Note: signatures are taken in groups of ecdsa_batch: the inverses of s for the group are found by one invmod_u_batch
+;			(Montgomery's trick), then for each, u1 = e / s, u2 = r / s mod n, and R = u1 G + u2 Q by ec_shamir_mul_u.
+;			x ( R ) mod n = r is tested in Jacobian form, ( r + j n ) Z^2 = X for r + j n < p, no inversion mod p.
+;			Out of range r or s, and public keys off the curve, are rejected before any point arithmetic.
+;
+ecdsa_batch		EQU				16
+
+ecv_Locals		STRUCT
+nctx			mont_ctx		<>									; Montgomery context for the order n
+sv				QWORD			ecdsa_batch * 8 dup (?)				; s of each in the group, zero if already rejected
+w				QWORD			ecdsa_batch * 8 dup (?)				; 1 / s mod n
+u				QWORD			16 dup (?)							; u1, u2
+q				ec_point		<>
+rp				ec_point		<>
+t0				QWORD			8 dup (?)
+t1				QWORD			8 dup (?)
+t2				QWORD			8 dup (?)
+ecv_Locals		ENDS
+
+;			Address of signature R14 of the group (at RSI) into reg
+Sig_At			MACRO			reg:REQ
+				IMUL			reg, R14, SIZEOF ecdsa_sig
+				ADD				reg, RSI
+				ENDM
+
+;			Address of 8 QWORD entry R14 of a local array into reg; RAX used
+Entry_At		MACRO			reg:REQ, array:REQ
+				MOV				RAX, R14
+				SHL				RAX, 6
+				LEA				reg, array
+				ADD				reg, RAX
+				ENDM
+
+				Proc_w_Local	ec_ecdsa_verify_u, ecv_Locals, RBX, RSI, RDI, R12, R13, R14
+
+				CheckAlign		RDX, @@exit							; (in) Signatures
+				CheckAlign		R9, @@exit							; (in) Curve
+				MOV				RDI, RCX							; results
+				MOV				RSI, RDX							; signatures
+				MOV				R12, R8								; count remaining
+				MOV				RBX, R9
+				LEA				RCX, l_Ptr.nctx
+				LEA				RDX, ec_curve.n [ RBX ]
+				CALL			mont_init_u
+				TEST			EAX, EAX
+				JNZ				@@exit								; -1: order is even or one
+
+@@group:		TEST			R12, R12
+				JZ				@@done
+				MOV				R13, ecdsa_batch					; signatures in this group
+				CMP				R12, R13
+				CMOVB			R13, R12
+
+; screen: 1 <= r, s < n, or rejected and s not inverted (zero values are skipped by invmod_u_batch)
+				XOR				R14D, R14D
+@@screen:		MOV				W_PTR [ RDI + R14 * 2 ], 0
+				Entry_At		RCX, l_Ptr.sv
+				Sig_At			RDX
+				LEA				RDX, ecdsa_sig.s [ RDX ]
+				Copy512			RCX, RDX
+				FOR				fld, < r, s >
+				Sig_At			RCX
+				LEA				RCX, ecdsa_sig.&fld [ RCX ]
+				TestZero512		RCX
+				JZ				@@reject
+				LEA				RDX, ec_curve.n [ RBX ]
+				CALL			compare_u
+				CMP				AX, 0
+				JGE				@@reject
+				ENDM
+				JMP				@@screened
+@@reject:		MOV				W_PTR [ RDI + R14 * 2 ], retcode_neg_one
+				Entry_At		RCX, l_Ptr.sv
+				Zero512Q		RCX
+@@screened:		INC				R14
+				CMP				R14, R13
+				JB				@@screen
+
+				LEA				RCX, l_Ptr.w						; one inversion for the group
+				LEA				RDX, l_Ptr.sv
+				MOV				R8, R13
+				LEA				R9, ec_curve.n [ RBX ]
+				CALL			invmod_u_batch
+
+				XOR				R14D, R14D
+@@verify:		CMP				W_PTR [ RDI + R14 * 2 ], 0
+				JNE				@@next
+
+; u1 = e w, u2 = r w mod n: Montgomery multiply by w, then by R^2 to cancel the R^-1
+				LEA				RCX, l_Ptr.t0						; e mod n
+				LEA				RDX, l_Ptr.t1
+				Sig_At			R8
+				LEA				R8, ecdsa_sig.e [ R8 ]
+				LEA				R9, ec_curve.n [ RBX ]
+				CALL			div_u
+				Entry_At		R8, l_Ptr.w
+				LEA				RCX, l_Ptr.u
+				LEA				RDX, l_Ptr.t1
+				LEA				R9, l_Ptr.nctx
+				CALL			mont_mul_u
+				Entry_At		R8, l_Ptr.w
+				LEA				RCX, l_Ptr.u + 64
+				Sig_At			RDX
+				LEA				RDX, ecdsa_sig.r [ RDX ]
+				LEA				R9, l_Ptr.nctx
+				CALL			mont_mul_u
+				FOR				off, < 0, 64 >
+				LEA				RCX, l_Ptr.u + off
+				MOV				RDX, RCX
+				LEA				R8, l_Ptr.nctx + mont_ctx.r2
+				LEA				R9, l_Ptr.nctx
+				CALL			mont_mul_u
+				ENDM
+
+; public key: coordinates below p, and on the curve
+				FOR				fld, < qx, qy >
+				Sig_At			RCX
+				LEA				RCX, ecdsa_sig.&fld [ RCX ]
+				MOV				RDX, RBX
+				CALL			compare_u
+				CMP				AX, 0
+				JGE				@@fail
+				ENDM
+				LEA				RCX, l_Ptr.q
+				Sig_At			RDX
+				LEA				R8, ecdsa_sig.qy [ RDX ]
+				LEA				RDX, ecdsa_sig.qx [ RDX ]
+				MOV				R9, RBX
+				CALL			ec_from_affine_u
+				LEA				RCX, l_Ptr.q
+				MOV				RDX, RBX
+				CALL			ec_on_curve_u
+				TEST			EAX, EAX
+				JNZ				@@fail
+
+				LEA				RCX, l_Ptr.rp						; R = u1 G + u2 Q, not infinity
+				LEA				RDX, l_Ptr.u
+				LEA				R8, l_Ptr.q
+				MOV				R9, RBX
+				CALL			ec_shamir_mul_u
+				LEA				RCX, l_Ptr.rp + ec_point.z
+				TestZero512		RCX
+				JZ				@@fail
+
+; x ( R ) = r mod n: ( r + j n ) Z^2 = X, for each r + j n < p
+				F_Sqr			l_Ptr.t2, < l_Ptr.rp + ec_point.z >
+				LEA				RCX, l_Ptr.t0
+				Sig_At			RDX
+				LEA				RDX, ecdsa_sig.r [ RDX ]
+				Copy512			RCX, RDX
+@@candidate:	LEA				RCX, l_Ptr.t0
+				MOV				RDX, RBX
+				CALL			compare_u
+				CMP				AX, 0
+				JGE				@@fail
+				F_Mul			l_Ptr.t1, l_Ptr.t0, < mont_ctx.r2 [ RBX ] >	; to Montgomery form
+				F_Mul			l_Ptr.t1, l_Ptr.t1, l_Ptr.t2
+				LEA				RCX, l_Ptr.t1
+				LEA				RDX, l_Ptr.rp
+				TestEqual512	RCX, RDX
+				JE				@@next
+				LEA				RCX, l_Ptr.t0
+				LEA				RDX, ec_curve.n [ RBX ]
+				AddMem512		RCX, RDX
+				JMP				@@candidate
+
+@@fail:			MOV				W_PTR [ RDI + R14 * 2 ], retcode_neg_one
+@@next:			INC				R14
+				CMP				R14, R13
+				JB				@@verify
+
+				IMUL			RAX, R13, SIZEOF ecdsa_sig			; next group
+				ADD				RSI, RAX
+				LEA				RDI, [ RDI + R13 * 2 ]
+				SUB				R12, R13
+				JMP				@@group
+
+@@done:			XOR				EAX, EAX							; return zero
+@@exit:			Local_Exit		R14, R13, R12, RDI, RSI, RBX
+ec_ecdsa_verify_u	ENDP
+
+ui512_ec		ENDS
+				END													; end of module
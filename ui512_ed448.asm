@@ -0,0 +1,549 @@
+;
+;			ui512_ed448
+;
+;--------------------------------------------------------------------------------------------------------------------------------------------------------------
+;
+;			File:			ui512_ed448.asm
+;			Author:			John G. Lynch
+;			Legal:			Copyright @2025, per MIT License below
+;			Date:			October 19, 2026
+;
+;			Ed448 (RFC 8032) point arithmetic: the Edwards curve x^2 + y^2 = 1 + d x^2 y^2, d = -39081, over p = 2^448 - 2^224 - 1
+;			(Goldilocks). The 448 bit field fits the ui512 with the leading QWORD zero, so an element can be handed to any of the ui512
+;			routines as is. Field values are ordinary (not Montgomery form) and fully reduced, below p.
+;
+;			Points are extended ( X, Y, Z, T ): x = X / Z, y = Y / Z, T = X Y / Z, each coordinate a 64 byte aligned ui512. The neutral
+;			point is ( 0, 1, 1, 0 ); there is no point at infinity, and Z is never zero. The formulas (a = 1) are complete for Ed448
+;			(d is not a square mod p), so add works for any two points, including a point and itself, or the neutral point.
+;				add:				add-2008-hwcd	8M + 1 times 39081
+;				double:				dbl-2008-hwcd	4M + 4S
+;			(Hisil, Wong, Carter, Dawson, "Twisted Edwards Curves Revisited", ASIACRYPT 2008)
+;
+;			A field multiply is mult_u, then reduce_448_u (the Goldilocks fold, no division and no Montgomery conversion);
+;			d T1 T2 is - 39081 T1 T2, by mult_uT64. The address of prime_448 is kept in RBX for the modular add and subtract.
+;			Operands are copied into the frame first, so the result may be the same point as either operand.
+
+				INCLUDE			ui512_legalnotes.inc
+				INCLUDE			ui512_compile_time_options.inc
+				INCLUDE			ui512_macros.inc
+				INCLUDE			ui512_externs.inc
+.NOLISTIF
+				OPTION			CASEMAP:NONE
+
+;--------------------------------------------------------------------------------------------------------------------------------------------------------------
+;			Base point (ed448_point, 32 QWORDS) and its order, aligned 64
+;
+ui512_ed448_data SEGMENT		READONLY ALIGN(64) 'CONST'
+
+				PUBLIC			ed448_base
+				PUBLIC			ed448_order
+
+				ALIGN			64
+ed448_base		QWORD			0, 04F1970C66BED0DEDh, 0221D15A622BF36DAh, 09E146570470F1767h, 0EA6DE324A3D3A464h, 012AE1AF72AB66511h, 0433B80E18B00938Eh, 02626A82BC70CC05Eh	; x
+				QWORD			0, 0693F46716EB6BC24h, 08876203756C9C762h, 04BEA73736CA39840h, 087789C1E05A0C2D7h, 03AD3FF1CE67C39C4h, 0FDBD132C4ED7C8ADh, 09808795BF230FA14h	; y
+				QWORD			0, 0, 0, 0, 0, 0, 0, 1	; z
+				QWORD			0, 0C75EB58AEE221C6Ch, 0CEC39D2D508D91C9h, 0C5056A183F8451D2h, 060D71667E2356D58h, 0F179DE90B5B27DA1h, 0F78FA07D85662D1Dh, 0EB06624E82AF95F3h	; t = x y
+ed448_order		QWORD			0, 03FFFFFFFFFFFFFFFh, 0FFFFFFFFFFFFFFFFh, 0FFFFFFFFFFFFFFFFh, 0FFFFFFFF7CCA23E9h, 0C44EDB49AED63690h, 0216CC2728DC58F55h, 02378C292AB5844F3h	; 2^446 - 13818066809895115352007386748515426880336692474882178609894547503885
+
+ui512_ed448_data ENDS
+
+;--------------------------------------------------------------------------------------------------------------------------------------------------------------
+;			Field operations on locals, address of prime_448 in RBX; each frame has prod and ovf for the double width product
+;			Note: RAX, RCX, RDX, R8 thru R11 are used and not restored
+;
+Ed_Mul			MACRO			dest:REQ, a:REQ, b:REQ
+				LEA				RCX, l_Ptr.prod
+				LEA				RDX, l_Ptr.ovf
+				LEA				R8, a
+				LEA				R9, b
+				CALL			mult_u
+				LEA				RCX, dest
+				LEA				RDX, l_Ptr.prod
+				LEA				R8, l_Ptr.ovf
+				CALL			reduce_448_u
+				ENDM
+
+Ed_Sqr			MACRO			dest:REQ, a:REQ
+				Ed_Mul			dest, a, a
+				ENDM
+
+;			dest = 39081 dest; the product is below 2^464, its overflow QWORD (zero) goes to the low word of ovf
+Ed_Mul39081		MACRO			dest:REQ
+				LEA				RCX, l_Ptr.ovf
+				Zero512Q		RCX
+				LEA				RCX, l_Ptr.prod
+				LEA				RDX, l_Ptr.ovf [ 7 * 8 ]
+				LEA				R8, dest
+				MOV				R9D, 39081
+				CALL			mult_uT64
+				LEA				RCX, dest
+				LEA				RDX, l_Ptr.prod
+				LEA				R8, l_Ptr.ovf
+				CALL			reduce_448_u
+				ENDM
+
+Ed_Copy			MACRO			dest:REQ, src:REQ
+				LEA				RCX, dest
+				LEA				RDX, src
+				Copy512			RCX, RDX
+				ENDM
+
+Ed_Add			MACRO			dest:REQ, src:REQ
+				LEA				RCX, dest
+				LEA				RDX, src
+				AddModMem512	RCX, RDX, RBX
+				ENDM
+
+Ed_Sub			MACRO			dest:REQ, src:REQ
+				LEA				RCX, dest
+				LEA				RDX, src
+				SubModMem512	RCX, RDX, RBX
+				ENDM
+
+Ed_Dbl			MACRO			dest:REQ
+				LEA				RCX, dest
+				AddModMem512	RCX, RCX, RBX
+				ENDM
+
+;			Copy an extended point (four ui512 coordinates) from address in src to address in dest; R10, R11, RAX used
+Copy_EdPoint	MACRO			dest:REQ, src:REQ
+				FOR				off, < 0, 64, 128, 192 >
+				LEA				R10, [ dest + off ]
+				LEA				R11, [ src + off ]
+				Copy512			R10, R11
+				ENDM
+				ENDM
+
+;			Set point at address in dest to the neutral point ( 0, 1, 1, 0 ); R10, RAX used
+Neutral_EdPoint	MACRO			dest:REQ
+				FOR				off, < 0, 64, 128, 192 >
+				LEA				R10, [ dest + off ]
+				Zero512Q		R10
+				ENDM
+				MOV				Q_PTR [ dest ] [ ed448_point.y + 7 * 8 ], 1
+				MOV				Q_PTR [ dest ] [ ed448_point.z + 7 * 8 ], 1
+				ENDM
+
+ui512_ed448		SEGMENT			PARA 'CODE'
+
+;--------------------------------------------------------------------------------------------------------------------------------------------------------------
+;			EXTERNDEF		ed448_from_affine_u:PROC	; s16 ed448_from_affine_u( ed448_point* P, u64* x, u64* y );
+;			ed448_from_affine_u	-	extended point ( x, y, 1, x y ) from affine coordinates
+;			Prototype:		-	s16 ed448_from_affine_u( ed448_point* P, u64* x, u64* y );
+;			P				-	Address of 32 QWORDS (ed448_point) to receive the point (in RCX), may be the same as x
+;			x				-	Address of 8 QWORDS, x (in RDX)
+;			y				-	Address of 8 QWORDS, y (in R8)
+;			returns			-	(0) for success, (-1) if x or y is not below p, (GP_Fault) for mis-aligned parameter address
+;
+;			Note: the point is not checked to be on the curve, see ed448_on_curve_u
+;
+eaff_Locals		STRUCT
+x				QWORD			8 dup (?)
+y				QWORD			8 dup (?)
+t				QWORD			8 dup (?)
+prod			QWORD			8 dup (?)
+ovf				QWORD			8 dup (?)
+eaff_Locals		ENDS
+
+				Proc_w_Local	ed448_from_affine_u, eaff_Locals, RBX
+
+				CheckAlign		RCX, @@exit							; (out) P
+				CheckAlign		RDX, @@exit							; (in) x
+				CheckAlign		R8, @@exit							; (in) y
+				LEA				RBX, prime_448
+				LEA				RCX, l_Ptr.x
+				Copy512			RCX, RDX
+				LEA				RCX, l_Ptr.y
+				Copy512			RCX, R8
+				LEA				RCX, l_Ptr.x
+				MOV				RDX, RBX
+				CALL			compare_u
+				CMP				AX, 0
+				JGE				@@err
+				LEA				RCX, l_Ptr.y
+				MOV				RDX, RBX
+				CALL			compare_u
+				CMP				AX, 0
+				JGE				@@err
+				Ed_Mul			l_Ptr.t, l_Ptr.x, l_Ptr.y
+				MOV				R9, RCXHome
+				LEA				RCX, ed448_point.x [ R9 ]
+				LEA				RDX, l_Ptr.x
+				Copy512			RCX, RDX
+				LEA				RCX, ed448_point.y [ R9 ]
+				LEA				RDX, l_Ptr.y
+				Copy512			RCX, RDX
+				LEA				RCX, ed448_point.t [ R9 ]
+				LEA				RDX, l_Ptr.t
+				Copy512			RCX, RDX
+				LEA				RCX, ed448_point.z [ R9 ]
+				Zero512Q		RCX
+				MOV				Q_PTR [ RCX ] [ 7 * 8 ], 1
+				XOR				EAX, EAX							; return zero
+				JMP				@@exit
+
+@@err:			MOV				EAX, retcode_neg_one
+@@exit:			Local_Exit		RBX
+ed448_from_affine_u ENDP
+
+;--------------------------------------------------------------------------------------------------------------------------------------------------------------
+;			EXTERNDEF		ed448_to_affine_u:PROC		; s16 ed448_to_affine_u( u64* x, u64* y, ed448_point* P );
+;			ed448_to_affine_u	-	affine coordinates x = X / Z, y = Y / Z of an extended point
+;			Prototype:		-	s16 ed448_to_affine_u( u64* x, u64* y, ed448_point* P );
+;			x				-	Address of 8 QWORDS to receive x (in RCX)
+;			y				-	Address of 8 QWORDS to receive y (in RDX)
+;			P				-	Address of point (in R8)
+;			returns			-	(0) for success, (-1) if Z is zero (not a point), (GP_Fault) for mis-aligned parameter address
+;
+;			Note: one inversion (invmod_u) of Z, then two multiplies
+;
+etoaff_Locals	STRUCT
+x				QWORD			8 dup (?)
+y				QWORD			8 dup (?)
+zi				QWORD			8 dup (?)
+prod			QWORD			8 dup (?)
+ovf				QWORD			8 dup (?)
+etoaff_Locals	ENDS
+
+				Proc_w_Local	ed448_to_affine_u, etoaff_Locals, RBX, RSI
+
+				CheckAlign		RCX, @@exit							; (out) x
+				CheckAlign		RDX, @@exit							; (out) y
+				CheckAlign		R8, @@exit							; (in) P
+				MOV				RDXHome, RDX
+				LEA				RBX, prime_448
+				MOV				RSI, R8
+
+				LEA				RCX, l_Ptr.zi
+				LEA				RDX, ed448_point.z [ RSI ]
+				MOV				R8, RBX
+				CALL			invmod_u
+				TEST			EAX, EAX
+				JNZ				@@err
+				Ed_Mul			l_Ptr.x, < ed448_point.x [ RSI ] >, l_Ptr.zi
+				Ed_Mul			l_Ptr.y, < ed448_point.y [ RSI ] >, l_Ptr.zi
+				MOV				RCX, RCXHome
+				LEA				RDX, l_Ptr.x
+				Copy512			RCX, RDX
+				MOV				RCX, RDXHome
+				LEA				RDX, l_Ptr.y
+				Copy512			RCX, RDX
+				XOR				EAX, EAX							; return zero
+				JMP				@@exit
+
+@@err:			MOV				EAX, retcode_neg_one
+@@exit:			Local_Exit		RSI, RBX
+ed448_to_affine_u ENDP
+
+;--------------------------------------------------------------------------------------------------------------------------------------------------------------
+;			EXTERNDEF		ed448_on_curve_u:PROC		; s16 ed448_on_curve_u( ed448_point* P );
+;			ed448_on_curve_u	-	test that an extended point is on the curve
+;			Prototype:		-	s16 ed448_on_curve_u( ed448_point* P );
+;			P				-	Address of point (in RCX)
+;			returns			-	(0) if on the curve, (-1) if not, (GP_Fault) for mis-aligned parameter address
+;
+;			Note: Z not zero, ( X^2 + Y^2 ) Z^2 = Z^4 + d X^2 Y^2 ( d = -39081: ( X^2 + Y^2 ) Z^2 + 39081 X^2 Y^2 = Z^4 ), and X Y = T Z
+;
+eonc_Locals		STRUCT
+x2				QWORD			8 dup (?)
+y2				QWORD			8 dup (?)
+z2				QWORD			8 dup (?)
+lhs				QWORD			8 dup (?)
+rhs				QWORD			8 dup (?)
+prod			QWORD			8 dup (?)
+ovf				QWORD			8 dup (?)
+eonc_Locals		ENDS
+
+				Proc_w_Local	ed448_on_curve_u, eonc_Locals, RBX, RSI
+
+				CheckAlign		RCX, @@exit							; (in) P
+				LEA				RBX, prime_448
+				MOV				RSI, RCX
+
+				LEA				RCX, ed448_point.z [ RSI ]
+				TestZero512		RCX
+				JZ				@@err
+				Ed_Sqr			l_Ptr.x2, < ed448_point.x [ RSI ] >
+				Ed_Sqr			l_Ptr.y2, < ed448_point.y [ RSI ] >
+				Ed_Sqr			l_Ptr.z2, < ed448_point.z [ RSI ] >
+				Ed_Copy			l_Ptr.lhs, l_Ptr.x2					; lhs = ( X^2 + Y^2 ) Z^2 + 39081 X^2 Y^2
+				Ed_Add			l_Ptr.lhs, l_Ptr.y2
+				Ed_Mul			l_Ptr.lhs, l_Ptr.lhs, l_Ptr.z2
+				Ed_Mul			l_Ptr.x2, l_Ptr.x2, l_Ptr.y2
+				Ed_Mul39081		l_Ptr.x2
+				Ed_Add			l_Ptr.lhs, l_Ptr.x2
+				Ed_Sqr			l_Ptr.rhs, l_Ptr.z2					; rhs = Z^4
+				LEA				RCX, l_Ptr.lhs
+				LEA				RDX, l_Ptr.rhs
+				TestEqual512	RCX, RDX
+				JNE				@@err
+				Ed_Mul			l_Ptr.lhs, < ed448_point.x [ RSI ] >, < ed448_point.y [ RSI ] >	; X Y = T Z
+				Ed_Mul			l_Ptr.rhs, < ed448_point.t [ RSI ] >, < ed448_point.z [ RSI ] >
+				LEA				RCX, l_Ptr.lhs
+				LEA				RDX, l_Ptr.rhs
+				TestEqual512	RCX, RDX
+				JNE				@@err
+				XOR				EAX, EAX							; return zero
+				JMP				@@exit
+
+@@err:			MOV				EAX, retcode_neg_one
+@@exit:			Local_Exit		RSI, RBX
+ed448_on_curve_u ENDP
+
+;--------------------------------------------------------------------------------------------------------------------------------------------------------------
+;			EXTERNDEF		ed448_double_u:PROC			; s16 ed448_double_u( ed448_point* R, ed448_point* P );
+;			ed448_double_u	-	point doubling, R = 2P
+;			Prototype:		-	s16 ed448_double_u( ed448_point* R, ed448_point* P );
+;			R				-	Address of 32 QWORDS (ed448_point) to receive the result (in RCX), may be the same as P
+;			P				-	Address of point (in RDX)
+;			returns			-	(0) for success, (GP_Fault) for mis-aligned parameter address
+;
+;			Note: A = X1^2, B = Y1^2, C = 2 Z1^2, E = ( X1 + Y1 )^2 - A - B, G = A + B, F = G - C, H = A - B,
+;			X3 = E F, Y3 = G H, T3 = E H, Z3 = F G. T1 is not used.
+;
+edbl_Locals		STRUCT
+x1				QWORD			8 dup (?)
+y1				QWORD			8 dup (?)
+z1				QWORD			8 dup (?)
+t1				QWORD			8 dup (?)
+x3				QWORD			8 dup (?)
+y3				QWORD			8 dup (?)
+z3				QWORD			8 dup (?)
+t3				QWORD			8 dup (?)
+ta				QWORD			8 dup (?)
+tb				QWORD			8 dup (?)
+tc				QWORD			8 dup (?)
+te				QWORD			8 dup (?)
+tf				QWORD			8 dup (?)
+tg				QWORD			8 dup (?)
+prod			QWORD			8 dup (?)
+ovf				QWORD			8 dup (?)
+edbl_Locals		ENDS
+
+				Proc_w_Local	ed448_double_u, edbl_Locals, RBX, RSI
+
+				CheckAlign		RCX, @@exit							; (out) R
+				CheckAlign		RDX, @@exit							; (in) P
+				LEA				RBX, prime_448
+				LEA				RSI, l_Ptr.x1
+				Copy_EdPoint	RSI, RDX
+
+				Ed_Sqr			l_Ptr.ta, l_Ptr.x1					; ta = A
+				Ed_Sqr			l_Ptr.tb, l_Ptr.y1					; tb = B
+				Ed_Sqr			l_Ptr.tc, l_Ptr.z1					; tc = C
+				Ed_Dbl			l_Ptr.tc
+				Ed_Copy			l_Ptr.te, l_Ptr.x1					; te = E
+				Ed_Add			l_Ptr.te, l_Ptr.y1
+				Ed_Sqr			l_Ptr.te, l_Ptr.te
+				Ed_Sub			l_Ptr.te, l_Ptr.ta
+				Ed_Sub			l_Ptr.te, l_Ptr.tb
+				Ed_Copy			l_Ptr.tg, l_Ptr.ta					; tg = G
+				Ed_Add			l_Ptr.tg, l_Ptr.tb
+				Ed_Copy			l_Ptr.tf, l_Ptr.tg					; tf = F
+				Ed_Sub			l_Ptr.tf, l_Ptr.tc
+				Ed_Sub			l_Ptr.ta, l_Ptr.tb					; ta = H
+				Ed_Mul			l_Ptr.x3, l_Ptr.te, l_Ptr.tf
+				Ed_Mul			l_Ptr.y3, l_Ptr.tg, l_Ptr.ta
+				Ed_Mul			l_Ptr.z3, l_Ptr.tf, l_Ptr.tg
+				Ed_Mul			l_Ptr.t3, l_Ptr.te, l_Ptr.ta
+
+				MOV				RCX, RCXHome
+				LEA				RDX, l_Ptr.x3
+				Copy_EdPoint	RCX, RDX
+				XOR				EAX, EAX							; return zero
+@@exit:			Local_Exit		RSI, RBX
+ed448_double_u	ENDP
+
+;--------------------------------------------------------------------------------------------------------------------------------------------------------------
+;			EXTERNDEF		ed448_add_u:PROC			; s16 ed448_add_u( ed448_point* R, ed448_point* P, ed448_point* Q );
+;			ed448_add_u		-	point addition, R = P + Q
+;			Prototype:		-	s16 ed448_add_u( ed448_point* R, ed448_point* P, ed448_point* Q );
+;			R				-	Address of 32 QWORDS (ed448_point) to receive the result (in RCX), may be the same as P or Q
+;			P				-	Address of point (in RDX)
+;			Q				-	Address of point (in R8), may be the same as P
+;			returns			-	(0) for success, (GP_Fault) for mis-aligned parameter address
+;
+;			Note: A = X1 X2, B = Y1 Y2, c = 39081 T1 T2 ( so d T1 T2 = -c ), D = Z1 Z2, E = ( X1 + Y1 )( X2 + Y2 ) - A - B,
+;			F = D + c, G = D - c, H = B - A, X3 = E F, Y3 = G H, T3 = E H, Z3 = F G.
+;
+eadd_Locals		STRUCT
+x1				QWORD			8 dup (?)
+y1				QWORD			8 dup (?)
+z1				QWORD			8 dup (?)
+t1				QWORD			8 dup (?)
+x2				QWORD			8 dup (?)
+y2				QWORD			8 dup (?)
+z2				QWORD			8 dup (?)
+t2				QWORD			8 dup (?)
+x3				QWORD			8 dup (?)
+y3				QWORD			8 dup (?)
+z3				QWORD			8 dup (?)
+t3				QWORD			8 dup (?)
+ta				QWORD			8 dup (?)
+tb				QWORD			8 dup (?)
+tc				QWORD			8 dup (?)
+td				QWORD			8 dup (?)
+te				QWORD			8 dup (?)
+tf				QWORD			8 dup (?)
+prod			QWORD			8 dup (?)
+ovf				QWORD			8 dup (?)
+eadd_Locals		ENDS
+
+				Proc_w_Local	ed448_add_u, eadd_Locals, RBX, RSI
+
+				CheckAlign		RCX, @@exit							; (out) R
+				CheckAlign		RDX, @@exit							; (in) P
+				CheckAlign		R8, @@exit							; (in) Q
+				LEA				RBX, prime_448
+				LEA				RSI, l_Ptr.x1
+				Copy_EdPoint	RSI, RDX
+				LEA				RSI, l_Ptr.x2
+				Copy_EdPoint	RSI, R8
+
+				Ed_Mul			l_Ptr.ta, l_Ptr.x1, l_Ptr.x2		; ta = A
+				Ed_Mul			l_Ptr.tb, l_Ptr.y1, l_Ptr.y2		; tb = B
+				Ed_Mul			l_Ptr.tc, l_Ptr.t1, l_Ptr.t2		; tc = c
+				Ed_Mul39081		l_Ptr.tc
+				Ed_Mul			l_Ptr.td, l_Ptr.z1, l_Ptr.z2		; td = D
+				Ed_Copy			l_Ptr.te, l_Ptr.x1					; te = E
+				Ed_Add			l_Ptr.te, l_Ptr.y1
+				Ed_Copy			l_Ptr.tf, l_Ptr.x2
+				Ed_Add			l_Ptr.tf, l_Ptr.y2
+				Ed_Mul			l_Ptr.te, l_Ptr.te, l_Ptr.tf
+				Ed_Sub			l_Ptr.te, l_Ptr.ta
+				Ed_Sub			l_Ptr.te, l_Ptr.tb
+				Ed_Copy			l_Ptr.tf, l_Ptr.td					; tf = F
+				Ed_Add			l_Ptr.tf, l_Ptr.tc
+				Ed_Sub			l_Ptr.td, l_Ptr.tc					; td = G
+				Ed_Sub			l_Ptr.tb, l_Ptr.ta					; tb = H
+				Ed_Mul			l_Ptr.x3, l_Ptr.te, l_Ptr.tf
+				Ed_Mul			l_Ptr.y3, l_Ptr.td, l_Ptr.tb
+				Ed_Mul			l_Ptr.z3, l_Ptr.tf, l_Ptr.td
+				Ed_Mul			l_Ptr.t3, l_Ptr.te, l_Ptr.tb
+
+				MOV				RCX, RCXHome
+				LEA				RDX, l_Ptr.x3
+				Copy_EdPoint	RCX, RDX
+				XOR				EAX, EAX							; return zero
+@@exit:			Local_Exit		RSI, RBX
+ed448_add_u		ENDP
+
+;--------------------------------------------------------------------------------------------------------------------------------------------------------------
+;			EXTERNDEF		ed448_scalar_mul_u:PROC		; s16 ed448_scalar_mul_u( ed448_point* R, u64* k, ed448_point* P );
+;			ed448_scalar_mul_u	-	scalar multiplication, R = k P
+;			Prototype:		-	s16 ed448_scalar_mul_u( ed448_point* R, u64* k, ed448_point* P );
+;			R				-	Address of 32 QWORDS (ed448_point) to receive the result (in RCX), may be the same as P
+;			k				-	Address of 8 QWORDS, scalar, any 512 bit value (in RDX), may be the same as R
+;			P				-	Address of point (in R8)
+;			returns			-	(0) for success, (GP_Fault) for mis-aligned parameter address
+;
+;			Note: fixed window of three bits, table of 0 P thru 7 P. All 171 windows (bit 512 and up read as zero) are processed
+;			the same way: three doubles, then one add of the table entry, selected by a masked scan of all eight entries.
+;			513 doubles and 171 adds. Not constant time, not for secret scalars: a zero digit adds the neutral point ( 0, 1, 1, 0 ),
+;			and the field layer branches on the data ( mult_u trims and skips zero QWORDS, and so takes its early exits for zero
+;			and one; AddModMem512 and SubModMem512 subtract p or not ), so the run time depends on k and on P.
+;
+esm_Locals		STRUCT
+tbl				ed448_point		8 dup (<>)							; tbl [ i ] = i P
+acc				ed448_point		<>
+sel				ed448_point		<>
+k				QWORD			8 dup (?)
+win				QWORD			?									; window, 170 down to 0
+pad				QWORD			7 dup (?)
+esm_Locals		ENDS
+
+				Proc_w_Local	ed448_scalar_mul_u, esm_Locals, RBX, RSI, RDI
+
+				CheckAlign		RCX, @@exit							; (out) R
+				CheckAlign		RDX, @@exit							; (in) k
+				CheckAlign		R8, @@exit							; (in) P
+				LEA				RCX, l_Ptr.k
+				Copy512			RCX, RDX
+				LEA				RCX, l_Ptr.tbl						; 0 P, P
+				Neutral_EdPoint	RCX
+				LEA				RCX, l_Ptr.tbl + 1 * SIZEOF ed448_point
+				Copy_EdPoint	RCX, R8
+				LEA				RCX, l_Ptr.tbl + 2 * SIZEOF ed448_point	; 2 P
+				LEA				RDX, l_Ptr.tbl + 1 * SIZEOF ed448_point
+				CALL			ed448_double_u
+				MOV				EBX, 3								; 3 P thru 7 P
+@@table:		MOV				RAX, RBX
+				SHL				RAX, 8								; SIZEOF ed448_point = 256
+				LEA				RCX, l_Ptr.tbl
+				ADD				RCX, RAX
+				LEA				RDX, [ RCX - SIZEOF ed448_point ]
+				LEA				R8, l_Ptr.tbl + 1 * SIZEOF ed448_point
+				CALL			ed448_add_u
+				INC				EBX
+				CMP				EBX, 8
+				JB				@@table
+
+				LEA				RCX, l_Ptr.acc
+				Neutral_EdPoint	RCX
+				MOV				l_Ptr.win, 170
+
+@@window:		MOV				EDI, 3								; three doubles
+@@dbl:			LEA				RCX, l_Ptr.acc
+				MOV				RDX, RCX
+				CALL			ed448_double_u
+				DEC				EDI
+				JNZ				@@dbl
+
+				MOV				RAX, l_Ptr.win						; digit (in RSI): bits 3 w + 2 thru 3 w of k
+				LEA				R10, [ RAX + RAX * 2 + 2 ]
+				XOR				ESI, ESI
+				MOV				R11D, 3
+@@bits:			SHL				RSI, 1
+				CMP				R10, 512							; window position only, not k
+				JAE				@F
+				MOV				RAX, R10
+				SHR				RAX, 6
+				NEG				RAX
+				LEA				RDX, l_Ptr.k
+				MOV				RDX, Q_PTR [ RDX + RAX * 8 + 7 * 8 ]
+				MOV				RCX, R10
+				SHR				RDX, CL
+				AND				EDX, 1
+				OR				RSI, RDX
+@@:				DEC				R10
+				DEC				R11D
+				JNZ				@@bits
+
+				LEA				RCX, l_Ptr.sel						; sel = tbl [ digit ], every entry read
+				Neutral_EdPoint	RCX
+				LEA				R10, l_Ptr.sel
+				LEA				R11, l_Ptr.tbl
+				XOR				EBX, EBX							; entry
+@@entry:		MOV				R8, RBX								; mask: all ones when entry = digit
+				XOR				R8, RSI
+				SUB				R8, 1
+				SBB				R8, R8
+				XOR				ECX, ECX
+@@qword:		MOV				RAX, Q_PTR [ R11 + RCX * 8 ]
+				XOR				RAX, Q_PTR [ R10 + RCX * 8 ]
+				AND				RAX, R8
+				XOR				Q_PTR [ R10 + RCX * 8 ], RAX
+				INC				ECX
+				CMP				ECX, SIZEOF ed448_point / 8
+				JB				@@qword
+				ADD				R11, SIZEOF ed448_point
+				INC				EBX
+				CMP				EBX, 8
+				JB				@@entry
+
+				LEA				RCX, l_Ptr.acc
+				MOV				RDX, RCX
+				LEA				R8, l_Ptr.sel
+				CALL			ed448_add_u
+				DEC				l_Ptr.win
+				JNS				@@window
+
+				MOV				RCX, RCXHome
+				LEA				RDX, l_Ptr.acc
+				Copy_EdPoint	RCX, RDX
+				XOR				EAX, EAX							; return zero
+@@exit:			Local_Exit		RDI, RSI, RBX
+ed448_scalar_mul_u ENDP
+
+ui512_ed448		ENDS
+				END													; end of module
@@ -0,0 +1,1078 @@
+;
+;			ui512_modular
+;
+;--------------------------------------------------------------------------------------------------------------------------------------------------------------
+;
+;			File:			ui512_modular.asm
+;			Author:			John G. Lynch
+;			Legal:			Copyright @2025, per MIT License below
+;			Date:			October 19, 2026
+;
+;			Modular arithmetic for an odd modulus of any size up to 512 bits:
+;				Montgomery context set up and Montgomery multiply (CIOS, over only the significant words of the modulus)
+;				modular inverse (binary extended Euclid)
+;				batch modular inverse (Montgomery's trick: one inversion and 3 (n - 1) Montgomery multiplies for n values)
+;				modular exponentiation (binary, in Montgomery form)
+;				modular square root (p = 3 mod 4 and p = 5 mod 8 with a single exponentiation, otherwise Tonelli-Shanks)
+;				Jacobi symbol (binary, no division)
+;				Chinese remainder reconstruction from residues mod up to 16 word size moduli (Garner, coefficients precomputed)
+
+				INCLUDE			ui512_legalnotes.inc
+				INCLUDE			ui512_compile_time_options.inc
+				INCLUDE			ui512_macros.inc
+				INCLUDE			ui512_externs.inc
+.NOLISTIF
+				OPTION			CASEMAP:NONE
+ui512_modular	SEGMENT			PARA 'CODE'
+
+;--------------------------------------------------------------------------------------------------------------------------------------------------------------
+;			EXTERNDEF		mont_init_u:PROC			; s16 mont_init_u( u64* ctx, u64* modulus );
+;			mont_init_u		-	set up a Montgomery context for an odd modulus
+;			Prototype:		-	s16 mont_init_u( u64* ctx, u64* modulus );
+;			ctx				-	Address of 32 QWORDS (mont_ctx) to receive the context (in RCX)
+;			modulus			-	Address of 8 QWORDS, odd modulus greater than one (in RDX)
+;			returns			-	(0) for success, (-1) if modulus is even or one, (GP_Fault) for mis-aligned parameter address
+;
+;			Note: with n the number of significant QWORDS of the modulus, R = 2^(64 * n). Context holds the modulus,
+;			R^2 mod m (to convert into Montgomery form), R mod m (one, in Montgomery form), -m^-1 mod 2^64, and the start index of the words
+;
+				Leaf_Entry		mont_init_u
+				CheckAlign		RCX									; (out) Context
+				CheckAlign		RDX									; (in) Modulus
+
+				TEST			B_PTR [ RDX ] [ 7 * 8 ], 1			; modulus must be odd
+				JZ				@@err
+				XOR				R8, R8								; find index of most significant non-zero word (the lowest index)
+@@:				CMP				Q_PTR [ RDX ] [ R8 * 8 ], 0
+				JNE				@F
+				INC				R8									; odd, so least significant word is non-zero, loop ends by index 7
+				JMP				@B
+@@:				CMP				R8, 7								; modulus of one?
+				JNE				@F
+				CMP				Q_PTR [ RDX ] [ 7 * 8 ], 1
+				JE				@@err
+@@:				MOV				mont_ctx.klo [ RCX ], R8
+
+; copy modulus to context
+				LEA				R9, mont_ctx.m [ RCX ]
+				Copy512			R9, RDX
+
+; -m^-1 mod 2^64: Newton iteration x = x * ( 2 - m * x ), starting from m (correct to 3 bits for any odd m), doubles correct bits each time
+				MOV				R10, Q_PTR [ RDX ] [ 7 * 8 ]
+				MOV				RAX, R10
+				REPEAT			5
+				MOV				R11, R10
+				IMUL			R11, RAX
+				NEG				R11
+				ADD				R11, 2
+				IMUL			RAX, R11
+				ENDM
+				NEG				RAX
+				MOV				mont_ctx.minv [ RCX ], RAX
+
+; R mod m, then R^2 mod m, by doubling (mod m) one, 64 * n times, then 64 * n times more
+				LEA				R10, mont_ctx.one [ RCX ]
+				Zero512Q		R10
+				MOV				Q_PTR [ R10 ] [ 7 * 8 ], 1
+				MOV				RDX, 8
+				SUB				RDX, R8
+				SHL				RDX, 6								; 64 * n
+				MOV				R11, RDX
+@@dbl1:			AddModMem512	R10, R10, R9
+				DEC				R11
+				JNZ				@@dbl1
+
+				LEA				R8, mont_ctx.r2 [ RCX ]
+				Copy512			R8, R10
+				MOV				R11, RDX
+@@dbl2:			AddModMem512	R8, R8, R9
+				DEC				R11
+				JNZ				@@dbl2
+
+				XOR				EAX, EAX							; return zero
+				RET
+
+@@err:			MOV				EAX, retcode_neg_one
+				RET
+mont_init_u		ENDP
+
+;--------------------------------------------------------------------------------------------------------------------------------------------------------------
+;			EXTERNDEF		mont_mul_u:PROC				; s16 mont_mul_u( u64* result, u64* a, u64* b, u64* ctx );
+;			mont_mul_u		-	Montgomery multiply, result = a * b * R^-1 mod m
+;			Prototype:		-	s16 mont_mul_u( u64* result, u64* a, u64* b, u64* ctx );
+;			result			-	Address of 8 QWORDS to store the result (in RCX), may be the same as a or b
+;			a				-	Address of 8 QWORDS multiplicand, less than m (in RDX)
+;			b				-	Address of 8 QWORDS multiplier, less than m (in R8)
+;			ctx				-	Address of Montgomery context from mont_init_u (in R9)
+;			returns			-	(0) for success, (GP_Fault) for mis-aligned parameter address
+;
+;			Note: CIOS method (Koc, Acar, Kaliski, "Analyzing and Comparing Montgomery Multiplication Algorithms", 1996),
+;			looping over only the n significant words of the modulus. Word j (least significant is 0) of a ui512 is at index 7 - j,
+;			so with "k" = 7 - j, word j of each operand is at [ base + k * 8 ], the n + 2 word working sum is laid out the same way.
+;
+mont_Locals		STRUCT
+t				QWORD			16 dup (?)
+mont_Locals		ENDS
+
+				Proc_w_Local	mont_mul_u, mont_Locals, R12, R13, R14, R15, RSI, RDI, RBX
+
+				CheckAlign		RCX, @@exit							; (out) Result
+				CheckAlign		RDX, @@exit							; (in) a
+				CheckAlign		R8, @@exit							; (in) b
+				CheckAlign		R9, @@exit							; (in) Context
+
+				MOV				RSI, RDX							; a
+				MOV				R12, R8								; b
+				LEA				RBX, mont_ctx.m [ R9 ]				; m
+				MOV				R15, mont_ctx.minv [ R9 ]			; -m^-1 mod 2^64
+				MOV				R13, mont_ctx.klo [ R9 ]			; index of most significant word of m (8 - n)
+				LEA				RDI, l_Ptr.t [ 2 * 8 ]				; t, word j at [ RDI + ( 7 - j ) * 8 ], j = 0 thru n + 1
+				XOR				EAX, EAX
+				FOR				idx, < -2, -1, 0, 1, 2, 3, 4, 5, 6, 7 >
+				MOV				Q_PTR [ RDI ] [ idx * 8 ], RAX
+				ENDM
+
+				MOV				R14, 7								; outer loop, for each word of b, least significant first
+@@outer:		MOV				R10, Q_PTR [ R12 ] [ R14 * 8 ]		; b [ i ]
+				XOR				R9, R9								; C = 0
+				MOV				R8, 7
+@@mul:			MOV				RAX, Q_PTR [ RSI ] [ R8 * 8 ]		; ( C, t [ j ] ) = t [ j ] + a [ j ] * b [ i ] + C
+				MUL				R10
+				ADD				RAX, R9
+				ADC				RDX, 0
+				ADD				Q_PTR [ RDI ] [ R8 * 8 ], RAX
+				ADC				RDX, 0
+				MOV				R9, RDX
+				DEC				R8
+				CMP				R8, R13
+				JGE				@@mul
+				ADD				Q_PTR [ RDI ] [ R8 * 8 ], R9		; ( C, t [ n ] ) = t [ n ] + C
+				MOV				R9D, 0
+				ADC				R9, 0
+				MOV				Q_PTR [ RDI ] [ R8 * 8 - 8 ], R9	; t [ n + 1 ] = C
+
+				MOV				R10, Q_PTR [ RDI ] [ 7 * 8 ]		; q = t [ 0 ] * ( -m^-1 ) mod 2^64
+				IMUL			R10, R15
+				MOV				RAX, Q_PTR [ RBX ] [ 7 * 8 ]		; t [ 0 ] + q * m [ 0 ], low word is zero, keep carry
+				MUL				R10
+				ADD				RAX, Q_PTR [ RDI ] [ 7 * 8 ]
+				ADC				RDX, 0
+				MOV				R9, RDX
+				MOV				R8, 6
+@@red:			CMP				R8, R13
+				JL				@@reddone
+				MOV				RAX, Q_PTR [ RBX ] [ R8 * 8 ]		; ( C, t [ j - 1 ] ) = t [ j ] + q * m [ j ] + C
+				MUL				R10
+				ADD				RAX, R9
+				ADC				RDX, 0
+				ADD				RAX, Q_PTR [ RDI ] [ R8 * 8 ]
+				ADC				RDX, 0
+				MOV				Q_PTR [ RDI ] [ R8 * 8 + 8 ], RAX
+				MOV				R9, RDX
+				DEC				R8
+				JMP				@@red
+@@reddone:		MOV				RAX, Q_PTR [ RDI ] [ R8 * 8 ]		; ( C, t [ n - 1 ] ) = t [ n ] + C
+				ADD				RAX, R9
+				MOV				Q_PTR [ RDI ] [ R8 * 8 + 8 ], RAX
+				MOV				RAX, Q_PTR [ RDI ] [ R8 * 8 - 8 ]	; t [ n ] = t [ n + 1 ] + C
+				ADC				RAX, 0
+				MOV				Q_PTR [ RDI ] [ R8 * 8 ], RAX
+
+				DEC				R14
+				CMP				R14, R13
+				JGE				@@outer
+
+; t (n + 1 words) is less than 2m; result = t - m, unless that borrows, then t
+				MOV				RCX, RCXHome						; callers result
+				MOV				R11, 8
+				SUB				R11, R13							; n, word count
+				MOV				R8, 7
+				CLC
+@@final:		MOV				RAX, Q_PTR [ RDI ] [ R8 * 8 ]
+				SBB				RAX, Q_PTR [ RBX ] [ R8 * 8 ]
+				MOV				Q_PTR [ RCX ] [ R8 * 8 ], RAX
+				DEC				R8
+				DEC				R11									; DEC leaves carry flag alone
+				JNZ				@@final
+				MOV				RAX, Q_PTR [ RDI ] [ R8 * 8 ]		; t [ n ] less borrow
+				SBB				RAX, 0
+				JNC				@@zerotop
+				MOV				R8, 7								; borrowed: t less than m, result is t
+				MOV				R11, 8
+				SUB				R11, R13
+@@copyt:		MOV				RAX, Q_PTR [ RDI ] [ R8 * 8 ]
+				MOV				Q_PTR [ RCX ] [ R8 * 8 ], RAX
+				DEC				R8
+				DEC				R11
+				JNZ				@@copyt
+@@zerotop:		XOR				EAX, EAX							; zero leading words of result
+				JMP				@@ztest
+@@zero:			MOV				Q_PTR [ RCX ] [ R8 * 8 ], RAX
+				DEC				R8
+@@ztest:		TEST			R8, R8
+				JNS				@@zero
+				XOR				EAX, EAX							; return zero
+@@exit:			Local_Exit		RBX, RDI, RSI, R15, R14, R13, R12
+mont_mul_u		ENDP
+
+;--------------------------------------------------------------------------------------------------------------------------------------------------------------
+;			EXTERNDEF		invmod_u:PROC				; s16 invmod_u( u64* inverse, u64* a, u64* modulus );
+;			invmod_u		-	modular inverse, inverse = a^-1 mod m, for odd modulus
+;			Prototype:		-	s16 invmod_u( u64* inverse, u64* a, u64* modulus );
+;			inverse			-	Address of 8 QWORDS to store the inverse (in RCX)
+;			a				-	Address of 8 QWORDS value to invert (in RDX) (reduced mod m first if not less than m)
+;			modulus			-	Address of 8 QWORDS odd modulus, greater than one (in R8)
+;			returns			-	(0) for success, (-1) if no inverse exists (gcd (a, m) not one) or modulus is even or one, (GP_Fault) for mis-aligned parameter address
+;
+;			Note: binary extended Euclid (Menezes, van Oorschot, Vanstone, "Handbook of Applied Cryptography", 14.61 for an odd modulus).
+;			Invariants: x1 * a = u, x2 * a = v (mod m); halving x mod m is ( x + m ) / 2 when x is odd, keeping the carry out of 512 bits
+;
+inv_Locals		STRUCT
+u				QWORD			8 dup (?)
+v				QWORD			8 dup (?)
+x1				QWORD			8 dup (?)
+x2				QWORD			8 dup (?)
+m				QWORD			8 dup (?)
+q				QWORD			8 dup (?)
+inv_Locals		ENDS
+
+				Proc_w_Local	invmod_u, inv_Locals
+
+				CheckAlign		RCX, @@exit							; (out) Inverse
+				CheckAlign		RDX, @@exit							; (in) a
+				CheckAlign		R8, @@exit							; (in) Modulus
+				MOV				RDXHome, RDX
+				MOV				R8Home, R8
+
+				TEST			B_PTR [ R8 ] [ 7 * 8 ], 1			; modulus must be odd
+				JZ				@@notinv
+				MOV				RCX, R8
+				CALL			msb_u								; and greater than one
+				CMP				AX, 0
+				JLE				@@notinv
+
+; u = a mod m
+				MOV				RCX, RDXHome
+				MOV				RDX, R8Home
+				CALL			compare_u
+				CMP				AX, 0
+				JL				@@reduced
+				LEA				RCX, l_Ptr.q
+				LEA				RDX, l_Ptr.u
+				MOV				R8, RDXHome
+				MOV				R9, R8Home
+				CALL			div_u								; remainder to u
+				JMP				@@setup
+@@reduced:		LEA				RCX, l_Ptr.u
+				MOV				RDX, RDXHome
+				Copy512			RCX, RDX
+
+; v = m, x1 = 1, x2 = 0
+@@setup:		LEA				R8, l_Ptr.u
+				LEA				R9, l_Ptr.v
+				LEA				R10, l_Ptr.x1
+				LEA				R11, l_Ptr.x2
+				LEA				RDX, l_Ptr.m
+				MOV				RCX, R8Home
+				Copy512			RDX, RCX
+				Copy512			R9, RCX
+				Zero512Q		R10
+				MOV				Q_PTR [ R10 ] [ 7 * 8 ], 1
+				Zero512Q		R11
+				TestZero512		R8
+				JZ				@@notinv
+
+@@loop:			TestOne512		R8
+				JZ				@@u_one
+				TestOne512		R9
+				JZ				@@v_one
+
+@@u_even:		TEST			B_PTR [ R8 ] [ 7 * 8 ], 1			; while u even: u = u / 2, x1 = x1 / 2 mod m
+				JNZ				@@v_even
+				ShrMem512		R8
+				TEST			B_PTR [ R10 ] [ 7 * 8 ], 1			; (TEST clears carry flag)
+				JZ				@F
+				AddMem512		R10, RDX							; odd: ( x1 + m ), carry out in carry flag
+@@:				RcrMem512		R10
+				JMP				@@u_even
+
+@@v_even:		TEST			B_PTR [ R9 ] [ 7 * 8 ], 1			; while v even: v = v / 2, x2 = x2 / 2 mod m
+				JNZ				@@both_odd
+				ShrMem512		R9
+				TEST			B_PTR [ R11 ] [ 7 * 8 ], 1
+				JZ				@F
+				AddMem512		R11, RDX
+@@:				RcrMem512		R11
+				JMP				@@v_even
+
+@@both_odd:		SubMem512		R8, R9								; u >= v ? u = u - v, x1 = x1 - x2 mod m
+				JC				@@u_less
+				SubMem512		R10, R11
+				JNC				@F
+				AddMem512		R10, RDX
+@@:				TestZero512		R8									; u == v, gcd is not one
+				JZ				@@notinv
+				JMP				@@loop
+
+@@u_less:		AddMem512		R8, R9								; restore u, v = v - u, x2 = x2 - x1 mod m
+				SubMem512		R9, R8
+				SubMem512		R11, R10
+				JNC				@@loop
+				AddMem512		R11, RDX
+				JMP				@@loop
+
+@@u_one:		MOV				RCX, RCXHome
+				Copy512			RCX, R10
+				XOR				EAX, EAX							; return zero
+				JMP				@@exit
+
+@@v_one:		MOV				RCX, RCXHome
+				Copy512			RCX, R11
+				XOR				EAX, EAX							; return zero
+				JMP				@@exit
+
+@@notinv:		MOV				EAX, retcode_neg_one
+@@exit:			Local_Exit
+invmod_u		ENDP
+
+;--------------------------------------------------------------------------------------------------------------------------------------------------------------
+;			EXTERNDEF		invmod_u_batch:PROC			; s16 invmod_u_batch( u64* out, u64* in, u64 count, u64* modulus );
+;			invmod_u_batch	-	modular inverse of each of an array of values, out [ k ] = in [ k ]^-1 mod m, for odd modulus
+;			Prototype:		-	s16 invmod_u_batch( u64* out, u64* in, u64 count, u64* modulus );
+;			out				-	Address of count * 8 QWORDS to receive the inverses (in RCX); also used as prefix product scratch
+;			in				-	Address of count * 8 QWORDS, values to invert, each less than m (in RDX); must not overlap out
+;			count			-	number of values (in R8)
+;			modulus			-	Address of 8 QWORDS odd modulus, greater than one (in R9)
+;			returns			-	(0) for success, (-1) if any value has no inverse or modulus is even or one, (GP_Fault) for mis-aligned parameter address
+;
+;			Note: Montgomery's trick. Zero values are skipped, their "inverse" is returned as zero (as for points at infinity).
+;			Forward, the prefix products are left in out, in Montgomery multiply form ( c [ k ] = c [ k - 1 ] * a [ k ] * R^-1 );
+;			one inversion of the last, then backward, out [ k ] = u * c [ k - 1 ] * R^-1 and u = u * a [ k ] * R^-1.
+;			The powers of R cancel, no conversion in or out of Montgomery form. One inversion, 3 ( n - 1 ) multiplies.
+;
+batch_Locals	STRUCT
+ctx				mont_ctx		<>
+u				QWORD			8 dup (?)
+first			QWORD			?
+pad				QWORD			7 dup (?)
+batch_Locals	ENDS
+
+				Proc_w_Local	invmod_u_batch, batch_Locals, R12, R13, R14, R15, RSI, RDI
+
+				CheckAlign		RCX, @@exit							; (out) Out array
+				CheckAlign		RDX, @@exit							; (in) In array
+				CheckAlign		R9, @@exit							; (in) Modulus
+
+				MOV				RSI, RCX							; out
+				MOV				RDI, RDX							; in
+				MOV				R12, R8
+				SHL				R12, 6								; count * 64, byte offset past last value
+				MOV				R13, R9								; modulus
+
+				LEA				RCX, l_Ptr.ctx
+				MOV				RDX, R13
+				CALL			mont_init_u
+				TEST			EAX, EAX
+				JNZ				@@exit								; -1: modulus is even or one
+
+; forward: out [ k ] = prefix product of the non-zero values thru k; R15 is address of the latest (zero if none yet)
+				XOR				R15, R15
+				XOR				R14, R14							; byte offset of value k
+@@fwd:			CMP				R14, R12
+				JAE				@@fwddone
+				LEA				RDX, [ RDI + R14 ]
+				LEA				RCX, [ RSI + R14 ]
+				TestZero512		RDX
+				JNZ				@@fnonzero
+				TEST			R15, R15							; zero value: carry prior product forward (or zero if none yet)
+				JZ				@@fzero
+				Copy512			RCX, R15
+				JMP				@@fnext
+@@fzero:		Zero512Q		RCX
+				JMP				@@fnext
+@@fnonzero:		TEST			R15, R15
+				JNZ				@@fmul
+				MOV				l_Ptr.first, R14					; first non-zero value: product is the value itself
+				Copy512			RCX, RDX
+				JMP				@@flast
+@@fmul:			MOV				R8, RDX								; c [ k ] = c [ k - 1 ] * a [ k ] * R^-1
+				MOV				RDX, R15
+				LEA				R9, l_Ptr.ctx
+				CALL			mont_mul_u
+@@flast:		LEA				R15, [ RSI + R14 ]
+@@fnext:		ADD				R14, 64
+				JMP				@@fwd
+
+@@fwddone:		TEST			R15, R15							; all zero? out is all zero, done
+				JZ				@@done
+				LEA				RCX, l_Ptr.u						; u = inverse of product of all
+				MOV				RDX, R15
+				MOV				R8, R13
+				CALL			invmod_u
+				TEST			EAX, EAX
+				JNZ				@@exit								; -1: some value shares a factor with the modulus
+
+; backward
+				MOV				R14, R12
+@@bwd:			SUB				R14, 64
+				JB				@@done
+				LEA				RDX, [ RDI + R14 ]
+				LEA				RCX, [ RSI + R14 ]
+				TestZero512		RDX
+				JNZ				@@bnonzero
+				Zero512Q		RCX									; zero value, zero "inverse"
+				JMP				@@bwd
+@@bnonzero:		CMP				R14, l_Ptr.first
+				JE				@@bfirst
+				LEA				RDX, l_Ptr.u						; out [ k ] = u * c [ k - 1 ] * R^-1
+				LEA				R8, [ RCX - 64 ]
+				LEA				R9, l_Ptr.ctx
+				CALL			mont_mul_u
+				LEA				RCX, l_Ptr.u						; u = u * a [ k ] * R^-1
+				MOV				RDX, RCX
+				LEA				R8, [ RDI + R14 ]
+				LEA				R9, l_Ptr.ctx
+				CALL			mont_mul_u
+				JMP				@@bwd
+@@bfirst:		LEA				RDX, l_Ptr.u						; first non-zero value, inverse is u
+				Copy512			RCX, RDX
+				JMP				@@bwd
+
+@@done:			XOR				EAX, EAX							; return zero
+@@exit:			Local_Exit		RDI, RSI, R15, R14, R13, R12
+invmod_u_batch	ENDP
+
+;--------------------------------------------------------------------------------------------------------------------------------------------------------------
+;			Montgomery multiply / exponentiate of locals, with context at l_Ptr.ctx (used by the procs below)
+;
+Mont_Mul		MACRO			dest:REQ, a:REQ, b:REQ
+				LEA				RCX, dest
+				LEA				RDX, a
+				LEA				R8, b
+				LEA				R9, l_Ptr.ctx
+				CALL			mont_mul_u
+				ENDM
+
+Mont_Pow		MACRO			dest:REQ, base:REQ, exponent:REQ
+				LEA				RCX, dest
+				LEA				RDX, base
+				LEA				R8, exponent
+				LEA				R9, l_Ptr.ctx
+				CALL			mont_pow_u
+				ENDM
+
+;--------------------------------------------------------------------------------------------------------------------------------------------------------------
+;			EXTERNDEF		mont_pow_u:PROC				; s16 mont_pow_u( u64* result, u64* base, u64* exponent, u64* ctx );
+;			mont_pow_u		-	Montgomery exponentiation, result = base^exponent, base and result in Montgomery form
+;			Prototype:		-	s16 mont_pow_u( u64* result, u64* base, u64* exponent, u64* ctx );
+;			result			-	Address of 8 QWORDS to store the result (in RCX), may be the same as base or exponent
+;			base			-	Address of 8 QWORDS, in Montgomery form, less than m (in RDX)
+;			exponent		-	Address of 8 QWORDS exponent (in R8)
+;			ctx				-	Address of Montgomery context from mont_init_u (in R9)
+;			returns			-	(0) for success, (GP_Fault) for mis-aligned parameter address
+;
+;			Note: left to right binary square and multiply. An exponent of zero gives one (in Montgomery form)
+;
+pow_Locals		STRUCT
+acc				QWORD			8 dup (?)
+b				QWORD			8 dup (?)
+pow_Locals		ENDS
+
+				Proc_w_Local	mont_pow_u, pow_Locals, R12, R13, R14, R15
+
+				CheckAlign		RCX, @@exit							; (out) Result
+				CheckAlign		RDX, @@exit							; (in) Base
+				CheckAlign		R8, @@exit							; (in) Exponent
+				CheckAlign		R9, @@exit							; (in) Context
+
+				MOV				R12, R8								; exponent
+				MOV				R13, R9								; context
+				LEA				RCX, l_Ptr.b						; copy of base (result may overlay it)
+				Copy512			RCX, RDX
+				MOV				RCX, R12
+				CALL			msb_u
+				MOVSX			R14, AX								; bit index, -1 if exponent is zero
+				LEA				RCX, l_Ptr.acc
+				TEST			R14, R14
+				JNS				@@top
+				LEA				RDX, mont_ctx.one [ R13 ]			; exponent zero: one
+				Copy512			RCX, RDX
+				JMP				@@done
+@@top:			LEA				RDX, l_Ptr.b						; most significant bit: acc = base
+				Copy512			RCX, RDX
+
+@@bit:			DEC				R14
+				JS				@@done
+				LEA				RCX, l_Ptr.acc						; acc = acc^2
+				MOV				RDX, RCX
+				MOV				R8, RCX
+				MOV				R9, R13
+				CALL			mont_mul_u
+				MOV				RAX, R14							; bit set? word 7 - ( bit / 64 ), bit mod 64
+				SHR				RAX, 6
+				NEG				RAX
+				MOV				RAX, Q_PTR [ R12 ] [ RAX * 8 + 7 * 8 ]
+				BT				RAX, R14
+				JNC				@@bit
+				LEA				RCX, l_Ptr.acc						; acc = acc * base
+				MOV				RDX, RCX
+				LEA				R8, l_Ptr.b
+				MOV				R9, R13
+				CALL			mont_mul_u
+				JMP				@@bit
+
+@@done:			MOV				RCX, RCXHome
+				LEA				RDX, l_Ptr.acc
+				Copy512			RCX, RDX
+				XOR				EAX, EAX							; return zero
+@@exit:			Local_Exit		R15, R14, R13, R12
+mont_pow_u		ENDP
+
+;--------------------------------------------------------------------------------------------------------------------------------------------------------------
+;			EXTERNDEF		powmod_u:PROC				; s16 powmod_u( u64* result, u64* base, u64* exponent, u64* modulus );
+;			powmod_u		-	modular exponentiation, result = base^exponent mod m, for odd modulus
+;			Prototype:		-	s16 powmod_u( u64* result, u64* base, u64* exponent, u64* modulus );
+;			result			-	Address of 8 QWORDS to store the result (in RCX), may be the same as any parameter
+;			base			-	Address of 8 QWORDS base (in RDX) (reduced mod m first if not less than m)
+;			exponent		-	Address of 8 QWORDS exponent (in R8)
+;			modulus			-	Address of 8 QWORDS odd modulus, greater than one (in R9)
+;			returns			-	(0) for success, (-1) if modulus is even or one, (GP_Fault) for mis-aligned parameter address
+;
+powm_Locals		STRUCT
+ctx				mont_ctx		<>
+x				QWORD			8 dup (?)
+q				QWORD			8 dup (?)
+powm_Locals		ENDS
+
+				Proc_w_Local	powmod_u, powm_Locals
+
+				CheckAlign		RCX, @@exit							; (out) Result
+				CheckAlign		RDX, @@exit							; (in) Base
+				CheckAlign		R8, @@exit							; (in) Exponent
+				CheckAlign		R9, @@exit							; (in) Modulus
+				MOV				RDXHome, RDX
+				MOV				R8Home, R8
+				MOV				R9Home, R9
+
+				LEA				RCX, l_Ptr.ctx
+				MOV				RDX, R9
+				CALL			mont_init_u
+				TEST			EAX, EAX
+				JNZ				@@exit								; -1: modulus is even or one
+
+; x = base mod m, into Montgomery form
+				MOV				RCX, RDXHome
+				MOV				RDX, R9Home
+				CALL			compare_u
+				CMP				AX, 0
+				JL				@@reduced
+				LEA				RCX, l_Ptr.q
+				LEA				RDX, l_Ptr.x
+				MOV				R8, RDXHome
+				MOV				R9, R9Home
+				CALL			div_u								; remainder to x
+				JMP				@@tomont
+@@reduced:		LEA				RCX, l_Ptr.x
+				MOV				RDX, RDXHome
+				Copy512			RCX, RDX
+@@tomont:		LEA				RCX, l_Ptr.x
+				MOV				RDX, RCX
+				LEA				R8, l_Ptr.ctx + mont_ctx.r2
+				LEA				R9, l_Ptr.ctx
+				CALL			mont_mul_u
+
+				LEA				RCX, l_Ptr.x
+				MOV				RDX, RCX
+				MOV				R8, R8Home
+				LEA				R9, l_Ptr.ctx
+				CALL			mont_pow_u
+
+; out of Montgomery form: times one
+				LEA				RCX, l_Ptr.q
+				Zero512Q		RCX
+				MOV				Q_PTR [ RCX ] [ 7 * 8 ], 1
+				MOV				RCX, RCXHome
+				Mont_Mul		[ RCX ], l_Ptr.x, l_Ptr.q
+				XOR				EAX, EAX							; return zero
+@@exit:			Local_Exit
+powmod_u		ENDP
+
+;--------------------------------------------------------------------------------------------------------------------------------------------------------------
+;			EXTERNDEF		sqrtmod_u:PROC				; s16 sqrtmod_u( u64* root, u64* a, u64* prime );
+;			sqrtmod_u		-	modular square root, root^2 = a mod p, for odd prime p
+;			Prototype:		-	s16 sqrtmod_u( u64* root, u64* a, u64* prime );
+;			root			-	Address of 8 QWORDS to store a root (in RCX); the other root is p - root
+;			a				-	Address of 8 QWORDS value (in RDX) (reduced mod p first if not less than p)
+;			prime			-	Address of 8 QWORDS odd prime (in R8)
+;			returns			-	(0) for success, (-1) if a is not a square mod p or p is even or one, (GP_Fault) for mis-aligned parameter address
+;
+;			Note: all arithmetic in Montgomery form. By the low bits of p:
+;				p = 3 mod 4:	root = a^( ( p + 1 ) / 4 ), one exponentiation (secp256k1, P-256, P-384, 2^448 - 2^224 - 1)
+;				p = 5 mod 8:	Atkin, v = ( 2a )^( ( p - 5 ) / 8 ), i = 2a * v^2, root = a * v * ( i - 1 ), one exponentiation (2^255 - 19)
+;				p = 1 mod 8:	Tonelli-Shanks (Cohen, "A Course in Computational Algebraic Number Theory", 1.5.1)
+;			Each candidate root is squared and checked, so a non-residue is reported without a separate Legendre symbol computation.
+;
+sqrt_Locals		STRUCT
+ctx				mont_ctx		<>
+x				QWORD			8 dup (?)
+r				QWORD			8 dup (?)
+t				QWORD			8 dup (?)
+c				QWORD			8 dup (?)
+b				QWORD			8 dup (?)
+e				QWORD			8 dup (?)
+w				QWORD			8 dup (?)
+sqrt_Locals		ENDS
+
+				Proc_w_Local	sqrtmod_u, sqrt_Locals, R12, R13, R14, R15
+
+				CheckAlign		RCX, @@exit							; (out) Root
+				CheckAlign		RDX, @@exit							; (in) a
+				CheckAlign		R8, @@exit							; (in) Prime
+				MOV				RDXHome, RDX
+				MOV				R12, R8								; p
+
+				LEA				RCX, l_Ptr.ctx
+				MOV				RDX, R12
+				CALL			mont_init_u
+				TEST			EAX, EAX
+				JNZ				@@exit								; -1: p is even or one
+
+; x = a mod p; zero is its own root
+				MOV				RCX, RDXHome
+				MOV				RDX, R12
+				CALL			compare_u
+				CMP				AX, 0
+				JL				@@reduced
+				LEA				RCX, l_Ptr.w
+				LEA				RDX, l_Ptr.x
+				MOV				R8, RDXHome
+				MOV				R9, R12
+				CALL			div_u								; remainder to x
+				JMP				@@iszero
+@@reduced:		LEA				RCX, l_Ptr.x
+				MOV				RDX, RDXHome
+				Copy512			RCX, RDX
+@@iszero:		LEA				RCX, l_Ptr.x
+				TestZero512		RCX
+				JNZ				@@tomont
+				MOV				RCX, RCXHome
+				Zero512Q		RCX
+				XOR				EAX, EAX							; return zero
+				JMP				@@exit
+@@tomont:		LEA				RCX, l_Ptr.x
+				MOV				RDX, RCX
+				LEA				R8, l_Ptr.ctx + mont_ctx.r2
+				LEA				R9, l_Ptr.ctx
+				CALL			mont_mul_u
+				LEA				RCX, l_Ptr.e						; e = p, exponents are derived from it
+				Copy512			RCX, R12
+
+				MOV				EAX, D_PTR [ R12 ] [ 7 * 8 ]
+				TEST			EAX, 2
+				JNZ				@@p3mod4
+				AND				EAX, 7
+				CMP				EAX, 5
+				JNE				@@tonelli
+
+; p = 5 mod 8: b = 2x, c = v = b^( ( p - 5 ) / 8 ), t = i = b * v^2 - 1, root = x * v * t
+				LEA				RCX, l_Ptr.e						; ( p - 5 ) / 8 = p >> 3
+				ShrMem512		RCX
+				ShrMem512		RCX
+				ShrMem512		RCX
+				LEA				RCX, l_Ptr.b
+				LEA				RDX, l_Ptr.x
+				Copy512			RCX, RDX
+				AddModMem512	RCX, RDX, R12
+				Mont_Pow		l_Ptr.c, l_Ptr.b, l_Ptr.e
+				Mont_Mul		l_Ptr.t, l_Ptr.c, l_Ptr.c
+				Mont_Mul		l_Ptr.t, l_Ptr.t, l_Ptr.b
+				LEA				RCX, l_Ptr.t
+				LEA				RDX, l_Ptr.ctx + mont_ctx.one
+				SubModMem512	RCX, RDX, R12
+				Mont_Mul		l_Ptr.r, l_Ptr.x, l_Ptr.c
+				Mont_Mul		l_Ptr.r, l_Ptr.r, l_Ptr.t
+				JMP				@@verify
+
+; p = 3 mod 4: root = x^( ( p + 1 ) / 4 ) = x^( ( p >> 2 ) + 1 )
+@@p3mod4:		LEA				RCX, l_Ptr.e
+				ShrMem512		RCX
+				ShrMem512		RCX
+				IncMem512		RCX
+				Mont_Pow		l_Ptr.r, l_Ptr.x, l_Ptr.e
+				JMP				@@verify
+
+; p = 1 mod 8: Tonelli-Shanks. p - 1 = q * 2^s, s in R13 (as M, the order of the 2-power subgroup still in play)
+@@tonelli:		LEA				RCX, l_Ptr.e						; e = p - 1
+				AND				B_PTR [ RCX ] [ 7 * 8 ], 0FEh
+				CALL			lsb_u
+				MOVSX			R13, AX								; s
+				LEA				RCX, l_Ptr.e						; e = q
+				MOV				RDX, RCX
+				MOV				R8, R13
+				CALL			shr_u
+
+; non-residue z (in b): first of 2, 3, 4 ... with Jacobi symbol ( z / p ) = -1. Half of all values qualify; give up (p not prime) after 64
+				LEA				RCX, l_Ptr.b						; z = 2
+				Zero512Q		RCX
+				MOV				Q_PTR [ RCX ] [ 7 * 8 ], 2
+				MOV				R15, 64
+@@findz:		LEA				RCX, l_Ptr.b
+				MOV				RDX, R12
+				CALL			jacobi_u
+				CMP				AX, retcode_neg_one
+				JE				@@foundz
+				TEST			AX, AX								; z shares a factor with p: not prime
+				JZ				@@noroot
+				LEA				RCX, l_Ptr.b						; z = z + 1
+				INC				Q_PTR [ RCX ] [ 7 * 8 ]
+				DEC				R15
+				JNZ				@@findz
+				JMP				@@noroot
+
+; c = z^q (z into Montgomery form first); g = x^( ( q - 1 ) / 2 ) (in b), root = g * x = x^( ( q + 1 ) / 2 ), t = root * g = x^q
+@@foundz:		LEA				RCX, l_Ptr.b
+				MOV				RDX, RCX
+				LEA				R8, l_Ptr.ctx + mont_ctx.r2
+				LEA				R9, l_Ptr.ctx
+				CALL			mont_mul_u
+				Mont_Pow		l_Ptr.c, l_Ptr.b, l_Ptr.e
+				LEA				RCX, l_Ptr.e						; q odd, ( q - 1 ) / 2 = q >> 1
+				ShrMem512		RCX
+				Mont_Pow		l_Ptr.b, l_Ptr.x, l_Ptr.e
+				Mont_Mul		l_Ptr.r, l_Ptr.b, l_Ptr.x
+				Mont_Mul		l_Ptr.t, l_Ptr.r, l_Ptr.b
+
+@@tsloop:		LEA				RCX, l_Ptr.t						; t = 1? root found
+				LEA				RDX, l_Ptr.ctx + mont_ctx.one
+				TestEqual512	RCX, RDX
+				JE				@@verify
+				LEA				RCX, l_Ptr.w						; least i, 0 < i < M, with t^( 2^i ) = 1; none: a is not a square
+				LEA				RDX, l_Ptr.t
+				Copy512			RCX, RDX
+				XOR				R14, R14
+@@sqr:			INC				R14
+				CMP				R14, R13
+				JAE				@@noroot
+				Mont_Mul		l_Ptr.w, l_Ptr.w, l_Ptr.w
+				LEA				RCX, l_Ptr.w
+				LEA				RDX, l_Ptr.ctx + mont_ctx.one
+				TestEqual512	RCX, RDX
+				JNE				@@sqr
+
+				LEA				RCX, l_Ptr.b						; b = c^( 2^( M - i - 1 ) )
+				LEA				RDX, l_Ptr.c
+				Copy512			RCX, RDX
+				MOV				R15, R13
+				SUB				R15, R14
+@@bsqr:			DEC				R15
+				JZ				@@bdone
+				Mont_Mul		l_Ptr.b, l_Ptr.b, l_Ptr.b
+				JMP				@@bsqr
+@@bdone:		MOV				R13, R14							; M = i, c = b^2, t = t * c, root = root * b
+				Mont_Mul		l_Ptr.c, l_Ptr.b, l_Ptr.b
+				Mont_Mul		l_Ptr.t, l_Ptr.t, l_Ptr.c
+				Mont_Mul		l_Ptr.r, l_Ptr.r, l_Ptr.b
+				JMP				@@tsloop
+
+; root^2 = x? then out of Montgomery form (times one)
+@@verify:		Mont_Mul		l_Ptr.w, l_Ptr.r, l_Ptr.r
+				LEA				RCX, l_Ptr.w
+				LEA				RDX, l_Ptr.x
+				TestEqual512	RCX, RDX
+				JNE				@@noroot
+				LEA				RCX, l_Ptr.w
+				Zero512Q		RCX
+				MOV				Q_PTR [ RCX ] [ 7 * 8 ], 1
+				MOV				RCX, RCXHome
+				Mont_Mul		[ RCX ], l_Ptr.r, l_Ptr.w
+				XOR				EAX, EAX							; return zero
+				JMP				@@exit
+
+@@noroot:		MOV				EAX, retcode_neg_one
+@@exit:			Local_Exit		R15, R14, R13, R12
+sqrtmod_u		ENDP
+
+;--------------------------------------------------------------------------------------------------------------------------------------------------------------
+;			EXTERNDEF		jacobi_u:PROC				; s16 jacobi_u( u64* a, u64* n );
+;			jacobi_u		-	Jacobi symbol ( a / n ), for odd n (the Legendre symbol when n is prime)
+;			Prototype:		-	s16 jacobi_u( u64* a, u64* n );
+;			a				-	Address of 8 QWORDS value (in RCX), any size (not reduced first)
+;			n				-	Address of 8 QWORDS odd modulus (in RDX)
+;			returns			-	(1) or (-1) the symbol, (0) if a and n share a factor, (-2) if n is even or zero, (GP_Fault) for mis-aligned parameter address
+;
+;			Note: binary algorithm (Cohen, "A Course in Computational Algebraic Number Theory", 1.4.10), no division:
+;				strip twos from x, each one flips the sign if y = 3 or 5 mod 8; x, y odd: swap so x >= y, flips if both are 3 mod 4; x = x - y.
+;			The sign is kept as a parity bit, flips are XORs of the low bits. x and y are swapped by exchanging their addresses.
+;			Once y fits in one QWORD, x is reduced mod y by a single QWORD divide chain, and the rest runs in registers.
+;
+jac_Locals		STRUCT
+x				QWORD			8 dup (?)
+y				QWORD			8 dup (?)
+jac_Locals		ENDS
+
+				Proc_w_Local	jacobi_u, jac_Locals, R12, R13, RSI, RDI
+
+				CheckAlign		RCX, @@exit							; (in) a
+				CheckAlign		RDX, @@exit							; (in) n
+
+				TEST			B_PTR [ RDX ] [ 7 * 8 ], 1			; n must be odd
+				JZ				@@err
+				LEA				RSI, l_Ptr.x						; RSI -> x, starts as a
+				Copy512			RSI, RCX
+				LEA				RDI, l_Ptr.y						; RDI -> y, starts as n
+				Copy512			RDI, RDX
+				XOR				R12, R12							; sign parity: 0 for +1, 1 for -1
+
+; multi QWORD y
+@@multi:		MOV				RAX, Q_PTR [ RDI ] [ 0 * 8 ]		; y fits in one QWORD?
+				FOR				idx, < 1, 2, 3, 4, 5, 6 >
+				OR				RAX, Q_PTR [ RDI ] [ idx * 8 ]
+				ENDM
+				JZ				@@single
+				TestZero512		RSI									; x = 0, y > 1: share a factor
+				JZ				@@zero
+				MOV				RCX, RSI
+				CALL			lsb_u
+				MOVZX			R13, AX								; k, factors of two
+				TEST			R13, R13
+				JZ				@@odd
+				MOV				RCX, RSI
+				MOV				RDX, RSI
+				MOV				R8, R13
+				CALL			shr_u
+				MOV				RAX, Q_PTR [ RDI ] [ 7 * 8 ]		; flip if k is odd and y = 3 or 5 mod 8 ( bit 1 XOR bit 2 of y )
+				MOV				RDX, RAX
+				SHR				RAX, 1
+				SHR				RDX, 2
+				XOR				RAX, RDX
+				AND				RAX, R13
+				AND				EAX, 1
+				XOR				R12, RAX
+@@odd:			SubMem512		RSI, RDI							; x >= y: x = x - y
+				JNC				@@multi
+				AddMem512		RSI, RDI							; x < y: restore x, swap, flip if both are 3 mod 4
+				XCHG			RSI, RDI
+				MOV				RAX, Q_PTR [ RSI ] [ 7 * 8 ]
+				AND				RAX, Q_PTR [ RDI ] [ 7 * 8 ]
+				SHR				EAX, 1
+				AND				EAX, 1
+				XOR				R12, RAX
+				SubMem512		RSI, RDI
+				JMP				@@multi
+
+; single QWORD y (in R8): x = x mod y, then x (in RAX) and y in registers
+@@single:		MOV				R8, Q_PTR [ RDI ] [ 7 * 8 ]
+				XOR				EDX, EDX
+				FOR				idx, < 0, 1, 2, 3, 4, 5, 6, 7 >
+				MOV				RAX, Q_PTR [ RSI ] [ idx * 8 ]
+				DIV				R8
+				ENDM
+				MOV				RAX, RDX
+@@reg:			TEST			RAX, RAX
+				JZ				@@regdone
+				BSF				RCX, RAX							; k
+				SHR				RAX, CL
+				MOV				RDX, R8
+				MOV				R9, R8
+				SHR				RDX, 1
+				SHR				R9, 2
+				XOR				RDX, R9
+				AND				RDX, RCX
+				AND				EDX, 1
+				XOR				R12, RDX
+				CMP				RAX, R8
+				JAE				@@regsub
+				XCHG			RAX, R8
+				MOV				RDX, RAX
+				AND				RDX, R8
+				SHR				EDX, 1
+				AND				EDX, 1
+				XOR				R12, RDX
+@@regsub:		SUB				RAX, R8
+				JMP				@@reg
+@@regdone:		CMP				R8, 1								; gcd one? symbol is the sign
+				JNE				@@zero
+				MOV				EAX, retcode_one
+				TEST			R12, R12
+				JZ				@@exit
+				MOV				EAX, retcode_neg_one
+				JMP				@@exit
+
+@@zero:			XOR				EAX, EAX							; return zero
+				JMP				@@exit
+@@err:			MOV				EAX, retcode_neg_two
+@@exit:			Local_Exit		RDI, RSI, R13, R12
+jacobi_u		ENDP
+
+;--------------------------------------------------------------------------------------------------------------------------------------------------------------
+;			EXTERNDEF		crt_init_u:PROC				; s16 crt_init_u( crt_ctx* ctx, u64* primes, u64 count );
+;			crt_init_u		-	set up a CRT context: the moduli, and Garner's coefficients ( p0 p1 ... p(i-1) )^-1 mod pi
+;			Prototype:		-	s16 crt_init_u( crt_ctx* ctx, u64* primes, u64 count );
+;			ctx				-	Address of crt_ctx (40 QWORDS) to set up (in RCX)
+;			primes			-	Address of count QWORDS, pairwise coprime moduli, each above one (in RDX), any alignment
+;			count			-	number of moduli, 1 to crt_max (in R8)
+;			returns			-	(0) for success, (-1) for a count out of range, a modulus below two, or moduli not coprime,
+;								(GP_Fault) for mis-aligned ctx address
+;
+;			Note: the product p0 ... p(i-1) is kept mod pi, and inverted by the extended Euclidean algorithm in registers
+;			( coefficients kept mod pi ); a gcd other than one is an error.
+;
+crt_Locals		STRUCT
+v				QWORD			crt_max dup (?)						; mixed radix digits
+over			QWORD			?									; overflow from mult_uT64
+crt_Locals		ENDS
+
+				Proc_w_Local	crt_init_u, crt_Locals, RBX, RSI, RDI, R12, R13, R14, R15
+
+				CheckAlign		RCX, @@exit							; (out) ctx
+				MOV				R12, RCX							; ctx
+				MOV				R13, RDX							; primes
+				MOV				R14, R8								; count
+				LEA				RAX, [ R14 - 1 ]
+				CMP				RAX, crt_max
+				JAE				@@err
+				MOV				crt_ctx.count [ R12 ], R14
+				XOR				ESI, ESI							; i
+@@prime:		MOV				R15, Q_PTR [ R13 + RSI * 8 ]		; p
+				CMP				R15, 2
+				JB				@@err
+				MOV				crt_ctx.primes [ R12 + RSI * 8 ], R15
+				MOV				crt_ctx.coef [ R12 + RSI * 8 ], 0
+				TEST			RSI, RSI
+				JZ				@@next
+
+; m = p0 ... p(i-1) mod p
+				MOV				EBX, 1
+				XOR				EDI, EDI
+@@prod:			MOV				RAX, RBX
+				MUL				Q_PTR [ R13 + RDI * 8 ]
+				DIV				R15
+				MOV				RBX, RDX
+				INC				RDI
+				CMP				RDI, RSI
+				JB				@@prod
+
+; m^-1 mod p: r0 = p, r1 = m, s0 = 0, s1 = 1; q = r0 / r1, ( r0, r1 ) = ( r1, r0 - q r1 ), ( s0, s1 ) = ( s1, s0 - q s1 mod p )
+				MOV				R8, R15
+				MOV				R9, RBX
+				XOR				R10D, R10D
+				MOV				R11D, 1
+@@euclid:		TEST			R9, R9
+				JZ				@@gcd
+				MOV				RAX, R8
+				XOR				EDX, EDX
+				DIV				R9
+				MOV				R8, R9
+				MOV				R9, RDX
+				MUL				R11
+				DIV				R15									; q s1 mod p
+				MOV				RAX, R10
+				SUB				RAX, RDX
+				JAE				@F
+				ADD				RAX, R15
+@@:				MOV				R10, R11
+				MOV				R11, RAX
+				JMP				@@euclid
+@@gcd:			CMP				R8, 1
+				JNE				@@err
+				MOV				crt_ctx.coef [ R12 + RSI * 8 ], R10
+@@next:			INC				RSI
+				CMP				RSI, R14
+				JB				@@prime
+				XOR				EAX, EAX							; return zero
+				JMP				@@exit
+@@err:			MOV				EAX, retcode_neg_one
+@@exit:			Local_Exit		R15, R14, R13, R12, RDI, RSI, RBX
+crt_init_u		ENDP
+
+;--------------------------------------------------------------------------------------------------------------------------------------------------------------
+;			EXTERNDEF		crt_reconstruct_u:PROC		; s16 crt_reconstruct_u( u64* out, u64* residues, crt_ctx* ctx );
+;			crt_reconstruct_u	-	the value x mod p0 p1 ... p(n-1) with x = residues [ i ] mod pi, Garner's algorithm
+;			Prototype:		-	s16 crt_reconstruct_u( u64* out, u64* residues, crt_ctx* ctx );
+;			out				-	Address of 8 QWORDS to store the result (in RCX)
+;			residues		-	Address of count QWORDS, residues mod each modulus, reduced here if not already (in RDX), any alignment
+;			ctx				-	Address of crt_ctx set up by crt_init_u (in R8)
+;			returns			-	(0) for success, (1) if the value does not fit 512 bits (out is the value mod 2^512),
+;								(GP_Fault) for mis-aligned parameter address
+;
+;			Note: mixed radix digits vi, x = v0 + v1 p0 + v2 p0 p1 + ..., each by a Horner sum of the lower digits mod pi, all in
+;			registers ( MUL, DIV ): vi = ( ri - ( v0 + v1 p0 + ... ) ) coef i mod pi. Then x by Horner from the top digit,
+;			x = x pi + vi (mult_uT64, add_uT64): n - 1 of each.
+;
+				Proc_w_Local	crt_reconstruct_u, crt_Locals, RBX, RSI, RDI, R12, R13, R14, R15
+
+				CheckAlign		RCX, @@exit							; (out) out
+				CheckAlign		R8, @@exit							; (in) ctx
+				MOV				R12, RCX							; out
+				MOV				R13, RDX							; residues
+				MOV				R14, R8								; ctx
+				MOV				R15, crt_ctx.count [ R14 ]
+
+; digits: v0 = r0 mod p0, then vi
+				MOV				RAX, Q_PTR [ R13 ]
+				XOR				EDX, EDX
+				DIV				crt_ctx.primes [ R14 ]
+				MOV				l_Ptr.v [ 0 ], RDX
+				MOV				ESI, 1								; i
+@@digit:		CMP				RSI, R15
+				JAE				@@radix
+				MOV				RBX, crt_ctx.primes [ R14 + RSI * 8 ]	; p
+				MOV				RAX, l_Ptr.v [ RSI * 8 - 8 ]		; t = v( i - 1 ) mod p
+				XOR				EDX, EDX
+				DIV				RBX
+				MOV				RCX, RDX
+				LEA				RDI, [ RSI - 2 ]					; j
+@@sum:			TEST			RDI, RDI
+				JS				@@diff
+				MOV				RAX, RCX							; t = t pj + vj mod p
+				MUL				crt_ctx.primes [ R14 + RDI * 8 ]
+				ADD				RAX, l_Ptr.v [ RDI * 8 ]
+				ADC				RDX, 0
+				DIV				RBX
+				MOV				RCX, RDX
+				DEC				RDI
+				JMP				@@sum
+@@diff:			MOV				RAX, Q_PTR [ R13 + RSI * 8 ]		; ( ri mod p - t ) coef mod p
+				XOR				EDX, EDX
+				DIV				RBX
+				SUB				RDX, RCX
+				JAE				@F
+				ADD				RDX, RBX
+@@:				MOV				RAX, RDX
+				MUL				crt_ctx.coef [ R14 + RSI * 8 ]
+				DIV				RBX
+				MOV				l_Ptr.v [ RSI * 8 ], RDX
+				INC				RSI
+				JMP				@@digit
+
+; x = v( n - 1 ), then x = x pi + vi down to i = 0; overflow noted in RBX
+@@radix:		Zero512Q		R12
+				MOV				RAX, l_Ptr.v [ R15 * 8 - 8 ]
+				MOV				Q_PTR [ R12 ] [ 7 * 8 ], RAX
+				XOR				EBX, EBX
+				LEA				RSI, [ R15 - 2 ]
+@@horner:		TEST			RSI, RSI
+				JS				@@done
+				MOV				RCX, R12
+				LEA				RDX, l_Ptr.over
+				MOV				R8, R12
+				MOV				R9, crt_ctx.primes [ R14 + RSI * 8 ]
+				CALL			mult_uT64
+				OR				RBX, l_Ptr.over
+				MOV				RCX, R12
+				MOV				RDX, R12
+				MOV				R8, l_Ptr.v [ RSI * 8 ]
+				CALL			add_uT64
+				MOVZX			EAX, AX
+				OR				RBX, RAX
+				DEC				RSI
+				JMP				@@horner
+@@done:			XOR				EAX, EAX							; return zero, or one for overflow
+				TEST			RBX, RBX
+				JZ				@@exit
+				MOV				EAX, retcode_one
+@@exit:			Local_Exit		R15, R14, R13, R12, RDI, RSI, RBX
+crt_reconstruct_u	ENDP
+
+ui512_modular	ENDS
+				END													; end of module
@@ -0,0 +1,1720 @@
+;
+;			ui512_prime
+;
+;--------------------------------------------------------------------------------------------------------------------------------------------------------------
+;
+;			File:			ui512_prime.asm
+;			Author:			John G. Lynch
+;			Legal:			Copyright @2025, per MIT License below
+;			Date:			October 19, 2026
+;
+;			Primality of numbers up to 512 bits:
+;				trial division by the odd primes below 256 (one divide chain for each group of primes with product below 2^64)
+;				strong probable prime test to base 2, in Montgomery form (mont_pow_u)
+;				strong Lucas probable prime test, Selfridge's parameters (D the first of 5, -7, 9, -11, ... with ( D / n ) = -1, P = 1,
+;				Q = ( 1 - D ) / 4): the two together are the Baillie-PSW test, with no known composite passing it
+;			(Baillie, Wagstaff, "Lucas Pseudoprimes", Math. Comp. 1980; Crandall, Pomerance, "Prime Numbers", 3.6.1, 3.6.7)
+;
+;			Factoring: greatest common divisor (binary), and Pollard's rho with Brent's cycle detection and one gcd for each block of steps
+;			Batch gcd: each of many values against the product of the rest, by a product tree and a remainder tree
+;			Integer square and k-th roots: Newton's method from an estimate, off the leading bits, above the root
+;			Random primes: a random odd start, windows of the odd values after it sieved by the odd primes below 4096, then Baillie-PSW
+
+				INCLUDE			ui512_legalnotes.inc
+				INCLUDE			ui512_compile_time_options.inc
+				INCLUDE			ui512_macros.inc
+				INCLUDE			ui512_externs.inc
+.NOLISTIF
+				OPTION			CASEMAP:NONE
+
+prm_primes		EQU				53									; odd primes below 256
+prm_sieve		EQU				563									; odd primes below 4096
+prm_groups		EQU				6
+prm_sqtries		EQU				20									; Selfridge D not found by then: check for a square
+
+;--------------------------------------------------------------------------------------------------------------------------------------------------------------
+;			Small primes: the odd primes below 4096 (sieving), the first prm_primes of them (trial division) also as products in groups
+;			below 2^64 ( prm_count primes each )
+;
+ui512_prime_data SEGMENT		READONLY ALIGN(64) 'CONST'
+
+				ALIGN			64
+prm_small		WORD			   3,    5,    7,   11,   13,   17,   19,   23,   29,   31,   37,   41,   43,   47,   53,   59
+				WORD			  61,   67,   71,   73,   79,   83,   89,   97,  101,  103,  107,  109,  113,  127,  131,  137
+				WORD			 139,  149,  151,  157,  163,  167,  173,  179,  181,  191,  193,  197,  199,  211,  223,  227
+				WORD			 229,  233,  239,  241,  251,  257,  263,  269,  271,  277,  281,  283,  293,  307,  311,  313
+				WORD			 317,  331,  337,  347,  349,  353,  359,  367,  373,  379,  383,  389,  397,  401,  409,  419
+				WORD			 421,  431,  433,  439,  443,  449,  457,  461,  463,  467,  479,  487,  491,  499,  503,  509
+				WORD			 521,  523,  541,  547,  557,  563,  569,  571,  577,  587,  593,  599,  601,  607,  613,  617
+				WORD			 619,  631,  641,  643,  647,  653,  659,  661,  673,  677,  683,  691,  701,  709,  719,  727
+				WORD			 733,  739,  743,  751,  757,  761,  769,  773,  787,  797,  809,  811,  821,  823,  827,  829
+				WORD			 839,  853,  857,  859,  863,  877,  881,  883,  887,  907,  911,  919,  929,  937,  941,  947
+				WORD			 953,  967,  971,  977,  983,  991,  997, 1009, 1013, 1019, 1021, 1031, 1033, 1039, 1049, 1051
+				WORD			1061, 1063, 1069, 1087, 1091, 1093, 1097, 1103, 1109, 1117, 1123, 1129, 1151, 1153, 1163, 1171
+				WORD			1181, 1187, 1193, 1201, 1213, 1217, 1223, 1229, 1231, 1237, 1249, 1259, 1277, 1279, 1283, 1289
+				WORD			1291, 1297, 1301, 1303, 1307, 1319, 1321, 1327, 1361, 1367, 1373, 1381, 1399, 1409, 1423, 1427
+				WORD			1429, 1433, 1439, 1447, 1451, 1453, 1459, 1471, 1481, 1483, 1487, 1489, 1493, 1499, 1511, 1523
+				WORD			1531, 1543, 1549, 1553, 1559, 1567, 1571, 1579, 1583, 1597, 1601, 1607, 1609, 1613, 1619, 1621
+				WORD			1627, 1637, 1657, 1663, 1667, 1669, 1693, 1697, 1699, 1709, 1721, 1723, 1733, 1741, 1747, 1753
+				WORD			1759, 1777, 1783, 1787, 1789, 1801, 1811, 1823, 1831, 1847, 1861, 1867, 1871, 1873, 1877, 1879
+				WORD			1889, 1901, 1907, 1913, 1931, 1933, 1949, 1951, 1973, 1979, 1987, 1993, 1997, 1999, 2003, 2011
+				WORD			2017, 2027, 2029, 2039, 2053, 2063, 2069, 2081, 2083, 2087, 2089, 2099, 2111, 2113, 2129, 2131
+				WORD			2137, 2141, 2143, 2153, 2161, 2179, 2203, 2207, 2213, 2221, 2237, 2239, 2243, 2251, 2267, 2269
+				WORD			2273, 2281, 2287, 2293, 2297, 2309, 2311, 2333, 2339, 2341, 2347, 2351, 2357, 2371, 2377, 2381
+				WORD			2383, 2389, 2393, 2399, 2411, 2417, 2423, 2437, 2441, 2447, 2459, 2467, 2473, 2477, 2503, 2521
+				WORD			2531, 2539, 2543, 2549, 2551, 2557, 2579, 2591, 2593, 2609, 2617, 2621, 2633, 2647, 2657, 2659
+				WORD			2663, 2671, 2677, 2683, 2687, 2689, 2693, 2699, 2707, 2711, 2713, 2719, 2729, 2731, 2741, 2749
+				WORD			2753, 2767, 2777, 2789, 2791, 2797, 2801, 2803, 2819, 2833, 2837, 2843, 2851, 2857, 2861, 2879
+				WORD			2887, 2897, 2903, 2909, 2917, 2927, 2939, 2953, 2957, 2963, 2969, 2971, 2999, 3001, 3011, 3019
+				WORD			3023, 3037, 3041, 3049, 3061, 3067, 3079, 3083, 3089, 3109, 3119, 3121, 3137, 3163, 3167, 3169
+				WORD			3181, 3187, 3191, 3203, 3209, 3217, 3221, 3229, 3251, 3253, 3257, 3259, 3271, 3299, 3301, 3307
+				WORD			3313, 3319, 3323, 3329, 3331, 3343, 3347, 3359, 3361, 3371, 3373, 3389, 3391, 3407, 3413, 3433
+				WORD			3449, 3457, 3461, 3463, 3467, 3469, 3491, 3499, 3511, 3517, 3527, 3529, 3533, 3539, 3541, 3547
+				WORD			3557, 3559, 3571, 3581, 3583, 3593, 3607, 3613, 3617, 3623, 3631, 3637, 3643, 3659, 3671, 3673
+				WORD			3677, 3691, 3697, 3701, 3709, 3719, 3727, 3733, 3739, 3761, 3767, 3769, 3779, 3793, 3797, 3803
+				WORD			3821, 3823, 3833, 3847, 3851, 3853, 3863, 3877, 3881, 3889, 3907, 3911, 3917, 3919, 3923, 3929
+				WORD			3931, 3943, 3947, 3967, 3989, 4001, 4003, 4007, 4013, 4019, 4021, 4027, 4049, 4051, 4057, 4073
+				WORD			4079, 4091, 4093
+
+prm_group		QWORD			0E221F97C30E94E1Dh, 06329899EA9F2714Bh, 058EDCB4C9ED39C8Bh, 009966FF94FD516FBh
+				QWORD			03BD7632C1F36EB51h, 00000000000DC9A05h
+prm_count		BYTE			15, 10, 9, 8, 8, 3
+ui512_prime_data ENDS
+
+ui512_prime		SEGMENT			PARA 'CODE'
+
+;--------------------------------------------------------------------------------------------------------------------------------------------------------------
+;			Operations on locals, mod n, in Montgomery form; Montgomery context (and so the modulus, at offset zero) in RBX
+;			Note: RAX, RCX, RDX, R8 thru R11 are used and not restored
+;
+F_Mul			MACRO			dest:REQ, a:REQ, b:REQ
+				LEA				RCX, dest
+				LEA				RDX, a
+				LEA				R8, b
+				MOV				R9, RBX
+				CALL			mont_mul_u
+				ENDM
+
+F_Pow			MACRO			dest:REQ, base:REQ, exponent:REQ
+				LEA				RCX, dest
+				LEA				RDX, base
+				LEA				R8, exponent
+				MOV				R9, RBX
+				CALL			mont_pow_u
+				ENDM
+
+F_Copy			MACRO			dest:REQ, src:REQ
+				LEA				RCX, dest
+				LEA				RDX, src
+				Copy512			RCX, RDX
+				ENDM
+
+F_Add			MACRO			dest:REQ, src:REQ
+				LEA				RCX, dest
+				LEA				RDX, src
+				AddModMem512	RCX, RDX, RBX
+				ENDM
+
+F_Sub			MACRO			dest:REQ, src:REQ
+				LEA				RCX, dest
+				LEA				RDX, src
+				SubModMem512	RCX, RDX, RBX
+				ENDM
+
+F_Dbl			MACRO			dest:REQ
+				LEA				RCX, dest
+				AddModMem512	RCX, RCX, RBX
+				ENDM
+
+;			dest = dest / 2: add the (odd) modulus first if dest is odd
+F_Half			MACRO			dest:REQ
+				LOCAL			even, done
+				LEA				RCX, dest
+				TEST			B_PTR [ RCX ] [ 7 * 8 ], 1
+				JZ				even
+				AddMem512		RCX, RBX
+				RcrMem512		RCX
+				JMP				done
+even:			ShrMem512		RCX
+done:
+				ENDM
+
+;			dest = value, a small integer in a register (not RAX or RCX), into Montgomery form
+F_Set			MACRO			dest:REQ, value:REQ
+				LEA				RCX, dest
+				Zero512Q		RCX
+				MOV				Q_PTR [ RCX ] [ 7 * 8 ], value
+				F_Mul			dest, dest, mont_ctx.r2 [ RBX ]
+				ENDM
+
+;			dest = -dest, dest not zero; scratch used
+F_Neg			MACRO			dest:REQ, scratch:REQ
+				F_Copy			scratch, [ RBX ]
+				F_Sub			scratch, dest
+				F_Copy			dest, scratch
+				ENDM
+
+;			V = V^2 - 2 Q^k, Q^k = ( Q^k )^2: Lucas V and Q^k for 2k from k
+Lucas_Dbl		MACRO
+				F_Mul			l_Ptr.v, l_Ptr.v, l_Ptr.v
+				F_Copy			l_Ptr.t, l_Ptr.qk
+				F_Dbl			l_Ptr.t
+				F_Sub			l_Ptr.v, l_Ptr.t
+				F_Mul			l_Ptr.qk, l_Ptr.qk, l_Ptr.qk
+				ENDM
+
+;--------------------------------------------------------------------------------------------------------------------------------------------------------------
+;			EXTERNDEF		is_probable_prime_u:PROC	; s16 is_probable_prime_u( u64* n, u64 rounds );
+;			is_probable_prime_u	-	Baillie-PSW probable prime test, with optional further Miller-Rabin rounds
+;			Prototype:		-	s16 is_probable_prime_u( u64* n, u64 rounds );
+;			n				-	Address of 8 QWORDS to test (in RCX)
+;			rounds			-	further strong probable prime tests (in RDX), to bases 3, 5, 7, ... ( at most 53, the odd primes below 256 ),
+;								zero for Baillie-PSW alone
+;			returns			-	(1) if n is a probable prime ( certainly prime below 2^64 ), (0) if n is composite, zero or one,
+;								(GP_Fault) for mis-aligned n address
+;
+;			Note: below 66049 ( 257^2 ) trial division decides. Above, the cost is one exponentiation mod n for each strong test,
+;			and a Lucas sequence ladder (about twice that); most composites are found by trial division, the rest by the base 2 test.
+;
+pp_Locals		STRUCT
+ctx				mont_ctx		<>
+d				QWORD			8 dup (?)							; odd part of n - 1, then of n + 1
+x				QWORD			8 dup (?)							; strong test base^( d 2^r ); Lucas U
+v				QWORD			8 dup (?)							; Lucas V
+qk				QWORD			8 dup (?)							; Q^k
+q				QWORD			8 dup (?)							; Q
+dd				QWORD			8 dup (?)							; D
+mone			QWORD			8 dup (?)							; -1
+t				QWORD			8 dup (?)
+pp_Locals		ENDS
+
+				Proc_w_Local	is_probable_prime_u, pp_Locals, RBX, RSI, RDI, R12, R13, R14, R15
+
+				CheckAlign		RCX, @@exit							; (in) n
+				MOV				R12, RCX							; n
+				MOV				R15, RDX							; rounds
+
+; 2, even, zero and one
+				MOV				RAX, Q_PTR [ R12 ] [ 0 * 8 ]
+				FOR				idx, < 1, 2, 3, 4, 5, 6 >
+				OR				RAX, Q_PTR [ R12 ] [ idx * 8 ]
+				ENDM
+				MOV				R14, RAX							; zero if n fits one QWORD
+				MOV				RAX, Q_PTR [ R12 ] [ 7 * 8 ]
+				TEST			R14, R14
+				JNZ				@F
+				CMP				RAX, 2
+				JB				@@composite
+				JE				@@prime
+@@:				TEST			AL, 1
+				JZ				@@composite
+
+; trial division: n mod the product of a group, then that mod each prime of the group
+				LEA				RSI, prm_small
+				LEA				RDI, prm_group
+				LEA				R13, prm_count
+				XOR				R9D, R9D							; prime
+				XOR				R10D, R10D							; group
+@@group:		MOV				R8, Q_PTR [ RDI + R10 * 8 ]
+				XOR				EDX, EDX
+				FOR				idx, < 0, 1, 2, 3, 4, 5, 6, 7 >
+				MOV				RAX, Q_PTR [ R12 ] [ idx * 8 ]
+				DIV				R8
+				ENDM
+				MOV				R11, RDX
+				MOVZX			ECX, BYTE PTR [ R13 + R10 ]
+@@trial:		MOVZX			R8D, WORD PTR [ RSI + R9 * 2 ]
+				MOV				RAX, R11
+				XOR				EDX, EDX
+				DIV				R8
+				TEST			RDX, RDX
+				JZ				@@divides
+				INC				R9
+				DEC				ECX
+				JNZ				@@trial
+				INC				R10
+				CMP				R10, prm_groups
+				JB				@@group
+				TEST			R14, R14							; no factor below 257: below 257^2, prime
+				JNZ				@@strong
+				CMP				Q_PTR [ R12 ] [ 7 * 8 ], 257 * 257
+				JB				@@prime
+				JMP				@@strong
+@@divides:		TEST			R14, R14							; only the prime itself
+				JNZ				@@composite
+				CMP				Q_PTR [ R12 ] [ 7 * 8 ], R8
+				JE				@@prime
+				JMP				@@composite
+
+; strong probable prime tests, n - 1 = d 2^s: base^d = 1, or base^( d 2^r ) = -1 for some r < s
+@@strong:		LEA				RBX, l_Ptr.ctx
+				MOV				RCX, RBX
+				MOV				RDX, R12
+				CALL			mont_init_u
+				F_Copy			l_Ptr.mone, [ RBX ]
+				F_Sub			l_Ptr.mone, mont_ctx.one [ RBX ]
+				F_Copy			l_Ptr.d, [ R12 ]					; n - 1, n odd
+				AND				B_PTR [ RCX ] [ 7 * 8 ], 0FEh
+				CALL			lsb_u
+				MOVZX			R14, AX								; s
+				LEA				RCX, l_Ptr.d
+				MOV				RDX, RCX
+				MOV				R8, R14
+				CALL			shr_u
+				XOR				R13D, R13D							; further rounds done
+				MOV				EDI, 2								; base
+@@mr:			F_Set			l_Ptr.t, RDI
+				F_Pow			l_Ptr.x, l_Ptr.t, l_Ptr.d
+				LEA				RCX, l_Ptr.x
+				LEA				RDX, mont_ctx.one [ RBX ]
+				TestEqual512	RCX, RDX
+				JE				@@round
+				MOV				RSI, R14
+@@square:		LEA				RCX, l_Ptr.x
+				LEA				RDX, l_Ptr.mone
+				TestEqual512	RCX, RDX
+				JE				@@round
+				DEC				RSI
+				JZ				@@composite
+				F_Mul			l_Ptr.x, l_Ptr.x, l_Ptr.x
+				JMP				@@square
+@@round:		CMP				R13, R15							; passed: next base, if any
+				JAE				@@lucas
+				CMP				R13, prm_primes
+				JAE				@@lucas
+				LEA				RAX, prm_small
+				MOVZX			EDI, WORD PTR [ RAX + R13 * 2 ]
+				INC				R13
+				JMP				@@mr
+
+; Selfridge: D = 5, -7, 9, -11, ... to ( D / n ) = -1; ( -1 / n ) = -1 for n = 3 mod 4. A square n has no such D
+@@lucas:		MOV				ESI, 5								; | D |
+				XOR				EDI, EDI							; 1 if D is negative
+				XOR				R13D, R13D							; tries
+@@selfridge:	LEA				RCX, l_Ptr.t
+				Zero512Q		RCX
+				MOV				Q_PTR [ RCX ] [ 7 * 8 ], RSI
+				MOV				RDX, R12
+				CALL			jacobi_u
+				MOVSX			RAX, AX
+				TEST			RAX, RAX
+				JZ				@@composite							; a factor in common with | D |, below n
+				TEST			EDI, EDI
+				JZ				@F
+				TEST			B_PTR [ R12 ] [ 7 * 8 ], 2
+				JZ				@F
+				NEG				RAX
+@@:				CMP				RAX, retcode_neg_one
+				JE				@@found
+				ADD				ESI, 2
+				XOR				EDI, 1
+				INC				R13
+				CMP				R13, prm_sqtries
+				JNE				@@selfridge
+
+; square? x = floor( sqrt( n ) ), x^2 = n
+				LEA				RCX, l_Ptr.x
+				MOV				RDX, R12
+				CALL			isqrt_u
+				LEA				RCX, l_Ptr.t
+				LEA				RDX, l_Ptr.v
+				LEA				R8, l_Ptr.x
+				MOV				R9, R8
+				CALL			mult_u
+				LEA				RCX, l_Ptr.t
+				TestEqual512	RCX, R12
+				JE				@@composite
+				JMP				@@selfridge
+
+; D and Q = ( 1 - D ) / 4 into Montgomery form; n + 1 = d 2^s
+@@found:		F_Set			l_Ptr.dd, RSI
+				LEA				R14, [ RSI - 1 ]					; | Q |: ( | D | - 1 ) / 4, Q negative, or ( | D | + 1 ) / 4
+				TEST			EDI, EDI
+				JZ				@F
+				LEA				R14, [ RSI + 1 ]
+@@:				SHR				R14, 2
+				F_Set			l_Ptr.q, R14
+				TEST			EDI, EDI
+				JZ				@F
+				F_Neg			l_Ptr.dd, l_Ptr.t
+				JMP				@@dq
+@@:				F_Neg			l_Ptr.q, l_Ptr.t
+@@dq:			F_Copy			l_Ptr.d, [ R12 ]					; n + 1, no carry (all ones is divisible by 3)
+				IncMem512		RCX
+				CALL			lsb_u
+				MOVZX			R14, AX								; s
+				LEA				RCX, l_Ptr.d
+				MOV				RDX, RCX
+				MOV				R8, R14
+				CALL			shr_u
+				LEA				RCX, l_Ptr.d
+				CALL			msb_u
+				MOVZX			R13, AX								; top bit of d
+
+; U, V, Q^k for k = d, bits of d from the top: k = 1, then 2k ( U = U V ), and 2k + 1 ( U = ( U + V ) / 2, V = ( D U + V ) / 2 )
+				F_Copy			l_Ptr.x, mont_ctx.one [ RBX ]		; U = 1
+				F_Copy			l_Ptr.v, mont_ctx.one [ RBX ]		; V = P = 1
+				F_Copy			l_Ptr.qk, l_Ptr.q
+@@ladder:		DEC				R13
+				JS				@@strongl
+				F_Mul			l_Ptr.x, l_Ptr.x, l_Ptr.v
+				Lucas_Dbl
+				MOV				RAX, R13							; bit set? word 7 - ( bit / 64 ), bit mod 64
+				SHR				RAX, 6
+				NEG				RAX
+				LEA				RDX, l_Ptr.d
+				MOV				RAX, Q_PTR [ RDX ] [ RAX * 8 + 7 * 8 ]
+				BT				RAX, R13
+				JNC				@@ladder
+				F_Copy			l_Ptr.t, l_Ptr.x
+				F_Add			l_Ptr.t, l_Ptr.v
+				F_Half			l_Ptr.t
+				F_Mul			l_Ptr.x, l_Ptr.x, l_Ptr.dd
+				F_Add			l_Ptr.x, l_Ptr.v
+				F_Half			l_Ptr.x
+				F_Copy			l_Ptr.v, l_Ptr.x
+				F_Copy			l_Ptr.x, l_Ptr.t
+				F_Mul			l_Ptr.qk, l_Ptr.qk, l_Ptr.q
+				JMP				@@ladder
+
+; strong Lucas: U_d = 0, or V_( d 2^r ) = 0 for some r < s
+@@strongl:		LEA				RCX, l_Ptr.x
+				TestZero512		RCX
+				JZ				@@prime
+@@vzero:		LEA				RCX, l_Ptr.v
+				TestZero512		RCX
+				JZ				@@prime
+				DEC				R14
+				JZ				@@composite
+				Lucas_Dbl
+				JMP				@@vzero
+
+@@prime:		MOV				EAX, retcode_one
+				JMP				@@exit
+@@composite:	XOR				EAX, EAX							; return zero
+@@exit:			Local_Exit		R15, R14, R13, R12, RDI, RSI, RBX
+is_probable_prime_u ENDP
+
+;--------------------------------------------------------------------------------------------------------------------------------------------------------------
+;			EXTERNDEF		gcd_u:PROC					; s16 gcd_u( u64* gcd, u64* a, u64* b );
+;			gcd_u			-	greatest common divisor
+;			Prototype:		-	s16 gcd_u( u64* gcd, u64* a, u64* b );
+;			gcd				-	Address of 8 QWORDS to store the result (in RCX)
+;			a				-	Address of 8 QWORDS (in RDX)
+;			b				-	Address of 8 QWORDS (in R8)
+;			returns			-	(0) for success ( gcd of zero and b is b ), (GP_Fault) for mis-aligned parameter address
+;
+;			Note: binary algorithm (Stein; Knuth, Vol. 2, 4.5.2 B), no division until y fits in one QWORD: common twos k set aside,
+;			x, y odd, strip twos from x, x = x - y ( swapped by address so x >= y ). Then x = x mod y by one divide chain, and the rest
+;			runs in registers. Result y * 2^k.
+;
+gcd_Locals		STRUCT
+x				QWORD			8 dup (?)
+y				QWORD			8 dup (?)
+gcd_Locals		ENDS
+
+				Proc_w_Local	gcd_u, gcd_Locals, R12, R13, RSI, RDI
+
+				CheckAlign		RCX, @@exit							; (out) gcd
+				CheckAlign		RDX, @@exit							; (in) a
+				CheckAlign		R8, @@exit							; (in) b
+
+				MOV				R12, RCX							; gcd
+				LEA				RSI, l_Ptr.x						; RSI -> x, starts as a
+				Copy512			RSI, RDX
+				LEA				RDI, l_Ptr.y						; RDI -> y, starts as b
+				Copy512			RDI, R8
+				XOR				R13D, R13D							; k, none yet ( gcd of zero and b skips to @@shift )
+				TestZero512		RDI									; gcd( a, 0 ) = a
+				JZ				@@xonly
+				TestZero512		RSI									; gcd( 0, b ) = b
+				JZ				@@yonly
+
+; k = min( twos of x, twos of y ); both made odd
+				MOV				RCX, RSI
+				CALL			lsb_u
+				MOVZX			R13, AX								; k
+				MOV				RCX, RSI
+				MOV				RDX, RSI
+				MOV				R8, R13
+				CALL			shr_u
+				MOV				RCX, RDI
+				CALL			lsb_u
+				MOVZX			R8, AX
+				CMP				R13, R8
+				CMOVA			R13, R8
+				MOV				RCX, RDI
+				MOV				RDX, RDI
+				CALL			shr_u
+
+; multi QWORD y, odd
+@@multi:		MOV				RAX, Q_PTR [ RDI ] [ 0 * 8 ]		; y fits in one QWORD?
+				FOR				idx, < 1, 2, 3, 4, 5, 6 >
+				OR				RAX, Q_PTR [ RDI ] [ idx * 8 ]
+				ENDM
+				JZ				@@single
+				TestZero512		RSI									; x = 0: gcd is y
+				JZ				@@yonly
+				MOV				RCX, RSI
+				CALL			lsb_u
+				MOVZX			R8, AX
+				TEST			R8, R8
+				JZ				@@odd
+				MOV				RCX, RSI
+				MOV				RDX, RSI
+				CALL			shr_u
+@@odd:			SubMem512		RSI, RDI							; x >= y: x = x - y
+				JNC				@@multi
+				AddMem512		RSI, RDI							; x < y: restore x, swap, x = x - y
+				XCHG			RSI, RDI
+				SubMem512		RSI, RDI
+				JMP				@@multi
+
+; single QWORD y (in R8): x = x mod y, then x (in RAX) and y in registers
+@@single:		MOV				R8, Q_PTR [ RDI ] [ 7 * 8 ]
+				XOR				EDX, EDX
+				FOR				idx, < 0, 1, 2, 3, 4, 5, 6, 7 >
+				MOV				RAX, Q_PTR [ RSI ] [ idx * 8 ]
+				DIV				R8
+				ENDM
+				MOV				RAX, RDX
+@@reg:			TEST			RAX, RAX
+				JZ				@@regdone
+				BSF				RCX, RAX
+				SHR				RAX, CL
+				CMP				RAX, R8
+				JAE				@F
+				XCHG			RAX, R8
+@@:				SUB				RAX, R8
+				JMP				@@reg
+@@regdone:		Zero512Q		R12
+				MOV				Q_PTR [ R12 ] [ 7 * 8 ], R8
+				JMP				@@shift
+
+@@yonly:		Copy512			R12, RDI
+@@shift:		TEST			R13, R13							; restore the common twos
+				JZ				@@ok
+				MOV				RCX, R12
+				MOV				RDX, R12
+				MOV				R8, R13
+				CALL			shl_u
+				JMP				@@ok
+@@xonly:		Copy512			R12, RSI
+@@ok:			XOR				EAX, EAX							; return zero
+@@exit:			Local_Exit		RDI, RSI, R13, R12
+gcd_u			ENDP
+
+;--------------------------------------------------------------------------------------------------------------------------------------------------------------
+;			x = x^2 + c mod n, in Montgomery form ( ( xR )^2 R^-1 + cR = ( x^2 + c ) R )
+;
+Rho_Step		MACRO			x:REQ
+				F_Mul			x, x, x
+				F_Add			x, l_Ptr.c
+				ENDM
+
+;--------------------------------------------------------------------------------------------------------------------------------------------------------------
+;			EXTERNDEF		factor_rho_u:PROC			; s16 factor_rho_u( u64* n, u64* factor );
+;			factor_rho_u	-	a proper factor of n, Pollard's rho with Brent's cycle detection
+;			Prototype:		-	s16 factor_rho_u( u64* n, u64* factor );
+;			n				-	Address of 8 QWORDS composite to split (in RCX)
+;			factor			-	Address of 8 QWORDS to store a factor f, 1 < f < n, not necessarily prime (in RDX)
+;			returns			-	(0) for a factor found, (1) for none found within the step limit, (-1) if n is below 4 or a probable prime,
+;								(GP_Fault) for mis-aligned parameter address
+;
+;			Note: x = x^2 + c, c = 1, 2, ... rho_polys, from x = 2, in Montgomery form (mont_mul_u). Brent: y runs r steps ahead of a
+;			saved x, r doubling, to r = rho_steps. The products q of ( x - y ) are accumulated over blocks of rho_block steps, and one
+;			gcd ( q, n ) taken per block: a gcd of n (more than one factor found in the block) is resolved by repeating the block
+;			from its start, a gcd per step. Expected steps are about sqrt( p ), p the least prime factor: to about 2^50.
+;			(Brent, "An improved Monte Carlo factorization algorithm", BIT 1980)
+;
+rho_block		EQU				100									; steps for each gcd
+rho_steps		EQU				1 SHL 26							; greatest cycle length r tried
+rho_polys		EQU				8									; c = 1 thru rho_polys
+
+rho_Locals		STRUCT
+ctx				mont_ctx		<>
+x				QWORD			8 dup (?)							; saved x
+y				QWORD			8 dup (?)							; running y
+ys				QWORD			8 dup (?)							; y at the start of the block
+q				QWORD			8 dup (?)							; product of ( x - y )
+c				QWORD			8 dup (?)
+t				QWORD			8 dup (?)
+g				QWORD			8 dup (?)							; gcd
+rho_Locals		ENDS
+
+				Proc_w_Local	factor_rho_u, rho_Locals, RBX, RSI, RDI, R12, R13, R14, R15
+
+				CheckAlign		RCX, @@exit							; (in) n
+				CheckAlign		RDX, @@exit							; (out) factor
+				MOV				R12, RCX							; n
+				MOV				R13, RDX							; factor
+
+; below 4, even, or prime
+				MOV				RDX, 4
+				CALL			compare_uT64
+				CMP				AX, 0
+				JL				@@none
+				TEST			B_PTR [ R12 ] [ 7 * 8 ], 1
+				JNZ				@F
+				Zero512Q		R13
+				MOV				Q_PTR [ R13 ] [ 7 * 8 ], 2
+				JMP				@@ok
+@@:				MOV				RCX, R12
+				XOR				EDX, EDX
+				CALL			is_probable_prime_u
+				CMP				AX, retcode_one
+				JE				@@none
+
+				LEA				RBX, l_Ptr.ctx
+				MOV				RCX, RBX
+				MOV				RDX, R12
+				CALL			mont_init_u
+				MOV				EDI, 1								; c
+@@poly:			F_Set			l_Ptr.c, RDI
+				F_Copy			l_Ptr.y, mont_ctx.one [ RBX ]		; y = 2
+				F_Dbl			l_Ptr.y
+				F_Copy			l_Ptr.q, mont_ctx.one [ RBX ]
+				MOV				R14D, 1								; r
+
+; x = y, y advanced r steps, then blocks of rho_block steps (at most r - k), accumulating q
+@@cycle:		F_Copy			l_Ptr.x, l_Ptr.y
+				MOV				RSI, R14
+@@advance:		Rho_Step		l_Ptr.y
+				DEC				RSI
+				JNZ				@@advance
+				XOR				R15D, R15D							; k
+@@block:		F_Copy			l_Ptr.ys, l_Ptr.y
+				MOV				RSI, R14
+				SUB				RSI, R15
+				MOV				EAX, rho_block
+				CMP				RSI, RAX
+				CMOVA			RSI, RAX
+@@step:			Rho_Step		l_Ptr.y
+				F_Copy			l_Ptr.t, l_Ptr.x
+				F_Sub			l_Ptr.t, l_Ptr.y
+				F_Mul			l_Ptr.q, l_Ptr.q, l_Ptr.t
+				DEC				RSI
+				JNZ				@@step
+				LEA				RCX, l_Ptr.g
+				LEA				RDX, l_Ptr.q
+				MOV				R8, R12
+				CALL			gcd_u
+				LEA				RCX, l_Ptr.g
+				TestOne512		RCX
+				JNZ				@@found
+				ADD				R15, rho_block
+				CMP				R15, R14
+				JB				@@block
+				SHL				R14, 1
+				CMP				R14, rho_steps
+				JBE				@@cycle
+				JMP				@@next
+
+; gcd above one: n itself, when all factors fell in the block: repeat the block from ys, a gcd each step
+@@found:		LEA				RCX, l_Ptr.g
+				TestEqual512	RCX, R12
+				JNE				@@factor
+@@back:			Rho_Step		l_Ptr.ys
+				F_Copy			l_Ptr.t, l_Ptr.x
+				F_Sub			l_Ptr.t, l_Ptr.ys
+				LEA				RCX, l_Ptr.g
+				LEA				RDX, l_Ptr.t
+				MOV				R8, R12
+				CALL			gcd_u
+				LEA				RCX, l_Ptr.g
+				TestOne512		RCX
+				JZ				@@back
+				LEA				RCX, l_Ptr.g
+				TestEqual512	RCX, R12
+				JNE				@@factor
+@@next:			INC				EDI									; x and y met mod n: next c
+				CMP				EDI, rho_polys
+				JBE				@@poly
+				MOV				EAX, retcode_one
+				JMP				@@exit
+
+@@factor:		LEA				RDX, l_Ptr.g
+				Copy512			R13, RDX
+@@ok:			XOR				EAX, EAX							; return zero
+				JMP				@@exit
+@@none:			MOV				EAX, retcode_neg_one
+@@exit:			Local_Exit		R15, R14, R13, R12, RDI, RSI, RBX
+factor_rho_u	ENDP
+
+;--------------------------------------------------------------------------------------------------------------------------------------------------------------
+;			EXTERNDEF		isqrt_u:PROC				; s16 isqrt_u( u64* root, u64* a );
+;			isqrt_u			-	integer square root, root = floor( sqrt( a ) )
+;			Prototype:		-	s16 isqrt_u( u64* root, u64* a );
+;			root			-	Address of 8 QWORDS to store the result (in RCX)
+;			a				-	Address of 8 QWORDS (in RDX)
+;			returns			-	(0) for success, (GP_Fault) for mis-aligned parameter address
+;
+;			Note: the leading bits top = a / 2^s, s even, below 2^63, give floor( sqrt( top ) ) + 2 by SQRTSD, and that times 2^( s / 2 )
+;			is above the root (by less than 2^-30 of it). Newton's method from above, x = ( x + a / x ) / 2 (floors) while that is less,
+;			ends exactly on the root: four or five divides for 512 bits. Below 2^63 all in registers.
+;
+isq_Locals		STRUCT
+x				QWORD			8 dup (?)
+t				QWORD			8 dup (?)
+r				QWORD			8 dup (?)							; remainder, not used
+isq_Locals		ENDS
+
+				Proc_w_Local	isqrt_u, isq_Locals, R12, R13, R14
+
+				CheckAlign		RCX, @@exit							; (out) root
+				CheckAlign		RDX, @@exit							; (in) a
+				MOV				R12, RCX							; root
+				MOV				R13, RDX							; a
+
+; s = msb - 62, rounded up to even, or zero
+				MOV				RCX, R13
+				CALL			msb_u
+				MOVSX			RCX, AX
+				TEST			RCX, RCX
+				JS				@@zero
+				XOR				R14D, R14D							; s
+				MOV				RAX, Q_PTR [ R13 ] [ 7 * 8 ]
+				SUB				RCX, 62
+				JBE				@@estimate
+				INC				RCX
+				AND				ECX, -2
+				MOV				R14, RCX
+				LEA				RCX, l_Ptr.t
+				MOV				RDX, R13
+				MOV				R8, R14
+				CALL			shr_u
+				MOV				RAX, l_Ptr.t [ 7 * 8 ]
+@@estimate:		CVTSI2SD		XMM0, RAX							; top
+				SQRTSD			XMM0, XMM0
+				CVTTSD2SI		RAX, XMM0
+				ADD				RAX, 2
+				TEST			R14, R14
+				JNZ				@@wide
+
+; a below 2^63: in registers
+				MOV				R8, Q_PTR [ R13 ] [ 7 * 8 ]
+				MOV				R9, RAX								; x
+@@reg:			MOV				RAX, R8
+				XOR				EDX, EDX
+				DIV				R9
+				ADD				RAX, R9
+				SHR				RAX, 1
+				CMP				RAX, R9
+				JAE				@@regdone
+				MOV				R9, RAX
+				JMP				@@reg
+@@regdone:		Zero512Q		R12
+				MOV				Q_PTR [ R12 ] [ 7 * 8 ], R9
+				JMP				@@ok
+
+; x = estimate * 2^( s / 2 ), then Newton with div_u
+@@wide:			LEA				RCX, l_Ptr.x
+				Zero512Q		RCX
+				MOV				Q_PTR [ RCX ] [ 7 * 8 ], RAX
+				MOV				RDX, RCX
+				MOV				R8, R14
+				SHR				R8, 1
+				CALL			shl_u
+@@newton:		LEA				RCX, l_Ptr.t						; t = a / x
+				LEA				RDX, l_Ptr.r
+				MOV				R8, R13
+				LEA				R9, l_Ptr.x
+				CALL			div_u
+				LEA				RCX, l_Ptr.t						; t = ( x + t ) / 2
+				LEA				RDX, l_Ptr.x
+				AddMem512		RCX, RDX
+				RcrMem512		RCX
+				LEA				RCX, l_Ptr.t
+				LEA				RDX, l_Ptr.x
+				CALL			compare_u
+				CMP				AX, 0
+				JGE				@@root
+				F_Copy			l_Ptr.x, l_Ptr.t
+				JMP				@@newton
+@@root:			LEA				RDX, l_Ptr.x
+				Copy512			R12, RDX
+				JMP				@@ok
+
+@@zero:			Zero512Q		R12
+@@ok:			XOR				EAX, EAX							; return zero
+@@exit:			Local_Exit		R14, R13, R12
+isqrt_u			ENDP
+
+;--------------------------------------------------------------------------------------------------------------------------------------------------------------
+;			EXTERNDEF		iroot_u:PROC				; s16 iroot_u( u64* root, u64* a, u64 k );
+;			iroot_u			-	integer k-th root, root = floor( a^( 1 / k ) )
+;			Prototype:		-	s16 iroot_u( u64* root, u64* a, u64 k );
+;			root			-	Address of 8 QWORDS to store the result (in RCX)
+;			a				-	Address of 8 QWORDS (in RDX)
+;			k				-	the root (in R8); two is isqrt_u
+;			returns			-	(0) for success, (-1) for k of zero, (GP_Fault) for mis-aligned parameter address
+;
+;			Note: log2( a ) from the msb and the 16 bits below it, ( msb + f + iroot_margin ) / k = i + g in 16.16 fixed point, is above
+;			the true log2 of the root ( log2( 1 + f ) - f < 0.0861 ); ( 1 + g ) 2^i is then above the root, by a few percent at most
+;			( 2^g <= 1 + g ). Newton's method from above, x = ( ( k - 1 ) x + a / x^( k - 1 ) ) / k (floors) while that is less, ends
+;			exactly on the root. The power x^( k - 1 ) stops early once it passes a (the quotient is then zero).
+;
+iroot_margin	EQU				5644								; 0.0861 * 2^16, and one for the truncated f
+
+irt_Locals		STRUCT
+x				QWORD			8 dup (?)
+t				QWORD			8 dup (?)
+p				QWORD			8 dup (?)							; x^( k - 1 ), then ( k - 1 ) x
+over			QWORD			8 dup (?)							; overflow, remainders
+irt_Locals		ENDS
+
+				Proc_w_Local	iroot_u, irt_Locals, R12, R13, R14, R15, RSI
+
+				CheckAlign		RCX, @@exit							; (out) root
+				CheckAlign		RDX, @@exit							; (in) a
+				MOV				R12, RCX							; root
+				MOV				R13, RDX							; a
+				MOV				R14, R8								; k
+				CMP				R14, 2
+				JA				@@general
+				JB				@@small
+				CALL			isqrt_u								; RCX, RDX as passed
+				JMP				@@exit
+@@small:		TEST			R14, R14
+				JZ				@@err
+				Copy512			R12, R13							; k = 1
+				JMP				@@ok
+
+; b = msb; k above b: the root is one
+@@general:		MOV				RCX, R13
+				CALL			msb_u
+				MOVSX			RSI, AX								; b
+				TEST			RSI, RSI
+				JS				@@zero
+				CMP				R14, RSI
+				JBE				@@fraction
+				Zero512Q		R12
+				MOV				Q_PTR [ R12 ] [ 7 * 8 ], 1
+				JMP				@@ok
+
+; f, the 16 bits below the msb
+@@fraction:		CMP				RSI, 16
+				JB				@F
+				LEA				RCX, l_Ptr.t
+				MOV				RDX, R13
+				LEA				R8, [ RSI - 16 ]
+				CALL			shr_u
+				MOV				RAX, l_Ptr.t [ 7 * 8 ]
+				JMP				@@log
+@@:				MOV				RAX, Q_PTR [ R13 ] [ 7 * 8 ]
+				MOV				ECX, 16
+				SUB				ECX, ESI
+				SHL				RAX, CL
+@@log:			MOVZX			EAX, AX								; f
+				MOV				RCX, RSI
+				SHL				RCX, 16
+				ADD				RAX, RCX
+				ADD				RAX, iroot_margin
+				XOR				EDX, EDX
+				DIV				R14
+				INC				RAX									; i + g, rounded up
+				MOV				RCX, RAX
+				SHR				RCX, 16								; i
+				MOVZX			EAX, AX
+				ADD				EAX, 10000h							; ( 1 + g ) 2^16
+				CMP				ECX, 16
+				JB				@F
+				LEA				RDX, l_Ptr.x						; x = ( 1 + g ) 2^i, at least 16
+				Zero512Q		RDX
+				MOV				Q_PTR [ RDX ] [ 7 * 8 ], RAX
+				SUB				ECX, 16
+				MOV				R8, RCX
+				MOV				RCX, RDX
+				CALL			shl_u
+				JMP				@@newton
+@@:				SHL				RAX, CL								; x = ( 1 + g ) 2^i, rounded up
+				ADD				RAX, 0FFFFh
+				SHR				RAX, 16
+				LEA				RDX, l_Ptr.x
+				Zero512Q		RDX
+				MOV				Q_PTR [ RDX ] [ 7 * 8 ], RAX
+
+; p = x^( k - 1 ), or a quotient of zero once p is above a
+@@newton:		LEA				RCX, l_Ptr.p
+				LEA				RDX, l_Ptr.x
+				Copy512			RCX, RDX
+				LEA				R15, [ R14 - 2 ]					; multiplies
+@@power:		TEST			R15, R15
+				JZ				@@divide
+				LEA				RCX, l_Ptr.p
+				MOV				RDX, R13
+				CALL			compare_u
+				CMP				AX, 0
+				JG				@@qzero
+				LEA				RCX, l_Ptr.p
+				LEA				RDX, l_Ptr.over
+				MOV				R8, RCX
+				LEA				R9, l_Ptr.x
+				CALL			mult_u
+				LEA				RCX, l_Ptr.over
+				TestZero512		RCX
+				JNZ				@@qzero
+				DEC				R15
+				JMP				@@power
+@@divide:		LEA				RCX, l_Ptr.t						; t = a / p
+				LEA				RDX, l_Ptr.over
+				MOV				R8, R13
+				LEA				R9, l_Ptr.p
+				CALL			div_u
+				JMP				@@sum
+@@qzero:		LEA				RCX, l_Ptr.t
+				Zero512Q		RCX
+
+; t = ( t + ( k - 1 ) x ) / k
+@@sum:			LEA				RCX, l_Ptr.p
+				LEA				RDX, l_Ptr.over
+				LEA				R8, l_Ptr.x
+				LEA				R9, [ R14 - 1 ]
+				CALL			mult_uT64
+				LEA				RCX, l_Ptr.t
+				LEA				RDX, l_Ptr.p
+				AddMem512		RCX, RDX
+				LEA				RCX, l_Ptr.t
+				LEA				RDX, l_Ptr.over
+				MOV				R8, RCX
+				MOV				R9, R14
+				CALL			div_uT64
+				LEA				RCX, l_Ptr.t
+				LEA				RDX, l_Ptr.x
+				CALL			compare_u
+				CMP				AX, 0
+				JGE				@@root
+				F_Copy			l_Ptr.x, l_Ptr.t
+				JMP				@@newton
+@@root:			LEA				RDX, l_Ptr.x
+				Copy512			R12, RDX
+				JMP				@@ok
+
+@@zero:			Zero512Q		R12
+@@ok:			XOR				EAX, EAX							; return zero
+				JMP				@@exit
+@@err:			MOV				EAX, retcode_neg_one
+@@exit:			Local_Exit		RSI, R15, R14, R13, R12
+iroot_u			ENDP
+
+;--------------------------------------------------------------------------------------------------------------------------------------------------------------
+;			EXTERNDEF		gen_prime_u:PROC			; s16 gen_prime_u( u64* out, u64 bits, random_fill random, void* context );
+;			gen_prime_u		-	random probable prime of exactly bits bits ( Baillie-PSW )
+;			Prototype:		-	s16 gen_prime_u( u64* out, u64 bits, random_fill random, void* context );
+;			out				-	Address of 8 QWORDS to store the prime (in RCX)
+;			bits			-	size of the prime, 2 to 512 (in RDX); the top bit is set
+;			random			-	Address of the caller's source of random bits (in R8): s16 random( u64* dest, u64 count, void* context ),
+;							fills count QWORDS at dest, returns zero, or non-zero for failure; called for ( bits + 63 ) / 64 QWORDS
+;							at each start. The prime is no harder to guess than those bits: for keys, use the system's CSPRNG
+;			context			-	passed through to random (in R9)
+;			returns			-	(0) for success, (-1) for bits out of range, random's non-zero return if it fails, (GP_Fault) for mis-aligned out
+;
+;			Note: a random odd start, then a window of candidates start + 2i, i below gp_window, sieved by the odd primes below 4096.
+;			Each prime keeps one residue, start mod p, found once (divide chain); a window strikes i = -( start mod p ) / 2 mod p, and
+;			every p after it, then the residue moves on by 2 gp_window mod p for the next window. Only survivors (about one in ten)
+;			get a strong test. A candidate past bits bits starts over. Below gp_small bits, random odd values are tested one at a time.
+;
+gp_window		EQU				2048								; candidates for each window
+gp_small		EQU				16
+
+gp_Locals		STRUCT
+start			QWORD			8 dup (?)
+cand			QWORD			8 dup (?)
+win				BYTE			gp_window dup (?)					; one for a candidate with a small factor
+res				WORD			prm_sieve dup (?)					; start of the window, mod p
+context			QWORD			?									; for random
+gp_Locals		ENDS
+
+				Proc_w_Local	gen_prime_u, gp_Locals, RBX, RSI, RDI, R12, R13, R14, R15
+
+				CheckAlign		RCX, @@exit							; (out) out
+				MOV				R12, RCX							; out
+				MOV				R13, RDX							; bits
+				MOV				R14, R8								; random
+				MOV				l_Ptr.context, R9
+				LEA				RAX, [ R13 - 2 ]
+				CMP				RAX, 512 - 2
+				JA				@@err
+
+; random odd start of bits bits: ( bits + 63 ) / 64 random QWORDS, the top one cut to bits, its top bit set
+@@random:		LEA				RDI, l_Ptr.start
+				Zero512Q		RDI
+				LEA				RDX, [ R13 + 63 ]
+				SHR				RDX, 6								; count
+				MOV				EBX, 8
+				SUB				RBX, RDX							; top QWORD index
+				LEA				RCX, [ RDI + RBX * 8 ]
+				MOV				R8, l_Ptr.context
+				CALL			R14
+				TEST			AX, AX
+				JNZ				@@exit								; random failed, its code returned
+				LEA				ECX, [ R13D - 1 ]
+				AND				ECX, 63								; top bit, in the top QWORD
+				MOV				EAX, 2
+				SHL				RAX, CL
+				DEC				RAX
+				AND				Q_PTR [ RDI + RBX * 8 ], RAX
+				BTS				Q_PTR [ RDI + RBX * 8 ], RCX
+				OR				B_PTR [ RDI ] [ 7 * 8 ], 1
+				CMP				R13, gp_small
+				JAE				@@residues
+				MOV				RCX, RDI							; small: test it, or another
+				XOR				EDX, EDX
+				CALL			is_probable_prime_u
+				CMP				AX, retcode_one
+				JNE				@@random
+				LEA				RDX, l_Ptr.start
+				Copy512			R12, RDX
+				JMP				@@ok
+
+; start mod p, for each sieving prime
+@@residues:		LEA				RSI, prm_small
+				XOR				EBX, EBX
+@@residue:		MOVZX			R8D, WORD PTR [ RSI + RBX * 2 ]
+				XOR				EDX, EDX
+				FOR				idx, < 0, 1, 2, 3, 4, 5, 6, 7 >
+				MOV				RAX, Q_PTR [ RDI ] [ idx * 8 ]
+				DIV				R8
+				ENDM
+				MOV				l_Ptr.res [ RBX * 2 ], DX
+				INC				RBX
+				CMP				RBX, prm_sieve
+				JB				@@residue
+				XOR				R15D, R15D							; windows done
+
+; window: strike i = ( p - r ) / 2, or ( 2p - r ) / 2, mod p, and each p after; then r = ( r + 2 gp_window ) mod p
+@@window:		LEA				RCX, l_Ptr.win
+				MOV				EDX, gp_window / 64
+@@clear:		Zero512			RCX
+				ADD				RCX, 64
+				DEC				EDX
+				JNZ				@@clear
+				XOR				EBX, EBX
+@@strike:		MOVZX			R8D, WORD PTR [ RSI + RBX * 2 ]		; p
+				MOVZX			EAX, l_Ptr.res [ RBX * 2 ]			; r
+				MOV				RCX, R8
+				SUB				RCX, RAX
+				TEST			ECX, 1
+				JZ				@F
+				ADD				RCX, R8
+@@:				SHR				RCX, 1
+				CMP				RCX, R8
+				JB				@F
+				SUB				RCX, R8
+@@:				LEA				RDX, l_Ptr.win
+@@multiple:		CMP				RCX, gp_window
+				JAE				@@move
+				MOV				B_PTR [ RDX + RCX ], 1
+				ADD				RCX, R8
+				JMP				@@multiple
+@@move:			ADD				EAX, 2 * gp_window
+				XOR				EDX, EDX
+				DIV				R8D
+				MOV				l_Ptr.res [ RBX * 2 ], DX
+				INC				RBX
+				CMP				RBX, prm_sieve
+				JB				@@strike
+
+; survivors: cand = start + 2 ( gp_window windows + i ), still bits bits, to the strong tests
+				XOR				EBX, EBX							; i
+@@survivor:		CMP				l_Ptr.win [ RBX ], 0
+				JNE				@@next
+				MOV				RAX, R15
+				IMUL			RAX, RAX, gp_window
+				ADD				RAX, RBX
+				ADD				RAX, RAX
+				LEA				RCX, l_Ptr.cand
+				LEA				RDX, l_Ptr.start
+				MOV				R8, RAX
+				CALL			add_uT64
+				TEST			AX, AX
+				JNZ				@@random
+				LEA				RCX, l_Ptr.cand
+				CALL			msb_u
+				MOVZX			EAX, AX
+				INC				EAX
+				CMP				RAX, R13
+				JNE				@@random
+				LEA				RCX, l_Ptr.cand
+				XOR				EDX, EDX
+				CALL			is_probable_prime_u
+				CMP				AX, retcode_one
+				JE				@@found
+@@next:			INC				RBX
+				CMP				RBX, gp_window
+				JB				@@survivor
+				INC				R15
+				JMP				@@window
+
+@@found:		LEA				RDX, l_Ptr.cand
+				Copy512			R12, RDX
+@@ok:			XOR				EAX, EAX							; return zero
+				JMP				@@exit
+@@err:			MOV				EAX, retcode_neg_one
+@@exit:			Local_Exit		R15, R14, R13, R12, RDI, RSI, RBX
+gen_prime_u		ENDP
+
+;--------------------------------------------------------------------------------------------------------------------------------------------------------------
+;			Batch gcd (Bernstein, "How to find smooth parts of integers", 2004; Heninger et al., "Mining your Ps and Qs", 2012):
+;			a product tree of the values, P at the root, then a remainder tree down it, P mod x^2 at each node x. At a leaf,
+;			( P mod x_i^2 ) / x_i = ( P / x_i ) mod x_i, and its gcd with x_i is the product of the factors x_i shares with the others.
+;
+;			The tree has m leaves, m the power of two at or above n, h = log2( m ) levels above them; past n the leaves are one.
+;			A node at level k holds 8 * 2^k QWORDS (the product of two below it fits exactly), a remainder twice that. Work area,
+;			in QWORDS, all numbers little-endian (least significant QWORD first):
+;				tree			8 m each level, h + 1 levels, level zero the values
+;				remainders		16 m, two of them, one level down from the other
+;				square			8 m, the node squared
+;				dividend		8 m + 8, normalized ( shifted so the divisor's top bit is set )
+;				quotient		8 m + 8
+;			8 m ( h + 8 ) + 16 in all, batch_gcd_size_u( n ). Nodes past the last value are not descended.
+;
+;			Products and squares are Karatsuba down to bg_kara QWORDS, schoolbook below ( Knuth, Vol. 2, 4.3.3 and 4.3.1 M ), the
+;			scratch for it in the dividend and quotient, free until the divide. The divide is schoolbook ( Knuth, 4.3.1 D ). At a
+;			level of nodes w QWORDS wide, each divide is a 4 w by 2 w QWORD remainder, 4 w^2 multiplies, 32 m w for the level,
+;			so the remainder tree costs about 128 m^2 QWORD multiplies in all: quadratic in n, if a much smaller constant than a gcd
+;			for each pair of values. A subquadratic divide ( Newton reciprocal, then multiplies ) is left out.
+;
+
+;--------------------------------------------------------------------------------------------------------------------------------------------------------------
+;			BG_Mul			-	wide multiply, d = a * b, little-endian QWORD arrays
+;			a				-	Address (in RSI), R8 QWORDS
+;			b				-	Address (in RDI), R9 QWORDS
+;			d				-	Address (in R10), R8 + R9 QWORDS, zeroed here
+;
+;			Note: internal to batch_gcd_u, not a public procedure. RAX, RBX, RCX, RDX, R8, R9, R11 thru R13 are used and not restored
+;			(batch_gcd_u saves the non-volatile ones once). Zero QWORDS at the top of a and b are passed over.
+;
+				ALIGN			16
+BG_Mul			PROC			PRIVATE
+				LEA				RCX, [ R8 + R9 ]
+				XOR				EAX, EAX
+@@:				MOV				Q_PTR [ R10 + RCX * 8 - 8 ], RAX
+				DEC				RCX
+				JNZ				@B
+@@:				CMP				Q_PTR [ RSI + R8 * 8 - 8 ], 0		; zero QWORDS at the top, out
+				JNE				@F
+				DEC				R8
+				JNZ				@B
+				RET
+@@:				CMP				Q_PTR [ RDI + R9 * 8 - 8 ], 0
+				JNE				@F
+				DEC				R9
+				JNZ				@B
+				RET
+@@:				XOR				R11D, R11D							; i, QWORD of b
+@@row:			MOV				RBX, Q_PTR [ RDI + R11 * 8 ]
+				TEST			RBX, RBX
+				JZ				@@next
+				LEA				R12, [ R10 + R11 * 8 ]				; d + i
+				XOR				ECX, ECX							; carry
+				XOR				R13D, R13D							; j, QWORD of a
+@@:				MOV				RAX, Q_PTR [ RSI + R13 * 8 ]
+				MUL				RBX
+				ADD				RAX, RCX
+				ADC				RDX, 0
+				ADD				RAX, Q_PTR [ R12 + R13 * 8 ]
+				ADC				RDX, 0
+				MOV				Q_PTR [ R12 + R13 * 8 ], RAX
+				MOV				RCX, RDX
+				INC				R13
+				CMP				R13, R8
+				JB				@B
+				MOV				Q_PTR [ R12 + R13 * 8 ], RCX
+@@next:			INC				R11
+				CMP				R11, R9
+				JB				@@row
+				RET
+BG_Mul			ENDP
+
+;--------------------------------------------------------------------------------------------------------------------------------------------------------------
+;			BG_Diff			-	r = | x0 - x1 |, x = x1 B^h + x0, B = 2^64, little-endian QWORD arrays
+;			x				-	Address (in RSI), 2 h QWORDS
+;			h				-	QWORDS (in RCX), not zero
+;			r				-	Address (in R10), h QWORDS
+;			returns			-	one if x0 < x1, otherwise zero (in RAX)
+;
+;			Note: internal to batch_gcd_u, not a public procedure. RDX, R9 and R11 are used; RCX, RSI and R10 are kept.
+;
+				ALIGN			16
+BG_Diff			PROC			PRIVATE
+				LEA				RDX, [ RSI + RCX * 8 ]				; x1
+				MOV				R9, RCX
+				XOR				R11D, R11D							; ( and carry clear )
+@@:				MOV				RAX, Q_PTR [ RSI + R11 * 8 ]
+				SBB				RAX, Q_PTR [ RDX + R11 * 8 ]
+				MOV				Q_PTR [ R10 + R11 * 8 ], RAX
+				LEA				R11, [ R11 + 1 ]
+				DEC				R9
+				JNZ				@B
+				SBB				EAX, EAX							; borrow out: x0 below x1
+				JZ				@@ret
+				MOV				R9, RCX								; negate, r = 0 - r
+				XOR				R11D, R11D							; ( and carry clear )
+@@:				MOV				RAX, 0								; ( carry kept )
+				SBB				RAX, Q_PTR [ R10 + R11 * 8 ]
+				MOV				Q_PTR [ R10 + R11 * 8 ], RAX
+				LEA				R11, [ R11 + 1 ]
+				DEC				R9
+				JNZ				@B
+				MOV				EAX, 1
+@@ret:			RET
+BG_Diff			ENDP
+
+;--------------------------------------------------------------------------------------------------------------------------------------------------------------
+;			BG_Kara			-	wide multiply by Karatsuba, d = a * b, little-endian QWORD arrays
+;			a				-	Address (in RSI), n QWORDS
+;			b				-	Address (in RDI), n QWORDS
+;			n				-	QWORDS (in R8), 8 times a power of two
+;			d				-	Address (in R10), 2 n QWORDS
+;			scratch			-	Address (in R14), 4 n QWORDS, kept
+;
+;			Note: internal to batch_gcd_u, not a public procedure. Below bg_kara QWORDS, BG_Mul. Otherwise, h = n / 2, a = a1 B^h + a0,
+;			b = b1 B^h + b0, and d = a1 b1 B^2h + ( a0 b0 + a1 b1 - ( a0 - a1 ) ( b0 - b1 ) ) B^h + a0 b0, three products of h QWORDS,
+;			not four. The differences are magnitudes in h QWORDS, and the sign of their product picks subtract or add. Recursive,
+;			so it has a frame, its arguments kept there; RAX, RBX, RCX, RDX, RSI, RDI, R8 thru R13 are used and not restored.
+;
+bg_kara			EQU				32									; QWORDS, at and above which BG_Kara splits
+
+bk_a			EQU				Q_PTR [ RSP ]
+bk_b			EQU				Q_PTR [ RSP + 8 ]
+bk_d			EQU				Q_PTR [ RSP + 16 ]
+bk_n			EQU				Q_PTR [ RSP + 24 ]
+bk_sign			EQU				Q_PTR [ RSP + 32 ]
+bk_s			EQU				Q_PTR [ RSP + 40 ]
+
+				ALIGN			16
+BG_Kara			PROC			PRIVATE FRAME
+				SUB				RSP, 38h							; arguments, and RSP aligned 16 for the calls
+				.ALLOCSTACK		38h
+				.ENDPROLOG
+				MOV				bk_a, RSI
+				MOV				bk_b, RDI
+				MOV				bk_d, R10
+				MOV				bk_n, R8
+				MOV				bk_s, R14
+				CMP				R8, bg_kara
+				JAE				@@split
+				MOV				R9, R8
+				CALL			BG_Mul
+				JMP				@@ret
+
+; a0 b0 into the low half of d, a1 b1 into the high half
+@@split:		SHR				R8, 1								; h
+				CALL			BG_Kara
+				MOV				R8, bk_n
+				SHR				R8, 1
+				MOV				RSI, bk_a
+				LEA				RSI, [ RSI + R8 * 8 ]				; a1
+				MOV				RDI, bk_b
+				LEA				RDI, [ RDI + R8 * 8 ]				; b1
+				MOV				RAX, bk_n
+				MOV				R10, bk_d
+				LEA				R10, [ R10 + RAX * 8 ]
+				MOV				R14, bk_s
+				CALL			BG_Kara
+
+; | a0 - a1 | and | b0 - b1 | at the bottom of scratch, t their product after them, then scratch for that
+				MOV				RCX, bk_n
+				SHR				RCX, 1
+				MOV				RSI, bk_a
+				MOV				R10, bk_s
+				CALL			BG_Diff
+				MOV				bk_sign, RAX
+				MOV				RSI, bk_b
+				LEA				R10, [ R10 + RCX * 8 ]
+				CALL			BG_Diff
+				XOR				bk_sign, RAX						; one: ( a0 - a1 ) ( b0 - b1 ) negative
+				MOV				R8, bk_n
+				SHR				R8, 1
+				MOV				RSI, bk_s
+				LEA				RDI, [ RSI + R8 * 8 ]
+				LEA				R10, [ RDI + R8 * 8 ]				; t
+				LEA				R14, [ R10 + R8 * 8 ]
+				LEA				R14, [ R14 + R8 * 8 ]
+				CALL			BG_Kara
+
+; middle, a0 b0 + a1 b1 over the differences ( done with ), then t off, or on for a negative product; carry out in RBX
+				MOV				RCX, bk_n
+				MOV				RSI, bk_d
+				LEA				RDX, [ RSI + RCX * 8 ]				; a1 b1
+				MOV				R10, bk_s
+				MOV				R9, RCX
+				XOR				R11D, R11D							; ( and carry clear )
+@@:				MOV				RAX, Q_PTR [ RSI + R11 * 8 ]
+				ADC				RAX, Q_PTR [ RDX + R11 * 8 ]
+				MOV				Q_PTR [ R10 + R11 * 8 ], RAX
+				LEA				R11, [ R11 + 1 ]
+				DEC				R9
+				JNZ				@B
+				SETC			BL
+				MOVZX			EBX, BL
+				LEA				RDX, [ R10 + RCX * 8 ]				; t
+				MOV				R9, RCX
+				XOR				R11D, R11D
+				CMP				bk_sign, 0							; ( and carry clear )
+				JNE				@@plus
+@@minus:		MOV				RAX, Q_PTR [ R10 + R11 * 8 ]
+				SBB				RAX, Q_PTR [ RDX + R11 * 8 ]
+				MOV				Q_PTR [ R10 + R11 * 8 ], RAX
+				LEA				R11, [ R11 + 1 ]
+				DEC				R9
+				JNZ				@@minus
+				SBB				RBX, 0								; a0 b1 + a1 b0, not negative
+				JMP				@@middle
+@@plus:			MOV				RAX, Q_PTR [ R10 + R11 * 8 ]
+				ADC				RAX, Q_PTR [ RDX + R11 * 8 ]
+				MOV				Q_PTR [ R10 + R11 * 8 ], RAX
+				LEA				R11, [ R11 + 1 ]
+				DEC				R9
+				JNZ				@@plus
+				ADC				RBX, 0
+
+; d from h, plus the middle, the carry on through the top; it ends within d, the product fits
+@@middle:		MOV				RSI, bk_d
+				MOV				RAX, RCX
+				SHR				RAX, 1
+				LEA				RSI, [ RSI + RAX * 8 ]				; d + h
+				MOV				R9, RCX
+				XOR				R11D, R11D							; ( and carry clear )
+@@:				MOV				RAX, Q_PTR [ R10 + R11 * 8 ]
+				ADC				Q_PTR [ RSI + R11 * 8 ], RAX
+				LEA				R11, [ R11 + 1 ]
+				DEC				R9
+				JNZ				@B
+				ADC				RBX, 0
+				LEA				RSI, [ RSI + RCX * 8 ]				; d + 3 h
+@@:				ADD				Q_PTR [ RSI ], RBX
+				JNC				@@ret
+				MOV				EBX, 1
+				ADD				RSI, 8
+				JMP				@B
+@@ret:			MOV				R14, bk_s
+				ADD				RSP, 38h
+				RET
+BG_Kara			ENDP
+
+;--------------------------------------------------------------------------------------------------------------------------------------------------------------
+;			BG_Mod			-	wide divide, r = u mod v and the quotient, little-endian QWORD arrays
+;			u				-	Address (in RSI), R8 QWORDS ( la )
+;			v				-	Address (in RDI), R9 QWORDS ( lb ), not zero; normalized in place, lost
+;			r				-	Address (in R10), lb QWORDS
+;			dividend		-	Address (in R12), la + 1 QWORDS, u normalized
+;			quotient		-	Address (in R13), la - lb + 1 QWORDS
+;
+;			Note: internal to batch_gcd_u, not a public procedure. All registers but RBP and RSP are used and not restored
+;			(batch_gcd_u saves the non-volatile ones once). Once normalized, the quotient address moves to RSI, r to R13,
+;			the shift to R8, and the place j is kept as the address of u [ j ] (in R11).
+;
+				ALIGN			16
+BG_Mod			PROC			PRIVATE
+				MOV				RCX, R9
+				XOR				EAX, EAX
+@@:				MOV				Q_PTR [ R10 + RCX * 8 - 8 ], RAX	; r zero
+				DEC				RCX
+				JNZ				@B
+@@:				CMP				Q_PTR [ RDI + R9 * 8 - 8 ], 0		; zero QWORDS at the top, out
+				JNE				@F
+				DEC				R9
+				JMP				@B
+@@:				TEST			R8, R8
+				JZ				@@ret								; u zero: r zero
+				CMP				Q_PTR [ RSI + R8 * 8 - 8 ], 0
+				JNE				@F
+				DEC				R8
+				JMP				@B
+@@:				CMP				R8, R9
+				JAE				@@norm
+@@:				MOV				RAX, Q_PTR [ RSI + R8 * 8 - 8 ]		; u shorter than v: r = u
+				MOV				Q_PTR [ R10 + R8 * 8 - 8 ], RAX
+				DEC				R8
+				JNZ				@B
+@@ret:			RET
+
+; normalize: v and u shifted left until the top bit of v is set; u one QWORD longer, in the dividend
+@@norm:			BSR				RCX, Q_PTR [ RDI + R9 * 8 - 8 ]
+				XOR				ECX, 63
+				MOV				R11, R9
+@@:				DEC				R11
+				JZ				@F
+				MOV				RAX, Q_PTR [ RDI + R11 * 8 ]
+				MOV				RDX, Q_PTR [ RDI + R11 * 8 - 8 ]
+				SHLD			RAX, RDX, CL
+				MOV				Q_PTR [ RDI + R11 * 8 ], RAX
+				JMP				@B
+@@:				SHL				Q_PTR [ RDI ], CL
+				MOV				RAX, Q_PTR [ RSI + R8 * 8 - 8 ]
+				XOR				EDX, EDX
+				SHLD			RDX, RAX, CL
+				MOV				Q_PTR [ R12 + R8 * 8 ], RDX
+				MOV				R11, R8
+@@:				DEC				R11
+				JZ				@F
+				MOV				RAX, Q_PTR [ RSI + R11 * 8 ]
+				MOV				RDX, Q_PTR [ RSI + R11 * 8 - 8 ]
+				SHLD			RAX, RDX, CL
+				MOV				Q_PTR [ R12 + R11 * 8 ], RAX
+				JMP				@B
+@@:				MOV				RAX, Q_PTR [ RSI ]
+				SHL				RAX, CL
+				MOV				Q_PTR [ R12 ], RAX
+				MOV				RSI, R13							; quotient
+				MOV				R13, R10							; r
+				MOV				R11, R8
+				SUB				R11, R9
+				LEA				R11, [ R12 + R11 * 8 ]				; u + j, j = la - lb: u [ j ] thru u [ j + lb ]
+				MOV				R8, RCX								; shift
+
+; a quotient QWORD for each place j, from la - lb down: qhat from the top two QWORDS of u over the top of v, corrected by the next
+				MOV				R14, Q_PTR [ RDI + R9 * 8 - 8 ]		; top of v
+				XOR				R15D, R15D
+				CMP				R9, 1
+				JE				@@digit
+				MOV				R15, Q_PTR [ RDI + R9 * 8 - 16 ]		; next of v
+@@digit:		MOV				RDX, Q_PTR [ R11 + R9 * 8 ]
+				MOV				RAX, Q_PTR [ R11 + R9 * 8 - 8 ]
+				CMP				RDX, R14
+				JB				@@div
+				MOV				RBX, -1								; qhat = 2^64 - 1, rhat = u [ j + lb - 1 ] + top of v
+				MOV				RCX, RAX
+				ADD				RCX, R14
+				JC				@@sub								; rhat past 2^64: qhat stands
+				JMP				@@test
+@@div:			DIV				R14
+				MOV				RBX, RAX							; qhat
+				MOV				RCX, RDX							; rhat
+@@test:			CMP				R9, 1
+				JE				@@sub
+				MOV				RAX, RBX							; qhat * next of v against rhat : u [ j + lb - 2 ]
+				MUL				R15
+				CMP				RDX, RCX
+				JB				@@sub
+				JA				@F
+				CMP				RAX, Q_PTR [ R11 + R9 * 8 - 16 ]
+				JBE				@@sub
+@@:				DEC				RBX
+				ADD				RCX, R14
+				JNC				@@test
+
+; u = u - qhat * v, from place j; borrow out: qhat one too many, add v back
+@@sub:			XOR				ECX, ECX							; carry, with the borrow of the subtract
+				XOR				R10D, R10D
+@@:				MOV				RAX, Q_PTR [ RDI + R10 * 8 ]
+				MUL				RBX
+				ADD				RAX, RCX
+				ADC				RDX, 0
+				SUB				Q_PTR [ R11 + R10 * 8 ], RAX
+				ADC				RDX, 0
+				MOV				RCX, RDX
+				INC				R10
+				CMP				R10, R9
+				JB				@B
+				SUB				Q_PTR [ R11 + R9 * 8 ], RCX
+				JNC				@@q
+				DEC				RBX
+				MOV				RCX, R9
+				XOR				R10D, R10D							; ( and carry clear )
+@@:				MOV				RAX, Q_PTR [ RDI + R10 * 8 ]
+				ADC				Q_PTR [ R11 + R10 * 8 ], RAX
+				LEA				R10, [ R10 + 1 ]
+				DEC				RCX
+				JNZ				@B
+				ADC				Q_PTR [ R11 + R9 * 8 ], 0
+@@q:			MOV				RAX, R11
+				SUB				RAX, R12							; j * 8
+				MOV				Q_PTR [ RSI + RAX ], RBX
+				SUB				R11, 8
+				CMP				R11, R12
+				JAE				@@digit
+
+; remainder, the low lb QWORDS of u, shifted back
+				MOV				RCX, R8
+				XOR				R11D, R11D
+@@:				LEA				RAX, [ R11 + 1 ]
+				CMP				RAX, R9
+				JAE				@F
+				MOV				RAX, Q_PTR [ R12 + R11 * 8 ]
+				MOV				RDX, Q_PTR [ R12 + R11 * 8 + 8 ]
+				SHRD			RAX, RDX, CL
+				MOV				Q_PTR [ R13 + R11 * 8 ], RAX
+				INC				R11
+				JMP				@B
+@@:				MOV				RAX, Q_PTR [ R12 + R11 * 8 ]
+				SHR				RAX, CL
+				MOV				Q_PTR [ R13 + R11 * 8 ], RAX
+				RET
+BG_Mod			ENDP
+
+;--------------------------------------------------------------------------------------------------------------------------------------------------------------
+;			EXTERNDEF		batch_gcd_size_u:PROC		; u64 batch_gcd_size_u( u64 n );
+;			batch_gcd_size_u -	QWORDS of work area for batch_gcd_u of n values
+;			Prototype:		-	u64 batch_gcd_size_u( u64 n );
+;			n				-	number of values (in RCX)
+;			returns			-	8 m ( h + 8 ) + 16, m the power of two at or above n, h its log2
+;
+				Leaf_Entry		batch_gcd_size_u
+				XOR				EDX, EDX							; h, zero for n of one ( or zero )
+				CMP				RCX, 1
+				JBE				@F
+				DEC				RCX
+				BSR				RDX, RCX
+				INC				EDX
+@@:				MOV				ECX, EDX
+				MOV				EAX, 8
+				SHL				RAX, CL								; 8 m
+				ADD				EDX, 8
+				IMUL			RAX, RDX
+				ADD				RAX, 16
+				RET
+batch_gcd_size_u ENDP
+
+;--------------------------------------------------------------------------------------------------------------------------------------------------------------
+;			EXTERNDEF		batch_gcd_u:PROC			; s16 batch_gcd_u( u64* results, u64* values, u64 n, u64* work );
+;			batch_gcd_u		-	gcd of each value with the product of all the others
+;			Prototype:		-	s16 batch_gcd_u( u64* results, u64* values, u64 n, u64* work );
+;			results			-	Address of n * 8 QWORDS to receive the gcds (in RCX); one where a value shares no factor
+;			values			-	Address of n * 8 QWORDS, the values, none zero (in RDX)
+;			n				-	number of values (in R8)
+;			work			-	Address of batch_gcd_size_u( n ) QWORDS of work area (in R9)
+;			returns			-	(0) for success, (-1) for n of zero or a zero value, (GP_Fault) for mis-aligned parameter address
+;
+;			Note: not quasi-linear. The products and squares are Karatsuba, but the remainder tree divides are schoolbook, about
+;			128 m^2 QWORD multiplies, m the power of two at or above n: 2 * 10^9 at 4096 values, 5 * 10^11 at 65536 ( work area
+;			100 MB ). Practical to a few tens of thousands of values; past that, batches of them, which miss factors shared across.
+;
+bg_Locals		STRUCT
+z				QWORD			8 dup (?)							; quotient at a leaf, for gcd_u
+res				QWORD			?
+val				QWORD			?
+n				QWORD			?
+lvl				QWORD			?									; 64 m, bytes in a level of the tree
+tree			QWORD			?
+rem				QWORD			?									; remainder buffers, one then the other
+sq				QWORD			?
+uu				QWORD			?
+qq				QWORD			?
+src				QWORD			?
+dst				QWORD			?
+lend			QWORD			?
+wd				QWORD			?									; QWORDS in a node
+tk				QWORD			?									; level of the tree
+par				QWORD			?									; parents: remainders, or the root
+pstride			QWORD			?
+pla				QWORD			?
+node			QWORD			?
+nodes			QWORD			?
+bg_Locals		ENDS
+
+				Proc_w_Local	batch_gcd_u, bg_Locals, RBX, RSI, RDI, R12, R13, R14, R15
+
+				CheckAlign		RCX, @@exit							; (out) results
+				CheckAlign		RDX, @@exit							; (in) values
+				CheckAlign		R9, @@exit							; (in) work
+				MOV				l_Ptr.res, RCX
+				MOV				l_Ptr.val, RDX
+				MOV				l_Ptr.n, R8
+				MOV				l_Ptr.tree, R9
+				TEST			R8, R8
+				JZ				@@err
+				MOV				RSI, RDX
+				MOV				RCX, R8
+@@:				TestZero512		RSI
+				JZ				@@err
+				ADD				RSI, 64
+				DEC				RCX
+				JNZ				@B
+				CMP				R8, 1								; one value: shares nothing
+				JNE				@F
+				MOV				RCX, l_Ptr.res
+				Zero512Q		RCX
+				MOV				Q_PTR [ RCX ] [ 7 * 8 ], 1
+				JMP				@@ok
+
+; h, 64 m, and the work area cut up
+@@:				LEA				RAX, [ R8 - 1 ]
+				BSR				RCX, RAX
+				INC				ECX									; h
+				MOV				EDX, 64
+				SHL				RDX, CL								; 64 m
+				MOV				l_Ptr.lvl, RDX
+				LEA				RAX, [ RCX + 1 ]
+				IMUL			RAX, RDX
+				ADD				RAX, R9
+				MOV				l_Ptr.rem, RAX
+				LEA				RAX, [ RAX + RDX * 4 ]				; two of 128 m
+				MOV				l_Ptr.sq, RAX
+				ADD				RAX, RDX
+				MOV				l_Ptr.uu, RAX
+				LEA				RAX, [ RAX + RDX + 64 ]
+				MOV				l_Ptr.qq, RAX
+
+; leaves: the values, little-endian, then ones
+				MOV				RDI, R9
+				MOV				RSI, l_Ptr.val
+				MOV				R11, l_Ptr.lvl
+				ADD				R11, R9								; the level above
+				XOR				EBX, EBX
+@@leaf:			Zero512Q		RDI
+				CMP				RBX, l_Ptr.n
+				JAE				@F
+				FOR				idx, < 0, 1, 2, 3, 4, 5, 6, 7 >
+				MOV				RAX, Q_PTR [ RSI ] [ idx * 8 ]
+				MOV				Q_PTR [ RDI ] [ ( 7 - idx ) * 8 ], RAX
+				ENDM
+				ADD				RSI, 64
+				JMP				@@leafnext
+@@:				MOV				Q_PTR [ RDI ], 1
+@@leafnext:		ADD				RDI, 64
+				INC				RBX
+				CMP				RDI, R11
+				JB				@@leaf
+
+; product tree: each pair of nodes at a level, into one at the next
+@@products:		MOV				RSI, l_Ptr.tree
+				MOV				R10, l_Ptr.lvl
+				ADD				R10, RSI
+				MOV				l_Ptr.lend, R10
+				MOV				R8D, 8
+@@product:		MOV				l_Ptr.src, RSI
+				MOV				l_Ptr.dst, R10
+				MOV				l_Ptr.wd, R8
+				LEA				RDI, [ RSI + R8 * 8 ]
+				MOV				R14, l_Ptr.uu						; scratch
+				CALL			BG_Kara
+				MOV				RAX, l_Ptr.wd
+				SHL				RAX, 4								; bytes in a pair
+				MOV				RSI, l_Ptr.src
+				MOV				R10, l_Ptr.dst
+				ADD				RSI, RAX
+				ADD				R10, RAX
+				MOV				R8, l_Ptr.wd
+				CMP				RSI, l_Ptr.lend
+				JB				@@product
+				SHL				R8, 1								; next level up; the root when its node fills the level
+				MOV				RAX, l_Ptr.lvl
+				SHR				RAX, 3
+				CMP				R8, RAX
+				JAE				@@descend
+				MOV				R10, l_Ptr.lvl
+				ADD				R10, RSI
+				MOV				l_Ptr.lend, R10
+				JMP				@@product
+
+; remainder tree: at each node the parent's remainder mod the node squared, from the level under the root down to the leaves
+@@descend:		MOV				RAX, RSI							; the root
+				MOV				l_Ptr.par, RAX
+				MOV				l_Ptr.pstride, 0
+				MOV				l_Ptr.pla, R8
+				SUB				RAX, l_Ptr.lvl
+				MOV				l_Ptr.tk, RAX
+				SHR				R8, 1
+				MOV				l_Ptr.wd, R8
+@@level:		MOV				RCX, l_Ptr.wd
+				SHR				RCX, 3								; leaves under a node
+				MOV				RAX, l_Ptr.n
+				LEA				RAX, [ RAX + RCX - 1 ]
+				XOR				EDX, EDX
+				DIV				RCX
+				MOV				l_Ptr.nodes, RAX					; those holding a value
+				MOV				l_Ptr.node, 0
+@@dnode:		MOV				RBX, l_Ptr.node
+				MOV				R8, l_Ptr.wd
+				MOV				RSI, RBX
+				IMUL			RSI, R8
+				SHL				RSI, 3
+				ADD				RSI, l_Ptr.tk						; T_k [ i ]
+				MOV				RDI, RSI
+				MOV				R10, l_Ptr.sq
+				MOV				R14, l_Ptr.uu						; scratch
+				CALL			BG_Kara								; square = T_k [ i ]^2
+				MOV				RBX, l_Ptr.node
+				MOV				RSI, RBX
+				SHR				RSI, 1
+				IMUL			RSI, l_Ptr.pstride
+				ADD				RSI, l_Ptr.par						; parent remainder
+				MOV				R8, l_Ptr.pla
+				MOV				RDI, l_Ptr.sq
+				MOV				R9, l_Ptr.wd
+				SHL				R9, 1
+				MOV				R10, RBX
+				IMUL			R10, R9
+				SHL				R10, 3
+				ADD				R10, l_Ptr.rem						; R_k [ i ]
+				MOV				R12, l_Ptr.uu
+				MOV				R13, l_Ptr.qq
+				CALL			BG_Mod
+				CMP				l_Ptr.wd, 8
+				JNE				@@dnext
+
+; leaf: z = R_0 [ i ] / x_i, result gcd( x_i, z )
+				MOV				RBX, l_Ptr.node
+				MOV				RSI, RBX
+				SHL				RSI, 6
+				ADD				RSI, l_Ptr.tk
+				MOV				RDI, l_Ptr.sq
+				Copy512Q		RDI, RSI
+				MOV				RCX, l_Ptr.qq
+				Zero512Q		RCX
+				ADD				RCX, 64
+				Zero512Q		RCX
+				MOV				RSI, RBX
+				SHL				RSI, 7
+				ADD				RSI, l_Ptr.rem
+				MOV				R8D, 16
+				MOV				R9D, 8
+				LEA				R10, l_Ptr.z						; remainder ( zero ) there, then the quotient
+				MOV				R12, l_Ptr.uu
+				MOV				R13, l_Ptr.qq
+				CALL			BG_Mod
+				MOV				RSI, l_Ptr.qq
+				FOR				idx, < 0, 1, 2, 3, 4, 5, 6, 7 >
+				MOV				RAX, Q_PTR [ RSI ] [ idx * 8 ]
+				MOV				l_Ptr.z [ ( 7 - idx ) * 8 ], RAX
+				ENDM
+				MOV				RAX, l_Ptr.node
+				SHL				RAX, 6
+				MOV				RCX, l_Ptr.res
+				ADD				RCX, RAX
+				MOV				RDX, l_Ptr.val
+				ADD				RDX, RAX
+				LEA				R8, l_Ptr.z
+				CALL			gcd_u
+
+@@dnext:		INC				l_Ptr.node
+				MOV				RAX, l_Ptr.node
+				CMP				RAX, l_Ptr.nodes
+				JB				@@dnode
+				MOV				R8, l_Ptr.wd						; down a level: these remainders are the parents
+				CMP				R8, 8
+				JE				@@ok
+				MOV				RAX, l_Ptr.rem
+				MOV				l_Ptr.par, RAX
+				LEA				RDX, [ R8 * 8 ]
+				SHL				RDX, 1
+				MOV				l_Ptr.pstride, RDX
+				SHL				R8, 1
+				MOV				l_Ptr.pla, R8
+				MOV				RDX, l_Ptr.lvl						; the other buffer
+				SHL				RDX, 1
+				MOV				RCX, l_Ptr.sq
+				SUB				RCX, RDX
+				CMP				RAX, RCX
+				JNE				@F
+				SUB				RAX, RDX
+				JMP				@@swap
+@@:				ADD				RAX, RDX
+@@swap:			MOV				l_Ptr.rem, RAX
+				MOV				RAX, l_Ptr.tk
+				SUB				RAX, l_Ptr.lvl
+				MOV				l_Ptr.tk, RAX
+				SHR				l_Ptr.wd, 1
+				JMP				@@level
+
+@@ok:			XOR				EAX, EAX							; return zero
+				JMP				@@exit
+@@err:			MOV				EAX, retcode_neg_one
+@@exit:			Local_Exit		R15, R14, R13, R12, RDI, RSI, RBX
+batch_gcd_u		ENDP
+
+ui512_prime		ENDS
+				END													; end of module
@@ -0,0 +1,496 @@
+;
+;			ui512_reduction
+;
+;--------------------------------------------------------------------------------------------------------------------------------------------------------------
+;
+;			File:			ui512_reduction.asm
+;			Author:			John G. Lynch
+;			Legal:			Copyright @2025, per MIT License below
+;			Date:			October 19, 2026
+;
+;			Reduction of a double-width product (as returned by mult_u) modulo the fixed, special-form primes of the commonly used curves.
+;			Each of these primes is a sum or difference of a few powers of two, so a product can be folded back below the prime with
+;			a handful of shifted adds and subtracts, with no division and no Montgomery form.
+;
+;				secp256k1		p = 2^256 - 2^32 - 977			fold high half times 2^32 + 977
+;				P-256			p = 2^256 - 2^224 + 2^192 + 2^96 - 1	NIST / Solinas 32 bit word sums (FIPS 186-4, D.2.3)
+;				P-384			p = 2^384 - 2^128 - 2^96 + 2^32 - 1	NIST / Solinas 32 bit word sums (FIPS 186-4, D.2.4)
+;				Curve25519		p = 2^255 - 19					fold high half times 38
+;				Ed448			p = 2^448 - 2^224 - 1			fold high 224 bit pieces (Goldilocks)
+;
+;			The product is presented as the two halves returned by mult_u: "product" (low 512 bits) and "overflow" (high 512 bits).
+;			The reduced result is left in the low order words of the 8 QWORD result, leading words zeroed.
+;			The result may be the same variable as the product (reduce in place).
+
+				INCLUDE			ui512_legalnotes.inc
+				INCLUDE			ui512_compile_time_options.inc
+				INCLUDE			ui512_macros.inc
+				INCLUDE			ui512_externs.inc
+.NOLISTIF
+				OPTION			CASEMAP:NONE
+
+;--------------------------------------------------------------------------------------------------------------------------------------------------------------
+;			The primes, as ui512 (big-endian by QWORD) variables, aligned 64 so they may be passed to any of the ui512 routines
+;
+ui512_reduction_data SEGMENT	READONLY ALIGN(64) 'CONST'
+
+				PUBLIC			prime_secp256k1
+				PUBLIC			prime_p256
+				PUBLIC			prime_p384
+				PUBLIC			prime_25519
+				PUBLIC			prime_448
+
+				ALIGN			64
+prime_secp256k1	QWORD			0, 0, 0, 0, 0FFFFFFFFFFFFFFFFh, 0FFFFFFFFFFFFFFFFh, 0FFFFFFFFFFFFFFFFh, 0FFFFFFFEFFFFFC2Fh
+				ALIGN			64
+prime_p256		QWORD			0, 0, 0, 0, 0FFFFFFFF00000001h, 0, 000000000FFFFFFFFh, 0FFFFFFFFFFFFFFFFh
+				ALIGN			64
+prime_p384		QWORD			0, 0, 0FFFFFFFFFFFFFFFFh, 0FFFFFFFFFFFFFFFFh, 0FFFFFFFFFFFFFFFFh, 0FFFFFFFFFFFFFFFEh, 0FFFFFFFF00000000h, 000000000FFFFFFFFh
+				ALIGN			64
+prime_25519		QWORD			0, 0, 0, 0, 07FFFFFFFFFFFFFFFh, 0FFFFFFFFFFFFFFFFh, 0FFFFFFFFFFFFFFFFh, 0FFFFFFFFFFFFFFEDh
+				ALIGN			64
+prime_448		QWORD			0, 0FFFFFFFFFFFFFFFFh, 0FFFFFFFFFFFFFFFFh, 0FFFFFFFFFFFFFFFFh, 0FFFFFFFEFFFFFFFFh, 0FFFFFFFFFFFFFFFFh, 0FFFFFFFFFFFFFFFFh, 0FFFFFFFFFFFFFFFFh
+
+ui512_reduction_data ENDS
+
+;--------------------------------------------------------------------------------------------------------------------------------------------------------------
+;			Helper macros for the Solinas style (32 bit word column) reductions
+;
+;			W32 ( idx )		-	address of the 32 bit word number idx (0 is least significant) of the 1024 bit product
+;								words 0 thru 15 are in the product (R10), words 16 thru 31 in the overflow (R11)
+;			ColSum			-	sum the listed words, subtract the listed words, plus signed carry in RAX; store low 32 bits as column "pos",
+;								leave the signed carry (arithmetic shift) in RAX for the next column
+;
+W32				MACRO			idx
+	IF idx LT 16
+				EXITM			<D_PTR [ R10 + ( ( 7 - ( idx / 2 ) ) * 8 ) + ( ( idx MOD 2 ) * 4 ) ]>
+	ELSE
+				EXITM			<D_PTR [ R11 + ( ( 7 - ( ( idx - 16 ) / 2 ) ) * 8 ) + ( ( ( idx - 16 ) MOD 2 ) * 4 ) ]>
+	ENDIF
+				ENDM
+
+ColSum			MACRO			pos, adds, subs
+				FOR				w, <adds>
+				MOV				EDX, W32(w)
+				ADD				RAX, RDX
+				ENDM
+	IFNB <subs>
+				FOR				w, <subs>
+				MOV				EDX, W32(w)
+				SUB				RAX, RDX
+				ENDM
+	ENDIF
+				MOV				l_Ptr.words [ pos * 4 ], EAX
+				SAR				RAX, 32
+				ENDM
+
+;			MulFold256		-	t (R13, R12, R9, R8 and carry word in RCX) = low 256 bits + high 256 bits * constant (in R11)
+;								used by both the secp256k1 (2^256 = 2^32 + 977) and the 25519 (2^256 = 38) reductions
+;								R10 holds address of product
+MulFold256		MACRO
+				MOV				RAX, Q_PTR [ R10 ] [ 3 * 8 ]
+				MUL				R11
+				ADD				RAX, Q_PTR [ R10 ] [ 7 * 8 ]
+				ADC				RDX, 0
+				MOV				R8, RAX
+				MOV				RCX, RDX
+				MOV				RAX, Q_PTR [ R10 ] [ 2 * 8 ]
+				MUL				R11
+				ADD				RAX, RCX
+				ADC				RDX, 0
+				ADD				RAX, Q_PTR [ R10 ] [ 6 * 8 ]
+				ADC				RDX, 0
+				MOV				R9, RAX
+				MOV				RCX, RDX
+				MOV				RAX, Q_PTR [ R10 ] [ 1 * 8 ]
+				MUL				R11
+				ADD				RAX, RCX
+				ADC				RDX, 0
+				ADD				RAX, Q_PTR [ R10 ] [ 5 * 8 ]
+				ADC				RDX, 0
+				MOV				R12, RAX
+				MOV				RCX, RDX
+				MOV				RAX, Q_PTR [ R10 ] [ 0 * 8 ]
+				MUL				R11
+				ADD				RAX, RCX
+				ADC				RDX, 0
+				ADD				RAX, Q_PTR [ R10 ] [ 4 * 8 ]
+				ADC				RDX, 0
+				MOV				R13, RAX
+				MOV				RCX, RDX
+				ENDM
+
+ui512_reduction	SEGMENT			PARA 'CODE'
+
+; Declare structure of local variables (will become part of stack-based frame) (thread-safe)
+reduce_Locals	STRUCT
+words			DWORD			16 dup (?)
+reduce_Locals	ENDS
+
+;--------------------------------------------------------------------------------------------------------------------------------------------------------------
+;			EXTERNDEF		reduce_secp256k1_u:PROC		; s16 reduce_secp256k1_u( u64* result, u64* product, u64* overflow );
+;			reduce_secp256k1_u	-	reduce 512 bit product modulo secp256k1 prime, p = 2^256 - 2^32 - 977
+;			Prototype:		-	s16 reduce_secp256k1_u( u64* result, u64* product, u64* overflow );
+;			result			-	Address of 8 QWORDS to store the reduced result (in RCX)
+;			product			-	Address of 8 QWORDS, low order half of the product (in RDX)
+;			overflow		-	Address of 8 QWORDS, high order half of the product (in R8) (not referenced, product of reduced operands fits in 512 bits)
+;			returns			-	(0) for success, (GP_Fault) for mis-aligned parameter address
+;
+;			Note: any 512 bit product is accepted; 2^256 = 2^32 + 977 (mod p), so t = low + high * (2^32 + 977) < 2^290,
+;			folded once more, then at most one subtract of p (done as add of 2^32 + 977 and carry out of 2^256)
+;
+				Proc_w_Local	reduce_secp256k1_u, reduce_Locals, R12, R13
+
+				CheckAlign		RCX, @@exit							; (out) Result
+				CheckAlign		RDX, @@exit							; (in) Product
+
+				MOV				R10, RDX							; product address, RDX gets used by MUL
+				MOV				R11, 1000003D1h						; 2^32 + 977
+				MulFold256											; R13:R12:R9:R8 = low + high * (2^32 + 977), carry word in RCX
+
+; fold carry word times (2^32 + 977) back in, a carry out of 2^256 here is worth another (2^32 + 977), it cannot carry again
+				MOV				RAX, RCX
+				MUL				R11
+				ADD				R8, RAX
+				ADC				R9, RDX
+				ADC				R12, 0
+				ADC				R13, 0
+				SBB				RAX, RAX							; carry out? RAX = all ones : zero
+				AND				RAX, R11
+				ADD				R8, RAX
+				ADC				R9, 0
+				ADC				R12, 0
+				ADC				R13, 0
+
+; final: t is less than 2^256, if t >= p, then t + 2^32 + 977 carries out of 2^256 and the low 256 bits of that sum is t - p
+				MOV				RAX, R8
+				MOV				RDX, R9
+				MOV				RCX, R12
+				MOV				R10, R13
+				ADD				RAX, R11
+				ADC				RDX, 0
+				ADC				RCX, 0
+				ADC				R10, 0
+				CMOVC			R8, RAX
+				CMOVC			R9, RDX
+				CMOVC			R12, RCX
+				CMOVC			R13, R10
+
+				MOV				RCX, RCXHome						; callers result
+				MOV				Q_PTR [ RCX ] [ 7 * 8 ], R8
+				MOV				Q_PTR [ RCX ] [ 6 * 8 ], R9
+				MOV				Q_PTR [ RCX ] [ 5 * 8 ], R12
+				MOV				Q_PTR [ RCX ] [ 4 * 8 ], R13
+				XOR				EAX, EAX
+				MOV				Q_PTR [ RCX ] [ 3 * 8 ], RAX
+				MOV				Q_PTR [ RCX ] [ 2 * 8 ], RAX
+				MOV				Q_PTR [ RCX ] [ 1 * 8 ], RAX
+				MOV				Q_PTR [ RCX ] [ 0 * 8 ], RAX		; return zero
+@@exit:			Local_Exit		R13, R12
+reduce_secp256k1_u	ENDP
+
+;--------------------------------------------------------------------------------------------------------------------------------------------------------------
+;			EXTERNDEF		reduce_p256_u:PROC			; s16 reduce_p256_u( u64* result, u64* product, u64* overflow );
+;			reduce_p256_u	-	reduce 512 bit product modulo NIST P-256 prime, p = 2^256 - 2^224 + 2^192 + 2^96 - 1
+;			Prototype:		-	s16 reduce_p256_u( u64* result, u64* product, u64* overflow );
+;			result			-	Address of 8 QWORDS to store the reduced result (in RCX)
+;			product			-	Address of 8 QWORDS, low order half of the product (in RDX)
+;			overflow		-	Address of 8 QWORDS, high order half of the product (in R8) (not referenced, product of reduced operands fits in 512 bits)
+;			returns			-	(0) for success, (GP_Fault) for mis-aligned parameter address
+;
+;			Note: Solinas reduction, the nine (s1 + 2 s2 + 2 s3 + s4 + s5 - s6 - s7 - s8 - s9) 256 bit terms of FIPS 186-4 D.2.3
+;			summed column by column (32 bit words), then a few adds or subtracts of p bring the result into 0 <= result < p
+;
+				Proc_w_Local	reduce_p256_u, reduce_Locals
+
+				CheckAlign		RCX, @@exit							; (out) Result
+				CheckAlign		RDX, @@exit							; (in) Product
+
+				MOV				R10, RDX							; product address (words 0 - 15)
+				XOR				EAX, EAX							; signed column carry
+				ColSum			0, <0, 8, 9>, <11, 12, 13, 14>
+				ColSum			1, <1, 9, 10>, <12, 13, 14, 15>
+				ColSum			2, <2, 10, 11>, <13, 14, 15>
+				ColSum			3, <3, 11, 11, 12, 12, 13>, <8, 9, 15>
+				ColSum			4, <4, 12, 12, 13, 13, 14>, <9, 10>
+				ColSum			5, <5, 13, 13, 14, 14, 15>, <10, 11>
+				ColSum			6, <6, 13, 14, 14, 14, 15, 15>, <8, 9>
+				ColSum			7, <7, 8, 15, 15, 15>, <10, 11, 12, 13>
+
+; columns, as four QWORDS, signed carry out of the top column stays in RAX
+				MOV				R8, Q_PTR l_Ptr.words [ 0 * 8 ]
+				MOV				R9, Q_PTR l_Ptr.words [ 1 * 8 ]
+				MOV				R10, Q_PTR l_Ptr.words [ 2 * 8 ]
+				MOV				R11, Q_PTR l_Ptr.words [ 3 * 8 ]
+
+; while negative, add p
+@@addp:			TEST			RAX, RAX
+				JNS				@@subp
+				ADD				R8, Q_PTR prime_p256 [ 7 * 8 ]
+				ADC				R9, Q_PTR prime_p256 [ 6 * 8 ]
+				ADC				R10, Q_PTR prime_p256 [ 5 * 8 ]
+				ADC				R11, Q_PTR prime_p256 [ 4 * 8 ]
+				ADC				RAX, 0
+				JMP				@@addp
+
+; subtract p until it goes negative, then add the last one back
+@@subp:			SUB				R8, Q_PTR prime_p256 [ 7 * 8 ]
+				SBB				R9, Q_PTR prime_p256 [ 6 * 8 ]
+				SBB				R10, Q_PTR prime_p256 [ 5 * 8 ]
+				SBB				R11, Q_PTR prime_p256 [ 4 * 8 ]
+				SBB				RAX, 0
+				JNS				@@subp
+				ADD				R8, Q_PTR prime_p256 [ 7 * 8 ]
+				ADC				R9, Q_PTR prime_p256 [ 6 * 8 ]
+				ADC				R10, Q_PTR prime_p256 [ 5 * 8 ]
+				ADC				R11, Q_PTR prime_p256 [ 4 * 8 ]
+
+				MOV				Q_PTR [ RCX ] [ 7 * 8 ], R8
+				MOV				Q_PTR [ RCX ] [ 6 * 8 ], R9
+				MOV				Q_PTR [ RCX ] [ 5 * 8 ], R10
+				MOV				Q_PTR [ RCX ] [ 4 * 8 ], R11
+				XOR				EAX, EAX
+				MOV				Q_PTR [ RCX ] [ 3 * 8 ], RAX
+				MOV				Q_PTR [ RCX ] [ 2 * 8 ], RAX
+				MOV				Q_PTR [ RCX ] [ 1 * 8 ], RAX
+				MOV				Q_PTR [ RCX ] [ 0 * 8 ], RAX		; return zero
+@@exit:			Local_Exit
+reduce_p256_u	ENDP
+
+;--------------------------------------------------------------------------------------------------------------------------------------------------------------
+;			EXTERNDEF		reduce_p384_u:PROC			; s16 reduce_p384_u( u64* result, u64* product, u64* overflow );
+;			reduce_p384_u	-	reduce 768 bit product modulo NIST P-384 prime, p = 2^384 - 2^128 - 2^96 + 2^32 - 1
+;			Prototype:		-	s16 reduce_p384_u( u64* result, u64* product, u64* overflow );
+;			result			-	Address of 8 QWORDS to store the reduced result (in RCX)
+;			product			-	Address of 8 QWORDS, low order half of the product (in RDX)
+;			overflow		-	Address of 8 QWORDS, high order half of the product (in R8) (only the low order 256 bits are referenced)
+;			returns			-	(0) for success, (GP_Fault) for mis-aligned parameter address
+;
+;			Note: Solinas reduction, the ten (s1 + 2 s2 + s3 + s4 + s5 + s6 + s7 - s8 - s9 - s10) 384 bit terms of FIPS 186-4 D.2.4
+;
+				Proc_w_Local	reduce_p384_u, reduce_Locals
+
+				CheckAlign		RCX, @@exit							; (out) Result
+				CheckAlign		RDX, @@exit							; (in) Product
+				CheckAlign		R8, @@exit							; (in) Overflow
+
+				MOV				R10, RDX							; product address (words 0 - 15)
+				MOV				R11, R8								; overflow address (words 16 - 23)
+				XOR				EAX, EAX							; signed column carry
+				ColSum			0, <0, 12, 20, 21>, <23>
+				ColSum			1, <1, 13, 22, 23>, <12, 20>
+				ColSum			2, <2, 14, 23>, <13, 21>
+				ColSum			3, <3, 12, 15, 20, 21>, <14, 22, 23>
+				ColSum			4, <4, 12, 13, 16, 20, 21, 21, 22>, <15, 23, 23>
+				ColSum			5, <5, 13, 14, 17, 21, 22, 22, 23>, <16>
+				ColSum			6, <6, 14, 15, 18, 22, 23, 23>, <17>
+				ColSum			7, <7, 15, 16, 19, 23>, <18>
+				ColSum			8, <8, 16, 17, 20>, <19>
+				ColSum			9, <9, 17, 18, 21>, <20>
+				ColSum			10, <10, 18, 19, 22>, <21>
+				ColSum			11, <11, 19, 20, 23>, <22>
+
+; columns, as six QWORDS, signed carry out of the top column stays in RAX
+				MOV				R8, Q_PTR l_Ptr.words [ 0 * 8 ]
+				MOV				R9, Q_PTR l_Ptr.words [ 1 * 8 ]
+				MOV				R10, Q_PTR l_Ptr.words [ 2 * 8 ]
+				MOV				R11, Q_PTR l_Ptr.words [ 3 * 8 ]
+				MOV				RDX, Q_PTR l_Ptr.words [ 4 * 8 ]
+				MOV				RCX, Q_PTR l_Ptr.words [ 5 * 8 ]
+
+; while negative, add p
+@@addp:			TEST			RAX, RAX
+				JNS				@@subp
+				ADD				R8, Q_PTR prime_p384 [ 7 * 8 ]
+				ADC				R9, Q_PTR prime_p384 [ 6 * 8 ]
+				ADC				R10, Q_PTR prime_p384 [ 5 * 8 ]
+				ADC				R11, Q_PTR prime_p384 [ 4 * 8 ]
+				ADC				RDX, Q_PTR prime_p384 [ 3 * 8 ]
+				ADC				RCX, Q_PTR prime_p384 [ 2 * 8 ]
+				ADC				RAX, 0
+				JMP				@@addp
+
+; subtract p until it goes negative, then add the last one back
+@@subp:			SUB				R8, Q_PTR prime_p384 [ 7 * 8 ]
+				SBB				R9, Q_PTR prime_p384 [ 6 * 8 ]
+				SBB				R10, Q_PTR prime_p384 [ 5 * 8 ]
+				SBB				R11, Q_PTR prime_p384 [ 4 * 8 ]
+				SBB				RDX, Q_PTR prime_p384 [ 3 * 8 ]
+				SBB				RCX, Q_PTR prime_p384 [ 2 * 8 ]
+				SBB				RAX, 0
+				JNS				@@subp
+				ADD				R8, Q_PTR prime_p384 [ 7 * 8 ]
+				ADC				R9, Q_PTR prime_p384 [ 6 * 8 ]
+				ADC				R10, Q_PTR prime_p384 [ 5 * 8 ]
+				ADC				R11, Q_PTR prime_p384 [ 4 * 8 ]
+				ADC				RDX, Q_PTR prime_p384 [ 3 * 8 ]
+				ADC				RCX, Q_PTR prime_p384 [ 2 * 8 ]
+
+				MOV				RAX, RCXHome						; callers result
+				MOV				Q_PTR [ RAX ] [ 7 * 8 ], R8
+				MOV				Q_PTR [ RAX ] [ 6 * 8 ], R9
+				MOV				Q_PTR [ RAX ] [ 5 * 8 ], R10
+				MOV				Q_PTR [ RAX ] [ 4 * 8 ], R11
+				MOV				Q_PTR [ RAX ] [ 3 * 8 ], RDX
+				MOV				Q_PTR [ RAX ] [ 2 * 8 ], RCX
+				XOR				ECX, ECX
+				MOV				Q_PTR [ RAX ] [ 1 * 8 ], RCX
+				MOV				Q_PTR [ RAX ] [ 0 * 8 ], RCX
+				XOR				EAX, EAX							; return zero
+@@exit:			Local_Exit
+reduce_p384_u	ENDP
+
+;--------------------------------------------------------------------------------------------------------------------------------------------------------------
+;			EXTERNDEF		reduce_25519_u:PROC			; s16 reduce_25519_u( u64* result, u64* product, u64* overflow );
+;			reduce_25519_u	-	reduce 512 bit product modulo Curve25519 prime, p = 2^255 - 19
+;			Prototype:		-	s16 reduce_25519_u( u64* result, u64* product, u64* overflow );
+;			result			-	Address of 8 QWORDS to store the reduced result (in RCX)
+;			product			-	Address of 8 QWORDS, low order half of the product (in RDX)
+;			overflow		-	Address of 8 QWORDS, high order half of the product (in R8) (not referenced, product of reduced operands fits in 512 bits)
+;			returns			-	(0) for success, (GP_Fault) for mis-aligned parameter address
+;
+;			Note: any 512 bit product is accepted; 2^256 = 38 (mod p), so t = low + high * 38, then the bits at and above 2^255 are
+;			folded in times 19, then at most one subtract of p (done as add of 19 and test of bit 255)
+;
+				Proc_w_Local	reduce_25519_u, reduce_Locals, R12, R13
+
+				CheckAlign		RCX, @@exit							; (out) Result
+				CheckAlign		RDX, @@exit							; (in) Product
+
+				MOV				R10, RDX							; product address, RDX gets used by MUL
+				MOV				R11D, 38							; 2 * 19
+				MulFold256											; R13:R12:R9:R8 = low + high * 38, carry word in RCX
+
+; q = t >> 255 (carry word * 2 plus top bit), clear top bit, add q * 19
+				MOV				RAX, R13
+				SHR				RAX, 63
+				LEA				RAX, [ RAX + RCX * 2 ]
+				BTR				R13, 63
+				IMUL			RAX, RAX, 19
+				ADD				R8, RAX
+				ADC				R9, 0
+				ADC				R12, 0
+				ADC				R13, 0
+
+; final: if t >= p, then t + 19 has bit 255 set, and with bit 255 cleared is t - p
+				MOV				RAX, R8
+				MOV				RDX, R9
+				MOV				RCX, R12
+				MOV				R10, R13
+				ADD				RAX, 19
+				ADC				RDX, 0
+				ADC				RCX, 0
+				ADC				R10, 0
+				BTR				R10, 63								; carry flag = bit 255 of t + 19
+				CMOVC			R8, RAX
+				CMOVC			R9, RDX
+				CMOVC			R12, RCX
+				CMOVC			R13, R10
+
+				MOV				RCX, RCXHome						; callers result
+				MOV				Q_PTR [ RCX ] [ 7 * 8 ], R8
+				MOV				Q_PTR [ RCX ] [ 6 * 8 ], R9
+				MOV				Q_PTR [ RCX ] [ 5 * 8 ], R12
+				MOV				Q_PTR [ RCX ] [ 4 * 8 ], R13
+				XOR				EAX, EAX
+				MOV				Q_PTR [ RCX ] [ 3 * 8 ], RAX
+				MOV				Q_PTR [ RCX ] [ 2 * 8 ], RAX
+				MOV				Q_PTR [ RCX ] [ 1 * 8 ], RAX
+				MOV				Q_PTR [ RCX ] [ 0 * 8 ], RAX		; return zero
+@@exit:			Local_Exit		R13, R12
+reduce_25519_u	ENDP
+
+;--------------------------------------------------------------------------------------------------------------------------------------------------------------
+;			EXTERNDEF		reduce_448_u:PROC			; s16 reduce_448_u( u64* result, u64* product, u64* overflow );
+;			reduce_448_u	-	reduce 896 bit product modulo Ed448 (Goldilocks) prime, p = 2^448 - 2^224 - 1
+;			Prototype:		-	s16 reduce_448_u( u64* result, u64* product, u64* overflow );
+;			result			-	Address of 8 QWORDS to store the reduced result (in RCX)
+;			product			-	Address of 8 QWORDS, low order half of the product (in RDX)
+;			overflow		-	Address of 8 QWORDS, high order half of the product (in R8) (only the low order 384 bits are referenced)
+;			returns			-	(0) for success, (GP_Fault) for mis-aligned parameter address
+;
+;			Note: with the product as 224 bit pieces x = a0 + a1 2^224 + a2 2^448 + a3 2^672, and 2^448 = 2^224 + 1 (mod p):
+;			x = (a0 + a2 + a3) + (a1 + a2 + 2 a3) 2^224 (mod p), summed by 32 bit column, then small carry folded, one subtract of p
+;
+				Proc_w_Local	reduce_448_u, reduce_Locals, R12, R13
+
+				CheckAlign		RCX, @@exit							; (out) Result
+				CheckAlign		RDX, @@exit							; (in) Product
+				CheckAlign		R8, @@exit							; (in) Overflow
+
+				MOV				R10, RDX							; product address (words 0 - 15)
+				MOV				R11, R8								; overflow address (words 16 - 27)
+				XOR				EAX, EAX							; column carry
+				ColSum			0, <0, 14, 21>
+				ColSum			1, <1, 15, 22>
+				ColSum			2, <2, 16, 23>
+				ColSum			3, <3, 17, 24>
+				ColSum			4, <4, 18, 25>
+				ColSum			5, <5, 19, 26>
+				ColSum			6, <6, 20, 27>
+				ColSum			7, <7, 14, 21, 21>
+				ColSum			8, <8, 15, 22, 22>
+				ColSum			9, <9, 16, 23, 23>
+				ColSum			10, <10, 17, 24, 24>
+				ColSum			11, <11, 18, 25, 25>
+				ColSum			12, <12, 19, 26, 26>
+				ColSum			13, <13, 20, 27, 27>
+
+; columns, as seven QWORDS, carry out of the top column (2^448 multiple) stays in RAX
+				MOV				R8, Q_PTR l_Ptr.words [ 0 * 8 ]
+				MOV				R9, Q_PTR l_Ptr.words [ 1 * 8 ]
+				MOV				R10, Q_PTR l_Ptr.words [ 2 * 8 ]
+				MOV				R11, Q_PTR l_Ptr.words [ 3 * 8 ]
+				MOV				RDX, Q_PTR l_Ptr.words [ 4 * 8 ]
+				MOV				R12, Q_PTR l_Ptr.words [ 5 * 8 ]
+				MOV				R13, Q_PTR l_Ptr.words [ 6 * 8 ]
+
+; fold: c * 2^448 = c * 2^224 + c, repeat until no carry out (at most twice)
+@@fold:			TEST			RAX, RAX
+				JZ				@@folded
+				MOV				RCX, RAX
+				SHL				RCX, 32								; c * 2^224 is c * 2^32 in the fourth QWORD
+				ADD				R8, RAX
+				ADC				R9, 0
+				ADC				R10, 0
+				ADC				R11, RCX
+				ADC				RDX, 0
+				ADC				R12, 0
+				ADC				R13, 0
+				MOV				EAX, 0
+				ADC				EAX, 0
+				JMP				@@fold
+
+; final: t < 2^448 < 2p; t >= p exactly when t + 2^224 + 1 carries out of 2^448, the low 448 bits are then t - p
+@@folded:		MOV				RCX, 100000000h
+				ADD				R8, 1
+				ADC				R9, 0
+				ADC				R10, 0
+				ADC				R11, RCX
+				ADC				RDX, 0
+				ADC				R12, 0
+				ADC				R13, 0
+				JC				@@store
+				SUB				R8, 1								; was less than p, take it back
+				SBB				R9, 0
+				SBB				R10, 0
+				SBB				R11, RCX
+				SBB				RDX, 0
+				SBB				R12, 0
+				SBB				R13, 0
+
+@@store:		MOV				RAX, RCXHome						; callers result
+				MOV				Q_PTR [ RAX ] [ 7 * 8 ], R8
+				MOV				Q_PTR [ RAX ] [ 6 * 8 ], R9
+				MOV				Q_PTR [ RAX ] [ 5 * 8 ], R10
+				MOV				Q_PTR [ RAX ] [ 4 * 8 ], R11
+				MOV				Q_PTR [ RAX ] [ 3 * 8 ], RDX
+				MOV				Q_PTR [ RAX ] [ 2 * 8 ], R12
+				MOV				Q_PTR [ RAX ] [ 1 * 8 ], R13
+				MOV				Q_PTR [ RAX ] [ 0 * 8 ], 0
+				XOR				EAX, EAX							; return zero
+@@exit:			Local_Exit		R13, R12
+reduce_448_u	ENDP
+
+ui512_reduction	ENDS
+				END													; end of module
@@ -0,0 +1,1312 @@
+;
+;			ui512_sieve
+;
+;--------------------------------------------------------------------------------------------------------------------------------------------------------------
+;
+;			File:			ui512_sieve.asm
+;			Author:			John G. Lynch
+;			Legal:			Copyright @2025, per MIT License below
+;			Date:			October 19, 2026
+;
+;			Sum of primes: a segmented Sieve of Eratosthenes, mod 30 wheel, for the "sum of primes up to 2^48" use case.
+;
+;			Wheel: each byte of a segment stands for 30 consecutive integers, one bit for each residue coprime to 30
+;			( 1, 7, 11, 13, 17, 19, 23, 29 ), so the sieve holds only the 8 / 30 of the integers that can be prime (above 5).
+;			A segment is sieve_seg_bytes ( 32 KB, the L1 data cache ) covering 983,040 integers.
+;
+;			Each sieving prime p = 30 a + r keeps its next multiple p m ( m coprime to 30 ) as a byte offset into the next segment,
+;			and the wheel position of m. Stepping m to the next wheel value moves the offset by a ( gap ) + a small correction, and
+;			the bit cleared depends only on r and the wheel position of m: two 64 entry tables, no division in the marking loop.
+;			A prime joins the sieve in the segment holding p^2 (or the first segment, if above that); its first multiple is found
+;			then, with one division.
+;
+;			Pre-sieve: a segment starts as the AND of periodic patterns for the primes 7 to 31 ( presieve_u, 64 bytes at a time ),
+;			so the marking loop runs only for primes from 37, and half the bits of a segment are clear before it starts.
+;
+;			Sieving primes (7 to sqrt( hi )) are found by the same sieve, seeded with those below 1024 by trial division.
+;			Primes found in a segment are summed in two registers ( 128 bits ), folded into the ui512 total once per segment.
+;
+;			Work memory is supplied by the caller (no allocation, thread-safe with separate work areas): the segment, then 16 bytes
+;			per sieving prime. sieve_work_size_u gives the size for a range.
+;
+;			Parallel sum: sum_primes_init_u cuts the range into chunks and deals them out to the workers; sum_primes_worker_u runs one
+;			worker (on the caller's thread, one call per thread), summing chunks, stealing chunks from the others when its own run out;
+;			sum_primes_combine_u adds the workers' partial sums. Each chunk finds its own sieving primes: at the default chunk
+;			( 1024 segments, about 10^9 integers ) that is under 2% more work for hi of 2^48.
+;			A running parallel sum can be stopped (workers return before their next chunk), saved with sum_primes_checkpoint_u, and
+;			resumed, in another process, with sum_primes_resume_u: the state is only the chunks left to each worker, and the partial sums.
+;
+;			Without sieving: sum_primes_lucy_u finds the sum of the primes below hi from sums over the 2 sqrt( hi ) distinct values of
+;			hi / k (Lucy_Hedgehog's method), O( hi^(3/4) ) time, O( sqrt( hi ) ) memory: seconds for hi of 2^40, minutes for 2^48.
+
+				INCLUDE			ui512_legalnotes.inc
+				INCLUDE			ui512_compile_time_options.inc
+				INCLUDE			ui512_macros.inc
+				INCLUDE			ui512_externs.inc
+.NOLISTIF
+				OPTION			CASEMAP:NONE
+
+sieve_seg_bytes	EQU				32768								; segment: bytes of 30 integers each
+sieve_seed_max	EQU				1024								; sieving primes below this by trial division
+sieve_hi_max	EQU				10000000000000h						; 2^52: limit on hi
+sieve_chunk_default EQU			30 * sieve_seg_bytes * 1024		; parallel sum: integers per chunk, 1024 segments
+sieve_presieved	EQU				8									; primes 7 to 31, by presieve_u patterns
+sieve_ckpt_magic EQU			6B63733231356975h					; checkpoint: "ui512sck"
+sieve_ckpt_version EQU			1
+
+;			Sieving prime, and where it is in the wheel, 16 bytes
+sv_prime		STRUCT
+off				DWORD			?									; byte offset of the next multiple, from the start of the next segment
+a				DWORD			?									; p div 30
+w				DWORD			?									; 8 * ( index of p mod 30 ) + index of m mod 30
+p				DWORD			?
+sv_prime		ENDS
+
+;			Range sieve context, in the caller's frame
+sv_ctx			STRUCT
+total			QWORD			8 dup (?)							; sum of primes found, ui512
+seg				QWORD			?									; address of the segment
+tbl				QWORD			?									; address of the sieving primes ( sv_prime )
+nprimes			QWORD			?									; sieving primes in the table
+nactive			QWORD			?									; of those, joined the sieve (a prefix of the table)
+lo				QWORD			?									; range: lo <= n < hi, lo at least 7
+hi				QWORD			?
+mode			QWORD			?									; 0: sum into total, 1: append to the sieving primes
+bb				QWORD			?									; first byte (integer / 30) of the segment
+eb				QWORD			?									; last byte of the range
+len				QWORD			?									; bytes in the segment
+left			QWORD			?									; candidates left by the pre-sieve
+pad				QWORD			12 dup (?)								; to 256 bytes
+sv_ctx			ENDS
+
+;--------------------------------------------------------------------------------------------------------------------------------------------------------------
+;			Wheel tables, i the index of p mod 30, j the index of m mod 30, both in the residues ( 1, 7, 11, 13, 17, 19, 23, 29 )
+;
+ui512_sieve_data SEGMENT		READONLY ALIGN(64) 'CONST'
+
+				ALIGN			64
+sv_residue		BYTE			1, 7, 11, 13, 17, 19, 23, 29
+sv_gap			BYTE			6, 4, 2, 4, 2, 4, 6, 2				; to the next residue, 29 to 31
+sv_next			BYTE			0, 0, 1, 1, 1, 1, 1, 1, 2, 2, 2, 2, 3, 3, 4, 4, 4, 4, 5, 5, 6, 6, 6, 6, 7, 7, 7, 7, 7, 7	; index of first residue >= x
+				BYTE			2 dup (0)
+;			bit value: 30 ( bit / 8 ) + residue ( bit mod 8 ), for a bit of a QWORD of the segment
+sv_bitval		BYTE			  1,   7,  11,  13,  17,  19,  23,  29,  31,  37,  41,  43,  47,  49,  53,  59
+				BYTE			 61,  67,  71,  73,  77,  79,  83,  89,  91,  97, 101, 103, 107, 109, 113, 119
+				BYTE			121, 127, 131, 133, 137, 139, 143, 149, 151, 157, 161, 163, 167, 169, 173, 179
+				BYTE			181, 187, 191, 193, 197, 199, 203, 209, 211, 217, 221, 223, 227, 229, 233, 239
+;			[ 8 i + j ]: mask clearing the bit of ( r_i r_j ) mod 30
+sv_clear		BYTE			0FEh, 0FDh, 0FBh, 0F7h, 0EFh, 0DFh, 0BFh, 07Fh
+				BYTE			0FDh, 0DFh, 0EFh, 0FEh, 07Fh, 0F7h, 0FBh, 0BFh
+				BYTE			0FBh, 0EFh, 0FEh, 0BFh, 0FDh, 07Fh, 0F7h, 0DFh
+				BYTE			0F7h, 0FEh, 0BFh, 0DFh, 0FBh, 0FDh, 07Fh, 0EFh
+				BYTE			0EFh, 07Fh, 0FDh, 0FBh, 0DFh, 0BFh, 0FEh, 0F7h
+				BYTE			0DFh, 0F7h, 07Fh, 0FDh, 0BFh, 0FEh, 0EFh, 0FBh
+				BYTE			0BFh, 0FBh, 0F7h, 07Fh, 0FEh, 0EFh, 0DFh, 0FDh
+				BYTE			07Fh, 0BFh, 0DFh, 0EFh, 0F7h, 0FBh, 0FDh, 0FEh
+;			[ 8 i + j ]: ( r_i r_j+1 ) div 30 - ( r_i r_j ) div 30, r_8 = 31
+sv_corr			BYTE			0, 0, 0, 0, 0, 0, 0, 1
+				BYTE			1, 1, 1, 0, 1, 1, 1, 1
+				BYTE			2, 2, 0, 2, 0, 2, 2, 1
+				BYTE			3, 1, 1, 2, 1, 1, 3, 1
+				BYTE			3, 3, 1, 2, 1, 3, 3, 1
+				BYTE			4, 2, 2, 2, 2, 2, 4, 1
+				BYTE			5, 3, 1, 4, 1, 3, 5, 1
+				BYTE			6, 4, 2, 4, 2, 4, 6, 1
+
+;			Pre-sieve patterns: bits of the integers with no factor in a pair of primes, repeating every product bytes, 64 more to read a block
+;			7 x 11: byte k ( 30 integers ) at [ k mod 77 ], 77 + 64 bytes
+sv_pre77		BYTE			0F9h, 0DFh, 0EFh, 07Eh, 0B6h, 0FBh, 03Dh, 0FDh, 0D7h, 0EFh, 05Eh, 0F3h, 0FBh, 0AFh, 0FDh, 09Eh
+				BYTE			0EFh, 07Ch, 0F7h, 0F3h, 0BFh, 0DDh, 0DBh, 0EFh, 06Eh, 0F7h, 0BAh, 0BFh, 07Dh, 0DFh, 0E7h, 07Eh
+				BYTE			0D7h, 0FBh, 0BFh, 0EDh, 0DFh, 0AEh, 07Eh, 075h, 0FBh, 0B7h, 0FDh, 0DFh, 0EBh, 07Eh, 0E7h, 0FBh
+				BYTE			0BEh, 0FDh, 05Dh, 0EFh, 076h, 0F7h, 0DBh, 0BBh, 0FDh, 0CFh, 0EFh, 03Eh, 0F7h, 079h, 0BFh, 0F5h
+				BYTE			0DFh, 0CFh, 07Ah, 0F7h, 0EBh, 0BFh, 0BCh, 0DFh, 06Dh, 07Eh, 0F7h, 0FBh, 09Fh, 0F9h, 0DFh, 0EFh
+				BYTE			07Eh, 0B6h, 0FBh, 03Dh, 0FDh, 0D7h, 0EFh, 05Eh, 0F3h, 0FBh, 0AFh, 0FDh, 09Eh, 0EFh, 07Ch, 0F7h
+				BYTE			0F3h, 0BFh, 0DDh, 0DBh, 0EFh, 06Eh, 0F7h, 0BAh, 0BFh, 07Dh, 0DFh, 0E7h, 07Eh, 0D7h, 0FBh, 0BFh
+				BYTE			0EDh, 0DFh, 0AEh, 07Eh, 075h, 0FBh, 0B7h, 0FDh, 0DFh, 0EBh, 07Eh, 0E7h, 0FBh, 0BEh, 0FDh, 05Dh
+				BYTE			0EFh, 076h, 0F7h, 0DBh, 0BBh, 0FDh, 0CFh, 0EFh, 03Eh, 0F7h, 079h, 0BFh, 0F5h
+;			13 x 17: byte k ( 30 integers ) at [ k mod 221 ], 221 + 64 bytes
+sv_pre221		BYTE			0E7h, 0FFh, 0FFh, 07Eh, 0BFh, 0DFh, 0FDh, 0FBh, 0FDh, 05Fh, 0BFh, 0FFh, 0EFh, 0F6h, 0FFh, 0FFh
+				BYTE			0F6h, 0AFh, 0DFh, 0FFh, 07Bh, 0FDh, 07Fh, 0FDh, 0FBh, 0EFh, 0D7h, 0BFh, 0FFh, 0FEh, 0BEh, 0DFh
+				BYTE			0FFh, 0F3h, 0EDh, 07Fh, 0FFh, 07Fh, 0EFh, 0F7h, 0FDh, 0FBh, 0FEh, 09Fh, 09Fh, 0FFh, 0FBh, 0FCh
+				BYTE			07Fh, 0FFh, 0F7h, 0EFh, 0F7h, 0FFh, 07Fh, 0FEh, 0BFh, 0DDh, 0FBh, 0FBh, 0DDh, 03Fh, 0FFh, 0FFh
+				BYTE			0EEh, 0F7h, 0FFh, 0F7h, 0EEh, 0BFh, 0DFh, 07Fh, 0FBh, 0FDh, 07Dh, 0FBh, 0FFh, 0CFh, 0B7h, 0FFh
+				BYTE			0FFh, 0FEh, 0BFh, 0DFh, 0F7h, 0EBh, 0FDh, 07Fh, 07Fh, 0FFh, 0EFh, 0F5h, 0FBh, 0FFh, 0DEh, 0BFh
+				BYTE			0DFh, 0FFh, 0FAh, 0FDh, 07Fh, 0F7h, 0EFh, 0EFh, 0F7h, 07Fh, 0FFh, 0FEh, 0BDh, 0DBh, 0FFh, 0DBh
+				BYTE			0BDh, 07Fh, 0FFh, 0FEh, 0EFh, 0F7h, 0F7h, 0EFh, 0FEh, 0BFh, 05Fh, 0FFh, 0FBh, 0FDh, 07Bh, 0FFh
+				BYTE			0DFh, 0AFh, 0F7h, 0FFh, 0FEh, 0FEh, 0BFh, 0D7h, 0EFh, 0FBh, 0FDh, 07Fh, 0FFh, 0FFh, 0EDh, 0F3h
+				BYTE			0FFh, 0DFh, 0BEh, 0BFh, 0DFh, 0FEh, 0FBh, 0FDh, 077h, 0EFh, 0FFh, 0EFh, 077h, 0FFh, 0FFh, 0FCh
+				BYTE			0BBh, 0DFh, 0DFh, 0BBh, 0FDh, 07Fh, 0FEh, 0FFh, 0EFh, 0F7h, 0EFh, 0FFh, 0FEh, 03Fh, 0DFh, 0FFh
+				BYTE			0F9h, 0F9h, 07Fh, 0DFh, 0BFh, 0EFh, 0F7h, 0FEh, 0FFh, 0FEh, 0B7h, 0CFh, 0FFh, 0FBh, 07Dh, 07Fh
+				BYTE			0FFh, 0FDh, 0EBh, 0F7h, 0DFh, 0BFh, 0FEh, 0BFh, 0DEh, 0FFh, 0FBh, 0F5h, 06Fh, 0FFh, 0FFh, 06Fh
+				BYTE			0F7h, 0FFh, 0FDh, 0FAh, 0BFh, 0DFh, 0BFh, 0FBh, 0FDh, 07Eh, 0FFh, 0FFh, 0E7h, 0E7h, 0FFh, 0FFh
+				BYTE			07Eh, 0BFh, 0DFh, 0FDh, 0FBh, 0FDh, 05Fh, 0BFh, 0FFh, 0EFh, 0F6h, 0FFh, 0FFh, 0F6h, 0AFh, 0DFh
+				BYTE			0FFh, 07Bh, 0FDh, 07Fh, 0FDh, 0FBh, 0EFh, 0D7h, 0BFh, 0FFh, 0FEh, 0BEh, 0DFh, 0FFh, 0F3h, 0EDh
+				BYTE			07Fh, 0FFh, 07Fh, 0EFh, 0F7h, 0FDh, 0FBh, 0FEh, 09Fh, 09Fh, 0FFh, 0FBh, 0FCh, 07Fh, 0FFh, 0F7h
+				BYTE			0EFh, 0F7h, 0FFh, 07Fh, 0FEh, 0BFh, 0DDh, 0FBh, 0FBh, 0DDh, 03Fh, 0FFh, 0FFh
+;			19 x 23: byte k ( 30 integers ) at [ k mod 437 ], 437 + 64 bytes
+sv_pre437		BYTE			09Fh, 0FFh, 0FFh, 0FFh, 0F7h, 0FBh, 07Fh, 0FFh, 0F5h, 07Fh, 0BFh, 0FFh, 0FEh, 0FEh, 0EFh, 0FFh
+				BYTE			0FFh, 0DFh, 0FBh, 0DFh, 0FFh, 0FFh, 0FDh, 0B7h, 0FFh, 07Fh, 0FFh, 0FDh, 0FBh, 0BFh, 0FFh, 0F6h
+				BYTE			07Fh, 0EFh, 0FFh, 0FFh, 0FEh, 0EBh, 0DFh, 0FFh, 0DFh, 0FFh, 0F7h, 0FFh, 07Fh, 0FDh, 0BDh, 0FFh
+				BYTE			0BFh, 0FFh, 0FEh, 0FBh, 0EFh, 0FFh, 0F7h, 07Fh, 0FBh, 0DFh, 0FFh, 0FEh, 0EFh, 0F7h, 0FFh, 05Fh
+				BYTE			0FFh, 0FDh, 0FFh, 0BFh, 0FDh, 0BEh, 0FFh, 0EFh, 0FFh, 0FFh, 0FBh, 0FBh, 0DFh, 0F7h, 07Fh, 0FFh
+				BYTE			0F7h, 0FFh, 07Eh, 0EFh, 0FDh, 0FFh, 09Fh, 0FFh, 0FEh, 0FFh, 0EFh, 0FDh, 0BFh, 0FFh, 0FBh, 0DFh
+				BYTE			0FFh, 0FBh, 0FFh, 0F7h, 0F7h, 07Fh, 0FFh, 0FDh, 0FFh, 0BEh, 0EFh, 0FEh, 0FFh, 0CFh, 0FFh, 0FFh
+				BYTE			0FFh, 0FBh, 0DDh, 0BFh, 0FFh, 0FFh, 0F7h, 0FFh, 07Bh, 0FFh, 0FDh, 0F7h, 03Fh, 0FFh, 0FEh, 0FFh
+				BYTE			0EEh, 0EFh, 0FFh, 0FFh, 0DBh, 0DFh, 0FFh, 0FFh, 0FFh, 0F5h, 0BFh, 07Fh, 0FFh, 0FDh, 0FFh, 0BBh
+				BYTE			0FFh, 0FEh, 0F7h, 06Fh, 0FFh, 0FFh, 0FFh, 0FAh, 0CFh, 0FFh, 0FFh, 0DFh, 0F7h, 0FFh, 07Fh, 0FFh
+				BYTE			0FDh, 0BFh, 0BFh, 0FFh, 0FEh, 0FFh, 0EBh, 0FFh, 0FFh, 0F7h, 07Bh, 0DFh, 0FFh, 0FFh, 0FEh, 0E7h
+				BYTE			0FFh, 07Fh, 0DFh, 0FDh, 0FFh, 0BFh, 0FFh, 0FCh, 0BFh, 0EFh, 0FFh, 0FFh, 0FFh, 0FBh, 0DFh, 0FFh
+				BYTE			0F7h, 07Fh, 0F7h, 0FFh, 07Fh, 0FEh, 0EDh, 0FFh, 0BFh, 0DFh, 0FEh, 0FFh, 0EFh, 0FFh, 0FDh, 0BFh
+				BYTE			0FBh, 0DFh, 0FFh, 0FFh, 0FBh, 0F7h, 0FFh, 077h, 07Fh, 0FDh, 0FFh, 0BFh, 0FEh, 0EEh, 0FFh, 0EFh
+				BYTE			0DFh, 0FFh, 0FFh, 0FBh, 0DFh, 0FDh, 0BFh, 0FFh, 0F7h, 0FFh, 07Fh, 0FBh, 0FDh, 0FFh, 0B7h, 07Fh
+				BYTE			0FEh, 0FFh, 0EFh, 0FEh, 0EFh, 0FFh, 0FBh, 0DFh, 0FFh, 0FFh, 0FFh, 0F7h, 0FDh, 03Fh, 0FFh, 0FDh
+				BYTE			0FFh, 0BFh, 0FBh, 0FEh, 0FFh, 0E7h, 07Fh, 0FFh, 0FFh, 0FBh, 0DEh, 0EFh, 0FFh, 0FFh, 0D7h, 0FFh
+				BYTE			07Fh, 0FFh, 0FDh, 0FDh, 0BFh, 0FFh, 0FEh, 0FFh, 0EFh, 0FBh, 0FFh, 0FFh, 0F3h, 05Fh, 0FFh, 0FFh
+				BYTE			0FFh, 0F6h, 0EFh, 07Fh, 0FFh, 0DDh, 0FFh, 0BFh, 0FFh, 0FEh, 0FDh, 0AFh, 0FFh, 0FFh, 0FFh, 0FBh
+				BYTE			0DBh, 0FFh, 0FFh, 0F7h, 077h, 0FFh, 07Fh, 0FFh, 0FCh, 0EFh, 0BFh, 0FFh, 0DEh, 0FFh, 0EFh, 0FFh
+				BYTE			0FFh, 0FDh, 0BBh, 0DFh, 0FFh, 0FFh, 0FFh, 0F3h, 0FFh, 07Fh, 0F7h, 07Dh, 0FFh, 0BFh, 0FFh, 0FEh
+				BYTE			0EFh, 0EFh, 0FFh, 0DFh, 0FFh, 0FBh, 0DFh, 0FFh, 0FDh, 0BFh, 0F7h, 0FFh, 07Fh, 0FFh, 0F9h, 0FFh
+				BYTE			0BFh, 0F7h, 07Eh, 0FFh, 0EFh, 0FFh, 0FEh, 0EFh, 0FBh, 0DFh, 0DFh, 0FFh, 0FFh, 0F7h, 0FFh, 07Dh
+				BYTE			0BFh, 0FDh, 0FFh, 0BFh, 0FFh, 0FAh, 0FFh, 0EFh, 0F7h, 07Fh, 0FFh, 0FBh, 0DFh, 0FEh, 0EFh, 0FFh
+				BYTE			0F7h, 0DFh, 07Fh, 0FFh, 0FDh, 0FFh, 0BDh, 0BFh, 0FEh, 0FFh, 0EFh, 0FFh, 0FBh, 0FFh, 0FBh, 0D7h
+				BYTE			07Fh, 0FFh, 0FFh, 0F7h, 0FEh, 06Fh, 0FFh, 0FDh, 0DFh, 0BFh, 0FFh, 0FEh, 0FFh, 0EDh, 0BFh, 0FFh
+				BYTE			0FFh, 0FBh, 0DFh, 0FBh, 0FFh, 0FFh, 0F7h, 07Fh, 07Fh, 0FFh, 0FDh, 0FEh, 0AFh, 0FFh, 0FEh, 0DFh
+				BYTE			0EFh, 0FFh, 0FFh, 0FFh, 0F9h, 09Fh, 0FFh, 0FFh, 0FFh, 0F7h, 0FBh, 07Fh, 0FFh, 0F5h, 07Fh, 0BFh
+				BYTE			0FFh, 0FEh, 0FEh, 0EFh, 0FFh, 0FFh, 0DFh, 0FBh, 0DFh, 0FFh, 0FFh, 0FDh, 0B7h, 0FFh, 07Fh, 0FFh
+				BYTE			0FDh, 0FBh, 0BFh, 0FFh, 0F6h, 07Fh, 0EFh, 0FFh, 0FFh, 0FEh, 0EBh, 0DFh, 0FFh, 0DFh, 0FFh, 0F7h
+				BYTE			0FFh, 07Fh, 0FDh, 0BDh, 0FFh, 0BFh, 0FFh, 0FEh, 0FBh, 0EFh, 0FFh, 0F7h, 07Fh, 0FBh, 0DFh, 0FFh
+				BYTE			0FEh, 0EFh, 0F7h, 0FFh, 05Fh
+;			29 x 31: byte k ( 30 integers ) at [ k mod 899 ], 899 + 64 bytes
+sv_pre899		BYTE			07Fh, 0FEh, 0FFh, 0FFh, 0FFh, 0FFh, 0BFh, 0FDh, 0FFh, 0FFh, 0DFh, 0FBh, 0EFh, 0F7h, 0FFh, 0FFh
+				BYTE			0F7h, 0EFh, 0FBh, 0DFh, 0FFh, 0FFh, 0FDh, 0BFh, 0FFh, 0FFh, 0FFh, 0FFh, 0FEh, 07Fh, 0FFh, 0FFh
+				BYTE			0FEh, 0FFh, 0FFh, 0BFh, 0FFh, 0FFh, 0FDh, 0DFh, 0FFh, 0EFh, 0FBh, 0FFh, 0F7h, 0F7h, 0FFh, 0FBh
+				BYTE			0EFh, 0FFh, 0DFh, 0FDh, 0FFh, 0FFh, 0BFh, 0FFh, 0FFh, 0FEh, 07Fh, 0FFh, 07Fh, 0FFh, 0FFh, 0FEh
+				BYTE			0BFh, 0FFh, 0FFh, 0FFh, 0DFh, 0FDh, 0EFh, 0FFh, 0FFh, 0FBh, 0F7h, 0F7h, 0FBh, 0FFh, 0FFh, 0EFh
+				BYTE			0FDh, 0DFh, 0FFh, 0FFh, 0FFh, 0BFh, 0FEh, 07Fh, 0FFh, 0FFh, 0FFh, 07Fh, 0FFh, 0BFh, 0FEh, 0FFh
+				BYTE			0FFh, 0DFh, 0FFh, 0EFh, 0FDh, 0FFh, 0FFh, 0F7h, 0FBh, 0FBh, 0F7h, 0FFh, 0FFh, 0FDh, 0EFh, 0FFh
+				BYTE			0DFh, 0FFh, 0FFh, 0FEh, 03Fh, 0FFh, 0FFh, 0FFh, 0FFh, 0FFh, 03Fh, 0FFh, 0FFh, 0FEh, 0DFh, 0FFh
+				BYTE			0EFh, 0FFh, 0FFh, 0FDh, 0F7h, 0FFh, 0FBh, 0FBh, 0FFh, 0F7h, 0FDh, 0FFh, 0FFh, 0EFh, 0FFh, 0DFh
+				BYTE			0FEh, 07Fh, 0FFh, 0BFh, 0FFh, 0FFh, 0FFh, 0BFh, 0FFh, 07Fh, 0FFh, 0DFh, 0FEh, 0EFh, 0FFh, 0FFh
+				BYTE			0FFh, 0F7h, 0FDh, 0FBh, 0FFh, 0FFh, 0FBh, 0FDh, 0F7h, 0FFh, 0FFh, 0FFh, 0EFh, 0FEh, 05Fh, 0FFh
+				BYTE			0FFh, 0FFh, 0BFh, 0FFh, 0BFh, 0FFh, 0FFh, 0FFh, 05Fh, 0FFh, 0EFh, 0FEh, 0FFh, 0FFh, 0F7h, 0FFh
+				BYTE			0FBh, 0FDh, 0FFh, 0FFh, 0FDh, 0FBh, 0FFh, 0F7h, 0FFh, 0FFh, 0FEh, 06Fh, 0FFh, 0DFh, 0FFh, 0FFh
+				BYTE			0FFh, 0BFh, 0FFh, 0FFh, 0FFh, 0DFh, 0FFh, 06Fh, 0FFh, 0FFh, 0FEh, 0F7h, 0FFh, 0FBh, 0FFh, 0FFh
+				BYTE			0FDh, 0FDh, 0FFh, 0FFh, 0FBh, 0FFh, 0F7h, 0FEh, 07Fh, 0FFh, 0EFh, 0FFh, 0DFh, 0FFh, 0BFh, 0FFh
+				BYTE			0BFh, 0FFh, 0DFh, 0FFh, 0EFh, 0FFh, 07Fh, 0FFh, 0F7h, 0FEh, 0FBh, 0FFh, 0FFh, 0FFh, 0FDh, 0FDh
+				BYTE			0FFh, 0FFh, 0FFh, 0FBh, 0FEh, 077h, 0FFh, 0FFh, 0FFh, 0EFh, 0FFh, 09Fh, 0FFh, 0FFh, 0FFh, 09Fh
+				BYTE			0FFh, 0EFh, 0FFh, 0FFh, 0FFh, 077h, 0FFh, 0FBh, 0FEh, 0FFh, 0FFh, 0FDh, 0FFh, 0FFh, 0FDh, 0FFh
+				BYTE			0FFh, 0FEh, 07Bh, 0FFh, 0F7h, 0FFh, 0FFh, 0FFh, 0AFh, 0FFh, 0DFh, 0FFh, 0DFh, 0FFh, 0AFh, 0FFh
+				BYTE			0FFh, 0FFh, 0F7h, 0FFh, 07Bh, 0FFh, 0FFh, 0FEh, 0FDh, 0FFh, 0FFh, 0FFh, 0FFh, 0FDh, 0FEh, 07Fh
+				BYTE			0FFh, 0FBh, 0FFh, 0F7h, 0FFh, 0BFh, 0FFh, 0EFh, 0FFh, 0DFh, 0FFh, 0EFh, 0FFh, 0BFh, 0FFh, 0F7h
+				BYTE			0FFh, 0FBh, 0FFh, 07Fh, 0FFh, 0FDh, 0FEh, 0FFh, 0FFh, 0FFh, 0FFh, 0FEh, 07Dh, 0FFh, 0FFh, 0FFh
+				BYTE			0FBh, 0FFh, 0B7h, 0FFh, 0FFh, 0FFh, 0CFh, 0FFh, 0CFh, 0FFh, 0FFh, 0FFh, 0B7h, 0FFh, 0FBh, 0FFh
+				BYTE			0FFh, 0FFh, 07Dh, 0FFh, 0FFh, 0FEh, 0FFh, 0FFh, 0FEh, 07Fh, 0FFh, 0FDh, 0FFh, 0FFh, 0FFh, 0BBh
+				BYTE			0FFh, 0F7h, 0FFh, 0DFh, 0FFh, 0EFh, 0FFh, 0DFh, 0FFh, 0F7h, 0FFh, 0BBh, 0FFh, 0FFh, 0FFh, 0FDh
+				BYTE			0FFh, 07Fh, 0FFh, 0FFh, 0FEh, 0FEh, 07Fh, 0FFh, 0FFh, 0FFh, 0FDh, 0FFh, 0BFh, 0FFh, 0FBh, 0FFh
+				BYTE			0D7h, 0FFh, 0EFh, 0FFh, 0EFh, 0FFh, 0D7h, 0FFh, 0FBh, 0FFh, 0BFh, 0FFh, 0FDh, 0FFh, 0FFh, 0FFh
+				BYTE			07Fh, 0FFh, 0FEh, 07Eh, 0FFh, 0FFh, 0FFh, 0FFh, 0FFh, 0BDh, 0FFh, 0FFh, 0FFh, 0DBh, 0FFh, 0E7h
+				BYTE			0FFh, 0FFh, 0FFh, 0E7h, 0FFh, 0DBh, 0FFh, 0FFh, 0FFh, 0BDh, 0FFh, 0FFh, 0FFh, 0FFh, 0FFh, 07Eh
+				BYTE			07Fh, 0FFh, 0FEh, 0FFh, 0FFh, 0FFh, 0BFh, 0FFh, 0FDh, 0FFh, 0DFh, 0FFh, 0EBh, 0FFh, 0F7h, 0FFh
+				BYTE			0F7h, 0FFh, 0EBh, 0FFh, 0DFh, 0FFh, 0FDh, 0FFh, 0BFh, 0FFh, 0FFh, 0FFh, 0FEh, 07Fh, 07Fh, 0FFh
+				BYTE			0FFh, 0FEh, 0FFh, 0BFh, 0FFh, 0FFh, 0FFh, 0DDh, 0FFh, 0EFh, 0FFh, 0FBh, 0FFh, 0F7h, 0FFh, 0FBh
+				BYTE			0FFh, 0EFh, 0FFh, 0DDh, 0FFh, 0FFh, 0FFh, 0BFh, 0FFh, 0FEh, 07Fh, 0FFh, 0FFh, 07Fh, 0FFh, 0FFh
+				BYTE			0BEh, 0FFh, 0FFh, 0FFh, 0DFh, 0FFh, 0EDh, 0FFh, 0FFh, 0FFh, 0F3h, 0FFh, 0F3h, 0FFh, 0FFh, 0FFh
+				BYTE			0EDh, 0FFh, 0DFh, 0FFh, 0FFh, 0FFh, 0BEh, 07Fh, 0FFh, 0FFh, 0FFh, 0FFh, 07Fh, 0BFh, 0FFh, 0FEh
+				BYTE			0FFh, 0DFh, 0FFh, 0EFh, 0FFh, 0FDh, 0FFh, 0F7h, 0FFh, 0FBh, 0FFh, 0F7h, 0FFh, 0FDh, 0FFh, 0EFh
+				BYTE			0FFh, 0DFh, 0FFh, 0FEh, 07Fh, 0BFh, 0FFh, 0FFh, 0FFh, 0FFh, 0BFh, 07Fh, 0FFh, 0FFh, 0DEh, 0FFh
+				BYTE			0EFh, 0FFh, 0FFh, 0FFh, 0F5h, 0FFh, 0FBh, 0FFh, 0FBh, 0FFh, 0F5h, 0FFh, 0FFh, 0FFh, 0EFh, 0FFh
+				BYTE			0DEh, 07Fh, 0FFh, 0FFh, 0BFh, 0FFh, 0FFh, 0BFh, 0FFh, 0FFh, 07Fh, 0DFh, 0FFh, 0EEh, 0FFh, 0FFh
+				BYTE			0FFh, 0F7h, 0FFh, 0F9h, 0FFh, 0FFh, 0FFh, 0F9h, 0FFh, 0F7h, 0FFh, 0FFh, 0FFh, 0EEh, 07Fh, 0DFh
+				BYTE			0FFh, 0FFh, 0FFh, 0BFh, 0BFh, 0FFh, 0FFh, 0FFh, 0DFh, 07Fh, 0EFh, 0FFh, 0FEh, 0FFh, 0F7h, 0FFh
+				BYTE			0FBh, 0FFh, 0FDh, 0FFh, 0FDh, 0FFh, 0FBh, 0FFh, 0F7h, 0FFh, 0FEh, 07Fh, 0EFh, 0FFh, 0DFh, 0FFh
+				BYTE			0FFh, 0BFh, 0BFh, 0FFh, 0FFh, 0DFh, 0FFh, 0EFh, 07Fh, 0FFh, 0FFh, 0F6h, 0FFh, 0FBh, 0FFh, 0FFh
+				BYTE			0FFh, 0FDh, 0FFh, 0FFh, 0FFh, 0FBh, 0FFh, 0F6h, 07Fh, 0FFh, 0FFh, 0EFh, 0FFh, 0DFh, 0BFh, 0FFh
+				BYTE			0FFh, 0BFh, 0DFh, 0FFh, 0EFh, 0FFh, 0FFh, 07Fh, 0F7h, 0FFh, 0FAh, 0FFh, 0FFh, 0FFh, 0FDh, 0FFh
+				BYTE			0FDh, 0FFh, 0FFh, 0FFh, 0FAh, 07Fh, 0F7h, 0FFh, 0FFh, 0FFh, 0EFh, 0BFh, 0DFh, 0FFh, 0FFh, 0DFh
+				BYTE			0BFh, 0EFh, 0FFh, 0FFh, 0FFh, 0F7h, 07Fh, 0FBh, 0FFh, 0FEh, 0FFh, 0FDh, 0FFh, 0FFh, 0FFh, 0FDh
+				BYTE			0FFh, 0FEh, 07Fh, 0FBh, 0FFh, 0F7h, 0FFh, 0FFh, 0BFh, 0EFh, 0FFh, 0DFh, 0DFh, 0FFh, 0EFh, 0BFh
+				BYTE			0FFh, 0FFh, 0F7h, 0FFh, 0FBh, 07Fh, 0FFh, 0FFh, 0FCh, 0FFh, 0FFh, 0FFh, 0FFh, 0FFh, 0FCh, 07Fh
+				BYTE			0FFh, 0FFh, 0FBh, 0FFh, 0F7h, 0BFh, 0FFh, 0FFh, 0EFh, 0DFh, 0DFh, 0EFh, 0FFh, 0FFh, 0BFh, 0F7h
+				BYTE			0FFh, 0FBh, 0FFh, 0FFh, 07Fh, 0FDh, 0FFh, 0FEh, 0FFh, 0FFh, 0FFh, 0FEh, 07Fh, 0FDh, 0FFh, 0FFh
+				BYTE			0FFh, 0FBh, 0BFh, 0F7h, 0FFh, 0FFh, 0DFh, 0EFh, 0EFh, 0DFh, 0FFh, 0FFh, 0F7h, 0BFh, 0FBh, 0FFh
+				BYTE			0FFh, 0FFh, 0FDh, 07Fh, 0FFh, 0FFh, 0FEh, 0FFh, 0FEh, 07Fh, 0FFh, 0FFh, 0FDh, 0FFh, 0FFh, 0BFh
+				BYTE			0FBh, 0FFh, 0F7h, 0DFh, 0FFh, 0EFh, 0EFh, 0FFh, 0DFh, 0F7h, 0FFh, 0FBh, 0BFh, 0FFh, 0FFh, 0FDh
+				BYTE			0FFh, 0FFh, 07Fh, 0FFh, 0FFh, 0FEh, 07Fh, 0FFh, 0FFh, 0FFh, 0FFh, 0FDh, 0BFh, 0FFh, 0FFh, 0FBh
+				BYTE			0DFh, 0F7h, 0EFh, 0FFh, 0FFh, 0EFh, 0F7h, 0DFh, 0FBh, 0FFh, 0FFh, 0BFh, 0FDh, 0FFh, 0FFh, 0FFh
+				BYTE			0FFh, 07Fh, 0FEh, 07Fh, 0FEh, 0FFh, 0FFh, 0FFh, 0FFh, 0BFh, 0FDh, 0FFh, 0FFh, 0DFh, 0FBh, 0EFh
+				BYTE			0F7h, 0FFh, 0FFh, 0F7h, 0EFh, 0FBh, 0DFh, 0FFh, 0FFh, 0FDh, 0BFh, 0FFh, 0FFh, 0FFh, 0FFh, 0FEh
+				BYTE			07Fh, 0FFh, 0FFh, 0FEh, 0FFh, 0FFh, 0BFh, 0FFh, 0FFh, 0FDh, 0DFh, 0FFh, 0EFh, 0FBh, 0FFh, 0F7h
+				BYTE			0F7h, 0FFh, 0FBh, 0EFh, 0FFh, 0DFh, 0FDh, 0FFh, 0FFh, 0BFh, 0FFh, 0FFh, 0FEh, 07Fh, 0FFh, 07Fh
+				BYTE			0FFh, 0FFh, 0FEh
+
+ui512_sieve_data ENDS
+
+ui512_sieve		SEGMENT			PARA 'CODE'
+
+;--------------------------------------------------------------------------------------------------------------------------------------------------------------
+;			Presieve_Step	-	next block: phase = ( phase + 64 ) mod period, period above 64; RAX used
+;
+Presieve_Step	MACRO			phase, period
+				LEA				RAX, [ phase + 64 - period ]
+				ADD				phase, 64
+				CMP				phase, period
+				CMOVAE			phase, RAX
+				ENDM
+
+;--------------------------------------------------------------------------------------------------------------------------------------------------------------
+;			Presieve_Phase	-	phase = first mod period; RAX, RCX, RDX used
+;
+Presieve_Phase	MACRO			phase, period
+				MOV				RAX, RDXHome
+				XOR				EDX, EDX
+				MOV				ECX, period
+				DIV				RCX
+				MOV				phase, RDX
+				ENDM
+
+;--------------------------------------------------------------------------------------------------------------------------------------------------------------
+;			EXTERNDEF		presieve_u:PROC				; s16 presieve_u( u64* seg, u64 first, u64 blocks, u64* count );
+;			presieve_u		-	fill wheel bytes with the candidates having no factor 7 to 31, and count them
+;			Prototype:		-	s16 presieve_u( u64* seg, u64 first, u64 blocks, u64* count );
+;			seg				-	Address of blocks * 64 bytes (in RCX), 64 byte aligned, to receive the wheel bytes
+;			first			-	the byte ( integer / 30 ) of the first byte of seg (in RDX)
+;			blocks			-	count of 64 byte blocks (in R8)
+;			count			-	Address of a QWORD (in R9) to receive the bits left set
+;			returns			-	(0) for success, (GP_Fault) for mis-aligned seg address
+;
+;			Note: each 64 byte block is the AND of four patterns, one for each pair of primes ( 7 11, 13 17, 19 23, 29 31 ), read from
+;			the block's byte mod the pair's product: no single bit writes for the smallest sieving primes, which clear most bits.
+;			The primes 7 to 31 themselves are left set ( first of 0 or 1 ), as is 1: the caller masks the ends of its range.
+;
+ps_Locals		STRUCT
+counts			QWORD			8 dup (?)
+ps_Locals		ENDS
+
+				Proc_w_Local	presieve_u, ps_Locals, RBX, RSI, RDI, R12, R13, R14, R15
+
+				CheckAlign		RCX, @@exit							; (out) Seg
+				MOV				RDXHome, RDX
+				XOR				R14D, R14D							; count
+				TEST			R8, R8
+				JZ				@@store
+				Presieve_Phase	R10, 77								; phases: first mod 77, 221, 437, 899
+				Presieve_Phase	R11, 221
+				Presieve_Phase	RBX, 437
+				Presieve_Phase	R15, 899
+				MOV				RCX, RCXHome
+				LEA				RSI, sv_pre77
+				LEA				RDI, sv_pre221
+				LEA				R12, sv_pre437
+				LEA				R13, sv_pre899
+
+	IF __UseZ
+				VPXORQ			ZMM18, ZMM18, ZMM18					; counts, by QWORD
+@@block:		VMOVDQU64		ZMM16, ZM_PTR [ RSI + R10 ]
+				VMOVDQU64		ZMM17, ZM_PTR [ RDI + R11 ]
+				VPTERNLOGQ		ZMM16, ZMM17, ZM_PTR [ R12 + RBX ], 80h	; 'AND' of three
+				VPANDQ			ZMM16, ZMM16, ZM_PTR [ R13 + R15 ]
+				VMOVDQA64		ZM_PTR [ RCX ], ZMM16
+	IF __UsePOPCNTDQ
+				VPOPCNTQ		ZMM17, ZMM16
+				VPADDQ			ZMM18, ZMM18, ZMM17
+	ELSE
+				FOR				idx, < 0, 1, 2, 3, 4, 5, 6, 7 >
+				POPCNT			RDX, Q_PTR [ RCX ] [ idx * 8 ]
+				ADD				R14, RDX
+				ENDM
+	ENDIF
+	ELSE
+@@block:		FOR				idx, < 0, 1, 2, 3, 4, 5, 6, 7 >
+				MOV				RDX, Q_PTR [ RSI + R10 ] [ idx * 8 ]
+				AND				RDX, Q_PTR [ RDI + R11 ] [ idx * 8 ]
+				AND				RDX, Q_PTR [ R12 + RBX ] [ idx * 8 ]
+				AND				RDX, Q_PTR [ R13 + R15 ] [ idx * 8 ]
+				MOV				Q_PTR [ RCX ] [ idx * 8 ], RDX
+				POPCNT			RDX, RDX
+				ADD				R14, RDX
+				ENDM
+	ENDIF
+				Presieve_Step	R10, 77
+				Presieve_Step	R11, 221
+				Presieve_Step	RBX, 437
+				Presieve_Step	R15, 899
+				ADD				RCX, 64
+				DEC				R8
+				JNZ				@@block
+	IF __UseZ AND __UsePOPCNTDQ
+				VMOVDQA64		ZM_PTR l_Ptr.counts, ZMM18
+				FOR				idx, < 0, 1, 2, 3, 4, 5, 6, 7 >
+				ADD				R14, l_Ptr.counts [ idx * 8 ]
+				ENDM
+	ENDIF
+				MOV				RAX, RDXHome						; 7 to 31 themselves, in bytes 0 and 1, are prime
+				MOV				RCX, RCXHome
+				CMP				RAX, 1
+				JA				@@store
+				JE				@@one
+				OR				WORD PTR [ RCX ], 01FEh
+				ADD				R14, 8
+				JMP				@@store
+@@one:			OR				BYTE PTR [ RCX ], 01h				; 31
+				INC				R14
+@@store:		MOV				Q_PTR [ R9 ], R14
+				XOR				EAX, EAX							; return zero
+@@exit:			Local_Exit		R15, R14, R13, R12, RDI, RSI, RBX
+presieve_u		ENDP
+
+;--------------------------------------------------------------------------------------------------------------------------------------------------------------
+;			Sieve_Range		-	sieve the range lo <= n < hi of the context, summing the primes found, or appending them to the sieving primes
+;			context			-	Address of sv_ctx (in RBX): seg, tbl, nprimes, lo ( at least 7 ), hi ( above lo ), mode
+;
+;			Note: internal to sum_primes_u, not a public procedure. All registers but RBX, RBP and RSP are used and not restored
+;			(sum_primes_u saves the non-volatile ones once). The sieving primes must cover sqrt( hi - 1 ), in order.
+;			Not a leaf: it calls presieve_u, so it declares its home space in a FRAME prologue for the unwinder.
+;
+				ALIGN			16
+Sieve_Range		PROC			PRIVATE FRAME
+				SUB				RSP, 28h							; home space for the call to presieve_u, and RSP aligned 16
+				.ALLOCSTACK		28h
+				.ENDPROLOG
+				MOV				RAX, sv_ctx.lo [ RBX ]
+				XOR				EDX, EDX
+				MOV				ECX, 30
+				DIV				RCX
+				MOV				sv_ctx.bb [ RBX ], RAX
+				MOV				RAX, sv_ctx.hi [ RBX ]
+				DEC				RAX
+				XOR				EDX, EDX
+				DIV				RCX
+				MOV				sv_ctx.eb [ RBX ], RAX
+				MOV				sv_ctx.nactive [ RBX ], 0
+
+@@segment:		MOV				RAX, sv_ctx.eb [ RBX ]				; len = min( segment, eb - bb + 1 )
+				SUB				RAX, sv_ctx.bb [ RBX ]
+				INC				RAX
+				MOV				ECX, sieve_seg_bytes
+				CMP				RAX, RCX
+				CMOVA			RAX, RCX
+				MOV				sv_ctx.len [ RBX ], RAX
+				MOV				RCX, sv_ctx.seg [ RBX ]				; candidates with no factor 7 to 31, in whole blocks
+				MOV				RDX, sv_ctx.bb [ RBX ]
+				LEA				R8, [ RAX + 63 ]
+				SHR				R8, 6
+				LEA				R9, sv_ctx.left [ RBX ]
+				CALL			presieve_u
+				MOV				RDI, sv_ctx.seg [ RBX ]				; then zero to the next QWORD
+				ADD				RDI, sv_ctx.len [ RBX ]
+				MOV				RCX, sv_ctx.len [ RBX ]
+				NEG				RCX
+				AND				ECX, 7
+				XOR				EAX, EAX
+				REP				STOSB
+
+; join: sieving primes with p^2 below the end of the segment
+				MOV				R14, sv_ctx.bb [ RBX ]
+				ADD				R14, sv_ctx.len [ RBX ]
+				IMUL			R14, R14, 30						; first integer past the segment
+				MOV				R12, sv_ctx.nactive [ RBX ]
+				MOV				RSI, sv_ctx.tbl [ RBX ]
+@@join:			CMP				R12, sv_ctx.nprimes [ RBX ]
+				JAE				@@joined
+				MOV				RDI, R12
+				SHL				RDI, 4
+				ADD				RDI, RSI							; RDI: the entry
+				MOV				R8D, sv_prime.p [ RDI ]
+				MOV				RAX, R8
+				MUL				R8
+				CMP				RAX, R14
+				JAE				@@joined
+				MOV				RAX, sv_ctx.bb [ RBX ]				; m = max( p, ceil( 30 bb / p ) ), then up to the wheel
+				IMUL			RAX, RAX, 30
+				ADD				RAX, R8
+				DEC				RAX
+				XOR				EDX, EDX
+				DIV				R8
+				CMP				RAX, R8
+				CMOVB			RAX, R8
+				XOR				EDX, EDX
+				MOV				ECX, 30
+				DIV				RCX									; RAX: m div 30, RDX: m mod 30
+				LEA				R9, sv_next
+				MOVZX			R10D, BYTE PTR [ R9 + RDX ]			; j
+				IMUL			RAX, RAX, 30
+				LEA				R9, sv_residue
+				MOVZX			EDX, BYTE PTR [ R9 + R10 ]
+				ADD				RAX, RDX							; m
+				MUL				R8									; q = p m
+				XOR				EDX, EDX
+				DIV				RCX
+				SUB				RAX, sv_ctx.bb [ RBX ]
+				MOV				sv_prime.off [ RDI ], EAX
+				MOV				EAX, R8D							; a, and i
+				XOR				EDX, EDX
+				DIV				ECX
+				MOV				sv_prime.a [ RDI ], EAX
+				LEA				R9, sv_next
+				MOVZX			EAX, BYTE PTR [ R9 + RDX ]
+				LEA				EAX, [ R10 + RAX * 8 ]
+				MOV				sv_prime.w [ RDI ], EAX
+				INC				R12
+				JMP				@@join
+@@joined:		MOV				sv_ctx.nactive [ RBX ], R12
+
+; mark: each joined prime, multiples through the segment
+				MOV				RDI, sv_ctx.seg [ RBX ]
+				MOV				R13, sv_ctx.len [ RBX ]
+				LEA				R11, sv_clear
+				LEA				R15, sv_gap
+				LEA				R14, sv_corr
+				MOV				EAX, sieve_presieved				; the first sieving primes, 7 to 31, are done by the pre-sieve
+				CMP				R12, RAX
+				CMOVB			RAX, R12
+				SUB				R12, RAX
+				SHL				RAX, 4
+				ADD				RSI, RAX
+				TEST			R12, R12
+				JZ				@@marked
+@@prime:		MOV				R8D, sv_prime.off [ RSI ]
+				MOV				R10D, sv_prime.w [ RSI ]
+				CMP				R8, R13
+				JAE				@@next
+				MOV				R9D, sv_prime.a [ RSI ]
+@@mark:			MOVZX			EAX, BYTE PTR [ R11 + R10 ]
+				AND				BYTE PTR [ RDI + R8 ], AL
+				MOV				EAX, R10D
+				AND				EAX, 7
+				MOVZX			EAX, BYTE PTR [ R15 + RAX ]
+				IMUL			RAX, R9
+				ADD				R8, RAX
+				MOVZX			EAX, BYTE PTR [ R14 + R10 ]
+				ADD				R8, RAX
+				LEA				EAX, [ R10 + 1 ]					; next wheel position of m
+				AND				EAX, 7
+				AND				R10D, -8
+				OR				R10D, EAX
+				CMP				R8, R13
+				JB				@@mark
+				MOV				sv_prime.w [ RSI ], R10D
+@@next:			SUB				R8, R13
+				MOV				sv_prime.off [ RSI ], R8D
+				ADD				RSI, SIZEOF sv_prime
+				DEC				R12
+				JNZ				@@prime
+@@marked:
+
+; ends of the range: clear bits below lo in the first byte, and from hi in the last
+				MOV				RAX, sv_ctx.lo [ RBX ]
+				XOR				EDX, EDX
+				MOV				ECX, 30
+				DIV				RCX
+				CMP				RAX, sv_ctx.bb [ RBX ]
+				JNE				@F
+				LEA				R9, sv_next							; bits from the first residue >= lo mod 30 are kept
+				MOVZX			ECX, BYTE PTR [ R9 + RDX ]
+				MOV				EAX, -1
+				SHL				EAX, CL
+				AND				BYTE PTR [ RDI ], AL
+@@:				MOV				RAX, sv_ctx.bb [ RBX ]
+				ADD				RAX, R13
+				DEC				RAX
+				CMP				RAX, sv_ctx.eb [ RBX ]
+				JNE				@F
+				MOV				RAX, sv_ctx.hi [ RBX ]				; bits from the first residue >= ( hi - 1 ) mod 30 + 1 are cleared
+				DEC				RAX
+				XOR				EDX, EDX
+				MOV				ECX, 30
+				DIV				RCX
+				INC				EDX
+				LEA				R9, sv_next
+				MOV				ECX, 8
+				CMP				EDX, 30
+				JAE				@@lastbyte
+				MOVZX			ECX, BYTE PTR [ R9 + RDX ]
+@@lastbyte:		MOV				EAX, 1
+				SHL				EAX, CL
+				DEC				EAX
+				AND				BYTE PTR [ RDI + R13 - 1 ], AL
+@@:
+
+; collect: each bit left is a prime; sum in R15:R14, or append
+				LEA				R11, sv_bitval
+				XOR				R14D, R14D
+				XOR				R15D, R15D
+				MOV				R12, sv_ctx.bb [ RBX ]				; 30 * byte of the QWORD
+				IMUL			R12, R12, 30
+				LEA				RSI, [ RDI + R13 + 7 ]				; past the last QWORD
+				AND				RSI, -8
+				MOV				R13, sv_ctx.tbl [ RBX ]
+				MOV				R10, sv_ctx.nprimes [ RBX ]
+@@qword:		MOV				R8, Q_PTR [ RDI ]
+				TEST			R8, R8
+				JZ				@@qnext
+@@bit:			BSF				RCX, R8
+				LEA				R9, [ R8 - 1 ]
+				AND				R8, R9
+				MOVZX			EAX, BYTE PTR [ R11 + RCX ]
+				ADD				RAX, R12							; the prime
+				CMP				sv_ctx.mode [ RBX ], 0
+				JNE				@@append
+				ADD				R14, RAX
+				ADC				R15, 0
+				JMP				@@bitnext
+@@append:		MOV				RDX, R10
+				SHL				RDX, 4
+				MOV				sv_prime.p [ R13 + RDX ], EAX
+				INC				R10
+@@bitnext:		TEST			R8, R8
+				JNZ				@@bit
+@@qnext:		ADD				R12, 8 * 30
+				ADD				RDI, 8
+				CMP				RDI, RSI
+				JB				@@qword
+				MOV				sv_ctx.nprimes [ RBX ], R10
+				ADD				Q_PTR sv_ctx.total [ RBX ] [ 7 * 8 ], R14	; fold into the total
+				ADC				Q_PTR sv_ctx.total [ RBX ] [ 6 * 8 ], R15
+				FOR				idx, < 5, 4, 3, 2, 1, 0 >
+				ADC				Q_PTR sv_ctx.total [ RBX ] [ idx * 8 ], 0
+				ENDM
+
+				MOV				RAX, sv_ctx.len [ RBX ]				; next segment
+				ADD				sv_ctx.bb [ RBX ], RAX
+				MOV				RAX, sv_ctx.bb [ RBX ]
+				CMP				RAX, sv_ctx.eb [ RBX ]
+				JBE				@@segment
+				ADD				RSP, 28h
+				RET
+Sieve_Range		ENDP
+
+;--------------------------------------------------------------------------------------------------------------------------------------------------------------
+;			Isqrt52			-	RAX = floor( sqrt( RAX ) ), for RAX at most 2^52 (exact as a double), then a check either way; R10, R11, XMM0 used
+;
+Isqrt52			MACRO
+				LOCAL			down, up, done
+				MOV				R11, RAX
+				CVTSI2SD		XMM0, RAX
+				SQRTSD			XMM0, XMM0
+				CVTTSD2SI		RAX, XMM0
+down:			MOV				R10, RAX
+				IMUL			R10, RAX
+				CMP				R10, R11
+				JBE				up
+				DEC				RAX
+				JMP				down
+up:				LEA				R10, [ RAX + 1 ]
+				IMUL			R10, R10
+				CMP				R10, R11
+				JA				done
+				INC				RAX
+				JMP				up
+done:
+				ENDM
+
+;--------------------------------------------------------------------------------------------------------------------------------------------------------------
+;			EXTERNDEF		sieve_work_size_u:PROC		; s16 sieve_work_size_u( u64* bytes, u64 hi );
+;			sieve_work_size_u	-	size of the work memory for sum_primes_u of a range below hi
+;			Prototype:		-	s16 sieve_work_size_u( u64* bytes, u64 hi );
+;			bytes			-	Address of QWORD to receive the size in bytes (in RCX)
+;			hi				-	end of the range (in RDX), at most 2^52
+;			returns			-	(0) for success, (-1) if hi is above 2^52
+;
+;			Note: the segment, then 16 bytes per sieving prime: pi( r ) <= 1.26 r / ln r < 2 r / floor( log2 r ), r = sqrt( hi ).
+;			About 22 MB for hi of 2^48, 2 MB for 2^40.
+;
+				Leaf_Entry		sieve_work_size_u
+				MOV				R8, sieve_hi_max
+				CMP				RDX, R8
+				JA				@@err
+				MOV				RAX, RDX
+				CMP				RAX, 4
+				JAE				@F
+				MOV				EAX, 4
+@@:				Isqrt52
+				LEA				R8, [ RAX + RAX ]					; 2 r / floor( log2 r ) + 8
+				BSR				R9, RAX
+				MOV				RAX, R8
+				XOR				EDX, EDX
+				DIV				R9
+				ADD				RAX, 8
+				SHL				RAX, 4
+				ADD				RAX, sieve_seg_bytes + 63			; rounded up to 64 bytes
+				AND				RAX, -64
+				MOV				Q_PTR [ RCX ], RAX
+				XOR				EAX, EAX							; return zero
+				RET
+@@err:			MOV				EAX, retcode_neg_one
+				RET
+sieve_work_size_u ENDP
+
+;--------------------------------------------------------------------------------------------------------------------------------------------------------------
+;			EXTERNDEF		sum_primes_u:PROC			; s16 sum_primes_u( u64* sum, u64 lo, u64 hi, u64* work );
+;			sum_primes_u	-	sum of the primes p, lo <= p < hi
+;			Prototype:		-	s16 sum_primes_u( u64* sum, u64 lo, u64 hi, u64* work );
+;			sum				-	Address of 8 QWORDS to receive the sum (in RCX)
+;			lo				-	start of the range (in RDX)
+;			hi				-	end of the range, not included (in R8), at most 2^52
+;			work			-	Address of work memory (in R9), sieve_work_size_u( hi ) bytes, 64 byte aligned
+;			returns			-	(0) for success, (-1) if hi is above 2^52, (GP_Fault) for mis-aligned parameter address
+;
+;			Note: ranges may be split anywhere, and summed separately (on separate threads, each with its own work memory):
+;			each call finds its own sieving primes, below sqrt( hi ), a small part of the run time for ranges of 2^32 or more.
+;
+sp_Locals		STRUCT
+ctx				sv_ctx			<>
+sp_Locals		ENDS
+
+				Proc_w_Local	sum_primes_u, sp_Locals, RBX, RSI, RDI, R12, R13, R14, R15
+
+				CheckAlign		RCX, @@exit							; (out) Sum
+				CheckAlign		R9, @@exit							; (in) Work
+				MOV				RDXHome, RDX
+				MOV				R8Home, R8
+				LEA				RBX, l_Ptr.ctx
+				Zero512Q		RBX									; total, first in the context
+				MOV				RAX, sieve_hi_max
+				CMP				R8, RAX
+				JA				@@err
+				MOV				sv_ctx.lo [ RBX ], RDX
+				MOV				sv_ctx.hi [ RBX ], R8
+				MOV				sv_ctx.seg [ RBX ], R9
+				LEA				RAX, [ R9 + sieve_seg_bytes ]
+				MOV				sv_ctx.tbl [ RBX ], RAX
+				MOV				sv_ctx.nprimes [ RBX ], 0
+				CMP				RDX, R8
+				JAE				@@store								; empty range
+
+				FOR				pw, < 2, 3, 5 >						; below the wheel
+				CMP				RDX, pw
+				JA				@F
+				CMP				R8, pw
+				JBE				@F
+				ADD				Q_PTR sv_ctx.total [ RBX ] [ 7 * 8 ], pw
+@@:
+				ENDM
+				CMP				R8, 7
+				JBE				@@store
+
+; sieving primes, 7 to r = floor( sqrt( hi - 1 ) ): below 1024 by trial division (by 3, 5, and those found), then by sieve
+				LEA				RAX, [ R8 - 1 ]
+				Isqrt52
+				MOV				R13, RAX							; r
+				MOV				RSI, sv_ctx.tbl [ RBX ]
+				XOR				EDI, EDI							; primes found
+				MOV				R12D, 7								; n
+@@seed:			CMP				R12, R13
+				JA				@@seeded
+				CMP				R12, sieve_seed_max
+				JAE				@@seeded
+				FOR				d, < 3, 5 >
+				MOV				EAX, R12D
+				XOR				EDX, EDX
+				MOV				ECX, d
+				DIV				ECX
+				TEST			EDX, EDX
+				JZ				@@composite
+				ENDM
+				XOR				R9D, R9D
+@@trial:		CMP				R9, RDI
+				JAE				@@prime
+				MOV				RAX, R9
+				SHL				RAX, 4
+				MOV				ECX, sv_prime.p [ RSI + RAX ]
+				MOV				EAX, ECX
+				MUL				ECX
+				CMP				EAX, R12D
+				JA				@@prime
+				MOV				EAX, R12D
+				XOR				EDX, EDX
+				DIV				ECX
+				TEST			EDX, EDX
+				JZ				@@composite
+				INC				R9
+				JMP				@@trial
+@@prime:		MOV				RAX, RDI
+				SHL				RAX, 4
+				MOV				sv_prime.p [ RSI + RAX ], R12D
+				INC				RDI
+@@composite:	ADD				R12, 2
+				JMP				@@seed
+@@seeded:		MOV				sv_ctx.nprimes [ RBX ], RDI
+				CMP				R13, sieve_seed_max
+				JB				@F
+				MOV				sv_ctx.lo [ RBX ], sieve_seed_max
+				LEA				RAX, [ R13 + 1 ]
+				MOV				sv_ctx.hi [ RBX ], RAX
+				MOV				sv_ctx.mode [ RBX ], 1
+				CALL			Sieve_Range
+
+@@:				MOV				RAX, RDXHome						; the range, from 7 up
+				MOV				ECX, 7
+				CMP				RAX, RCX
+				CMOVB			RAX, RCX
+				MOV				sv_ctx.lo [ RBX ], RAX
+				MOV				RCX, R8Home
+				MOV				sv_ctx.hi [ RBX ], RCX
+				MOV				sv_ctx.mode [ RBX ], 0
+				CALL			Sieve_Range
+
+@@store:		MOV				RCX, RCXHome
+				Copy512Q		RCX, RBX
+				XOR				EAX, EAX							; return zero
+				JMP				@@exit
+
+@@err:			MOV				EAX, retcode_neg_one
+@@exit:			Local_Exit		R15, R14, R13, R12, RDI, RSI, RBX
+sum_primes_u	ENDP
+
+;--------------------------------------------------------------------------------------------------------------------------------------------------------------
+;			EXTERNDEF		sum_primes_init_u:PROC		; s16 sum_primes_init_u( sieve_job* job );
+;			sum_primes_init_u	-	set up a parallel sum of primes: split the range into chunks, and deal them out evenly to the workers
+;			Prototype:		-	s16 sum_primes_init_u( sieve_job* job );
+;			job				-	Address of sieve_job (in RCX), lo, hi, chunk, count, workers set by the caller, and the work address of each worker
+;			returns			-	(0) for success, (-1) if hi is above 2^52, count is zero, or 2^32 - 1 chunks or more,
+;								(GP_Fault) for mis-aligned workers address
+;
+;			Note: a chunk of zero is sieve_chunk_default integers; a chunk above hi - lo is hi - lo. Partial sums, counts and stop are zeroed.
+;
+				Leaf_Entry		sum_primes_init_u
+				MOV				R10, sieve_job.workers [ RCX ]
+				CheckAlign		R10									; (in) Workers
+				MOV				RAX, sieve_hi_max
+				CMP				sieve_job.hi [ RCX ], RAX
+				JA				@@err
+				MOV				R11, sieve_job.count [ RCX ]
+				TEST			R11, R11
+				JZ				@@err
+				MOV				R8, sieve_job.hi [ RCX ]			; R8: integers in the range
+				SUB				R8, sieve_job.lo [ RCX ]
+				JAE				@F
+				XOR				R8D, R8D
+@@:				MOV				RAX, sieve_job.chunk [ RCX ]
+				MOV				EDX, sieve_chunk_default
+				TEST			RAX, RAX
+				CMOVZ			RAX, RDX
+				CMP				RAX, R8
+				CMOVA			RAX, R8
+				TEST			RAX, RAX
+				MOV				EDX, 1
+				CMOVZ			RAX, RDX							; empty range: any chunk, no chunks
+				MOV				sieve_job.chunk [ RCX ], RAX
+				MOV				R9, RAX								; chunks = ceil( integers / chunk )
+				LEA				RAX, [ R8 + R9 - 1 ]
+				XOR				EDX, EDX
+				DIV				R9
+				MOV				EDX, -1
+				CMP				RAX, RDX
+				JAE				@@err
+				MOV				sieve_job.nchunks [ RCX ], RAX
+				MOV				sieve_job.stop [ RCX ], 0
+
+				XOR				R9D, R9D							; worker i: chunks from i nchunks / count to ( i + 1 ) nchunks / count
+				XOR				R8D, R8D							; start of the next worker's chunks
+@@worker:		LEA				RAX, [ R9 + 1 ]
+				MUL				sieve_job.nchunks [ RCX ]
+				DIV				R11
+				SHL				RAX, 32
+				OR				R8, RAX
+				MOV				sieve_worker.range [ R10 ], R8
+				SHR				RAX, 32
+				MOV				R8, RAX
+				Zero512Q		R10									; partial sum, counts
+				MOV				sieve_worker.chunks [ R10 ], RAX
+				MOV				sieve_worker.steals [ R10 ], RAX
+				ADD				R10, SIZEOF sieve_worker
+				INC				R9
+				CMP				R9, R11
+				JB				@@worker
+				XOR				EAX, EAX							; return zero
+				RET
+@@err:			MOV				EAX, retcode_neg_one
+				RET
+sum_primes_init_u ENDP
+
+;--------------------------------------------------------------------------------------------------------------------------------------------------------------
+;			EXTERNDEF		sum_primes_worker_u:PROC	; s16 sum_primes_worker_u( sieve_job* job, u64 index );
+;			sum_primes_worker_u	-	run one worker of a parallel sum of primes, until no chunks are left to it or to steal
+;			Prototype:		-	s16 sum_primes_worker_u( sieve_job* job, u64 index );
+;			job				-	Address of sieve_job (in RCX), set up by sum_primes_init_u
+;			index			-	the worker (in RDX), 0 to count - 1; call once for each, each on its own thread
+;			returns			-	(0) for success, (1) if stopped ( job stop set ), (-1) if index is not below count
+;
+;			Note: each worker's chunks are a range, next and end, in one QWORD. The worker takes chunks from the front of its own range;
+;			when it is empty, it steals the back half of another's ( LOCK CMPXCHG on the QWORD, so a chunk goes to exactly one worker ).
+;			Chunks near the start of a range cost more (sieving primes joining), and threads are not equally fast; stealing evens out
+;			the finish. Each chunk's sum goes into the worker's own partial sum (its own cache lines, no locking): sum_primes_combine_u
+;			adds the partials once all workers have returned.
+;			Setting the job's stop makes each worker return before its next chunk: once all have returned, the job (remaining ranges,
+;			partial sums) can be saved by sum_primes_checkpoint_u, and the workers called again, now or after sum_primes_resume_u.
+;
+spw_Locals		STRUCT
+part			QWORD			8 dup (?)
+spw_Locals		ENDS
+
+				Proc_w_Local	sum_primes_worker_u, spw_Locals, RBX, RSI, RDI, R12, R13
+
+				MOV				RBX, RCX
+				MOV				RDI, RDX
+				MOV				R12, sieve_job.count [ RBX ]
+				CMP				RDI, R12
+				JAE				@@err
+				MOV				RSI, RDI
+				SHL				RSI, 7								; SIZEOF sieve_worker, 128
+				ADD				RSI, sieve_job.workers [ RBX ]
+
+@@take:			CMP				sieve_job.stop [ RBX ], 0
+				JNE				@@stop
+				MOV				RAX, sieve_worker.range [ RSI ]		; own chunks, from the front
+@@retry:		MOV				RCX, RAX
+				SHR				RCX, 32
+				CMP				EAX, ECX
+				JAE				@@steal
+				LEA				RCX, [ RAX + 1 ]
+				LOCK CMPXCHG	sieve_worker.range [ RSI ], RCX
+				JNZ				@@retry								; RAX: the range as changed by a thief
+				MOV				EAX, EAX							; chunk: lo + c chunk, to the lesser of hi and that + chunk
+				MUL				sieve_job.chunk [ RBX ]
+				ADD				RAX, sieve_job.lo [ RBX ]
+				MOV				RDX, RAX
+				MOV				R8, RAX
+				ADD				R8, sieve_job.chunk [ RBX ]
+				CMP				R8, sieve_job.hi [ RBX ]
+				CMOVA			R8, sieve_job.hi [ RBX ]
+				LEA				RCX, l_Ptr.part
+				MOV				R9, sieve_worker.work [ RSI ]
+				CALL			sum_primes_u
+				TEST			AX, AX
+				JNZ				@@exit
+				MOV				RCX, RSI
+				MOV				RDX, RSI
+				LEA				R8, l_Ptr.part
+				CALL			add_u
+				INC				sieve_worker.chunks [ RSI ]
+				JMP				@@take
+
+@@steal:		MOV				R13D, 1								; others, in turn from the next
+@@victim:		CMP				R13, R12
+				JAE				@@done
+				LEA				RAX, [ RDI + R13 ]
+				CMP				RAX, R12
+				JB				@F
+				SUB				RAX, R12
+@@:				SHL				RAX, 7
+				MOV				R8, sieve_job.workers [ RBX ]
+				ADD				R8, RAX
+				MOV				RAX, sieve_worker.range [ R8 ]
+@@vretry:		MOV				RDX, RAX							; RCX: next, RDX: end, R9: chunks stolen, half, rounded up
+				SHR				RDX, 32
+				MOV				ECX, EAX
+				MOV				R9, RDX
+				SUB				R9, RCX
+				JBE				@@vnext
+				INC				R9
+				SHR				R9, 1
+				MOV				R10, RDX							; victim keeps next to end - stolen
+				SUB				R10, R9
+				SHL				R10, 32
+				OR				R10, RCX
+				LOCK CMPXCHG	sieve_worker.range [ R8 ], R10
+				JNZ				@@vretry
+				SHR				R10, 32								; own range: end - stolen to end
+				SHL				RDX, 32
+				OR				RDX, R10
+				XCHG			sieve_worker.range [ RSI ], RDX
+				INC				sieve_worker.steals [ RSI ]
+				JMP				@@take
+@@vnext:		INC				R13
+				JMP				@@victim
+
+@@done:			XOR				EAX, EAX							; return zero
+				JMP				@@exit
+@@stop:			MOV				EAX, retcode_one
+				JMP				@@exit
+@@err:			MOV				EAX, retcode_neg_one
+@@exit:			Local_Exit		R13, R12, RDI, RSI, RBX
+sum_primes_worker_u ENDP
+
+;--------------------------------------------------------------------------------------------------------------------------------------------------------------
+;			EXTERNDEF		sum_primes_combine_u:PROC	; s16 sum_primes_combine_u( u64* sum, sieve_job* job );
+;			sum_primes_combine_u	-	add the workers' partial sums, after all have returned
+;			Prototype:		-	s16 sum_primes_combine_u( u64* sum, sieve_job* job );
+;			sum				-	Address of 16 QWORDS to receive the sum (in RCX), 1024 bits, the more significant 512 first
+;			job				-	Address of sieve_job (in RDX)
+;			returns			-	(0) for success, (GP_Fault) for mis-aligned parameter address
+;
+;			Note: each partial is added to the low half with add_u_wc, the carry into the high half.
+;
+spc_Locals		STRUCT
+zero			QWORD			8 dup (?)
+spc_Locals		ENDS
+
+				Proc_w_Local	sum_primes_combine_u, spc_Locals, RBX, RSI, RDI
+
+				CheckAlign		RCX, @@exit							; (out) Sum
+				MOV				RBX, RCX
+				MOV				RSI, sieve_job.workers [ RDX ]
+				MOV				RDI, sieve_job.count [ RDX ]
+				Zero512Q		RBX
+				LEA				RCX, [ RBX + 8 * 8 ]
+				Zero512Q		RCX
+				LEA				RCX, l_Ptr.zero
+				Zero512Q		RCX
+				TEST			RDI, RDI
+				JZ				@@done
+@@part:			LEA				RCX, [ RBX + 8 * 8 ]
+				MOV				RDX, RCX
+				MOV				R8, RSI
+				XOR				R9D, R9D
+				CALL			add_u_wc
+				MOVZX			R9D, AX								; carry
+				MOV				RCX, RBX
+				MOV				RDX, RBX
+				LEA				R8, l_Ptr.zero
+				CALL			add_u_wc
+				ADD				RSI, SIZEOF sieve_worker
+				DEC				RDI
+				JNZ				@@part
+@@done:			XOR				EAX, EAX							; return zero
+@@exit:			Local_Exit		RDI, RSI, RBX
+sum_primes_combine_u ENDP
+
+;--------------------------------------------------------------------------------------------------------------------------------------------------------------
+;			Ckpt_Crc		-	RAX = CRC-32C of a checkpoint image, the check QWORD taken as zero; count ( workers ) in R9, not changed.
+;							R10, R11 used
+;
+Ckpt_Crc		MACRO			image
+				LOCAL			blocks, done
+				MOV				EAX, -1
+				FOR				idx, < 0, 1, 2, 3, 4, 5, 6 >
+				CRC32			RAX, Q_PTR [ image ] [ idx * 8 ]
+				ENDM
+				XOR				R11D, R11D
+				CRC32			RAX, R11
+				MOV				R10, R9								; 16 QWORDS per worker
+				SHL				R10, 4
+				JZ				done
+				LEA				R11, [ image + SIZEOF sieve_ckpt ]
+blocks:			CRC32			RAX, Q_PTR [ R11 ]
+				ADD				R11, 8
+				DEC				R10
+				JNZ				blocks
+done:			NOT				EAX
+				ENDM
+
+;--------------------------------------------------------------------------------------------------------------------------------------------------------------
+;			EXTERNDEF		sum_primes_checkpoint_u:PROC	; s16 sum_primes_checkpoint_u( u64* image, sieve_job* job );
+;			sum_primes_checkpoint_u	-	save a stopped parallel sum of primes: range, chunks left to each worker, and partial sums
+;			Prototype:		-	s16 sum_primes_checkpoint_u( u64* image, sieve_job* job );
+;			image			-	Address of 64 + 128 count bytes (in RCX), 64 byte aligned, to receive the checkpoint
+;			job				-	Address of sieve_job (in RDX), no worker running ( all returned, after stop was set, or done )
+;			returns			-	(0) for success, (GP_Fault) for mis-aligned image address
+;
+;			Note: the image is a sieve_ckpt header ( magic "ui512sck", version, the job's range and chunks, count, CRC-32C ), then each
+;			worker as it is in memory: partial sum, range, counts, raw 64 byte blocks ( work address zeroed ). The caller writes it out;
+;			to replace a checkpoint file safely, write a new file, flush it, and rename it over the old one.
+;
+				Leaf_Entry		sum_primes_checkpoint_u
+				CheckAlign		RCX									; (out) Image
+				MOV				RAX, sieve_ckpt_magic
+				MOV				sieve_ckpt.magic [ RCX ], RAX
+				MOV				sieve_ckpt.version [ RCX ], sieve_ckpt_version
+				MOV				RAX, sieve_job.lo [ RDX ]
+				MOV				sieve_ckpt.lo [ RCX ], RAX
+				MOV				RAX, sieve_job.hi [ RDX ]
+				MOV				sieve_ckpt.hi [ RCX ], RAX
+				MOV				RAX, sieve_job.chunk [ RDX ]
+				MOV				sieve_ckpt.chunk [ RCX ], RAX
+				MOV				RAX, sieve_job.nchunks [ RDX ]
+				MOV				sieve_ckpt.nchunks [ RCX ], RAX
+				MOV				R9, sieve_job.count [ RDX ]
+				MOV				sieve_ckpt.count [ RCX ], R9
+				MOV				R8, sieve_job.workers [ RDX ]
+				LEA				R10, [ RCX + SIZEOF sieve_ckpt ]
+				MOV				R11, R9
+				TEST			R11, R11
+				JZ				@@check
+@@worker:		FOR				idx, < 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15 >
+				MOV				RAX, Q_PTR [ R8 ] [ idx * 8 ]
+				MOV				Q_PTR [ R10 ] [ idx * 8 ], RAX
+				ENDM
+				MOV				sieve_worker.work [ R10 ], 0
+				ADD				R8, SIZEOF sieve_worker
+				ADD				R10, SIZEOF sieve_worker
+				DEC				R11
+				JNZ				@@worker
+@@check:		Ckpt_Crc		RCX
+				MOV				sieve_ckpt.check [ RCX ], RAX
+				XOR				EAX, EAX							; return zero
+				RET
+sum_primes_checkpoint_u ENDP
+
+;--------------------------------------------------------------------------------------------------------------------------------------------------------------
+;			EXTERNDEF		sum_primes_resume_u:PROC		; s16 sum_primes_resume_u( sieve_job* job, u64* image );
+;			sum_primes_resume_u	-	restore a parallel sum of primes from a checkpoint image; then call the workers to finish it
+;			Prototype:		-	s16 sum_primes_resume_u( sieve_job* job, u64* image );
+;			job				-	Address of sieve_job (in RCX): count and workers ( each with its work address ) set by the caller
+;			image			-	Address of checkpoint image (in RDX), 64 byte aligned
+;			returns			-	(0) for success, (-1) if the image is not a checkpoint of this version, is for another count of workers,
+;								or fails its check, (GP_Fault) for mis-aligned image address
+;
+;			Note: the job's range, chunks, and each worker's range, counts and partial sum are restored; stop is cleared.
+;
+				Leaf_Entry		sum_primes_resume_u
+				CheckAlign		RDX									; (in) Image
+				MOV				RAX, sieve_ckpt_magic
+				CMP				sieve_ckpt.magic [ RDX ], RAX
+				JNE				@@err
+				CMP				sieve_ckpt.version [ RDX ], sieve_ckpt_version
+				JNE				@@err
+				MOV				R9, sieve_job.count [ RCX ]
+				CMP				sieve_ckpt.count [ RDX ], R9
+				JNE				@@err
+				Ckpt_Crc		RDX
+				CMP				sieve_ckpt.check [ RDX ], RAX
+				JNE				@@err
+
+				MOV				RAX, sieve_ckpt.lo [ RDX ]
+				MOV				sieve_job.lo [ RCX ], RAX
+				MOV				RAX, sieve_ckpt.hi [ RDX ]
+				MOV				sieve_job.hi [ RCX ], RAX
+				MOV				RAX, sieve_ckpt.chunk [ RDX ]
+				MOV				sieve_job.chunk [ RCX ], RAX
+				MOV				RAX, sieve_ckpt.nchunks [ RDX ]
+				MOV				sieve_job.nchunks [ RCX ], RAX
+				MOV				sieve_job.stop [ RCX ], 0
+				MOV				R8, sieve_job.workers [ RCX ]
+				LEA				R10, [ RDX + SIZEOF sieve_ckpt ]
+				TEST			R9, R9
+				JZ				@@done
+@@worker:		FOR				idx, < 0, 1, 2, 3, 4, 5, 6, 7 >
+				MOV				RAX, Q_PTR [ R10 ] [ idx * 8 ]
+				MOV				Q_PTR [ R8 ] [ idx * 8 ], RAX
+				ENDM
+				MOV				RAX, sieve_worker.range [ R10 ]
+				MOV				sieve_worker.range [ R8 ], RAX
+				MOV				RAX, sieve_worker.chunks [ R10 ]
+				MOV				sieve_worker.chunks [ R8 ], RAX
+				MOV				RAX, sieve_worker.steals [ R10 ]
+				MOV				sieve_worker.steals [ R8 ], RAX
+				ADD				R8, SIZEOF sieve_worker
+				ADD				R10, SIZEOF sieve_worker
+				DEC				R9
+				JNZ				@@worker
+@@done:			XOR				EAX, EAX							; return zero
+				RET
+@@err:			MOV				EAX, retcode_neg_one
+				RET
+sum_primes_resume_u ENDP
+
+;--------------------------------------------------------------------------------------------------------------------------------------------------------------
+;			Lucy_Tri		-	RDX:RAX = x ( x + 1 ) / 2 - 1, the sum of 2 to x, for x in RAX, below 2^52; R9 used
+;
+Lucy_Tri		MACRO
+				LEA				R9, [ RAX + 1 ]
+				MUL				R9
+				SHRD			RAX, RDX, 1
+				SHR				RDX, 1
+				SUB				RAX, 1
+				SBB				RDX, 0
+				ENDM
+
+;			Lucy_Update		-	subtract p ( S - sp ) from the 128 bit value at dest, S in RDX:RAX; p in R14, sp in RBX:R15; R10 used
+;
+Lucy_Update		MACRO			dest
+				SUB				RAX, R15
+				SBB				RDX, RBX
+				MOV				R10, RDX
+				IMUL			R10, R14
+				MUL				R14
+				ADD				RDX, R10
+				SUB				Q_PTR [ dest ], RAX
+				SBB				Q_PTR [ dest ] [ 8 ], RDX
+				ENDM
+
+;--------------------------------------------------------------------------------------------------------------------------------------------------------------
+;			EXTERNDEF		lucy_work_size_u:PROC		; s16 lucy_work_size_u( u64* bytes, u64 hi );
+;			lucy_work_size_u	-	size of the work memory for sum_primes_lucy_u below hi
+;			Prototype:		-	s16 lucy_work_size_u( u64* bytes, u64 hi );
+;			bytes			-	Address of QWORD to receive the size in bytes (in RCX)
+;			hi				-	end of the range (in RDX), at most 2^52
+;			returns			-	(0) for success, (-1) if hi is above 2^52
+;
+;			Note: 32 bytes for each r up to sqrt( hi ): 32 MB for hi of 2^40, 512 MB for 2^48.
+;
+				Leaf_Entry		lucy_work_size_u
+				MOV				R8, sieve_hi_max
+				CMP				RDX, R8
+				JA				@@err
+				LEA				RAX, [ RDX - 1 ]
+				CMP				RDX, 2
+				JAE				@F
+				MOV				EAX, 1
+@@:				Isqrt52
+				INC				RAX									; two tables of r + 1, 16 bytes each
+				SHL				RAX, 5
+				ADD				RAX, 63								; rounded up to 64 bytes
+				AND				RAX, -64
+				MOV				Q_PTR [ RCX ], RAX
+				XOR				EAX, EAX							; return zero
+				RET
+@@err:			MOV				EAX, retcode_neg_one
+				RET
+lucy_work_size_u ENDP
+
+;--------------------------------------------------------------------------------------------------------------------------------------------------------------
+;			EXTERNDEF		sum_primes_lucy_u:PROC		; s16 sum_primes_lucy_u( u64* sum, u64 hi, u64* work );
+;			sum_primes_lucy_u	-	sum of the primes below hi, without sieving the range: Lucy_Hedgehog's method, O( hi^(3/4) )
+;			Prototype:		-	s16 sum_primes_lucy_u( u64* sum, u64 hi, u64* work );
+;			sum				-	Address of 8 QWORDS to receive the sum (in RCX)
+;			hi				-	end of the range, not included (in RDX), at most 2^52
+;			work			-	Address of work memory (in R8), lucy_work_size_u( hi ) bytes, 64 byte aligned
+;			returns			-	(0) for success, (-1) if hi is above 2^52, (GP_Fault) for mis-aligned parameter address
+;
+;			Note: with n = hi - 1 and r = sqrt( n ), S( v ) is the sum of the integers 2 to v not crossed off by the primes below p.
+;			Only v = n / k is ever needed: r "small" values ( v = 1 to r ), and r "large" ( v = n / i, i = 1 to r ), at first the sum
+;			2 to v. For each prime p to r, for each v >= p^2, largest first:	S( v ) -= p ( S( v / p ) - S( p - 1 ) ).
+;			S( n ) is then the sum. Values are below n^2 / 2, 2^103, so each is 128 bits ( two QWORDS, less significant first,
+;			added and subtracted in registers ); the sum is returned as a ui512.
+;
+spl_Locals		STRUCT
+p2				QWORD			?									; p^2
+lim				QWORD			?									; large values to update: i to min( r, n / p^2 )
+lima			QWORD			?									; of those, n / ( i p ) is large: i to min( lim, r / p )
+pad				QWORD			5 dup (?)
+spl_Locals		ENDS
+
+				Proc_w_Local	sum_primes_lucy_u, spl_Locals, RBX, RSI, RDI, R12, R13, R14, R15
+
+				CheckAlign		RCX, @@exit							; (out) Sum
+				CheckAlign		R8, @@exit							; (in) Work
+				MOV				RAX, sieve_hi_max
+				CMP				RDX, RAX
+				JA				@@err
+				MOV				RSI, R8
+				Zero512Q		RCX
+				CMP				RDX, 3
+				JB				@@done								; no primes below 2
+				LEA				R12, [ RDX - 1 ]					; n
+				MOV				RAX, R12
+				Isqrt52
+				MOV				R13, RAX							; r
+				LEA				RDI, [ R13 + 1 ]					; small S( v ) at RSI, large S( n / i ) at RDI, 16 bytes, [ 0 ] not used
+				SHL				RDI, 4
+				ADD				RDI, RSI
+
+				XOR				EAX, EAX
+				MOV				Q_PTR [ RSI ], RAX
+				MOV				Q_PTR [ RSI ] [ 8 ], RAX
+				MOV				Q_PTR [ RDI ], RAX
+				MOV				Q_PTR [ RDI ] [ 8 ], RAX
+				MOV				ECX, 1
+@@init:			MOV				RAX, RCX							; small: the sum 2 to v
+				Lucy_Tri
+				MOV				R8, RCX
+				SHL				R8, 4
+				MOV				Q_PTR [ RSI + R8 ], RAX
+				MOV				Q_PTR [ RSI + R8 ] [ 8 ], RDX
+				MOV				RAX, R12							; large: the sum 2 to n / i
+				XOR				EDX, EDX
+				DIV				RCX
+				Lucy_Tri
+				MOV				Q_PTR [ RDI + R8 ], RAX
+				MOV				Q_PTR [ RDI + R8 ] [ 8 ], RDX
+				INC				RCX
+				CMP				RCX, R13
+				JBE				@@init
+
+				MOV				R14D, 2								; p
+@@p:			CMP				R14, R13
+				JA				@@result
+				MOV				RAX, R14
+				SHL				RAX, 4
+				MOV				R15, Q_PTR [ RSI + RAX ] [ -16 ]	; sp = S( p - 1 ), the sum of the primes below p
+				MOV				RBX, Q_PTR [ RSI + RAX ] [ -8 ]
+				CMP				Q_PTR [ RSI + RAX ], R15			; S( p ) is sp + p for a prime, sp if not
+				JE				@@pnext
+				MOV				RAX, R14
+				MUL				R14
+				MOV				l_Ptr.p2, RAX
+				MOV				R10, RAX
+				MOV				RAX, R12
+				XOR				EDX, EDX
+				DIV				R10
+				CMP				RAX, R13
+				CMOVA			RAX, R13
+				MOV				l_Ptr.lim, RAX
+				MOV				R11, RAX
+				MOV				RAX, R13
+				XOR				EDX, EDX
+				DIV				R14
+				CMP				RAX, R11
+				CMOVA			RAX, R11
+				MOV				l_Ptr.lima, RAX
+
+; large values, i p <= r: S( n / ( i p ) ) is large value i p
+				LEA				RCX, [ RDI + 16 ]					; S( n / i )
+				MOV				R8, R14
+				SHL				R8, 4
+				MOV				R9, R8
+				ADD				R8, RDI								; S( n / ( i p ) )
+				MOV				R11, RAX
+				TEST			R11, R11
+				JZ				@@b
+@@a:			MOV				RAX, Q_PTR [ R8 ]
+				MOV				RDX, Q_PTR [ R8 ] [ 8 ]
+				Lucy_Update		RCX
+				ADD				RCX, 16
+				ADD				R8, R9
+				DEC				R11
+				JNZ				@@a
+
+; large values, i p > r: S( n / ( i p ) ) is small value n / ( i p )
+@@b:			MOV				R11, l_Ptr.lim
+				MOV				RAX, l_Ptr.lima
+				SUB				R11, RAX
+				JZ				@@c
+				INC				RAX
+				MUL				R14
+				MOV				R8, RAX								; i p
+@@bloop:		MOV				RAX, R12
+				XOR				EDX, EDX
+				DIV				R8
+				SHL				RAX, 4
+				MOV				RDX, Q_PTR [ RSI + RAX ] [ 8 ]
+				MOV				RAX, Q_PTR [ RSI + RAX ]
+				Lucy_Update		RCX
+				ADD				RCX, 16
+				ADD				R8, R14
+				DEC				R11
+				JNZ				@@bloop
+
+; small values, r down to p^2: S( v / p ) is small value v / p
+@@c:			MOV				RCX, R13
+				CMP				RCX, l_Ptr.p2
+				JB				@@pnext
+@@cloop:		MOV				RAX, RCX
+				XOR				EDX, EDX
+				DIV				R14
+				SHL				RAX, 4
+				MOV				RDX, Q_PTR [ RSI + RAX ] [ 8 ]
+				MOV				RAX, Q_PTR [ RSI + RAX ]
+				MOV				R8, RCX
+				SHL				R8, 4
+				ADD				R8, RSI
+				Lucy_Update		R8
+				DEC				RCX
+				CMP				RCX, l_Ptr.p2
+				JAE				@@cloop
+
+@@pnext:		INC				R14
+				JMP				@@p
+
+@@result:		MOV				RCX, RCXHome						; S( n ), large value 1
+				MOV				RAX, Q_PTR [ RDI ] [ 16 ]
+				MOV				Q_PTR [ RCX ] [ 7 * 8 ], RAX
+				MOV				RAX, Q_PTR [ RDI ] [ 24 ]
+				MOV				Q_PTR [ RCX ] [ 6 * 8 ], RAX
+@@done:			XOR				EAX, EAX							; return zero
+				JMP				@@exit
+@@err:			MOV				EAX, retcode_neg_one
+@@exit:			Local_Exit		R15, R14, R13, R12, RDI, RSI, RBX
+sum_primes_lucy_u ENDP
+
+ui512_sieve		ENDS
+				END													; end of module
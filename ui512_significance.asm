@@ -120,5 +120,47 @@ msb_u			ENDP
 
 	ENDIF
 lsb_u			ENDP
+
+;--------------------------------------------------------------------------------------------------------------------------------------------------------------
+;			popcount_u	-	count the one bits in supplied source 512bit (8 QWORDS)
+;			Prototype:		s16 popcount_u( u64* source );
+;			source		-	Address of 64 byte aligned array of 8 64-bit words (QWORDS) 512 bits (in RCX)
+;			returns		-	number of one bits, 0 to 512 inclusive
+;			Note:	with VPOPCNTDQ, one count of all eight words, then added across the register (halves, quarters, eighths);
+;					otherwise eight POPCNTs into separate registers, summed in a tree so no add waits on more than two others
+;					__UsePOPCNTDQ is off by default (see ui512_compile_time_options.inc), so the scalar path is the one built and tested
+
+				Leaf_Entry		popcount_u						; Declare public proc, no prolog, no frame, exceptions handled by caller
+				CheckAlign		RCX								; (IN) source to count
+
+	IF __UseZ AND __UsePOPCNTDQ
+				VMOVDQA64		ZMM31, ZM_PTR [ RCX ]			; Load source
+				VPOPCNTQ		ZMM0, ZMM31						; count of each word, 0 to 64
+				VEXTRACTI64X4	YMM1, ZMM0, 1
+				VPADDQ			YMM0, YMM0, YMM1				; four sums
+				VEXTRACTI128	XMM1, YMM0, 1
+				VPADDQ			XMM0, XMM0, XMM1				; two
+				VPSHUFD			XMM1, XMM0, 0EEh				; high word down
+				VPADDQ			XMM0, XMM0, XMM1				; one
+				VMOVQ			RAX, XMM0
+	ELSE
+				POPCNT			RAX, Q_PTR [ RCX ] [ 0 * 8 ]
+				POPCNT			RDX, Q_PTR [ RCX ] [ 1 * 8 ]
+				POPCNT			R8, Q_PTR [ RCX ] [ 2 * 8 ]
+				POPCNT			R9, Q_PTR [ RCX ] [ 3 * 8 ]
+				POPCNT			R10, Q_PTR [ RCX ] [ 4 * 8 ]
+				POPCNT			R11, Q_PTR [ RCX ] [ 5 * 8 ]
+				ADD				RAX, RDX
+				ADD				R8, R9
+				ADD				R10, R11
+				POPCNT			RDX, Q_PTR [ RCX ] [ 6 * 8 ]
+				POPCNT			R9, Q_PTR [ RCX ] [ 7 * 8 ]
+				ADD				RAX, R8
+				ADD				R10, RDX
+				ADD				RAX, R9
+				ADD				RAX, R10
+	ENDIF
+				RET
+popcount_u		ENDP
 ui512_significance ENDS											; end of section
 				END												; end of module
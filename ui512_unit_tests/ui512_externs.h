@@ -69,6 +69,37 @@ extern "C"
 	// returns: zero for no carry, 1 for carry (overflow)
 	s16 add_uT64(const u64*, const u64*, const u64);
 
+	//	deferred carry accumulator: a 512 bit value, plus 128 pending bits; adds are a single ADD / ADC to the pending bits,
+	//	rippled into the value only when the carries reach 2^63, or on flush. 64 byte aligned
+	struct alignas ( 64 ) ui512_acc
+	{
+		u64 value [ 8 ];		// 512 bit value, pending bits not included
+		u64 lo;					// pending, less significant QWORD
+		u64 hi;					// pending, more significant QWORD ( carries out of lo ), below 2^63 between adds
+		u64 ovf;				// 1 if the value has carried out of 512 bits
+		u64 pad [ 5 ];
+	};
+
+	// s16 acc_init_u ( ui512_acc* acc );
+	// set accumulator to zero
+	// returns: zero
+	s16 acc_init_u(ui512_acc*);
+
+	// s16 acc_add_uT64 ( ui512_acc* acc, u64 addend );
+	// add 64bit QWORD (value) to accumulator, carries deferred
+	// returns: zero
+	s16 acc_add_uT64(ui512_acc*, const u64);
+
+	// s16 acc_add_uT128 ( ui512_acc* acc, u64 addend_lo, u64 addend_hi );
+	// add 128bit value ( two QWORDS ) to accumulator, carries deferred
+	// returns: zero
+	s16 acc_add_uT128(ui512_acc*, const u64, const u64);
+
+	// s16 acc_flush_u ( u64* sum, ui512_acc* acc );
+	// ripple pending bits into the accumulator's value, copy the value to sum; the accumulator may continue
+	// returns: zero for no carry, 1 for carry (overflow) out of 512 bits since acc_init_u
+	s16 acc_flush_u(const u64*, ui512_acc*);
+
 	//--------------------------------------------------------------------------------------------------------------------------------------------------------------
 	//
 	//	from ui512_subtraction.asm
@@ -119,6 +150,440 @@ extern "C"
 	//	Prototype:	s16 div_u ( u64 * quotient, u64 * remainder, u64 * dividend, u64 * divisor );
 	s16 div_u(const u64*, const u64*, const u64*, const u64*);
 
+	//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+	//
+	//	from ui512_reduction.asm
+	//
+
+	//	EXTERNDEF	reduce_xxx_u : PROC
+	//	reduce_xxx_u	reduce 1024 bit product (product, overflow halves from mult_u) modulo a fixed special-form prime
+	//	Prototype:	s16 reduce_xxx_u ( u64 * result, u64 * product, u64 * overflow );
+	//	returns:	zero for success, result is fully reduced ( 0 <= result < p ), leading words zeroed
+	s16 reduce_secp256k1_u(const u64*, const u64*, const u64*);		// p = 2^256 - 2^32 - 977
+	s16 reduce_p256_u(const u64*, const u64*, const u64*);			// p = 2^256 - 2^224 + 2^192 + 2^96 - 1
+	s16 reduce_p384_u(const u64*, const u64*, const u64*);			// p = 2^384 - 2^128 - 2^96 + 2^32 - 1
+	s16 reduce_25519_u(const u64*, const u64*, const u64*);			// p = 2^255 - 19
+	s16 reduce_448_u(const u64*, const u64*, const u64*);			// p = 2^448 - 2^224 - 1
+
+	//	the primes, as 64 byte aligned ui512 variables
+	extern const u64 prime_secp256k1[8];
+	extern const u64 prime_p256[8];
+	extern const u64 prime_p384[8];
+	extern const u64 prime_25519[8];
+	extern const u64 prime_448[8];
+
+	//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+	//
+	//	from ui512_modular.asm
+	//
+	//	Note: a Montgomery context is 32 QWORDS, 64 byte aligned: modulus, R^2 mod m, R mod m, -m^-1 mod 2^64, index of most significant QWORD of m
+	//	R = 2^(64 * n), n = number of significant QWORDS of the modulus
+
+	//	EXTERNDEF	mont_init_u : PROC
+	//	mont_init_u	set up a Montgomery context for an odd modulus
+	//	Prototype:	s16 mont_init_u ( u64 * ctx, u64 * modulus );
+	//	returns:	zero for success, -1 if modulus is even or one
+	s16 mont_init_u(const u64*, const u64*);
+
+	//	EXTERNDEF	mont_mul_u : PROC
+	//	mont_mul_u	Montgomery multiply, result = a * b * R^-1 mod m, a and b less than m
+	//	Prototype:	s16 mont_mul_u ( u64 * result, u64 * a, u64 * b, u64 * ctx );
+	s16 mont_mul_u(const u64*, const u64*, const u64*, const u64*);
+
+	//	EXTERNDEF	invmod_u : PROC
+	//	invmod_u	modular inverse, inverse = a^-1 mod m, odd modulus
+	//	Prototype:	s16 invmod_u ( u64 * inverse, u64 * a, u64 * modulus );
+	//	returns:	zero for success, -1 if no inverse exists, or modulus is even or one
+	s16 invmod_u(const u64*, const u64*, const u64*);
+
+	//	EXTERNDEF	invmod_u_batch : PROC
+	//	invmod_u_batch	modular inverse of each of count values (Montgomery's trick: one inversion, 3 (count - 1) multiplies), odd modulus
+	//	Prototype:	s16 invmod_u_batch ( u64 * out, u64 * in, u64 count, u64 * modulus );
+	//	out is also used as the prefix product scratch, must not overlap in; zero values get zero
+	//	returns:	zero for success, -1 if any value has no inverse, or modulus is even or one
+	s16 invmod_u_batch(const u64*, const u64*, const u64, const u64*);
+
+	//	EXTERNDEF	mont_pow_u : PROC
+	//	mont_pow_u	Montgomery exponentiation, result = base^exponent, base and result in Montgomery form
+	//	Prototype:	s16 mont_pow_u ( u64 * result, u64 * base, u64 * exponent, u64 * ctx );
+	s16 mont_pow_u(const u64*, const u64*, const u64*, const u64*);
+
+	//	EXTERNDEF	powmod_u : PROC
+	//	powmod_u	modular exponentiation, result = base^exponent mod m, odd modulus
+	//	Prototype:	s16 powmod_u ( u64 * result, u64 * base, u64 * exponent, u64 * modulus );
+	//	returns:	zero for success, -1 if modulus is even or one
+	s16 powmod_u(const u64*, const u64*, const u64*, const u64*);
+
+	//	EXTERNDEF	sqrtmod_u : PROC
+	//	sqrtmod_u	modular square root, root^2 = a mod p, odd prime p (the other root is p - root)
+	//	Prototype:	s16 sqrtmod_u ( u64 * root, u64 * a, u64 * prime );
+	//	returns:	zero for success, -1 if a is not a square mod p, or p is even or one
+	s16 sqrtmod_u(const u64*, const u64*, const u64*);
+
+	//	EXTERNDEF	jacobi_u : PROC
+	//	jacobi_u	Jacobi symbol ( a / n ), odd n (Legendre symbol for prime n)
+	//	Prototype:	s16 jacobi_u ( u64 * a, u64 * n );
+	//	returns:	1 or -1, zero if a and n share a factor, -2 if n is even or zero
+	s16 jacobi_u(const u64*, const u64*);
+
+	//	CRT context: moduli and Garner coefficients, set up by crt_init_u. 64 byte aligned
+	struct alignas ( 64 ) crt_ctx
+	{
+		u64 count;				// number of moduli, 1 to 16 ( crt_max )
+		u64 pad [ 7 ];
+		u64 primes [ 16 ];	// pairwise coprime moduli
+		u64 coef [ 16 ];	// Garner coefficients, ( p0 p1 ... p(i-1) )^-1 mod pi; coef [ 0 ] unused
+	};
+
+	//	EXTERNDEF	crt_init_u : PROC
+	//	crt_init_u	set up a CRT context for count pairwise coprime moduli ( word size, each above one )
+	//	Prototype:	s16 crt_init_u ( crt_ctx * ctx, u64 * primes, u64 count );
+	//	returns:	zero for success, -1 for count of zero or above 16, a modulus below two, or moduli not coprime
+	s16 crt_init_u(crt_ctx*, const u64*, u64);
+
+	//	EXTERNDEF	crt_reconstruct_u : PROC
+	//	crt_reconstruct_u	the value x mod p0 p1 ... p(n-1) with x = residues [ i ] mod pi ( Garner's mixed radix )
+	//	Prototype:	s16 crt_reconstruct_u ( u64 * out, u64 * residues, crt_ctx * ctx );
+	//	returns:	zero for success, 1 if x does not fit 512 bits ( out is x mod 2^512 )
+	s16 crt_reconstruct_u(const u64*, const u64*, const crt_ctx*);
+
+	//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+	//
+	//	from ui512_ec.asm
+	//
+	//	Note: points are Jacobian ( X, Y, Z ), 24 QWORDS, 64 byte aligned, coordinates in Montgomery form for the curve prime; infinity has Z = 0
+	//	affine points ( x, y ) are 16 QWORDS, also Montgomery form. Curve contexts are 80 QWORDS: Montgomery context for p, a, b, generator, order, kind
+	//	Curves: y^2 = x^3 + a x + b, a = 0 or a = -3
+
+	//	curve contexts, 64 byte aligned
+	extern const u64 curve_secp256k1[80];
+	extern const u64 curve_p256[80];
+	extern const u64 curve_p384[80];
+
+	//	EXTERNDEF	ec_curve_init_u : PROC
+	//	ec_curve_init_u	build a curve context from six consecutive ui512 values: p, a, b, generator x, generator y, order
+	//	Prototype:	s16 ec_curve_init_u ( u64 * curve, u64 * params );
+	//	returns:	zero for success, -1 if p is even or one, or a is neither 0 nor -3
+	s16 ec_curve_init_u(const u64*, const u64*);
+
+	//	EXTERNDEF	ec_from_affine_u : PROC
+	//	ec_from_affine_u	Jacobian point ( x, y, 1 ) in Montgomery form, from ordinary affine coordinates
+	//	Prototype:	s16 ec_from_affine_u ( u64 * P, u64 * x, u64 * y, u64 * curve );
+	s16 ec_from_affine_u(const u64*, const u64*, const u64*, const u64*);
+
+	//	EXTERNDEF	ec_to_affine_u : PROC
+	//	ec_to_affine_u	ordinary affine coordinates of a Jacobian point
+	//	Prototype:	s16 ec_to_affine_u ( u64 * x, u64 * y, u64 * P, u64 * curve );
+	//	returns:	zero for success, -1 if P is the point at infinity
+	s16 ec_to_affine_u(const u64*, const u64*, const u64*, const u64*);
+
+	//	EXTERNDEF	ec_double_u : PROC
+	//	ec_double_u	point doubling, R = 2P, R may be P
+	//	Prototype:	s16 ec_double_u ( u64 * R, u64 * P, u64 * curve );
+	s16 ec_double_u(const u64*, const u64*, const u64*);
+
+	//	EXTERNDEF	ec_add_u : PROC
+	//	ec_add_u	point addition, R = P + Q, R may be P or Q
+	//	Prototype:	s16 ec_add_u ( u64 * R, u64 * P, u64 * Q, u64 * curve );
+	s16 ec_add_u(const u64*, const u64*, const u64*, const u64*);
+
+	//	EXTERNDEF	ec_add_mixed_u : PROC
+	//	ec_add_mixed_u	mixed point addition, R = P + Q, Q affine (16 QWORDS), R may be P
+	//	Prototype:	s16 ec_add_mixed_u ( u64 * R, u64 * P, u64 * Q, u64 * curve );
+	s16 ec_add_mixed_u(const u64*, const u64*, const u64*, const u64*);
+
+	//	EXTERNDEF	ec_on_curve_u : PROC
+	//	ec_on_curve_u	check a Jacobian point is on the curve
+	//	Prototype:	s16 ec_on_curve_u ( u64 * P, u64 * curve );
+	//	returns:	zero if on the curve (or infinity), -1 if not
+	s16 ec_on_curve_u(const u64*, const u64*);
+
+	//	EXTERNDEF	ec_scalar_mul_u : PROC
+	//	ec_scalar_mul_u	variable base scalar multiplication, R = k P, width-5 NAF; R may be P. Run time depends on k (public scalars)
+	//	Prototype:	s16 ec_scalar_mul_u ( u64 * R, u64 * k, u64 * P, u64 * curve );
+	s16 ec_scalar_mul_u(const u64*, const u64*, const u64*, const u64*);
+
+	//	Fixed base comb tables: 8 QWORD header ( magic, teeth, blocks, spacing, bsize, bytes, pcheck, ncheck ), then blocks * 255 affine entries.
+	//	Size in bytes: 64 + blocks * 255 * 128. No pointers: a table can be written to a file and mapped back at any 64 byte aligned address.
+
+	//	EXTERNDEF	ec_comb_build_u : PROC
+	//	ec_comb_build_u	build a fixed base comb table for the curve's generator, blocks 1 to 8
+	//	Prototype:	s16 ec_comb_build_u ( u64 * table, u64 blocks, u64 * curve );
+	//	returns:	zero for success, -1 for blocks out of range
+	s16 ec_comb_build_u(const u64*, const u64, const u64*);
+
+	//	EXTERNDEF	ec_comb_mul_u : PROC
+	//	ec_comb_mul_u	fixed base scalar multiplication, R = k G, using a comb table
+	//	Prototype:	s16 ec_comb_mul_u ( u64 * R, u64 * k, u64 * table, u64 * curve );
+	//	returns:	zero for success, -1 if the table is not a complete comb table for the curve
+	s16 ec_comb_mul_u(const u64*, const u64*, const u64*, const u64*);
+
+	//	Multi-scalar multiply job, 8 QWORDS, 64 byte aligned: a slice of the terms and of the windows.
+	//	Slices covering each term and window once can run on separate threads (each with its own buckets); add their results with ec_add_u.
+	//	When splitting by windows, give every job the same window size.
+	struct alignas ( 64 ) ec_msm
+	{
+		const u64* scalars;		// count scalars, 8 QWORDS each
+		const u64* points;		// count affine points, 16 QWORDS each, Montgomery form, not infinity
+		u64 count;				// terms in the slice
+		const u64* curve;		// curve context
+		u64* buckets;			// scratch, ( 2^window - 1 ) * 24 QWORDS
+		u64 window;				// bits per window, 1 to 16, zero: ec_msm_window_u( count )
+		u64 wfirst;				// first window of the slice, zero is the least significant
+		u64 wcount;				// windows in the slice, zero: all from wfirst
+	};
+
+	//	EXTERNDEF	ec_msm_window_u : PROC
+	//	ec_msm_window_u	window size for a multi-scalar multiply of count terms, log2( count ) - 2, from 2 to 12
+	//	Prototype:	s16 ec_msm_window_u ( u64 count );
+	s16 ec_msm_window_u(const u64);
+
+	//	EXTERNDEF	ec_msm_u : PROC
+	//	ec_msm_u	multi-scalar multiplication (Pippenger bucket method) of a slice of terms and windows, R = sum k_i P_i
+	//	Prototype:	s16 ec_msm_u ( u64 * R, ec_msm * job );
+	//	returns:	zero for success, -1 for window out of range
+	s16 ec_msm_u(const u64*, const ec_msm*);
+
+	//	EXTERNDEF	ec_dual_mul_u : PROC
+	//	ec_dual_mul_u	double scalar multiplication (Shamir's trick), R = u1 P + u2 Q; u1 then u2 at u, 16 QWORDS; P then Q at PQ, 48 QWORDS
+	//	Prototype:	s16 ec_dual_mul_u ( u64 * R, u64 * u, u64 * PQ, u64 * curve );
+	s16 ec_dual_mul_u(const u64*, const u64*, const u64*, const u64*);
+
+	//	EXTERNDEF	ec_shamir_mul_u : PROC
+	//	ec_shamir_mul_u	double scalar multiplication (Shamir's trick), R = u1 G + u2 Q, G the curve's generator; u1 then u2 at u, 16 QWORDS
+	//	Prototype:	s16 ec_shamir_mul_u ( u64 * R, u64 * u, u64 * Q, u64 * curve );
+	s16 ec_shamir_mul_u(const u64*, const u64*, const u64*, const u64*);
+
+	//	EXTERNDEF	ec_glv_mul_u : PROC
+	//	ec_glv_mul_u	secp256k1 scalar multiplication, R = k P, k split as k1 + k2 lambda ( GLV endomorphism ), halves by ec_dual_mul_u
+	//	Prototype:	s16 ec_glv_mul_u ( u64 * R, u64 * k, u64 * P, u64 * curve );
+	//	returns:	zero for success, -1 if the curve is not secp256k1
+	s16 ec_glv_mul_u(const u64*, const u64*, const u64*, const u64*);
+
+	//	ECDSA signature to verify, 40 QWORDS, 64 byte aligned, ordinary values (not Montgomery form)
+	struct alignas ( 64 ) ecdsa_sig
+	{
+		u64 e [ 8 ];			// message hash, as an integer
+		u64 r [ 8 ];
+		u64 s [ 8 ];
+		u64 qx [ 8 ];			// public key
+		u64 qy [ 8 ];
+	};
+
+	//	EXTERNDEF	ec_ecdsa_verify_u : PROC
+	//	ec_ecdsa_verify_u	verify a batch of ECDSA signatures, one inversion mod n per group of 16
+	//	Prototype:	s16 ec_ecdsa_verify_u ( s16 * results, ecdsa_sig * sigs, u64 count, u64 * curve );
+	//	returns:	zero, results [ i ] zero for a valid signature, -1 invalid; -1 if the curve order is even
+	s16 ec_ecdsa_verify_u(s16*, const ecdsa_sig*, const u64, const u64*);
+
+	//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+	//
+	//	from ui512_x25519.asm
+	//
+
+	//	EXTERNDEF	x25519_u : PROC
+	//	x25519_u	X25519 function (RFC 7748), out = u coordinate of the clamped scalar times the point with u coordinate u
+	//				scalar and u are the integers decoded from their 32 little-endian bytes, in the low four QWORDS
+	//	Prototype:	s16 x25519_u ( u64 * out, u64 * scalar, u64 * u );
+	//	returns:	zero for success, -1 if the result is zero ( u of small order )
+	s16 x25519_u(const u64*, const u64*, const u64*);
+
+	//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+	//
+	//	from ui512_ed448.asm
+	//
+	//	Ed448 points are extended ( X, Y, Z, T ), 32 QWORDS, 64 byte aligned: x = X / Z, y = Y / Z, T = X Y / Z, values below p = 2^448 - 2^224 - 1
+	//	The neutral point is ( 0, 1, 1, 0 )
+
+	//	the base point ( extended, Z = 1 ) and its order
+	extern const u64 ed448_base[32];
+	extern const u64 ed448_order[8];
+
+	//	EXTERNDEF	ed448_from_affine_u : PROC
+	//	ed448_from_affine_u	extended point ( x, y, 1, x y ) from affine coordinates; not checked to be on the curve
+	//	Prototype:	s16 ed448_from_affine_u ( u64 * P, u64 * x, u64 * y );
+	//	returns:	zero for success, -1 if x or y is not below p
+	s16 ed448_from_affine_u(const u64*, const u64*, const u64*);
+
+	//	EXTERNDEF	ed448_to_affine_u : PROC
+	//	ed448_to_affine_u	affine coordinates x = X / Z, y = Y / Z
+	//	Prototype:	s16 ed448_to_affine_u ( u64 * x, u64 * y, u64 * P );
+	//	returns:	zero for success, -1 if Z is zero
+	s16 ed448_to_affine_u(const u64*, const u64*, const u64*);
+
+	//	EXTERNDEF	ed448_on_curve_u : PROC
+	//	ed448_on_curve_u	test that an extended point is on the curve ( and T Z = X Y )
+	//	Prototype:	s16 ed448_on_curve_u ( u64 * P );
+	//	returns:	zero if on the curve, -1 if not
+	s16 ed448_on_curve_u(const u64*);
+
+	//	EXTERNDEF	ed448_double_u : PROC
+	//	ed448_double_u	point doubling, R = 2P, R may be P
+	//	Prototype:	s16 ed448_double_u ( u64 * R, u64 * P );
+	s16 ed448_double_u(const u64*, const u64*);
+
+	//	EXTERNDEF	ed448_add_u : PROC
+	//	ed448_add_u	point addition, R = P + Q, complete (any P, Q), R may be P or Q
+	//	Prototype:	s16 ed448_add_u ( u64 * R, u64 * P, u64 * Q );
+	s16 ed448_add_u(const u64*, const u64*, const u64*);
+
+	//	EXTERNDEF	ed448_scalar_mul_u : PROC
+	//	ed448_scalar_mul_u	scalar multiplication, R = k P, k any 512 bit value. R may be P. Not constant time: run time depends on k, not for secret scalars
+	//	Prototype:	s16 ed448_scalar_mul_u ( u64 * R, u64 * k, u64 * P );
+	s16 ed448_scalar_mul_u(const u64*, const u64*, const u64*);
+
+	//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+	//
+	//	from ui512_sieve.asm
+	//
+	//	Sum of primes by a segmented Sieve of Eratosthenes ( mod 30 wheel, 32 KB segments ); the caller supplies the work memory
+
+	//	EXTERNDEF	sum_primes_u : PROC
+	//	sum_primes_u	sum of the primes p, lo <= p < hi, into a 512 bit sum; ranges may be split and summed separately
+	//	Prototype:	s16 sum_primes_u ( u64 * sum, u64 lo, u64 hi, u64 * work );
+	//	work:		sieve_work_size_u ( hi ) bytes, 64 byte aligned
+	//	returns:	zero for success, -1 if hi is above 2^52
+	s16 sum_primes_u(const u64*, u64, u64, u64*);
+
+	//	EXTERNDEF	sieve_work_size_u : PROC
+	//	sieve_work_size_u	bytes of work memory for sum_primes_u of a range below hi ( the segment, and the sieving primes below sqrt( hi ) )
+	//	Prototype:	s16 sieve_work_size_u ( u64 * bytes, u64 hi );
+	//	returns:	zero for success, -1 if hi is above 2^52
+	s16 sieve_work_size_u(u64*, u64);
+
+	//	EXTERNDEF	presieve_u : PROC
+	//	presieve_u	fill blocks of 64 wheel bytes ( each 30 integers, a bit for each of 1, 7, 11, 13, 17, 19, 23, 29 mod 30 ), from byte first,
+	//				with the candidates having no factor 7 to 31 ( those primes themselves, and 1, left set ); count the bits set
+	//	Prototype:	s16 presieve_u ( u64 * seg, u64 first, u64 blocks, u64 * count );
+	//	seg:		blocks * 64 bytes, 64 byte aligned
+	s16 presieve_u(u64*, u64, u64, u64*);
+
+	//	Parallel sum of primes: the range is cut into chunks, dealt out evenly to the workers; each worker runs on its own thread,
+	//	taking its own chunks from the front, then stealing the back half of another's. Partial sums are combined at the end.
+	struct alignas ( 64 ) sieve_worker
+	{
+		u64 sum [ 8 ];			// partial sum of the worker's chunks
+		u64 range;				// chunks left to the worker: next ( low 32 bits ), end ( high 32 bits )
+		u64* work;				// work memory, sieve_work_size_u ( hi ) bytes, 64 byte aligned
+		u64 chunks;				// chunks summed
+		u64 steals;				// chunk ranges stolen from other workers
+		u64 pad [ 4 ];
+	};
+
+	struct alignas ( 64 ) sieve_job
+	{
+		u64 lo;					// range: lo <= p < hi
+		u64 hi;
+		u64 chunk;				// integers per chunk, zero for the default ( about 10^9 )
+		u64 nchunks;			// set by sum_primes_init_u
+		u64 count;				// workers
+		sieve_worker* workers;	// count workers, 64 byte aligned
+		u64 stop;				// non zero: workers return before their next chunk
+		u64 pad;
+	};
+
+	//	EXTERNDEF	sum_primes_init_u : PROC
+	//	sum_primes_init_u	set up a parallel sum of primes: chunks, dealt out to the workers; partial sums and counts zeroed
+	//	Prototype:	s16 sum_primes_init_u ( sieve_job * job );
+	//	returns:	zero for success, -1 if hi is above 2^52, count is zero, or 2^32 - 1 chunks or more
+	s16 sum_primes_init_u(sieve_job*);
+
+	//	EXTERNDEF	sum_primes_worker_u : PROC
+	//	sum_primes_worker_u	run one worker until no chunks are left to it or to steal; one call per worker, each on its own thread
+	//	Prototype:	s16 sum_primes_worker_u ( sieve_job * job, u64 index );
+	//	returns:	zero for success, 1 if stopped ( job stop set ), -1 if index is not below count
+	s16 sum_primes_worker_u(sieve_job*, u64);
+
+	//	EXTERNDEF	sum_primes_combine_u : PROC
+	//	sum_primes_combine_u	add the workers' partial sums ( add_u_wc ), after all have returned, into 16 QWORDS, the more significant 512 bits first
+	//	Prototype:	s16 sum_primes_combine_u ( u64 * sum, sieve_job * job );
+	s16 sum_primes_combine_u(const u64*, const sieve_job*);
+
+	//	Checkpoint: once all workers have returned ( stop set, or done ), the job is saved as an image of 64 + 128 count bytes:
+	//	a header ( magic "ui512sck", version 1, lo, hi, chunk, nchunks, count, CRC-32C ), then each worker's partial sum, range and counts
+	//	as raw 64 byte blocks. Write it to a new file, flush, and rename it over the old checkpoint; resume in any later process.
+
+	//	EXTERNDEF	sum_primes_checkpoint_u : PROC
+	//	sum_primes_checkpoint_u	save a stopped parallel sum of primes
+	//	Prototype:	s16 sum_primes_checkpoint_u ( u64 * image, sieve_job * job );
+	s16 sum_primes_checkpoint_u(const u64*, const sieve_job*);
+
+	//	EXTERNDEF	sum_primes_resume_u : PROC
+	//	sum_primes_resume_u	restore a parallel sum of primes from a checkpoint image ( count and workers, with work addresses, set by the caller )
+	//	Prototype:	s16 sum_primes_resume_u ( sieve_job * job, u64 * image );
+	//	returns:	zero for success, -1 if the image is not a version 1 checkpoint, is for another count of workers, or fails its check
+	s16 sum_primes_resume_u(sieve_job*, const u64*);
+
+	//	EXTERNDEF	sum_primes_lucy_u : PROC
+	//	sum_primes_lucy_u	sum of the primes below hi, without sieving: Lucy_Hedgehog's method over the 2 sqrt( hi ) values of hi / k, O( hi^(3/4) )
+	//	Prototype:	s16 sum_primes_lucy_u ( u64 * sum, u64 hi, u64 * work );
+	//	work:		lucy_work_size_u ( hi ) bytes, 64 byte aligned
+	//	returns:	zero for success, -1 if hi is above 2^52
+	s16 sum_primes_lucy_u(const u64*, u64, u64*);
+
+	//	EXTERNDEF	lucy_work_size_u : PROC
+	//	lucy_work_size_u	bytes of work memory for sum_primes_lucy_u below hi, 32 ( sqrt( hi ) + 1 ): 512 MB for hi of 2^48
+	//	Prototype:	s16 lucy_work_size_u ( u64 * bytes, u64 hi );
+	//	returns:	zero for success, -1 if hi is above 2^52
+	s16 lucy_work_size_u(u64*, u64);
+
+	//--------------------------------------------------------------------------------------------------------------------------------------------------------------
+	//
+	//	from ui512_prime.asm
+	//
+
+	//	EXTERNDEF	is_probable_prime_u : PROC
+	//	is_probable_prime_u	Baillie-PSW probable prime test: trial division by the odd primes below 256, strong probable prime test
+	//				to base 2, strong Lucas test ( Selfridge's D, P, Q ); then rounds further strong tests to bases 3, 5, 7, ... ( at most 53 )
+	//	Prototype:	s16 is_probable_prime_u ( u64 * n, u64 rounds );
+	//	returns:	1 if n is a probable prime ( certainly prime below 2^64 ), 0 if n is composite, zero or one
+	s16 is_probable_prime_u(const u64*, u64);
+
+	//	EXTERNDEF	gcd_u : PROC
+	//	gcd_u		greatest common divisor ( binary algorithm ), gcd of zero and b is b
+	//	Prototype:	s16 gcd_u ( u64 * gcd, u64 * a, u64 * b );
+	s16 gcd_u(const u64*, const u64*, const u64*);
+
+	//	EXTERNDEF	factor_rho_u : PROC
+	//	factor_rho_u	a proper factor of n ( not necessarily prime ), Pollard's rho with Brent's cycle detection, one gcd per block of steps
+	//	Prototype:	s16 factor_rho_u ( u64 * n, u64 * factor );
+	//	returns:	0 factor found, 1 none found within the step limit, -1 if n is below 4 or a probable prime
+	s16 factor_rho_u(const u64*, const u64*);
+
+	//	EXTERNDEF	isqrt_u : PROC
+	//	isqrt_u		integer square root, root = floor( sqrt( a ) )
+	//	Prototype:	s16 isqrt_u ( u64 * root, u64 * a );
+	s16 isqrt_u(const u64*, const u64*);
+
+	//	EXTERNDEF	iroot_u : PROC
+	//	iroot_u		integer k-th root, root = floor( a^( 1 / k ) )
+	//	Prototype:	s16 iroot_u ( u64 * root, u64 * a, u64 k );
+	//	returns:	zero for success, -1 for k of zero
+	s16 iroot_u(const u64*, const u64*, u64);
+
+	//	random_fill	caller's source of random bits for gen_prime_u: fill count QWORDS at dest, return zero (non-zero for failure)
+	//	Prototype:	s16 random ( u64 * dest, u64 count, void * context );
+	typedef s16 (*random_fill)(u64*, u64, void*);
+
+	//	EXTERNDEF	gen_prime_u : PROC
+	//	gen_prime_u	random probable prime of exactly bits bits, from ( bits + 63 ) / 64 QWORDS of random per start
+	//				no harder to guess than what random supplies: for keys, use the system's CSPRNG ( BCryptGenRandom )
+	//	Prototype:	s16 gen_prime_u ( u64 * out, u64 bits, random_fill random, void * context );
+	//	returns:	zero for success, -1 for bits out of 2 to 512, or random's non-zero return
+	s16 gen_prime_u(u64*, u64, random_fill, void*);
+
+	//	EXTERNDEF	batch_gcd_size_u : PROC
+	//	batch_gcd_size_u	QWORDS of work area for batch_gcd_u of n values: 8 m ( h + 8 ) + 16, m the power of two at or above n, h its log2
+	//	Prototype:	u64 batch_gcd_size_u ( u64 n );
+	u64 batch_gcd_size_u(u64);
+
+	//	EXTERNDEF	batch_gcd_u : PROC
+	//	batch_gcd_u	gcd of each value with the product of all the others, by a product tree and a remainder tree
+	//				Karatsuba products, but schoolbook divides: about 128 m^2 QWORD multiplies, quadratic in n; practical to a few tens of thousands
+	//	Prototype:	s16 batch_gcd_u ( u64 * results, u64 * values, u64 n, u64 * work );
+	//	returns:	zero for success, -1 for n of zero or a zero value
+	s16 batch_gcd_u(u64*, const u64*, u64, u64*);
+
 	//--------------------------------------------------------------------------------------------------------------------------------------------------------------
 	//
 	//	from ui512_significance.asm
@@ -134,6 +599,11 @@ extern "C"
 	// returns: -1 if no least significant bit, bit number otherwise, bits numbered 0 to 511 inclusive
 	s16 lsb_u(const u64*);
 
+	// EXTERNDEF	popcount_u : PROC
+	// count the one bits in supplied source 512bit (8 QWORDS)
+	// returns: number of one bits, 0 to 512 inclusive
+	s16 popcount_u(const u64*);
+
 	//--------------------------------------------------------------------------------------------------------------------------------------------------------------
 	//
 	//	from ui512_shift.asm
@@ -42,6 +42,7 @@
 #include <chrono>
 #include "intrin.h"
 #include <string>
+#include <new>
 
 using namespace std;
 using namespace Microsoft::VisualStudio::CppUnitTestFramework;
@@ -60,7 +61,8 @@ namespace ui512_Unit_Tests
 	const bool pipeline_test = true;
 
 
-	//enum Perf_Tests { Comp, Comp64, Add, AddwC, Add64, Sub, Subwb, Sub64, Mul, Mul64, Div, Div64, And, Or, Xor, Not, Shl, Shr, msb, lsb };
+	//enum Perf_Tests { Comp, Comp64, Add, AddwC, Add64, Sub, Subwb, Sub64, Mul, Mul64, Div, Div64, And, Or, Xor, Not, Shl, Shr, msb, lsb,
+	//		RedK1, RedP256, RedP384, Red25519, Red448, MontMul, InvMod, PowMod, SqrtMod, Jacobi, EcDbl, EcAdd, EcMul, EcComb, EcMsm, X25519, EcGlv, Ed448Mul, SumPrimes, LucySum, AccAdd64, Presieve, IsPrime, Gcd, FactorRho, Isqrt, Iroot, Crt, GenPrime, BatchGcd, popcount };
 	const string TestName [ ] = { "Compare: 512 <=> 512", "Compare 512 <=> 64",
 		"Add: 512 + 512", "Add: 512 + 512 + carry", "Add: 512 + 64",
 		"Subtract: 512 - 512", "Subtract: 512 - 512 - borrow", "Subtract: 512 - 64",
@@ -68,7 +70,16 @@ namespace ui512_Unit_Tests
 		"Divide: 512 / 512", "Divide: 512 / 64",
 		"Logical bit AND", "Logical bit OR", "Logical bit XOR", "Logical bit NOT",
 		"Shift Left", "Shift Right",
-		"Most significant bit", "Least significant bit"
+		"Most significant bit", "Least significant bit",
+		"Reduce mod secp256k1", "Reduce mod P-256", "Reduce mod P-384", "Reduce mod 2^255-19", "Reduce mod 2^448-2^224-1",
+		"Montgomery multiply", "Modular inverse", "Modular exponentiation", "Modular square root", "Jacobi symbol",
+		"EC point double", "EC point add", "EC scalar multiply", "EC comb multiply",
+		"EC multi-scalar multiply", "X25519", "EC GLV scalar multiply", "Ed448 scalar multiply", "Sum of primes", "Sum of primes, Lucy_Hedgehog",
+		"Accumulator add x64", "Pre-sieve, one segment", "Probable prime, 256 bit prime",
+		"Greatest common divisor", "Pollard rho, 20 and 33 bit factors",
+		"Integer square root, 512 bit", "Integer cube root, 512 bit",
+		"CRT reconstruct, nine 62 bit primes", "Random prime, 256 bit",
+		"Batch gcd, 64 values of 512 bits", "Population count"
 	};
 
 	/// <summary>
@@ -107,6 +118,107 @@ namespace ui512_Unit_Tests
 		};
 	};
 
+	/// <summary>
+	/// Random source for gen_prime_u in the tests: splitmix64 (Steele, Lea, Flood, OOPSLA 2014), repeatable from its state.
+	/// Not for keys; a 64 bit state gives at most 2^64 outputs, and each output gives away the state.
+	/// </summary>
+	/// <param name="dest">QWORDS to be filled</param>
+	/// <param name="count">number of QWORDS</param>
+	/// <param name="state">address of the u64 state, advanced</param>
+	/// <returns>zero</returns>
+	extern s16 SplitMixFill( u64* dest, u64 count, void* state )
+	{
+		u64* s = ( u64* ) state;
+		for ( u64 i = 0; i < count; i++ )
+		{
+			u64 z = ( *s += 0x9e3779b97f4a7c15ull );
+			z = ( z ^ ( z >> 30 ) ) * 0xbf58476d1ce4e5b9ull;
+			z = ( z ^ ( z >> 27 ) ) * 0x94d049bb133111ebull;
+			dest [ i ] = z ^ ( z >> 31 );
+		};
+		return 0;
+	};
+
+	/// <summary>
+	/// Random fill of ui512 variable, less than supplied modulus
+	/// </summary>
+	/// <param name="var">512 bit variable to be filled</param>
+	/// <param name="mod">modulus, result is 0 <= var < mod</param>
+	/// <param name="seed">seed for random number generator</param>
+	/// <returns>none</returns>
+	extern void RandomFillMod( u64* var, const u64* mod, u64* seed )
+	{
+		RandomFill( var, seed );
+		const int bits = msb_u( mod ) + 1;
+		for ( int j = 0; j < 8; j++ )
+		{
+			const int lowbit = ( 7 - j ) * 64;
+			if ( lowbit >= bits )
+			{
+				var [ j ] = 0;
+			}
+			else if ( bits - lowbit < 64 )
+			{
+				var [ j ] &= ( 1ull << ( bits - lowbit ) ) - 1;
+			};
+		};
+		while ( compare_u( var, mod ) >= 0 )
+		{
+			sub_u( var, var, mod );
+		};
+	};
+
+	/// <summary>
+	/// Reference modular multiply, shift and add (one bit at a time), for checking the faster routines
+	/// Uses only add, subtract, compare, and shift; modulus must be less than 2^511, a and b less than modulus
+	/// </summary>
+	/// <param name="result">a * b mod mod</param>
+	/// <param name="a">multiplicand</param>
+	/// <param name="b">multiplier</param>
+	/// <param name="mod">modulus</param>
+	/// <returns>none</returns>
+	extern void MulModRef( u64* result, const u64* a, const u64* b, const u64* mod )
+	{
+		_UI512( r ) { 0 };
+		_UI512( aa ) { 0 };
+		copy_u( aa, a );
+		for ( int i = msb_u( b ); i >= 0; i-- )
+		{
+			bool carry = ( r [ 0 ] >> 63 ) != 0;			// moduli may use all 512 bits: a carry out is always > mod
+			shl_u( r, r, 1 );
+			if ( carry || compare_u( r, mod ) >= 0 )
+			{
+				sub_u( r, r, mod );
+			};
+			if ( ( b [ 7 - i / 64 ] >> ( i % 64 ) ) & 1ull )
+			{
+				carry = add_u( r, r, aa ) != 0;
+				if ( carry || compare_u( r, mod ) >= 0 )
+				{
+					sub_u( r, r, mod );
+				};
+			};
+		};
+		copy_u( result, r );
+	};
+
+	/// <summary>
+	/// Work memory for sum_primes_u of ranges below hi, 64 byte aligned
+	/// </summary>
+	/// <param name="hi">end of the ranges to be summed</param>
+	/// <returns>work memory, release with FreeSieveWork</returns>
+	u64* AllocSieveWork( u64 hi )
+	{
+		u64 bytes = 0;
+		Assert::AreEqual( s16( 0 ), sieve_work_size_u( &bytes, hi ), L"Return code failed work size" );
+		return ( u64* ) ::operator new ( size_t( bytes ), std::align_val_t( 64 ) );
+	};
+
+	void FreeSieveWork( u64* work )
+	{
+		::operator delete ( ( void* ) work, std::align_val_t( 64 ) );
+	};
+
 	/// <summary>
 	/// 
 	/// </summary>
@@ -482,6 +594,503 @@ namespace ui512_Unit_Tests
 		return ( __rdtsc( ) - start );
 	};
 
+	/// <summary>
+	/// 
+	/// </summary>
+	/// <returns></returns>
+	u64 DurationTest_popcount( )
+	{
+		_UI512( num1 ) { 7, 6, 5, 4, 3, 2, 1, 0 };
+		s16 result = 0;
+		if ( !pipeline_test )
+		{
+			for ( int j = 0; j < 8; j++ )
+			{
+				num1 [ j ] = RandomU64( &seed );
+			}
+		}
+		u64 start = __rdtsc( );
+		result = popcount_u( num1 );
+		return ( __rdtsc( ) - start );
+	};
+
+	/// <summary>
+	/// 
+	/// </summary>
+	/// <returns></returns>
+	u64 DurationTest_RedK1( )
+	{
+		_UI512( product ) { 7, 6, 5, 4, 3, 2, 1, 0 };
+		_UI512( overflow ) { 0 };
+		_UI512( result ) { 0 };
+		u64 start = __rdtsc( );
+		reduce_secp256k1_u( result, product, overflow );
+		return ( __rdtsc( ) - start );
+	};
+
+	/// <summary>
+	/// 
+	/// </summary>
+	/// <returns></returns>
+	u64 DurationTest_RedP256( )
+	{
+		_UI512( product ) { 7, 6, 5, 4, 3, 2, 1, 0 };
+		_UI512( overflow ) { 0 };
+		_UI512( result ) { 0 };
+		u64 start = __rdtsc( );
+		reduce_p256_u( result, product, overflow );
+		return ( __rdtsc( ) - start );
+	};
+
+	/// <summary>
+	/// 
+	/// </summary>
+	/// <returns></returns>
+	u64 DurationTest_RedP384( )
+	{
+		_UI512( product ) { 7, 6, 5, 4, 3, 2, 1, 0 };
+		_UI512( overflow ) { 0, 0, 0, 0, 4, 3, 2, 1 };
+		_UI512( result ) { 0 };
+		u64 start = __rdtsc( );
+		reduce_p384_u( result, product, overflow );
+		return ( __rdtsc( ) - start );
+	};
+
+	/// <summary>
+	/// 
+	/// </summary>
+	/// <returns></returns>
+	u64 DurationTest_Red25519( )
+	{
+		_UI512( product ) { 7, 6, 5, 4, 3, 2, 1, 0 };
+		_UI512( overflow ) { 0 };
+		_UI512( result ) { 0 };
+		u64 start = __rdtsc( );
+		reduce_25519_u( result, product, overflow );
+		return ( __rdtsc( ) - start );
+	};
+
+	/// <summary>
+	/// 
+	/// </summary>
+	/// <returns></returns>
+	u64 DurationTest_Red448( )
+	{
+		_UI512( product ) { 7, 6, 5, 4, 3, 2, 1, 0 };
+		_UI512( overflow ) { 0, 0, 6, 5, 4, 3, 2, 1 };
+		_UI512( result ) { 0 };
+		u64 start = __rdtsc( );
+		reduce_448_u( result, product, overflow );
+		return ( __rdtsc( ) - start );
+	};
+
+	u64 DurationTest_MontMul( )
+	{
+		alignas ( 64 ) u64 ctx [ 32 ] { };
+		_UI512( num1 ) { 0, 0, 0, 0, 7, 6, 5, 4 };
+		_UI512( num2 ) { 0, 0, 0, 0, 3, 2, 1, 0 };
+		_UI512( result ) { 0 };
+		mont_init_u( ctx, prime_p256 );
+		u64 start = __rdtsc( );
+		mont_mul_u( result, num1, num2, ctx );
+		return ( __rdtsc( ) - start );
+	};
+
+	u64 DurationTest_InvMod( )
+	{
+		_UI512( num1 ) { 0, 0, 0, 0, 7, 6, 5, 4 };
+		_UI512( result ) { 0 };
+		u64 start = __rdtsc( );
+		invmod_u( result, num1, prime_p256 );
+		return ( __rdtsc( ) - start );
+	};
+
+	u64 DurationTest_PowMod( )
+	{
+		_UI512( num1 ) { 0, 0, 0, 0, 7, 6, 5, 4 };
+		_UI512( exponent ) { 0, 0, 0, 0, 0xFFFFFFFF00000001ull, 0, 0x00000000FFFFFFFFull, 0xFFFFFFFFFFFFFFFDull };
+		_UI512( result ) { 0 };
+		u64 start = __rdtsc( );
+		powmod_u( result, num1, exponent, prime_p256 );
+		return ( __rdtsc( ) - start );
+	};
+
+	u64 DurationTest_SqrtMod( )
+	{
+		_UI512( num1 ) { 0, 0, 0, 0, 0, 0, 0, 49 };
+		_UI512( result ) { 0 };
+		u64 start = __rdtsc( );
+		sqrtmod_u( result, num1, prime_p256 );
+		return ( __rdtsc( ) - start );
+	};
+
+	u64 DurationTest_Jacobi( )
+	{
+		_UI512( num1 ) { 0, 0, 0, 0, 7, 6, 5, 4 };
+		u64 start = __rdtsc( );
+		jacobi_u( num1, prime_p256 );
+		return ( __rdtsc( ) - start );
+	};
+
+	u64 DurationTest_EcDbl( )
+	{
+		alignas ( 64 ) u64 point [ 24 ];
+		for ( int j = 0; j < 8; j++ )
+		{
+			point [ j ] = curve_p256 [ 48 + j ];			// generator x, y, and Z = one, all Montgomery form
+			point [ 8 + j ] = curve_p256 [ 56 + j ];
+			point [ 16 + j ] = curve_p256 [ 16 + j ];
+		};
+		u64 start = __rdtsc( );
+		ec_double_u( point, point, curve_p256 );
+		return ( __rdtsc( ) - start );
+	};
+
+	u64 DurationTest_EcAdd( )
+	{
+		alignas ( 64 ) u64 point1 [ 24 ];
+		alignas ( 64 ) u64 point2 [ 24 ];
+		for ( int j = 0; j < 8; j++ )
+		{
+			point1 [ j ] = curve_p256 [ 48 + j ];
+			point1 [ 8 + j ] = curve_p256 [ 56 + j ];
+			point1 [ 16 + j ] = curve_p256 [ 16 + j ];
+		};
+		ec_double_u( point2, point1, curve_p256 );
+		u64 start = __rdtsc( );
+		ec_add_u( point2, point2, point1, curve_p256 );
+		return ( __rdtsc( ) - start );
+	};
+
+	u64 DurationTest_EcMul( )
+	{
+		alignas ( 64 ) u64 point [ 24 ];
+		_UI512( k ) { 0, 0, 0, 0, 0x0123456789ABCDEFull, 0xFEDCBA9876543210ull, 0x0F1E2D3C4B5A6978ull, 0x8796A5B4C3D2E1F0ull };
+		for ( int j = 0; j < 8; j++ )
+		{
+			point [ j ] = curve_p256 [ 48 + j ];
+			point [ 8 + j ] = curve_p256 [ 56 + j ];
+			point [ 16 + j ] = curve_p256 [ 16 + j ];
+		};
+		u64 start = __rdtsc( );
+		ec_scalar_mul_u( point, k, point, curve_p256 );
+		return ( __rdtsc( ) - start );
+	};
+
+	u64 DurationTest_EcComb( )
+	{
+		alignas ( 64 ) static u64 table [ ( 64 + 2 * 255 * 128 ) / 8 ];
+		static bool built = false;
+		alignas ( 64 ) u64 point [ 24 ];
+		_UI512( k ) { 0, 0, 0, 0, 0x0123456789ABCDEFull, 0xFEDCBA9876543210ull, 0x0F1E2D3C4B5A6978ull, 0x8796A5B4C3D2E1F0ull };
+		if ( !built )
+		{
+			ec_comb_build_u( table, 2, curve_p256 );
+			built = true;
+		};
+		u64 start = __rdtsc( );
+		ec_comb_mul_u( point, k, table, curve_p256 );
+		return ( __rdtsc( ) - start );
+	};
+
+	u64 DurationTest_EcMsm( )
+	{
+		// 64 terms, each the generator with a random scalar
+		const int terms = 64;
+		alignas ( 64 ) static u64 scalars [ terms * 8 ];
+		alignas ( 64 ) static u64 points [ terms * 16 ];
+		alignas ( 64 ) static u64 buckets [ 255 * 24 ];
+		static bool built = false;
+		alignas ( 64 ) u64 result [ 24 ];
+		if ( !built )
+		{
+			u64 seed = 0;
+			for ( int i = 0; i < terms; i++ )
+			{
+				RandomFillMod( scalars + i * 8, curve_p256 + 64, &seed );
+				for ( int j = 0; j < 16; j++ )
+				{
+					points [ i * 16 + j ] = curve_p256 [ 48 + j ];
+				};
+			};
+			built = true;
+		};
+		ec_msm job { scalars, points, u64( terms ), curve_p256, buckets, 0, 0, 0 };
+		u64 start = __rdtsc( );
+		ec_msm_u( result, &job );
+		return ( __rdtsc( ) - start );
+	};
+
+	/// <summary>
+	/// 
+	/// </summary>
+	/// <returns></returns>
+	u64 DurationTest_X25519( )
+	{
+		_UI512( scalar ) { 0, 0, 0, 0, 0x0123456789ABCDEFull, 0xFEDCBA9876543210ull, 0x0F1E2D3C4B5A6978ull, 0x8796A5B4C3D2E1F0ull };
+		_UI512( u ) { 0, 0, 0, 0, 0, 0, 0, 9 };
+		_UI512( result ) { 0 };
+		u64 start = __rdtsc( );
+		x25519_u( result, scalar, u );
+		return ( __rdtsc( ) - start );
+	};
+
+	/// <summary>
+	/// 
+	/// </summary>
+	/// <returns></returns>
+	u64 DurationTest_EcGlv( )
+	{
+		_UI512( k ) { 0, 0, 0, 0, 0x0123456789ABCDEFull, 0xFEDCBA9876543210ull, 0x0F1E2D3C4B5A6978ull, 0x8796A5B4C3D2E1F0ull };
+		alignas ( 64 ) u64 point [ 24 ];
+		alignas ( 64 ) u64 result [ 24 ];
+		for ( int j = 0; j < 16; j++ )
+		{
+			point [ j ] = curve_secp256k1 [ 48 + j ];
+		};
+		for ( int j = 0; j < 8; j++ )
+		{
+			point [ 16 + j ] = curve_secp256k1 [ 16 + j ];
+		};
+		u64 start = __rdtsc( );
+		ec_glv_mul_u( result, k, point, curve_secp256k1 );
+		return ( __rdtsc( ) - start );
+	};
+
+	/// <summary>
+	/// 
+	/// </summary>
+	/// <returns></returns>
+	u64 DurationTest_Ed448Mul( )
+	{
+		_UI512( k ) { 0x0123456789ABCDEFull, 0xFEDCBA9876543210ull, 0x0F1E2D3C4B5A6978ull, 0x8796A5B4C3D2E1F0ull,
+			0x0123456789ABCDEFull, 0xFEDCBA9876543210ull, 0x0F1E2D3C4B5A6978ull, 0x8796A5B4C3D2E1F0ull };
+		alignas ( 64 ) u64 result [ 32 ];
+		u64 start = __rdtsc( );
+		ed448_scalar_mul_u( result, k, ed448_base );
+		return ( __rdtsc( ) - start );
+	};
+
+	/// <summary>
+	/// 
+	/// </summary>
+	/// <returns></returns>
+	u64 DurationTest_SumPrimes( )
+	{
+		// a small range ( one short segment, sieving primes to 4096 ): the per call cost; see ui512sv_02 for whole ranges
+		static u64* work = AllocSieveWork( ( 1ull << 24 ) + ( 1ull << 16 ) );
+		_UI512( sum ) { 0 };
+		u64 start = __rdtsc( );
+		sum_primes_u( sum, 1ull << 24, ( 1ull << 24 ) + ( 1ull << 16 ), work );
+		return ( __rdtsc( ) - start );
+	};
+
+	/// <summary>
+	/// 
+	/// </summary>
+	/// <returns></returns>
+	u64 DurationTest_LucySum( )
+	{
+		alignas ( 64 ) static u64 work [ 1024 ];
+		_UI512( sum ) { 0 };
+		u64 start = __rdtsc( );
+		sum_primes_lucy_u( sum, 1ull << 16, work );
+		return ( __rdtsc( ) - start );
+	};
+
+	/// <summary>
+	/// 
+	/// </summary>
+	/// <returns></returns>
+	u64 DurationTest_AccAdd64( )
+	{
+		static ui512_acc acc { };
+		u64 val = 123456;
+		if ( !pipeline_test )
+		{
+			val = RandomU64( &seed );
+		}
+		u64 start = __rdtsc( );
+		acc_add_uT64( &acc, val );
+		return ( __rdtsc( ) - start );
+	};
+
+	/// <summary>
+	/// 
+	/// </summary>
+	/// <returns></returns>
+	u64 DurationTest_Presieve( )
+	{
+		alignas ( 64 ) static u64 seg [ 4096 ];
+		u64 first = 1ull << 40;
+		u64 count = 0;
+		if ( !pipeline_test )
+		{
+			first = RandomU64( &seed ) >> 16;
+		}
+		u64 start = __rdtsc( );
+		presieve_u( seg, first, 512, &count );
+		return ( __rdtsc( ) - start );
+	};
+
+	/// <summary>
+	/// 
+	/// </summary>
+	/// <returns></returns>
+	u64 DurationTest_IsPrime( )
+	{
+		const u64* n = prime_secp256k1;
+		if ( !pipeline_test )
+		{
+			n = ( RandomU64( &seed ) & 1 ) ? prime_secp256k1 : prime_p256;
+		}
+		u64 start = __rdtsc( );
+		is_probable_prime_u( n, 0 );
+		return ( __rdtsc( ) - start );
+	};
+
+	/// <summary>
+	/// 
+	/// </summary>
+	/// <returns></returns>
+	u64 DurationTest_Gcd( )
+	{
+		_UI512( a ) { 0 };
+		_UI512( b ) { 0 };
+		_UI512( g ) { 0 };
+		copy_u( a, prime_p256 );
+		copy_u( b, prime_secp256k1 );
+		if ( !pipeline_test )
+		{
+			for ( int j = 0; j < 8; j++ )
+			{
+				a [ j ] = RandomU64( &seed );
+				b [ j ] = RandomU64( &seed );
+			}
+		}
+		u64 start = __rdtsc( );
+		gcd_u( g, a, b );
+		return ( __rdtsc( ) - start );
+	};
+
+	/// <summary>
+	/// 
+	/// </summary>
+	/// <returns></returns>
+	u64 DurationTest_FactorRho( )
+	{
+		_UI512( n ) { 0 };
+		_UI512( factor ) { 0 };
+		set_uT64( n, 1000003ull * 4294967311ull );
+		u64 start = __rdtsc( );
+		factor_rho_u( n, factor );
+		return ( __rdtsc( ) - start );
+	};
+
+	/// <summary>
+	/// 
+	/// </summary>
+	/// <returns></returns>
+	u64 DurationTest_Isqrt( )
+	{
+		_UI512( a ) { 0 };
+		_UI512( root ) { 0 };
+		mult_u( a, root, prime_p256, prime_secp256k1 );
+		if ( !pipeline_test )
+		{
+			for ( int j = 0; j < 8; j++ )
+			{
+				a [ j ] = RandomU64( &seed );
+			}
+		}
+		u64 start = __rdtsc( );
+		isqrt_u( root, a );
+		return ( __rdtsc( ) - start );
+	};
+
+	/// <summary>
+	/// 
+	/// </summary>
+	/// <returns></returns>
+	u64 DurationTest_Iroot( )
+	{
+		_UI512( a ) { 0 };
+		_UI512( root ) { 0 };
+		mult_u( a, root, prime_p256, prime_secp256k1 );
+		if ( !pipeline_test )
+		{
+			for ( int j = 0; j < 8; j++ )
+			{
+				a [ j ] = RandomU64( &seed );
+			}
+		}
+		u64 start = __rdtsc( );
+		iroot_u( root, a, 3 );
+		return ( __rdtsc( ) - start );
+	};
+
+	/// <summary>
+	/// 
+	/// </summary>
+	/// <returns></returns>
+	u64 DurationTest_Crt( )
+	{
+		static crt_ctx ctx { };
+		static const u64 primes [ ] = { 0x3fffffffffffffc7ull, 0x3fffffffffffffa9ull, 0x3fffffffffffff8bull, 0x3fffffffffffff71ull,
+			0x3fffffffffffff67ull, 0x3fffffffffffff59ull, 0x3fffffffffffff55ull, 0x3fffffffffffff3dull, 0x3fffffffffffff35ull };
+		u64 residues [ 9 ] = { 1, 2, 3, 4, 5, 6, 7, 8, 9 };
+		_UI512( result ) { 0 };
+		if ( ctx.count == 0 )
+		{
+			crt_init_u( &ctx, primes, 9 );
+		}
+		if ( !pipeline_test )
+		{
+			for ( int j = 0; j < 9; j++ )
+			{
+				residues [ j ] = RandomU64( &seed ) % primes [ j ];
+			}
+		}
+		u64 start = __rdtsc( );
+		crt_reconstruct_u( result, residues, &ctx );
+		return ( __rdtsc( ) - start );
+	};
+
+	/// <summary>
+	/// 
+	/// </summary>
+	/// <returns></returns>
+	u64 DurationTest_GenPrime( )
+	{
+		_UI512( p ) { 0 };
+		u64 state = 0x0123456789abcdefull;
+		if ( !pipeline_test )
+		{
+			state = RandomU64( &seed );
+		}
+		u64 start = __rdtsc( );
+		gen_prime_u( p, 256, SplitMixFill, &state );
+		return ( __rdtsc( ) - start );
+	};
+
+	/// <summary>
+	/// 
+	/// </summary>
+	/// <returns></returns>
+	u64 DurationTest_BatchGcd( )
+	{
+		alignas ( 64 ) static u64 values [ 64 * 8 ] { };
+		alignas ( 64 ) static u64 results [ 64 * 8 ] { };
+		alignas ( 64 ) static u64 work [ 8 * 64 * 14 + 16 ] { };
+		for ( int i = 0; i < 64 * 8; i++ )
+		{
+			values [ i ] = pipeline_test ? 0x0123456789abcdefull * ( i + 1 ) : RandomU64( &seed );
+		}
+		u64 start = __rdtsc( );
+		batch_gcd_u( results, values, 64, work );
+		return ( __rdtsc( ) - start );
+	};
+
 	/// <summary>
 	/// 
 	/// </summary>
@@ -493,7 +1102,8 @@ namespace ui512_Unit_Tests
 		stat->x_i = new std::vector<double>( stat->timing_count );
 		stat->z_score = new std::vector<double>( stat->timing_count );
 		stat->outliers = new std::vector<outlier>( 0 );
-		// for reference: enum Perf_Tests { Comp, Comp64, Add, AddwC, Add64, Sub, Subwb, Sub64, Mul, Mul64, Div, Div64, And, Or, Xor, Not, Shl, Shr, msb, lsb };
+		// for reference: enum Perf_Tests { Comp, Comp64, Add, AddwC, Add64, Sub, Subwb, Sub64, Mul, Mul64, Div, Div64, And, Or, Xor, Not, Shl, Shr, msb, lsb,
+		//		RedK1, RedP256, RedP384, Red25519, Red448, MontMul, InvMod, PowMod, SqrtMod, Jacobi, EcDbl, EcAdd, EcMul, EcComb, EcMsm, X25519, EcGlv, Ed448Mul, SumPrimes, LucySum, AccAdd64, Presieve, IsPrime, Gcd, FactorRho, Isqrt, Iroot, Crt, GenPrime, BatchGcd, popcount };
 		typedef u64( *targettest )( );
 		targettest targets [ ] = {
 			&DurationTest_Comp, &DurationTest_Comp64,
@@ -504,7 +1114,16 @@ namespace ui512_Unit_Tests
 			&DurationTest_And, &DurationTest_Or,
 			&DurationTest_Xor, &DurationTest_Not,
 			&DurationTest_Shl, &DurationTest_Shr,
-			&DurationTest_msb, &DurationTest_lsb
+			&DurationTest_msb, &DurationTest_lsb,
+			&DurationTest_RedK1, &DurationTest_RedP256, &DurationTest_RedP384,
+			&DurationTest_Red25519, &DurationTest_Red448,
+			&DurationTest_MontMul, &DurationTest_InvMod, &DurationTest_PowMod, &DurationTest_SqrtMod,
+			&DurationTest_Jacobi, &DurationTest_EcDbl, &DurationTest_EcAdd,
+			&DurationTest_EcMul, &DurationTest_EcComb, &DurationTest_EcMsm,
+			&DurationTest_X25519, &DurationTest_EcGlv, &DurationTest_Ed448Mul,
+			&DurationTest_SumPrimes, &DurationTest_LucySum, &DurationTest_AccAdd64, &DurationTest_Presieve, &DurationTest_IsPrime,
+			&DurationTest_Gcd, &DurationTest_FactorRho, &DurationTest_Isqrt, &DurationTest_Iroot, &DurationTest_Crt,
+			&DurationTest_GenPrime, &DurationTest_BatchGcd, &DurationTest_popcount
 		};
 
 		for ( int i = 0; i < warm_up_count; i++ ) {
@@ -55,7 +55,8 @@ namespace ui512_Unit_Tests
 		std::vector<outlier> *outliers;
 	};
 
-	enum Perf_Tests { Comp, Comp64, Add, AddwC, Add64, Sub, Subwb, Sub64, Mul, Mul64, Div, Div64, And, Or, Xor, Not, Shl, Shr, msb, lsb };
+	enum Perf_Tests { Comp, Comp64, Add, AddwC, Add64, Sub, Subwb, Sub64, Mul, Mul64, Div, Div64, And, Or, Xor, Not, Shl, Shr, msb, lsb,
+		RedK1, RedP256, RedP384, Red25519, Red448, MontMul, InvMod, PowMod, SqrtMod, Jacobi, EcDbl, EcAdd, EcMul, EcComb, EcMsm, X25519, EcGlv, Ed448Mul, SumPrimes, LucySum, AccAdd64, Presieve, IsPrime, Gcd, FactorRho, Isqrt, Iroot, Crt, GenPrime, BatchGcd, popcount };
 	
 	extern const s32 test_run_count;
 	extern const s32 reg_verification_count;
@@ -73,6 +74,13 @@ namespace ui512_Unit_Tests
 
 	extern u64 RandomU64(u64* seed);
 	extern void RandomFill(u64* var, u64* seed);
+	extern void RandomFillMod(u64* var, const u64* mod, u64* seed);
+	extern s16 SplitMixFill(u64* dest, u64 count, void* state);
+
+	extern void MulModRef(u64* result, const u64* a, const u64* b, const u64* mod);
+
+	extern u64* AllocSieveWork(u64 hi);
+	extern void FreeSieveWork(u64* work);
 
 	extern void RunStats(perf_stats* stat, Perf_Tests test_sel);
 };
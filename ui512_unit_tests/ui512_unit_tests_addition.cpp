@@ -485,5 +485,124 @@ namespace ui512_Unit_Tests
 			Logger::WriteMessage( runmsg.c_str( ) );
 		};
 
+
+		TEST_METHOD( ui512_04_acc )
+		{
+			// acc_init_u, acc_add_uT64, acc_add_uT128, acc_flush_u tests
+			// Note: add_u and add_uT64 must pass before these tests (they are the reference)
+			regs r_before {};
+			regs r_after {};
+			ui512_acc acc {};
+			_UI512( sum ) { 0 };
+			_UI512( expected ) { 0 };
+			_UI512( addend ) { 0 };
+			u64 seed = 0;
+
+			// 1. init, flush of zero
+			for ( int j = 0; j < 8; j++ )
+			{
+				acc.value [ j ] = RandomU64( &seed );
+			};
+			acc.lo = acc.hi = acc.ovf = 1;
+			Assert::AreEqual( s16( 0 ), acc_init_u( &acc ), L"Return code failed init" );
+			Assert::AreEqual( s16( 0 ), acc_flush_u( sum, &acc ), L"Return code failed flush of zero" );
+			for ( int j = 0; j < 8; j++ )
+			{
+				Assert::AreEqual( u64( 0 ), sum [ j ], L"Flush failed, zero" );
+			};
+
+			// 2. pseudo random 64 and 128 bit addends, flushed along the way ( the accumulator continues ), against add_uT64 / add_u
+			zero_u( expected );
+			for ( int i = 0; i < test_run_count * 10; i++ )
+			{
+				u64 lo = RandomU64( &seed );
+				u64 hi = ( i % 3 == 0 ) ? RandomU64( &seed ) : 0;
+				reg_verify( ( u64* ) &r_before );
+				s16 ret = ( i % 3 == 0 ) ? acc_add_uT128( &acc, lo, hi ) : acc_add_uT64( &acc, lo );
+				reg_verify( ( u64* ) &r_after );
+				Assert::IsTrue( r_before.AreEqual( &r_after ), L"Register validation failed" );
+				Assert::AreEqual( s16( 0 ), ret, _MSGW( L"Return code failed add on run #" << i ) );
+				zero_u( addend );
+				addend [ 7 ] = lo;
+				addend [ 6 ] = hi;
+				add_u( expected, expected, addend );
+				if ( i % 97 == 0 )
+				{
+					reg_verify( ( u64* ) &r_before );
+					ret = acc_flush_u( sum, &acc );
+					reg_verify( ( u64* ) &r_after );
+					Assert::IsTrue( r_before.AreEqual( &r_after ), L"Register validation failed" );
+					Assert::AreEqual( s16( 0 ), ret, _MSGW( L"Return code failed flush on run #" << i ) );
+					for ( int j = 0; j < 8; j++ )
+					{
+						Assert::AreEqual( expected [ j ], sum [ j ], _MSGW( L"Flush failed on run #" << i << L", word " << j ) );
+					};
+					Assert::AreEqual( u64( 0 ), acc.lo | acc.hi, L"Flush failed, pending bits not cleared" );
+				};
+			};
+			acc_flush_u( sum, &acc );
+			for ( int j = 0; j < 8; j++ )
+			{
+				Assert::AreEqual( expected [ j ], sum [ j ], _MSGW( L"Flush failed, random adds, word " << j ) );
+			};
+
+			// 3. the pending carries reaching 2^63, and passing 2^128, ripple into the value
+			acc_init_u( &acc );
+			acc.lo = u64_Max;
+			acc.hi = ( 1ull << 63 ) - 1;
+			acc_add_uT64( &acc, 1 );
+			Assert::AreEqual( u64( 0 ), acc.lo | acc.hi, L"Ripple failed at 2^63 carries, pending" );
+			Assert::AreEqual( 1ull << 63, acc.value [ 6 ], L"Ripple failed at 2^63 carries, value" );
+			acc_init_u( &acc );
+			acc.lo = 5;
+			acc.hi = 7;
+			acc_add_uT128( &acc, 1, u64_Max - 6 );
+			Assert::AreEqual( u64( 0 ), acc.lo | acc.hi, L"Ripple failed past 2^128, pending" );
+			acc_flush_u( sum, &acc );
+			Assert::AreEqual( u64( 6 ), sum [ 7 ], L"Ripple failed past 2^128, word 7" );
+			Assert::AreEqual( u64( 0 ), sum [ 6 ], L"Ripple failed past 2^128, word 6" );
+			Assert::AreEqual( u64( 1 ), sum [ 5 ], L"Ripple failed past 2^128, word 5" );
+
+			// 4. carry out of 512 bits: reported by flush, and kept until init
+			acc_init_u( &acc );
+			for ( int j = 0; j < 8; j++ )
+			{
+				acc.value [ j ] = u64_Max;
+			};
+			acc_add_uT64( &acc, 2 );
+			Assert::AreEqual( s16( 1 ), acc_flush_u( sum, &acc ), L"Return code failed overflow" );
+			Assert::AreEqual( u64( 1 ), sum [ 7 ], L"Flush failed, overflow" );
+			acc_add_uT64( &acc, 2 );
+			Assert::AreEqual( s16( 1 ), acc_flush_u( sum, &acc ), L"Return code failed overflow kept" );
+			Assert::AreEqual( u64( 3 ), sum [ 7 ], L"Flush failed, after overflow" );
+			acc_init_u( &acc );
+			Assert::AreEqual( s16( 0 ), acc_flush_u( sum, &acc ), L"Return code failed overflow cleared" );
+
+			string runmsg = "Deferred carry accumulator function testing. Ran " + to_string( test_run_count * 10 )
+				+ " pseudo random 64 and 128 bit adds, flushed along the way, checked against add_u;\n"
+				+ "\tripple at 2^63 carries and past 2^128, carry out of 512 bits.\n";
+			Logger::WriteMessage( runmsg.c_str( ) );
+			Logger::WriteMessage( L"Passed. Tested expected values, return value, and volatile register integrity: each via assert.\n\n" );
+		};
+
+		TEST_METHOD( ui512_04_acc_performance )
+		{
+			// Performance timing tests.
+			// Note: these tests are not pass/fail, they are informational only
+
+			Logger::WriteMessage( L"Deferred carry accumulator add x64 function performance timing test.\n\n" );
+
+			Logger::WriteMessage( L"First run.\n" );
+			perf_stats No1 = Perf_Test_Parms [ 0 ];
+			ui512_Unit_Tests::RunStats( &No1, AccAdd64 );
+
+			Logger::WriteMessage( L"Second run.\n" );
+			perf_stats No2 = Perf_Test_Parms [ 1 ];
+			RunStats( &No2, AccAdd64 );
+
+			Logger::WriteMessage( L"Third run.\n" );
+			perf_stats No3 = Perf_Test_Parms [ 2 ];
+			RunStats( &No3, AccAdd64 );
+		};
 	};	// test_class
 };	// namespace
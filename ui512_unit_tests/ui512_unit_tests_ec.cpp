@@ -0,0 +1,1323 @@
+//		ui512_unit_tests_ec
+//
+//		File:			ui512_unit_tests_ec.cpp
+//		Author:			John G.Lynch
+//		Legal:			Copyright @2025, per MIT License below
+//		Date:			October 19, 2026
+//
+//		ui512 is a small project to provide basic operations for a variable type of unsigned 512 bit integer.
+//		The basic operations : zero, copy, compare, add, subtract.
+//		Other optional modules provide bit ops and multiply / divide.
+//		It is written in assembly language, using the MASM ( ml64 ) assembler provided as an option within Visual Studio.
+//		( currently using VS Community 2022 17.14.10)
+//		It provides external signatures that allow linkage to C and C++ programs,
+//		where a shell / wrapper could encapsulate the methods as part of an object.
+//		It has assembly time options directing the use of Intel processor extensions : AVX4, AVX2, SIMD, or none :
+//		( Z ( 512 ), Y ( 256 ), or X ( 128 ) registers, or regular Q ( 64bit ) ).
+//		If processor extensions are used, the caller must align the variables declared and passed
+//		on the appropriate byte boundary ( e.g. alignas 64 for 512 )
+//		These modules (in total) are very light-weight ( less than 10K bytes ) and relatively fast,
+//		but is not intended for all processor types or all environments.
+//
+//		Intended use cases :
+//			1.) a "sum of primes" for primes up to 2 ^ 48.
+//			2.) elliptical curve cryptography(ECC)
+//
+//		This sub - project: ui512aTests, is a unit test project that invokes each of the routines in the ui512a assembly.
+//		It runs each assembler proc with pseudo-random values.
+//		It validates ( asserts ) expected and returned results.
+//		It also runs each repeatedly for comparative timings.
+//		It provides a means to invoke and debug.
+//		It illustrates calling the routines from C++.
+
+#include "pch.h"
+#include "CppUnitTest.h"
+#include "ui512_externs.h"
+#include "ui512_unit_tests.h"
+
+#include <cstring>
+#include <sstream>
+#include <format>
+#include <chrono>
+#include <thread>
+#include <vector>
+#include <fstream>
+#include "intrin.h"
+
+using namespace std;
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+namespace ui512_Unit_Tests
+{
+	/// <summary>
+	/// Affine point, ordinary (not Montgomery form) coordinates, for the reference arithmetic
+	/// </summary>
+	struct ref_point
+	{
+		alignas ( 64 ) u64 x [ 8 ];
+		alignas ( 64 ) u64 y [ 8 ];
+		bool infinity;
+	};
+
+	static void AddModRef( u64* result, const u64* a, const u64* b, const u64* mod )
+	{
+		s16 carry = add_u( result, a, b );
+		if ( carry != 0 || compare_u( result, mod ) >= 0 )
+		{
+			sub_u( result, result, mod );
+		};
+	};
+
+	static void SubModRef( u64* result, const u64* a, const u64* b, const u64* mod )
+	{
+		s16 borrow = sub_u( result, a, b );
+		if ( borrow != 0 )
+		{
+			add_u( result, result, mod );
+		};
+	};
+
+	/// <summary>
+	/// Reference affine point doubling: lambda = ( 3 x^2 + a ) / 2 y, x3 = lambda^2 - 2 x, y3 = lambda ( x - x3 ) - y
+	/// </summary>
+	/// <param name="params">curve parameters: p, a, b, gx, gy, n</param>
+	static void DoubleRef( ref_point* r, const ref_point* pt, const u64* params )
+	{
+		const u64* p = params;
+		const u64* a = params + 8;
+		_UI512( lambda ) { 0 };
+		_UI512( t ) { 0 };
+		_UI512( x3 ) { 0 };
+		if ( pt->infinity || compare_uT64( pt->y, 0ull ) == 0 )
+		{
+			r->infinity = true;
+			return;
+		};
+		MulModRef( lambda, pt->x, pt->x, p );
+		AddModRef( t, lambda, lambda, p );
+		AddModRef( lambda, lambda, t, p );
+		AddModRef( lambda, lambda, a, p );
+		AddModRef( t, pt->y, pt->y, p );
+		invmod_u( t, t, p );
+		MulModRef( lambda, lambda, t, p );
+		MulModRef( x3, lambda, lambda, p );
+		SubModRef( x3, x3, pt->x, p );
+		SubModRef( x3, x3, pt->x, p );
+		SubModRef( t, pt->x, x3, p );
+		MulModRef( t, lambda, t, p );
+		SubModRef( r->y, t, pt->y, p );
+		copy_u( r->x, x3 );
+		r->infinity = false;
+	};
+
+	/// <summary>
+	/// Reference affine point addition: lambda = ( y2 - y1 ) / ( x2 - x1 ), x3 = lambda^2 - x1 - x2, y3 = lambda ( x1 - x3 ) - y1
+	/// </summary>
+	static void AddRef( ref_point* r, const ref_point* p1, const ref_point* p2, const u64* params )
+	{
+		const u64* p = params;
+		_UI512( lambda ) { 0 };
+		_UI512( t ) { 0 };
+		_UI512( x3 ) { 0 };
+		if ( p1->infinity )
+		{
+			*r = *p2;
+			return;
+		};
+		if ( p2->infinity )
+		{
+			*r = *p1;
+			return;
+		};
+		if ( compare_u( p1->x, p2->x ) == 0 )
+		{
+			if ( compare_u( p1->y, p2->y ) == 0 )
+			{
+				DoubleRef( r, p1, params );
+			}
+			else
+			{
+				r->infinity = true;
+			};
+			return;
+		};
+		SubModRef( t, p2->x, p1->x, p );
+		invmod_u( t, t, p );
+		SubModRef( lambda, p2->y, p1->y, p );
+		MulModRef( lambda, lambda, t, p );
+		MulModRef( x3, lambda, lambda, p );
+		SubModRef( x3, x3, p1->x, p );
+		SubModRef( x3, x3, p2->x, p );
+		SubModRef( t, p1->x, x3, p );
+		MulModRef( t, lambda, t, p );
+		SubModRef( r->y, t, p1->y, p );
+		copy_u( r->x, x3 );
+		r->infinity = false;
+	};
+
+	/// <summary>
+	/// Check a Jacobian point against a reference affine point: converted to affine, and on the curve
+	/// </summary>
+	static void CheckPoint( const u64* point, const ref_point* expected, const u64* curve, const char* name, const char* test, int run )
+	{
+		_UI512( x ) { 0 };
+		_UI512( y ) { 0 };
+		s16 ret = ec_to_affine_u( x, y, point, curve );
+		Assert::AreEqual( s16( 0 ), ec_on_curve_u( point, curve ), _MSGW( L"Result not on curve, " << test << " test, " << name << " on run #" << run ) );
+		if ( expected->infinity )
+		{
+			Assert::AreEqual( s16( -1 ), ret, _MSGW( L"Expected infinity, " << test << " test, " << name << " on run #" << run ) );
+			return;
+		};
+		Assert::AreEqual( s16( 0 ), ret, _MSGW( L"Unexpected infinity, " << test << " test, " << name << " on run #" << run ) );
+		for ( int j = 0; j < 8; j++ )
+		{
+			Assert::AreEqual( expected->x [ j ], x [ j ], _MSGW( L"x at word #" << j << " failed " << test << " test, " << name << " on run #" << run ) );
+			Assert::AreEqual( expected->y [ j ], y [ j ], _MSGW( L"y at word #" << j << " failed " << test << " test, " << name << " on run #" << run ) );
+		};
+	};
+
+	/// <summary>
+	/// Same point, different Jacobian representation: ( X lambda^2, Y lambda^3, Z lambda ), lambda a pseudo random non-zero value
+	/// </summary>
+	static void ScalePoint( u64* point, const u64* curve, u64* seed )
+	{
+		_UI512( lambda ) { 0 };
+		_UI512( l2 ) { 0 };
+		do
+		{
+			RandomFillMod( lambda, curve, seed );
+		} while ( compare_uT64( lambda, 0ull ) == 0 );
+		mont_mul_u( l2, lambda, lambda, curve );
+		mont_mul_u( point, point, l2, curve );
+		mont_mul_u( l2, l2, lambda, curve );
+		mont_mul_u( point + 8, point + 8, l2, curve );
+		mont_mul_u( point + 16, point + 16, lambda, curve );
+	};
+
+	/// <summary>
+	/// Negate a Jacobian point: ( X, p - Y, Z )
+	/// </summary>
+	static void NegatePoint( u64* point, const u64* curve )
+	{
+		if ( compare_uT64( point + 8, 0ull ) != 0 )
+		{
+			sub_u( point + 8, curve, point + 8 );
+		};
+	};
+
+	/// <summary>
+	/// Generator as a Jacobian point ( Z = one ) and as a reference affine point
+	/// </summary>
+	static void Generator( u64* point, ref_point* ref, const u64* curve, const u64* params )
+	{
+		ec_from_affine_u( point, params + 24, params + 32, curve );
+		copy_u( ref->x, params + 24 );
+		copy_u( ref->y, params + 32 );
+		ref->infinity = false;
+	};
+
+	/// <summary>
+	/// Reference scalar multiplication, left to right binary double and add on the (tested) Jacobian formulas
+	/// </summary>
+	static void ScalarMulRef( u64* result, const u64* k, const u64* point, const u64* curve )
+	{
+		alignas ( 64 ) u64 acc [ 24 ] { 0 };
+		for ( int i = msb_u( k ); i >= 0; i-- )
+		{
+			ec_double_u( acc, acc, curve );
+			if ( ( k [ 7 - i / 64 ] >> ( i % 64 ) ) & 1ull )
+			{
+				ec_add_u( acc, acc, point, curve );
+			};
+		};
+		for ( int j = 0; j < 24; j++ )
+		{
+			result [ j ] = acc [ j ];
+		};
+	};
+
+	/// <summary>
+	/// Check two Jacobian points are the same point: both infinity, or the same affine coordinates
+	/// </summary>
+	static void CheckSamePoint( const u64* point, const u64* expected, const u64* curve, const char* name, const char* test, int run )
+	{
+		ref_point ref {};
+		ref.infinity = ( ec_to_affine_u( ref.x, ref.y, expected, curve ) != 0 );
+		CheckPoint( point, &ref, curve, name, test, run );
+	};
+
+	/// <summary>
+	/// Affine point, Montgomery form coordinates, from a Jacobian point (not infinity)
+	/// </summary>
+	static void ToAffineMont( u64* affine, const u64* point, const u64* curve )
+	{
+		ec_to_affine_u( affine, affine + 8, point, curve );
+		mont_mul_u( affine, affine, curve + 8, curve );
+		mont_mul_u( affine + 8, affine + 8, curve + 8, curve );
+	};
+
+	alignas ( 64 ) static const u64 params_secp256k1 [ 48 ] {
+		0, 0, 0, 0, 0xFFFFFFFFFFFFFFFFull, 0xFFFFFFFFFFFFFFFFull, 0xFFFFFFFFFFFFFFFFull, 0xFFFFFFFEFFFFFC2Full,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0x0000000000000007ull,
+		0, 0, 0, 0, 0x79BE667EF9DCBBACull, 0x55A06295CE870B07ull, 0x029BFCDB2DCE28D9ull, 0x59F2815B16F81798ull,
+		0, 0, 0, 0, 0x483ADA7726A3C465ull, 0x5DA4FBFC0E1108A8ull, 0xFD17B448A6855419ull, 0x9C47D08FFB10D4B8ull,
+		0, 0, 0, 0, 0xFFFFFFFFFFFFFFFFull, 0xFFFFFFFFFFFFFFFEull, 0xBAAEDCE6AF48A03Bull, 0xBFD25E8CD0364141ull };	// p, a, b, gx, gy, n
+	alignas ( 64 ) static const u64 params_p256 [ 48 ] {
+		0, 0, 0, 0, 0xFFFFFFFF00000001ull, 0, 0x00000000FFFFFFFFull, 0xFFFFFFFFFFFFFFFFull,
+		0, 0, 0, 0, 0xFFFFFFFF00000001ull, 0, 0x00000000FFFFFFFFull, 0xFFFFFFFFFFFFFFFCull,
+		0, 0, 0, 0, 0x5AC635D8AA3A93E7ull, 0xB3EBBD55769886BCull, 0x651D06B0CC53B0F6ull, 0x3BCE3C3E27D2604Bull,
+		0, 0, 0, 0, 0x6B17D1F2E12C4247ull, 0xF8BCE6E563A440F2ull, 0x77037D812DEB33A0ull, 0xF4A13945D898C296ull,
+		0, 0, 0, 0, 0x4FE342E2FE1A7F9Bull, 0x8EE7EB4A7C0F9E16ull, 0x2BCE33576B315ECEull, 0xCBB6406837BF51F5ull,
+		0, 0, 0, 0, 0xFFFFFFFF00000000ull, 0xFFFFFFFFFFFFFFFFull, 0xBCE6FAADA7179E84ull, 0xF3B9CAC2FC632551ull };	// p, a, b, gx, gy, n
+	alignas ( 64 ) static const u64 params_p384 [ 48 ] {
+		0, 0, 0xFFFFFFFFFFFFFFFFull, 0xFFFFFFFFFFFFFFFFull, 0xFFFFFFFFFFFFFFFFull, 0xFFFFFFFFFFFFFFFEull, 0xFFFFFFFF00000000ull, 0x00000000FFFFFFFFull,
+		0, 0, 0xFFFFFFFFFFFFFFFFull, 0xFFFFFFFFFFFFFFFFull, 0xFFFFFFFFFFFFFFFFull, 0xFFFFFFFFFFFFFFFEull, 0xFFFFFFFF00000000ull, 0x00000000FFFFFFFCull,
+		0, 0, 0xB3312FA7E23EE7E4ull, 0x988E056BE3F82D19ull, 0x181D9C6EFE814112ull, 0x0314088F5013875Aull, 0xC656398D8A2ED19Dull, 0x2A85C8EDD3EC2AEFull,
+		0, 0, 0xAA87CA22BE8B0537ull, 0x8EB1C71EF320AD74ull, 0x6E1D3B628BA79B98ull, 0x59F741E082542A38ull, 0x5502F25DBF55296Cull, 0x3A545E3872760AB7ull,
+		0, 0, 0x3617DE4A96262C6Full, 0x5D9E98BF9292DC29ull, 0xF8F41DBD289A147Cull, 0xE9DA3113B5F0B8C0ull, 0x0A60B1CE1D7E819Dull, 0x7A431D7C90EA0E5Full,
+		0, 0, 0xFFFFFFFFFFFFFFFFull, 0xFFFFFFFFFFFFFFFFull, 0xFFFFFFFFFFFFFFFFull, 0xC7634D81F4372DDFull, 0x581A0DB248B0A77Aull, 0xECEC196ACCC52973ull };	// p, a, b, gx, gy, n
+
+	// comb tables, up to four blocks, and a second buffer to move one to
+	alignas ( 64 ) static u64 comb_table [ ( 64 + 4 * 255 * 128 ) / 8 ];
+	alignas ( 64 ) static u64 comb_moved [ ( 64 + 4 * 255 * 128 ) / 8 ];
+
+	// multi-scalar multiply terms and bucket scratch, four sets of buckets for windows up to 8 bits
+	const int msm_terms = 200;
+	alignas ( 64 ) static u64 msm_scalars [ msm_terms * 8 ];
+	alignas ( 64 ) static u64 msm_points [ msm_terms * 16 ];
+	alignas ( 64 ) static u64 msm_buckets [ 4 ] [ 255 * 24 ];
+
+	// ECDSA known-answer vectors, from ecdsa_vectors.txt beside this source file, by curve ( secp256k1, p256, p384 )
+	struct ecdsa_vectors
+	{
+		vector<ecdsa_sig> sigs;
+		vector<s16> expected;									// 0 valid, -1 invalid
+	};
+
+	/// <summary>
+	/// ui512 from a hex string, right aligned; false if not hex or too long
+	/// </summary>
+	static bool HexToU512( u64* value, const string& hex )
+	{
+		if ( hex.empty( ) || hex.size( ) > 128 )
+		{
+			return false;
+		};
+		for ( int j = 0; j < 8; j++ )
+		{
+			value [ j ] = 0;
+		};
+		for ( size_t i = 0; i < hex.size( ); i++ )
+		{
+			const char ch = hex [ hex.size( ) - 1 - i ];
+			u64 digit = 0;
+			if ( ch >= '0' && ch <= '9' )
+			{
+				digit = u64( ch - '0' );
+			}
+			else if ( ch >= 'A' && ch <= 'F' )
+			{
+				digit = u64( ch - 'A' + 10 );
+			}
+			else if ( ch >= 'a' && ch <= 'f' )
+			{
+				digit = u64( ch - 'a' + 10 );
+			}
+			else
+			{
+				return false;
+			};
+			value [ 7 - i / 16 ] |= digit << ( 4 * ( i % 16 ) );
+		};
+		return true;
+	};
+
+	/// <summary>
+	/// Read the ECDSA vectors: one per line, curve, e, r, s, public key x, y, expected ( 1 valid, 0 invalid ); '#' lines are comments
+	/// </summary>
+	/// <returns>number of vectors read, -1 if the file is missing or a line does not parse</returns>
+	static int LoadEcdsaVectors( ecdsa_vectors* sets )
+	{
+		static const char* file_curves [ ] = { "secp256k1", "p256", "p384" };
+		string path = __FILE__;
+		path = path.substr( 0, path.find_last_of( "\\/" ) + 1 ) + "ecdsa_vectors.txt";
+		ifstream in( path );
+		if ( !in )
+		{
+			return -1;
+		};
+		int count = 0;
+		string line;
+		while ( getline( in, line ) )
+		{
+			if ( line.empty( ) || line [ 0 ] == '#' || line [ 0 ] == '\r' )
+			{
+				continue;
+			};
+			istringstream fields( line );
+			string name, hex [ 5 ];
+			int valid = -1;
+			fields >> name >> hex [ 0 ] >> hex [ 1 ] >> hex [ 2 ] >> hex [ 3 ] >> hex [ 4 ] >> valid;
+			int c = 0;
+			while ( c < 3 && name != file_curves [ c ] )
+			{
+				c++;
+			};
+			ecdsa_sig sig {};
+			u64* values [ 5 ] = { sig.e, sig.r, sig.s, sig.qx, sig.qy };
+			bool ok = ( c < 3 ) && ( valid == 0 || valid == 1 );
+			for ( int f = 0; f < 5 && ok; f++ )
+			{
+				ok = HexToU512( values [ f ], hex [ f ] );
+			};
+			if ( !ok )
+			{
+				return -1;
+			};
+			sets [ c ].sigs.push_back( sig );
+			sets [ c ].expected.push_back( s16( valid - 1 ) );
+			count++;
+		};
+		return count;
+	};
+
+	static const u64* curves [ ] = { curve_secp256k1, curve_p256, curve_p384 };
+	static const u64* curve_params [ ] = { params_secp256k1, params_p256, params_p384 };
+	static const char* curve_names [ ] = { "secp256k1", "P-256", "P-384" };
+
+	TEST_CLASS( ui512_unit_tests_ec )
+	{
+		TEST_METHOD( ui512ec_01_curve_init )
+		{
+			// ec_curve_init_u, ec_from_affine_u, ec_to_affine_u, ec_on_curve_u tests
+			// Note: mont_init_u, mont_mul_u, invmod_u must pass testing before these tests
+			regs r_before {};
+			regs r_after {};
+			alignas ( 64 ) u64 curve [ 80 ];
+			alignas ( 64 ) u64 params [ 48 ];
+			alignas ( 64 ) u64 point [ 24 ];
+			_UI512( x ) { 0 };
+			_UI512( y ) { 0 };
+
+			for ( int c = 0; c < 3; c++ )
+			{
+				// 1. built context matches the constant one
+				reg_verify( ( u64* ) &r_before );
+				s16 ret = ec_curve_init_u( curve, curve_params [ c ] );
+				reg_verify( ( u64* ) &r_after );
+				Assert::IsTrue( r_before.AreEqual( &r_after ), L"Register validation failed" );
+				Assert::AreEqual( s16( 0 ), ret, _MSGW( L"Return code failed init test, " << curve_names [ c ] ) );
+				for ( int j = 0; j < 80; j++ )
+				{
+					Assert::AreEqual( curves [ c ] [ j ], curve [ j ], _MSGW( L"Context at word #" << j << " failed init test, " << curve_names [ c ] ) );
+				};
+
+				// 2. generator is on the curve, and converts back; a changed y is not on the curve
+				ret = ec_from_affine_u( point, curve_params [ c ] + 24, curve_params [ c ] + 32, curve );
+				Assert::AreEqual( s16( 0 ), ret, _MSGW( L"Return code failed from affine test, " << curve_names [ c ] ) );
+				Assert::AreEqual( s16( 0 ), ec_on_curve_u( point, curve ), _MSGW( L"Generator not on curve, " << curve_names [ c ] ) );
+				ret = ec_to_affine_u( x, y, point, curve );
+				Assert::AreEqual( s16( 0 ), ret, _MSGW( L"Return code failed to affine test, " << curve_names [ c ] ) );
+				for ( int j = 0; j < 8; j++ )
+				{
+					Assert::AreEqual( curve_params [ c ] [ 24 + j ], x [ j ], _MSGW( L"x at word #" << j << " failed round trip test, " << curve_names [ c ] ) );
+					Assert::AreEqual( curve_params [ c ] [ 32 + j ], y [ j ], _MSGW( L"y at word #" << j << " failed round trip test, " << curve_names [ c ] ) );
+				};
+				point [ 15 ] ^= 1ull;
+				Assert::AreEqual( s16( -1 ), ec_on_curve_u( point, curve ), _MSGW( L"Changed point on curve, " << curve_names [ c ] ) );
+
+				// 3. infinity: on the curve, no affine coordinates
+				zero_u( point );
+				zero_u( point + 8 );
+				zero_u( point + 16 );
+				Assert::AreEqual( s16( 0 ), ec_on_curve_u( point, curve ), _MSGW( L"Infinity not on curve, " << curve_names [ c ] ) );
+				Assert::AreEqual( s16( -1 ), ec_to_affine_u( x, y, point, curve ), _MSGW( L"Return code failed infinity to affine test, " << curve_names [ c ] ) );
+			};
+
+			// 4. error cases: a neither 0 nor -3, even p
+			for ( int j = 0; j < 48; j++ )
+			{
+				params [ j ] = params_p256 [ j ];
+			};
+			params [ 15 ] = 1ull;
+			Assert::AreEqual( s16( -1 ), ec_curve_init_u( curve, params ), L"Return code failed a = 1 test." );
+			params [ 15 ] = 0ull;
+			params [ 7 ] ^= 1ull;
+			Assert::AreEqual( s16( -1 ), ec_curve_init_u( curve, params ), L"Return code failed even p test." );
+
+			string test_message = _MSGA( "Curve context function testing.\n\nsecp256k1, P-256, P-384:\n\tcontext built matches constant context,\n"
+				<< "\tgenerator on curve,\n\taffine round trip,\n\tchanged point not on curve,\n\tinfinity.\nError cases:\n\ta = 1,\n\teven p.\n" );
+			Logger::WriteMessage( test_message.c_str( ) );
+			Logger::WriteMessage( L"Passed. Tested expected values, return value, and volatile register integrity: each via assert.\n\n" );
+		};
+
+		TEST_METHOD( ui512ec_02_double )
+		{
+			// ec_double_u tests
+			// Note: ui512ec_01 must pass before these tests; the reference is affine, using MulModRef and invmod_u
+			u64 seed = 0;
+			regs r_before {};
+			regs r_after {};
+			alignas ( 64 ) u64 point [ 24 ];
+			alignas ( 64 ) u64 result [ 24 ];
+			ref_point ref {};
+			ref_point expected {};
+			int adjtest_run_count = test_run_count / 10;
+
+			for ( int c = 0; c < 3; c++ )
+			{
+				const u64* curve = curves [ c ];
+
+				// 1. infinity doubles to infinity
+				zero_u( point );
+				zero_u( point + 8 );
+				zero_u( point + 16 );
+				ec_double_u( result, point, curve );
+				Assert::AreEqual( s16( 0 ), compare_uT64( result + 16, 0ull ), _MSGW( L"Failed infinity test, " << curve_names [ c ] ) );
+
+				// 2. repeated doubling from the generator, a random Jacobian representation each time, also in place
+				Generator( point, &ref, curve, curve_params [ c ] );
+				for ( int i = 0; i < adjtest_run_count; i++ )
+				{
+					ScalePoint( point, curve, &seed );
+					DoubleRef( &expected, &ref, curve_params [ c ] );
+					reg_verify( ( u64* ) &r_before );
+					s16 ret = ec_double_u( result, point, curve );
+					reg_verify( ( u64* ) &r_after );
+					Assert::IsTrue( r_before.AreEqual( &r_after ), L"Register validation failed" );
+					Assert::AreEqual( s16( 0 ), ret, _MSGW( L"Return code failed double test, " << curve_names [ c ] << " on run #" << i ) );
+					CheckPoint( result, &expected, curve, curve_names [ c ], "double", i );
+					ec_double_u( point, point, curve );
+					CheckPoint( point, &expected, curve, curve_names [ c ], "in place double", i );
+					ref = expected;
+				};
+			};
+
+			string test_message = _MSGA( "Point doubling function testing.\n\nsecp256k1 ( a = 0 ), P-256, P-384 ( a = -3 ):\n\tinfinity,\n\t"
+				<< adjtest_run_count << " repeated doublings of the generator, random Jacobian representations, checked against affine reference, also in place.\n" );
+			Logger::WriteMessage( test_message.c_str( ) );
+			Logger::WriteMessage( L"Passed. Tested expected values, return value, and volatile register integrity: each via assert.\n\n" );
+		};
+
+		TEST_METHOD( ui512ec_02_double_performance )
+		{
+			Logger::WriteMessage( L"Point doubling function performance timing test.\n\n" );
+
+			Logger::WriteMessage( L"First run.\n" );
+			perf_stats No1 = Perf_Test_Parms [ 0 ];
+			ui512_Unit_Tests::RunStats( &No1, EcDbl );
+
+			Logger::WriteMessage( L"Second run.\n" );
+			perf_stats No2 = Perf_Test_Parms [ 1 ];
+			RunStats( &No2, EcDbl );
+
+			Logger::WriteMessage( L"Third run.\n" );
+			perf_stats No3 = Perf_Test_Parms [ 2 ];
+			RunStats( &No3, EcDbl );
+		};
+
+		TEST_METHOD( ui512ec_03_add )
+		{
+			// ec_add_u tests
+			// Note: ui512ec_02 must pass before these tests
+			u64 seed = 0;
+			regs r_before {};
+			regs r_after {};
+			alignas ( 64 ) u64 gen [ 24 ];
+			alignas ( 64 ) u64 point [ 24 ];
+			alignas ( 64 ) u64 other [ 24 ];
+			alignas ( 64 ) u64 result [ 24 ];
+			alignas ( 64 ) u64 inf [ 24 ] { 0 };
+			ref_point gref {};
+			ref_point ref {};
+			ref_point expected {};
+			ref_point infref {};
+			infref.infinity = true;
+			int adjtest_run_count = test_run_count / 10;
+
+			for ( int c = 0; c < 3; c++ )
+			{
+				const u64* curve = curves [ c ];
+				Generator( gen, &gref, curve, curve_params [ c ] );
+
+				// 1. infinity either side, P + ( -P ) = infinity, P + P = 2P
+				ec_add_u( result, inf, gen, curve );
+				CheckPoint( result, &gref, curve, curve_names [ c ], "infinity + Q", 0 );
+				ec_add_u( result, gen, inf, curve );
+				CheckPoint( result, &gref, curve, curve_names [ c ], "P + infinity", 0 );
+				ec_add_u( result, inf, inf, curve );
+				CheckPoint( result, &infref, curve, curve_names [ c ], "infinity + infinity", 0 );
+				for ( int j = 0; j < 24; j++ )
+				{
+					other [ j ] = gen [ j ];
+				};
+				ScalePoint( other, curve, &seed );
+				NegatePoint( other, curve );
+				ec_add_u( result, gen, other, curve );
+				CheckPoint( result, &infref, curve, curve_names [ c ], "P + ( -P )", 0 );
+				NegatePoint( other, curve );
+				ec_add_u( result, gen, other, curve );
+				DoubleRef( &expected, &gref, curve_params [ c ] );
+				CheckPoint( result, &expected, curve, curve_names [ c ], "P + P", 0 );
+
+				// 2. running sums: P = P + G and P = G + P, random Jacobian representations, also in place either side
+				for ( int j = 0; j < 24; j++ )
+				{
+					point [ j ] = result [ j ];
+				};
+				ref = expected;
+				for ( int i = 0; i < adjtest_run_count; i++ )
+				{
+					ScalePoint( point, curve, &seed );
+					for ( int j = 0; j < 24; j++ )
+					{
+						other [ j ] = gen [ j ];
+					};
+					ScalePoint( other, curve, &seed );
+					AddRef( &expected, &ref, &gref, curve_params [ c ] );
+					reg_verify( ( u64* ) &r_before );
+					s16 ret = ec_add_u( result, point, other, curve );
+					reg_verify( ( u64* ) &r_after );
+					Assert::IsTrue( r_before.AreEqual( &r_after ), L"Register validation failed" );
+					Assert::AreEqual( s16( 0 ), ret, _MSGW( L"Return code failed add test, " << curve_names [ c ] << " on run #" << i ) );
+					CheckPoint( result, &expected, curve, curve_names [ c ], "add", i );
+					ec_add_u( result, other, point, curve );
+					CheckPoint( result, &expected, curve, curve_names [ c ], "commuted add", i );
+					if ( i % 2 == 0 )
+					{
+						ec_add_u( point, point, other, curve );
+					}
+					else
+					{
+						ec_add_u( other, point, other, curve );
+						for ( int j = 0; j < 24; j++ )
+						{
+							point [ j ] = other [ j ];
+						};
+					};
+					CheckPoint( point, &expected, curve, curve_names [ c ], "in place add", i );
+					ref = expected;
+				};
+			};
+
+			string test_message = _MSGA( "Point addition function testing.\n\nsecp256k1, P-256, P-384:\n\tinfinity either side,\n\tP + ( -P ),\n\tP + P.\n"
+				<< adjtest_run_count << " running sums with the generator, random Jacobian representations, checked against affine reference, commuted, also in place.\n" );
+			Logger::WriteMessage( test_message.c_str( ) );
+			Logger::WriteMessage( L"Passed. Tested expected values, return value, and volatile register integrity: each via assert.\n\n" );
+		};
+
+		TEST_METHOD( ui512ec_03_add_performance )
+		{
+			Logger::WriteMessage( L"Point addition function performance timing test.\n\n" );
+
+			Logger::WriteMessage( L"First run.\n" );
+			perf_stats No1 = Perf_Test_Parms [ 0 ];
+			ui512_Unit_Tests::RunStats( &No1, EcAdd );
+
+			Logger::WriteMessage( L"Second run.\n" );
+			perf_stats No2 = Perf_Test_Parms [ 1 ];
+			RunStats( &No2, EcAdd );
+
+			Logger::WriteMessage( L"Third run.\n" );
+			perf_stats No3 = Perf_Test_Parms [ 2 ];
+			RunStats( &No3, EcAdd );
+		};
+
+		TEST_METHOD( ui512ec_04_add_mixed )
+		{
+			// ec_add_mixed_u tests
+			// Note: ui512ec_03 must pass before these tests
+			u64 seed = 0;
+			regs r_before {};
+			regs r_after {};
+			alignas ( 64 ) u64 gen [ 24 ];
+			alignas ( 64 ) u64 affine [ 16 ];
+			alignas ( 64 ) u64 point [ 24 ];
+			alignas ( 64 ) u64 result [ 24 ];
+			alignas ( 64 ) u64 inf [ 24 ] { 0 };
+			ref_point gref {};
+			ref_point ref {};
+			ref_point expected {};
+			ref_point infref {};
+			infref.infinity = true;
+			int adjtest_run_count = test_run_count / 10;
+
+			for ( int c = 0; c < 3; c++ )
+			{
+				const u64* curve = curves [ c ];
+				Generator( gen, &gref, curve, curve_params [ c ] );
+				for ( int j = 0; j < 16; j++ )
+				{
+					affine [ j ] = curve [ 48 + j ];			// generator, Montgomery form, from the context
+				};
+
+				// 1. infinity + Q = Q, P + ( -P ) = infinity, P + P = 2P
+				ec_add_mixed_u( result, inf, affine, curve );
+				CheckPoint( result, &gref, curve, curve_names [ c ], "infinity + Q", 0 );
+				for ( int j = 0; j < 24; j++ )
+				{
+					point [ j ] = gen [ j ];
+				};
+				ScalePoint( point, curve, &seed );
+				NegatePoint( point, curve );
+				ec_add_mixed_u( result, point, affine, curve );
+				CheckPoint( result, &infref, curve, curve_names [ c ], "P + ( -P )", 0 );
+				NegatePoint( point, curve );
+				ec_add_mixed_u( result, point, affine, curve );
+				DoubleRef( &expected, &gref, curve_params [ c ] );
+				CheckPoint( result, &expected, curve, curve_names [ c ], "P + P", 0 );
+
+				// 2. running sums: P = P + G, random Jacobian representations, also in place
+				for ( int j = 0; j < 24; j++ )
+				{
+					point [ j ] = result [ j ];
+				};
+				ref = expected;
+				for ( int i = 0; i < adjtest_run_count; i++ )
+				{
+					ScalePoint( point, curve, &seed );
+					AddRef( &expected, &ref, &gref, curve_params [ c ] );
+					reg_verify( ( u64* ) &r_before );
+					s16 ret = ec_add_mixed_u( result, point, affine, curve );
+					reg_verify( ( u64* ) &r_after );
+					Assert::IsTrue( r_before.AreEqual( &r_after ), L"Register validation failed" );
+					Assert::AreEqual( s16( 0 ), ret, _MSGW( L"Return code failed mixed add test, " << curve_names [ c ] << " on run #" << i ) );
+					CheckPoint( result, &expected, curve, curve_names [ c ], "mixed add", i );
+					ec_add_mixed_u( point, point, affine, curve );
+					CheckPoint( point, &expected, curve, curve_names [ c ], "in place mixed add", i );
+					ref = expected;
+				};
+			};
+
+			string test_message = _MSGA( "Mixed point addition function testing.\n\nsecp256k1, P-256, P-384:\n\tinfinity + Q,\n\tP + ( -P ),\n\tP + P.\n"
+				<< adjtest_run_count << " running sums with the affine generator, random Jacobian representations, checked against affine reference, also in place.\n" );
+			Logger::WriteMessage( test_message.c_str( ) );
+			Logger::WriteMessage( L"Passed. Tested expected values, return value, and volatile register integrity: each via assert.\n\n" );
+		};
+
+		TEST_METHOD( ui512ec_05_scalar_mul )
+		{
+			// ec_scalar_mul_u tests
+			// Note: ui512ec_03 must pass before these tests (reference is binary double and add)
+			u64 seed = 0;
+			regs r_before {};
+			regs r_after {};
+			alignas ( 64 ) u64 gen [ 24 ];
+			alignas ( 64 ) u64 point [ 24 ];
+			alignas ( 64 ) u64 result [ 24 ];
+			alignas ( 64 ) u64 expected [ 24 ];
+			alignas ( 64 ) u64 inf [ 24 ] { 0 };
+			_UI512( k ) { 0 };
+			_UI512( q ) { 0 };
+			_UI512( kmodn ) { 0 };
+			ref_point gref {};
+			ref_point infref {};
+			infref.infinity = true;
+			int adjtest_run_count = test_run_count / 20;
+
+			for ( int c = 0; c < 3; c++ )
+			{
+				const u64* curve = curves [ c ];
+				const u64* order = curve_params [ c ] + 40;
+				Generator( gen, &gref, curve, curve_params [ c ] );
+
+				// 1. zero, one, two, infinity
+				zero_u( k );
+				ec_scalar_mul_u( result, k, gen, curve );
+				CheckPoint( result, &infref, curve, curve_names [ c ], "k of zero", 0 );
+				set_uT64( k, 1ull );
+				ec_scalar_mul_u( result, k, gen, curve );
+				CheckPoint( result, &gref, curve, curve_names [ c ], "k of one", 0 );
+				set_uT64( k, 2ull );
+				ec_scalar_mul_u( result, k, gen, curve );
+				ec_double_u( expected, gen, curve );
+				CheckSamePoint( result, expected, curve, curve_names [ c ], "k of two", 0 );
+				ec_scalar_mul_u( result, k, inf, curve );
+				CheckPoint( result, &infref, curve, curve_names [ c ], "infinity", 0 );
+
+				// 2. group order: n G = infinity, ( n - 1 ) G = -G, ( n + 1 ) G = G
+				ec_scalar_mul_u( result, order, gen, curve );
+				CheckPoint( result, &infref, curve, curve_names [ c ], "k of n", 0 );
+				sub_uT64( k, order, 1ull );
+				ec_scalar_mul_u( result, k, gen, curve );
+				for ( int j = 0; j < 24; j++ )
+				{
+					expected [ j ] = gen [ j ];
+				};
+				NegatePoint( expected, curve );
+				CheckSamePoint( result, expected, curve, curve_names [ c ], "k of n - 1", 0 );
+				add_uT64( k, order, 1ull );
+				ec_scalar_mul_u( result, k, gen, curve );
+				CheckPoint( result, &gref, curve, curve_names [ c ], "k of n + 1", 0 );
+
+				// 3. random k of random sizes (all ones once), random multiples of the generator as P; against reference,
+				//	against k mod n, also in place
+				for ( int i = 0; i < adjtest_run_count; i++ )
+				{
+					RandomFill( k, &seed );
+					shr_u( k, k, u16( RandomU64( &seed ) % 512 ) );
+					if ( i == 0 )
+					{
+						for ( int j = 0; j < 8; j++ )
+						{
+							k [ j ] = u64_Max;
+						};
+					};
+					RandomFillMod( q, order, &seed );
+					ScalarMulRef( point, q, gen, curve );
+					ScalarMulRef( expected, k, point, curve );
+					reg_verify( ( u64* ) &r_before );
+					s16 ret = ec_scalar_mul_u( result, k, point, curve );
+					reg_verify( ( u64* ) &r_after );
+					Assert::IsTrue( r_before.AreEqual( &r_after ), L"Register validation failed" );
+					Assert::AreEqual( s16( 0 ), ret, _MSGW( L"Return code failed scalar multiply test, " << curve_names [ c ] << " on run #" << i ) );
+					CheckSamePoint( result, expected, curve, curve_names [ c ], "scalar multiply", i );
+					div_u( q, kmodn, k, order );
+					ec_scalar_mul_u( result, kmodn, point, curve );
+					CheckSamePoint( result, expected, curve, curve_names [ c ], "k mod n", i );
+					ec_scalar_mul_u( point, k, point, curve );
+					CheckSamePoint( point, expected, curve, curve_names [ c ], "in place scalar multiply", i );
+				};
+			};
+
+			string test_message = _MSGA( "Scalar multiply function testing.\n\nsecp256k1, P-256, P-384:\n\tk of zero, one, two,\n\tinfinity,\n\tk of n, n - 1, n + 1.\n"
+				<< adjtest_run_count << " pseudo random scalars of random sizes and points, checked against binary double and add, against k mod n, also in place.\n" );
+			Logger::WriteMessage( test_message.c_str( ) );
+			Logger::WriteMessage( L"Passed. Tested expected values, return value, and volatile register integrity: each via assert.\n\n" );
+		};
+
+		TEST_METHOD( ui512ec_05_scalar_mul_performance )
+		{
+			Logger::WriteMessage( L"Scalar multiply function performance timing test.\n\n" );
+
+			Logger::WriteMessage( L"First run.\n" );
+			perf_stats No1 = Perf_Test_Parms [ 0 ];
+			ui512_Unit_Tests::RunStats( &No1, EcMul );
+
+			Logger::WriteMessage( L"Second run.\n" );
+			perf_stats No2 = Perf_Test_Parms [ 1 ];
+			RunStats( &No2, EcMul );
+
+			Logger::WriteMessage( L"Third run.\n" );
+			perf_stats No3 = Perf_Test_Parms [ 2 ];
+			RunStats( &No3, EcMul );
+		};
+
+		TEST_METHOD( ui512ec_06_comb )
+		{
+			// ec_comb_build_u, ec_comb_mul_u tests
+			// Note: ui512ec_05 must pass before these tests (scalar multiply is the reference)
+			u64 seed = 0;
+			regs r_before {};
+			regs r_after {};
+			alignas ( 64 ) u64 gen [ 24 ];
+			alignas ( 64 ) u64 result [ 24 ];
+			alignas ( 64 ) u64 expected [ 24 ];
+			_UI512( k ) { 0 };
+			ref_point gref {};
+			ref_point infref {};
+			infref.infinity = true;
+			int adjtest_run_count = test_run_count / 20;
+			const u64 block_counts [ ] = { 1, 2, 4 };
+
+			// 1. error cases: blocks out of range
+			Assert::AreEqual( s16( -1 ), ec_comb_build_u( comb_table, 0ull, curve_p256 ), L"Return code failed zero blocks test." );
+			Assert::AreEqual( s16( -1 ), ec_comb_build_u( comb_table, 9ull, curve_p256 ), L"Return code failed nine blocks test." );
+
+			for ( int c = 0; c < 3; c++ )
+			{
+				const u64* curve = curves [ c ];
+				const u64* order = curve_params [ c ] + 40;
+				Generator( gen, &gref, curve, curve_params [ c ] );
+				for ( int b = 0; b < 3; b++ )
+				{
+					const u64 blocks = block_counts [ b ];
+					const u64 bytes = 64 + blocks * 255 * 128;
+					s16 ret = ec_comb_build_u( comb_table, blocks, curve );
+					Assert::AreEqual( s16( 0 ), ret, _MSGW( L"Return code failed build test, " << curve_names [ c ] << ", blocks " << blocks ) );
+					Assert::AreEqual( bytes, comb_table [ 5 ], _MSGW( L"Table size failed build test, " << curve_names [ c ] << ", blocks " << blocks ) );
+
+					// 2. the table works from anywhere: moved, original cleared
+					memcpy( comb_moved, comb_table, bytes );
+					memset( comb_table, 0, bytes );
+
+					// 3. zero, one, n, n - 1
+					zero_u( k );
+					ec_comb_mul_u( result, k, comb_moved, curve );
+					CheckPoint( result, &infref, curve, curve_names [ c ], "comb k of zero", int( blocks ) );
+					set_uT64( k, 1ull );
+					ec_comb_mul_u( result, k, comb_moved, curve );
+					CheckPoint( result, &gref, curve, curve_names [ c ], "comb k of one", int( blocks ) );
+					ec_comb_mul_u( result, order, comb_moved, curve );
+					CheckPoint( result, &infref, curve, curve_names [ c ], "comb k of n", int( blocks ) );
+					sub_uT64( k, order, 1ull );
+					ec_comb_mul_u( result, k, comb_moved, curve );
+					ec_scalar_mul_u( expected, k, gen, curve );
+					CheckSamePoint( result, expected, curve, curve_names [ c ], "comb k of n - 1", int( blocks ) );
+
+					// 4. random k of random sizes, full 512 bits (reduced mod n) once, against variable base scalar multiply
+					for ( int i = 0; i < adjtest_run_count; i++ )
+					{
+						RandomFill( k, &seed );
+						if ( i != 0 )
+						{
+							shr_u( k, k, u16( RandomU64( &seed ) % 512 ) );
+						};
+						ec_scalar_mul_u( expected, k, gen, curve );
+						reg_verify( ( u64* ) &r_before );
+						ret = ec_comb_mul_u( result, k, comb_moved, curve );
+						reg_verify( ( u64* ) &r_after );
+						Assert::IsTrue( r_before.AreEqual( &r_after ), L"Register validation failed" );
+						Assert::AreEqual( s16( 0 ), ret, _MSGW( L"Return code failed comb test, " << curve_names [ c ] << " on run #" << i ) );
+						CheckSamePoint( result, expected, curve, curve_names [ c ], "comb", i );
+					};
+
+					// 5. table for another curve, incomplete table
+					Assert::AreEqual( s16( -1 ), ec_comb_mul_u( result, k, comb_moved, curves [ ( c + 1 ) % 3 ] ),
+						_MSGW( L"Return code failed wrong curve test, " << curve_names [ c ] ) );
+					comb_moved [ 0 ] = 0;
+					Assert::AreEqual( s16( -1 ), ec_comb_mul_u( result, k, comb_moved, curve ),
+						_MSGW( L"Return code failed incomplete table test, " << curve_names [ c ] ) );
+				};
+			};
+
+			string test_message = _MSGA( "Fixed base comb function testing.\n\nError cases:\n\tzero blocks,\n\tnine blocks,\n\ttable for another curve,\n\tincomplete table.\n"
+				<< "secp256k1, P-256, P-384, tables of 1, 2, 4 blocks, moved after build:\n\tk of zero, one, n, n - 1.\n\t"
+				<< adjtest_run_count << " pseudo random scalars of random sizes, checked against variable base scalar multiply.\n" );
+			Logger::WriteMessage( test_message.c_str( ) );
+			Logger::WriteMessage( L"Passed. Tested expected values, return value, and volatile register integrity: each via assert.\n\n" );
+		};
+
+		TEST_METHOD( ui512ec_06_comb_performance )
+		{
+			Logger::WriteMessage( L"Fixed base comb multiply function performance timing test.\n\n" );
+
+			Logger::WriteMessage( L"First run.\n" );
+			perf_stats No1 = Perf_Test_Parms [ 0 ];
+			ui512_Unit_Tests::RunStats( &No1, EcComb );
+
+			Logger::WriteMessage( L"Second run.\n" );
+			perf_stats No2 = Perf_Test_Parms [ 1 ];
+			RunStats( &No2, EcComb );
+
+			Logger::WriteMessage( L"Third run.\n" );
+			perf_stats No3 = Perf_Test_Parms [ 2 ];
+			RunStats( &No3, EcComb );
+		};
+
+		TEST_METHOD( ui512ec_07_msm )
+		{
+			// ec_msm_window_u, ec_msm_u tests
+			// Note: ui512ec_05 must pass before these tests (expected sums are separate scalar multiplies)
+			u64 seed = 0;
+			regs r_before {};
+			regs r_after {};
+			alignas ( 64 ) u64 gen [ 24 ];
+			alignas ( 64 ) u64 point [ 24 ];
+			alignas ( 64 ) u64 result [ 24 ];
+			alignas ( 64 ) u64 expected [ 24 ];
+			alignas ( 64 ) u64 part [ 4 ] [ 24 ];
+			ref_point gref {};
+			ref_point infref {};
+			infref.infinity = true;
+			ec_msm job {};
+
+			// 1. window sizes
+			Assert::AreEqual( s16( 2 ), ec_msm_window_u( 0ull ), L"Window failed count of zero test." );
+			Assert::AreEqual( s16( 2 ), ec_msm_window_u( 1ull ), L"Window failed count of one test." );
+			Assert::AreEqual( s16( 7 ), ec_msm_window_u( 1000ull ), L"Window failed count of 1000 test." );
+			Assert::AreEqual( s16( 12 ), ec_msm_window_u( 1ull << 40 ), L"Window failed count of 2^40 test." );
+
+			for ( int c = 0; c < 3; c++ )
+			{
+				const u64* curve = curves [ c ];
+				const u64* order = curve_params [ c ] + 40;
+				Generator( gen, &gref, curve, curve_params [ c ] );
+
+				// terms: random multiples of the generator, random scalars less than n, a few full 512 bit, and a few zero
+				alignas ( 64 ) u64 ignore [ 24 ];
+				_UI512( q ) { 0 };
+				for ( int i = 0; i < msm_terms; i++ )
+				{
+					RandomFillMod( q, order, &seed );
+					ec_scalar_mul_u( point, q, gen, curve );
+					ToAffineMont( msm_points + i * 16, point, curve );
+					if ( i % 50 == 7 )
+					{
+						RandomFill( msm_scalars + i * 8, &seed );
+					}
+					else if ( i % 50 == 9 )
+					{
+						zero_u( msm_scalars + i * 8 );
+					}
+					else
+					{
+						RandomFillMod( msm_scalars + i * 8, order, &seed );
+					};
+				};
+				for ( int j = 0; j < 24; j++ )
+				{
+					expected [ j ] = 0;
+				};
+				for ( int i = 0; i < msm_terms; i++ )
+				{
+					for ( int j = 0; j < 16; j++ )
+					{
+						point [ j ] = msm_points [ i * 16 + j ];		// already Montgomery form: X and Y as is, Z = one
+					};
+					for ( int j = 0; j < 8; j++ )
+					{
+						point [ 16 + j ] = curve [ 16 + j ];
+					};
+					ec_scalar_mul_u( ignore, msm_scalars + i * 8, point, curve );
+					ec_add_u( expected, expected, ignore, curve );
+				};
+
+				// 2. whole job, window chosen from count, and fixed windows of 1, 4, 8 bits
+				job = { msm_scalars, msm_points, u64( msm_terms ), curve, msm_buckets [ 0 ], 0, 0, 0 };
+				const u64 windows [ ] = { 0, 1, 4, 8 };
+				for ( u64 w : windows )
+				{
+					job.window = w;
+					reg_verify( ( u64* ) &r_before );
+					s16 ret = ec_msm_u( result, &job );
+					reg_verify( ( u64* ) &r_after );
+					Assert::IsTrue( r_before.AreEqual( &r_after ), L"Register validation failed" );
+					Assert::AreEqual( s16( 0 ), ret, _MSGW( L"Return code failed msm test, " << curve_names [ c ] << " window " << w ) );
+					CheckSamePoint( result, expected, curve, curve_names [ c ], "msm", int( w ) );
+				};
+
+				// 3. split by terms and by windows, four jobs on four threads, results added
+				const u64 window = u64( ec_msm_window_u( msm_terms ) );
+				const u64 half_windows = ( 512 / window ) / 2;
+				const int half_terms = msm_terms / 2;
+				ec_msm jobs [ 4 ];
+				for ( int k = 0; k < 4; k++ )
+				{
+					const int terms_first = ( k & 1 ) ? half_terms : 0;
+					jobs [ k ] = { msm_scalars + terms_first * 8, msm_points + terms_first * 16, u64( ( k & 1 ) ? msm_terms - half_terms : half_terms ),
+						curve, msm_buckets [ k ], window, ( k & 2 ) ? half_windows : 0, ( k & 2 ) ? 0 : half_windows };
+				};
+				std::thread workers [ 4 ];
+				for ( int k = 0; k < 4; k++ )
+				{
+					workers [ k ] = std::thread( [ &part, &jobs, k ] ( ) { ec_msm_u( part [ k ], &jobs [ k ] ); } );
+				};
+				for ( int k = 0; k < 4; k++ )
+				{
+					workers [ k ].join( );
+				};
+				for ( int k = 1; k < 4; k++ )
+				{
+					ec_add_u( part [ 0 ], part [ 0 ], part [ k ], curve );
+				};
+				CheckSamePoint( part [ 0 ], expected, curve, curve_names [ c ], "split msm", 0 );
+
+				// 4. no terms, all the same point ( buckets double ), window out of range
+				job = { msm_scalars, msm_points, 0, curve, msm_buckets [ 0 ], 0, 0, 0 };
+				ec_msm_u( result, &job );
+				CheckPoint( result, &infref, curve, curve_names [ c ], "no terms", 0 );
+				ToAffineMont( msm_points, gen, curve );
+				for ( int i = 1; i < 20; i++ )
+				{
+					for ( int j = 0; j < 16; j++ )
+					{
+						msm_points [ i * 16 + j ] = msm_points [ j ];
+					};
+				};
+				_UI512( sum ) { 0 };
+				for ( int i = 0; i < 20; i++ )
+				{
+					add_u( sum, sum, msm_scalars + i * 8 );
+				};
+				div_u( q, sum, sum, order );
+				ec_scalar_mul_u( expected, sum, gen, curve );
+				job = { msm_scalars, msm_points, 20, curve, msm_buckets [ 0 ], 4, 0, 0 };
+				ec_msm_u( result, &job );
+				CheckSamePoint( result, expected, curve, curve_names [ c ], "same point", 0 );
+				job.window = 17;
+				Assert::AreEqual( s16( -1 ), ec_msm_u( result, &job ), _MSGW( L"Return code failed window of 17 test, " << curve_names [ c ] ) );
+			};
+
+			string test_message = _MSGA( "Multi-scalar multiply function testing.\n\nWindow sizes for 0, 1, 1000, 2^40 terms.\nsecp256k1, P-256, P-384:\n\t"
+				<< msm_terms << " terms, random points and scalars ( some full 512 bit, some zero ), against separate scalar multiplies:\n"
+				<< "\t\twindow from count, 1, 4, 8 bits,\n\t\tsplit in four by terms and windows, on four threads.\n\tno terms,\n\tall terms the same point,\n\twindow of 17.\n" );
+			Logger::WriteMessage( test_message.c_str( ) );
+			Logger::WriteMessage( L"Passed. Tested expected values, return value, and volatile register integrity: each via assert.\n\n" );
+		};
+
+		TEST_METHOD( ui512ec_07_msm_performance )
+		{
+			Logger::WriteMessage( L"Multi-scalar multiply function performance timing test.\n\n" );
+
+			Logger::WriteMessage( L"First run.\n" );
+			perf_stats No1 = Perf_Test_Parms [ 0 ];
+			ui512_Unit_Tests::RunStats( &No1, EcMsm );
+
+			Logger::WriteMessage( L"Second run.\n" );
+			perf_stats No2 = Perf_Test_Parms [ 1 ];
+			RunStats( &No2, EcMsm );
+
+			Logger::WriteMessage( L"Third run.\n" );
+			perf_stats No3 = Perf_Test_Parms [ 2 ];
+			RunStats( &No3, EcMsm );
+		};
+
+		TEST_METHOD( ui512ec_08_ecdsa_verify )
+		{
+			// ec_shamir_mul_u, ec_ecdsa_verify_u tests
+			// Note: ui512ec_05 must pass before these tests (scalar multiply is the reference)
+			u64 seed = 0;
+			regs r_before {};
+			regs r_after {};
+			alignas ( 64 ) u64 gen [ 24 ];
+			alignas ( 64 ) u64 point [ 24 ];
+			alignas ( 64 ) u64 result [ 24 ];
+			alignas ( 64 ) u64 expected [ 24 ];
+			alignas ( 64 ) u64 part [ 24 ];
+			alignas ( 64 ) u64 u [ 16 ];
+			_UI512( q ) { 0 };
+			ref_point gref {};
+			ref_point infref {};
+			infref.infinity = true;
+			int adjtest_run_count = test_run_count / 20;
+
+			ecdsa_vectors sets [ 3 ];
+			const int vector_count = LoadEcdsaVectors( sets );
+			Assert::IsTrue( vector_count > 0, L"Could not read ecdsa_vectors.txt" );
+
+			for ( int c = 0; c < 3; c++ )
+			{
+				const u64* curve = curves [ c ];
+				const u64* order = curve_params [ c ] + 40;
+				Generator( gen, &gref, curve, curve_params [ c ] );
+
+				// 1. Shamir double multiply: zero scalars, one and zero, random scalars and points against two scalar multiplies, also in place
+				for ( int j = 0; j < 16; j++ )
+				{
+					u [ j ] = 0;
+				};
+				ec_shamir_mul_u( result, u, gen, curve );
+				CheckPoint( result, &infref, curve, curve_names [ c ], "u1, u2 of zero", 0 );
+				u [ 7 ] = 1;
+				ec_shamir_mul_u( result, u, gen, curve );
+				CheckPoint( result, &gref, curve, curve_names [ c ], "u1 of one, u2 of zero", 0 );
+				for ( int i = 0; i < adjtest_run_count; i++ )
+				{
+					RandomFillMod( u, order, &seed );
+					RandomFillMod( u + 8, order, &seed );
+					RandomFillMod( q, order, &seed );
+					ScalarMulRef( point, q, gen, curve );
+					ec_scalar_mul_u( expected, u, gen, curve );
+					ec_scalar_mul_u( part, u + 8, point, curve );
+					ec_add_u( expected, expected, part, curve );
+					reg_verify( ( u64* ) &r_before );
+					s16 ret = ec_shamir_mul_u( result, u, point, curve );
+					reg_verify( ( u64* ) &r_after );
+					Assert::IsTrue( r_before.AreEqual( &r_after ), L"Register validation failed" );
+					Assert::AreEqual( s16( 0 ), ret, _MSGW( L"Return code failed Shamir multiply test, " << curve_names [ c ] << " on run #" << i ) );
+					CheckSamePoint( result, expected, curve, curve_names [ c ], "Shamir multiply", i );
+					ec_shamir_mul_u( point, u, point, curve );
+					CheckSamePoint( point, expected, curve, curve_names [ c ], "in place Shamir multiply", i );
+				};
+
+				// 2. known-answer vectors, the whole set, then an odd slice ( groups split unevenly ), then none
+				const ecdsa_vectors& set = sets [ c ];
+				const int count = int( set.sigs.size( ) );
+				Assert::IsTrue( count > 17, _MSGW( L"Too few vectors for " << curve_names [ c ] ) );
+				vector<s16> results( count, s16( 1 ) );
+				reg_verify( ( u64* ) &r_before );
+				s16 ret = ec_ecdsa_verify_u( results.data( ), set.sigs.data( ), u64( count ), curve );
+				reg_verify( ( u64* ) &r_after );
+				Assert::IsTrue( r_before.AreEqual( &r_after ), L"Register validation failed" );
+				Assert::AreEqual( s16( 0 ), ret, _MSGW( L"Return code failed verify test, " << curve_names [ c ] ) );
+				for ( int i = 0; i < count; i++ )
+				{
+					Assert::AreEqual( set.expected [ i ], results [ i ], _MSGW( L"Result failed verify test, " << curve_names [ c ] << " vector #" << i ) );
+				};
+				const int first = 3;
+				const int slice = count - 2 * first;
+				for ( int i = 0; i < count; i++ )
+				{
+					results [ i ] = 1;
+				};
+				ec_ecdsa_verify_u( results.data( ) + first, set.sigs.data( ) + first, u64( slice ), curve );
+				for ( int i = 0; i < count; i++ )
+				{
+					const s16 expect = ( i >= first && i < first + slice ) ? set.expected [ i ] : s16( 1 );
+					Assert::AreEqual( expect, results [ i ], _MSGW( L"Result failed slice verify test, " << curve_names [ c ] << " vector #" << i ) );
+				};
+				Assert::AreEqual( s16( 0 ), ec_ecdsa_verify_u( results.data( ), set.sigs.data( ), 0, curve ), _MSGW( L"Return code failed no signatures test, " << curve_names [ c ] ) );
+			};
+
+			string test_message = _MSGA( "ECDSA verify function testing.\n\nsecp256k1, P-256, P-384:\n\tShamir multiply, u1, u2 of zero, u1 of one,\n\t"
+				<< adjtest_run_count << " pseudo random scalar pairs and points, checked against two scalar multiplies, also in place.\n\t"
+				<< vector_count << " known-answer signatures in all ( valid, r, s out of range, s negated, wrong hash, wrong key, key off the curve ),"
+				<< " as one batch, and an uneven slice.\n" );
+			Logger::WriteMessage( test_message.c_str( ) );
+			Logger::WriteMessage( L"Passed. Tested expected values, return value, and volatile register integrity: each via assert.\n\n" );
+		};
+
+		TEST_METHOD( ui512ec_08_ecdsa_verify_performance )
+		{
+			// Throughput: the known-answer vectors, repeated to a burst of verify_burst signatures, verified as one batch.
+			// Note: not pass/fail, informational only
+			const int verify_burst = 4096;
+			ecdsa_vectors sets [ 3 ];
+			Assert::IsTrue( LoadEcdsaVectors( sets ) > 0, L"Could not read ecdsa_vectors.txt" );
+
+			Logger::WriteMessage( L"ECDSA verify throughput test.\n\n" );
+			for ( int c = 0; c < 3; c++ )
+			{
+				const ecdsa_vectors& set = sets [ c ];
+				vector<ecdsa_sig> burst( verify_burst );
+				for ( int i = 0; i < verify_burst; i++ )
+				{
+					burst [ i ] = set.sigs [ i % set.sigs.size( ) ];
+				};
+				vector<s16> results( verify_burst );
+				for ( int run = 0; run < 3; run++ )
+				{
+					auto start = chrono::steady_clock::now( );
+					ec_ecdsa_verify_u( results.data( ), burst.data( ), u64( verify_burst ), curves [ c ] );
+					auto stop = chrono::steady_clock::now( );
+					const double seconds = chrono::duration<double>( stop - start ).count( );
+					string msg = format( "{}, run {}: {} signatures in {:.3f} ms, {:.0f} signatures per second.\n",
+						curve_names [ c ], run + 1, verify_burst, seconds * 1000.0, verify_burst / seconds );
+					Logger::WriteMessage( msg.c_str( ) );
+				};
+				for ( int i = 0; i < verify_burst; i++ )
+				{
+					Assert::AreEqual( set.expected [ i % set.sigs.size( ) ], results [ i ], _MSGW( L"Result failed throughput run, " << curve_names [ c ] << " signature #" << i ) );
+				};
+			};
+			Logger::WriteMessage( L"\n" );
+		};
+
+		TEST_METHOD( ui512ec_09_glv )
+		{
+			// ec_dual_mul_u, ec_glv_mul_u tests
+			// Note: ui512ec_05 must pass before these tests (scalar multiply is the reference)
+			u64 seed = 0;
+			regs r_before {};
+			regs r_after {};
+			alignas ( 64 ) u64 gen [ 24 ];
+			alignas ( 64 ) u64 point [ 24 ];
+			alignas ( 64 ) u64 result [ 24 ];
+			alignas ( 64 ) u64 expected [ 24 ];
+			alignas ( 64 ) u64 part [ 24 ];
+			alignas ( 64 ) u64 pq [ 48 ];
+			alignas ( 64 ) u64 inf [ 24 ] { 0 };
+			alignas ( 64 ) u64 u [ 16 ];
+			_UI512( k ) { 0 };
+			_UI512( q ) { 0 };
+			ref_point gref {};
+			ref_point infref {};
+			infref.infinity = true;
+			int adjtest_run_count = test_run_count / 20;
+
+			// 1. dual multiply, each curve: random scalars and points, against two scalar multiplies
+			for ( int c = 0; c < 3; c++ )
+			{
+				const u64* curve = curves [ c ];
+				const u64* order = curve_params [ c ] + 40;
+				Generator( gen, &gref, curve, curve_params [ c ] );
+				for ( int i = 0; i < adjtest_run_count / 4; i++ )
+				{
+					RandomFillMod( u, order, &seed );
+					RandomFillMod( u + 8, order, &seed );
+					RandomFillMod( q, order, &seed );
+					ScalarMulRef( pq, q, gen, curve );
+					RandomFillMod( q, order, &seed );
+					ScalarMulRef( pq + 24, q, gen, curve );
+					ec_scalar_mul_u( expected, u, pq, curve );
+					ec_scalar_mul_u( part, u + 8, pq + 24, curve );
+					ec_add_u( expected, expected, part, curve );
+					reg_verify( ( u64* ) &r_before );
+					s16 ret = ec_dual_mul_u( result, u, pq, curve );
+					reg_verify( ( u64* ) &r_after );
+					Assert::IsTrue( r_before.AreEqual( &r_after ), L"Register validation failed" );
+					Assert::AreEqual( s16( 0 ), ret, _MSGW( L"Return code failed dual multiply test, " << curve_names [ c ] << " on run #" << i ) );
+					CheckSamePoint( result, expected, curve, curve_names [ c ], "dual multiply", i );
+				};
+			};
+
+			// 2. GLV, secp256k1: k of zero, one, n - 1, n, n + 1, all ones; infinity
+			const u64* curve = curves [ 0 ];
+			const u64* order = curve_params [ 0 ] + 40;
+			Generator( gen, &gref, curve, curve_params [ 0 ] );
+			zero_u( k );
+			ec_glv_mul_u( result, k, gen, curve );
+			CheckPoint( result, &infref, curve, curve_names [ 0 ], "GLV k of zero", 0 );
+			set_uT64( k, 1ull );
+			ec_glv_mul_u( result, k, gen, curve );
+			CheckPoint( result, &gref, curve, curve_names [ 0 ], "GLV k of one", 0 );
+			ec_glv_mul_u( result, order, gen, curve );
+			CheckPoint( result, &infref, curve, curve_names [ 0 ], "GLV k of n", 0 );
+			add_uT64( k, order, 1ull );
+			ec_glv_mul_u( result, k, gen, curve );
+			CheckPoint( result, &gref, curve, curve_names [ 0 ], "GLV k of n + 1", 0 );
+			sub_uT64( k, order, 1ull );
+			ec_scalar_mul_u( expected, k, gen, curve );
+			ec_glv_mul_u( result, k, gen, curve );
+			CheckSamePoint( result, expected, curve, curve_names [ 0 ], "GLV k of n - 1", 0 );
+			for ( int j = 0; j < 8; j++ )
+			{
+				k [ j ] = u64_Max;
+			};
+			ec_scalar_mul_u( expected, k, gen, curve );
+			ec_glv_mul_u( result, k, gen, curve );
+			CheckSamePoint( result, expected, curve, curve_names [ 0 ], "GLV k all ones", 0 );
+			ec_glv_mul_u( result, k, inf, curve );
+			CheckPoint( result, &infref, curve, curve_names [ 0 ], "GLV infinity", 0 );
+
+			// 3. GLV, random k of random sizes and random points, against scalar multiply, also in place
+			for ( int i = 0; i < adjtest_run_count; i++ )
+			{
+				RandomFill( k, &seed );
+				shr_u( k, k, u16( RandomU64( &seed ) % 512 ) );
+				RandomFillMod( q, order, &seed );
+				ScalarMulRef( point, q, gen, curve );
+				ec_scalar_mul_u( expected, k, point, curve );
+				reg_verify( ( u64* ) &r_before );
+				s16 ret = ec_glv_mul_u( result, k, point, curve );
+				reg_verify( ( u64* ) &r_after );
+				Assert::IsTrue( r_before.AreEqual( &r_after ), L"Register validation failed" );
+				Assert::AreEqual( s16( 0 ), ret, _MSGW( L"Return code failed GLV test on run #" << i ) );
+				CheckSamePoint( result, expected, curve, curve_names [ 0 ], "GLV multiply", i );
+				ec_glv_mul_u( point, k, point, curve );
+				CheckSamePoint( point, expected, curve, curve_names [ 0 ], "in place GLV multiply", i );
+			};
+
+			// 4. not secp256k1
+			Assert::AreEqual( s16( -1 ), ec_glv_mul_u( result, k, gen, curves [ 1 ] ), L"Return code failed GLV on P-256 test" );
+
+			string test_message = _MSGA( "GLV and dual multiply function testing.\n\nDual multiply, secp256k1, P-256, P-384:\n\t"
+				<< adjtest_run_count / 4 << " pseudo random scalar pairs and point pairs, checked against two scalar multiplies.\n"
+				<< "GLV, secp256k1:\n\tk of zero, one, n - 1, n, n + 1, all ones,\n\tinfinity,\n\t"
+				<< adjtest_run_count << " pseudo random scalars of random sizes and points, checked against scalar multiply, also in place.\n"
+				<< "\tP-256 rejected.\n" );
+			Logger::WriteMessage( test_message.c_str( ) );
+			Logger::WriteMessage( L"Passed. Tested expected values, return value, and volatile register integrity: each via assert.\n\n" );
+		};
+
+		TEST_METHOD( ui512ec_09_glv_performance )
+		{
+			Logger::WriteMessage( L"GLV scalar multiply function performance timing test.\n\n" );
+
+			Logger::WriteMessage( L"First run.\n" );
+			perf_stats No1 = Perf_Test_Parms [ 0 ];
+			ui512_Unit_Tests::RunStats( &No1, EcGlv );
+
+			Logger::WriteMessage( L"Second run.\n" );
+			perf_stats No2 = Perf_Test_Parms [ 1 ];
+			RunStats( &No2, EcGlv );
+
+			Logger::WriteMessage( L"Third run.\n" );
+			perf_stats No3 = Perf_Test_Parms [ 2 ];
+			RunStats( &No3, EcGlv );
+		};
+	};
+};
@@ -0,0 +1,369 @@
+//		ui512_unit_tests_ed448
+//
+//		File:			ui512_unit_tests_ed448.cpp
+//		Author:			John G.Lynch
+//		Legal:			Copyright @2025, per MIT License below
+//		Date:			October 19, 2026
+//
+//		ui512 is a small project to provide basic operations for a variable type of unsigned 512 bit integer.
+//		The basic operations : zero, copy, compare, add, subtract.
+//		Other optional modules provide bit ops and multiply / divide.
+//		It is written in assembly language, using the MASM ( ml64 ) assembler provided as an option within Visual Studio.
+//		( currently using VS Community 2022 17.14.10)
+//		It provides external signatures that allow linkage to C and C++ programs,
+//		where a shell / wrapper could encapsulate the methods as part of an object.
+//		It has assembly time options directing the use of Intel processor extensions : AVX4, AVX2, SIMD, or none :
+//		( Z ( 512 ), Y ( 256 ), or X ( 128 ) registers, or regular Q ( 64bit ) ).
+//		If processor extensions are used, the caller must align the variables declared and passed
+//		on the appropriate byte boundary ( e.g. alignas 64 for 512 )
+//		These modules (in total) are very light-weight ( less than 10K bytes ) and relatively fast,
+//		but is not intended for all processor types or all environments.
+//
+//		Intended use cases :
+//			1.) a "sum of primes" for primes up to 2 ^ 48.
+//			2.) elliptical curve cryptography(ECC)
+//
+//		This sub - project: ui512aTests, is a unit test project that invokes each of the routines in the ui512a assembly.
+//		It runs each assembler proc with pseudo-random values.
+//		It validates ( asserts ) expected and returned results.
+//		It also runs each repeatedly for comparative timings.
+//		It provides a means to invoke and debug.
+//		It illustrates calling the routines from C++.
+
+#include "pch.h"
+#include "CppUnitTest.h"
+#include "ui512_externs.h"
+#include "ui512_unit_tests.h"
+
+#include <cstring>
+#include <sstream>
+#include <format>
+#include <chrono>
+#include "intrin.h"
+
+using namespace std;
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+namespace ui512_Unit_Tests
+{
+	/// <summary>
+	/// Reference affine addition, x3 = ( x1 y2 + y1 x2 ) / ( 1 + d x1 x2 y1 y2 ), y3 = ( y1 y2 - x1 x2 ) / ( 1 - d x1 x2 y1 y2 ), d = -39081
+	/// </summary>
+	static void AffineAddRef( u64* x3, u64* y3, const u64* x1, const u64* y1, const u64* x2, const u64* y2 )
+	{
+		_UI512( d ) { 0 };
+		_UI512( t ) { 0 };
+		_UI512( u ) { 0 };
+		_UI512( num ) { 0 };
+		_UI512( den ) { 0 };
+		_UI512( rx ) { 0 };
+		_UI512( one ) { 0 };
+		set_uT64( one, 1ull );
+		sub_uT64( d, prime_448, 39081ull );
+		MulModRef( t, x1, x2, prime_448 );
+		MulModRef( u, y1, y2, prime_448 );
+		MulModRef( den, t, u, prime_448 );
+		MulModRef( den, den, d, prime_448 );						// d x1 x2 y1 y2
+		MulModRef( num, x1, y2, prime_448 );
+		MulModRef( rx, y1, x2, prime_448 );
+		if ( add_u( num, num, rx ) != 0 || compare_u( num, prime_448 ) >= 0 )
+		{
+			sub_u( num, num, prime_448 );
+		};
+		add_u( rx, one, den );
+		if ( compare_u( rx, prime_448 ) >= 0 )
+		{
+			sub_u( rx, rx, prime_448 );
+		};
+		invmod_u( rx, rx, prime_448 );
+		MulModRef( rx, num, rx, prime_448 );
+		if ( sub_u( num, u, t ) != 0 )
+		{
+			add_u( num, num, prime_448 );
+		};
+		if ( sub_u( den, one, den ) != 0 )
+		{
+			add_u( den, den, prime_448 );
+		};
+		invmod_u( den, den, prime_448 );
+		MulModRef( y3, num, den, prime_448 );
+		copy_u( x3, rx );
+	};
+
+	/// <summary>
+	/// Check an extended point: on the curve, and the given affine coordinates
+	/// </summary>
+	static void CheckEdPoint( const u64* point, const u64* ex, const u64* ey, const char* test, int run )
+	{
+		_UI512( x ) { 0 };
+		_UI512( y ) { 0 };
+		Assert::AreEqual( s16( 0 ), ed448_on_curve_u( point ), _MSGW( L"Result not on curve, " << test << " test on run #" << run ) );
+		Assert::AreEqual( s16( 0 ), ed448_to_affine_u( x, y, point ), _MSGW( L"Return code failed to affine, " << test << " test on run #" << run ) );
+		for ( int j = 0; j < 8; j++ )
+		{
+			Assert::AreEqual( ex [ j ], x [ j ], _MSGW( L"x at word #" << j << " failed " << test << " test on run #" << run ) );
+			Assert::AreEqual( ey [ j ], y [ j ], _MSGW( L"y at word #" << j << " failed " << test << " test on run #" << run ) );
+		};
+	};
+
+	/// <summary>
+	/// Check two extended points are the same point
+	/// </summary>
+	static void CheckSameEdPoint( const u64* point, const u64* expected, const char* test, int run )
+	{
+		_UI512( x ) { 0 };
+		_UI512( y ) { 0 };
+		ed448_to_affine_u( x, y, expected );
+		CheckEdPoint( point, x, y, test, run );
+	};
+
+	/// <summary>
+	/// Same point, different extended representation: ( X lambda, Y lambda, Z lambda, T lambda ), lambda a pseudo random non-zero value
+	/// </summary>
+	static void ScaleEdPoint( u64* point, u64* seed )
+	{
+		_UI512( lambda ) { 0 };
+		do
+		{
+			RandomFillMod( lambda, prime_448, seed );
+		} while ( compare_uT64( lambda, 0ull ) == 0 );
+		for ( int c = 0; c < 4; c++ )
+		{
+			MulModRef( point + 8 * c, point + 8 * c, lambda, prime_448 );
+		};
+	};
+
+	/// <summary>
+	/// Reference scalar multiplication, left to right binary double and add on the (tested) extended formulas
+	/// </summary>
+	static void EdScalarMulRef( u64* result, const u64* k, const u64* point )
+	{
+		alignas ( 64 ) u64 acc [ 32 ] { 0 };
+		acc [ 15 ] = 1;
+		acc [ 23 ] = 1;
+		for ( int i = msb_u( k ); i >= 0; i-- )
+		{
+			ed448_double_u( acc, acc );
+			if ( ( k [ 7 - i / 64 ] >> ( i % 64 ) ) & 1ull )
+			{
+				ed448_add_u( acc, acc, point );
+			};
+		};
+		for ( int j = 0; j < 32; j++ )
+		{
+			result [ j ] = acc [ j ];
+		};
+	};
+
+	TEST_CLASS( ui512_unit_tests_ed448 )
+	{
+		TEST_METHOD( ui512ed_01_add_double )
+		{
+			// ed448_from_affine_u, ed448_to_affine_u, ed448_on_curve_u, ed448_add_u, ed448_double_u tests
+			// Note: mult_u, reduce_448_u and invmod_u must pass testing before these tests
+			u64 seed = 0;
+			regs r_before {};
+			regs r_after {};
+			alignas ( 64 ) u64 point [ 32 ];
+			alignas ( 64 ) u64 other [ 32 ];
+			alignas ( 64 ) u64 result [ 32 ];
+			alignas ( 64 ) u64 neutral [ 32 ] { 0 };
+			_UI512( x ) { 0 };
+			_UI512( y ) { 0 };
+			_UI512( rx ) { 0 };
+			_UI512( ry ) { 0 };
+			_UI512( ex ) { 0 };
+			_UI512( ey ) { 0 };
+			_UI512( zero ) { 0 };
+			_UI512( one ) { 0 };
+			set_uT64( one, 1ull );
+			neutral [ 15 ] = 1;
+			neutral [ 23 ] = 1;
+			int adjtest_run_count = test_run_count / 20;
+
+			// 1. base point: on the curve, affine round trip; neutral point; a changed point is not on the curve; x, y not below p rejected
+			Assert::AreEqual( s16( 0 ), ed448_on_curve_u( ed448_base ), L"Base point not on curve" );
+			reg_verify( ( u64* ) &r_before );
+			s16 ret = ed448_to_affine_u( x, y, ed448_base );
+			reg_verify( ( u64* ) &r_after );
+			Assert::IsTrue( r_before.AreEqual( &r_after ), L"Register validation failed" );
+			Assert::AreEqual( s16( 0 ), ret, L"Return code failed to affine test" );
+			reg_verify( ( u64* ) &r_before );
+			ret = ed448_from_affine_u( point, x, y );
+			reg_verify( ( u64* ) &r_after );
+			Assert::IsTrue( r_before.AreEqual( &r_after ), L"Register validation failed" );
+			Assert::AreEqual( s16( 0 ), ret, L"Return code failed from affine test" );
+			for ( int j = 0; j < 32; j++ )
+			{
+				Assert::AreEqual( ed448_base [ j ], point [ j ], _MSGW( L"Base point at word #" << j << " failed round trip test" ) );
+			};
+			CheckEdPoint( neutral, zero, one, "neutral point", 0 );
+			point [ 7 ] ^= 1;
+			Assert::AreEqual( s16( -1 ), ed448_on_curve_u( point ), L"Changed point on curve" );
+			copy_u( point, ed448_base );
+			point [ 31 ] ^= 1;
+			Assert::AreEqual( s16( -1 ), ed448_on_curve_u( point ), L"Point with changed T on curve" );
+			Assert::AreEqual( s16( -1 ), ed448_from_affine_u( point, prime_448, y ), L"Return code failed x of p test" );
+			Assert::AreEqual( s16( -1 ), ed448_from_affine_u( point, x, prime_448 ), L"Return code failed y of p test" );
+			zero_u( point + 16 );
+			Assert::AreEqual( s16( -1 ), ed448_to_affine_u( rx, ry, point ), L"Return code failed Z of zero test" );
+
+			// 2. neutral point: P + 0, 0 + P, 0 + 0, 2 * 0, and P + ( -P )
+			ed448_add_u( result, ed448_base, neutral );
+			CheckEdPoint( result, x, y, "P + neutral", 0 );
+			ed448_add_u( result, neutral, ed448_base );
+			CheckEdPoint( result, x, y, "neutral + P", 0 );
+			ed448_add_u( result, neutral, neutral );
+			CheckEdPoint( result, zero, one, "neutral + neutral", 0 );
+			ed448_double_u( result, neutral );
+			CheckEdPoint( result, zero, one, "2 * neutral", 0 );
+			sub_u( rx, prime_448, x );
+			ed448_from_affine_u( other, rx, y );
+			ed448_add_u( result, ed448_base, other );
+			CheckEdPoint( result, zero, one, "P + ( -P )", 0 );
+
+			// 3. walk: P = P + base, and 2P, against the affine reference; P in a pseudo random representation; also in place, and P + P
+			memcpy( point, ed448_base, sizeof( point ) );
+			copy_u( rx, x );
+			copy_u( ry, y );
+			for ( int i = 0; i < adjtest_run_count; i++ )
+			{
+				ScaleEdPoint( point, &seed );
+				AffineAddRef( ex, ey, rx, ry, rx, ry );
+				reg_verify( ( u64* ) &r_before );
+				ret = ed448_double_u( result, point );
+				reg_verify( ( u64* ) &r_after );
+				Assert::IsTrue( r_before.AreEqual( &r_after ), L"Register validation failed" );
+				Assert::AreEqual( s16( 0 ), ret, _MSGW( L"Return code failed double test on run #" << i ) );
+				CheckEdPoint( result, ex, ey, "double", i );
+				ed448_add_u( result, point, point );
+				CheckEdPoint( result, ex, ey, "P + P", i );
+				memcpy( other, point, sizeof( other ) );
+				ed448_double_u( other, other );
+				CheckEdPoint( other, ex, ey, "in place double", i );
+
+				AffineAddRef( ex, ey, rx, ry, x, y );
+				reg_verify( ( u64* ) &r_before );
+				ret = ed448_add_u( result, point, ed448_base );
+				reg_verify( ( u64* ) &r_after );
+				Assert::IsTrue( r_before.AreEqual( &r_after ), L"Register validation failed" );
+				Assert::AreEqual( s16( 0 ), ret, _MSGW( L"Return code failed add test on run #" << i ) );
+				CheckEdPoint( result, ex, ey, "add", i );
+				ed448_add_u( point, ed448_base, point );
+				CheckEdPoint( point, ex, ey, "in place add", i );
+				copy_u( rx, ex );
+				copy_u( ry, ey );
+			};
+
+			string test_message = _MSGA( "Ed448 point add and double function testing.\n\nBase point on curve, affine round trip,\n"
+				<< "\tneutral point, changed X, changed T not on curve, x or y of p rejected, Z of zero rejected.\n"
+				<< "Neutral point: P + 0, 0 + P, 0 + 0, 2 * 0, P + ( -P ).\n"
+				<< adjtest_run_count << " successive multiples of the base point, in pseudo random representations, doubled and added,\n"
+				<< "\tchecked against affine reference formulas, also in place, and P + P.\n" );
+			Logger::WriteMessage( test_message.c_str( ) );
+			Logger::WriteMessage( L"Passed. Tested expected values, return value, and volatile register integrity: each via assert.\n\n" );
+		};
+
+		TEST_METHOD( ui512ed_02_scalar_mul )
+		{
+			// ed448_scalar_mul_u tests
+			// Note: ui512ed_01 must pass before these tests (add and double are the reference)
+			u64 seed = 0;
+			regs r_before {};
+			regs r_after {};
+			alignas ( 64 ) u64 point [ 32 ];
+			alignas ( 64 ) u64 result [ 32 ];
+			alignas ( 64 ) u64 expected [ 32 ];
+			_UI512( k ) { 0x0123456789ABCDEFull, 0xFEDCBA9876543210ull, 0x0F1E2D3C4B5A6978ull, 0x8796A5B4C3D2E1F0ull,
+				0x0123456789ABCDEFull, 0xFEDCBA9876543210ull, 0x0F1E2D3C4B5A6978ull, 0x8796A5B4C3D2E1F0ull };
+			_UI512( kx ) { 0, 0x9CCEB540E898B85Dull, 0x175A9018A766B16Cull, 0xA15CA6A042253560ull,
+				0xA0C3194288DD20C5ull, 0x8511339FD1123745ull, 0x9A938CC37FA517C2ull, 0x1E51683E4C630EA8ull };
+			_UI512( ky ) { 0, 0xFEA682C94DA2301Eull, 0x921CC30742C0A90Cull, 0xB082A1911CEC3434ull,
+				0xCF6E99B95E71D0D3ull, 0x50295D1768087DCCull, 0xF63DFDEF18C41CB6ull, 0x432541B4259E5C1Cull };
+			_UI512( x ) { 0 };
+			_UI512( y ) { 0 };
+			_UI512( zero ) { 0 };
+			_UI512( one ) { 0 };
+			set_uT64( one, 1ull );
+			ed448_to_affine_u( x, y, ed448_base );
+			int adjtest_run_count = test_run_count / 50;
+
+			// 1. known answer ( computed independently, affine formulas ), full 512 bit k
+			reg_verify( ( u64* ) &r_before );
+			s16 ret = ed448_scalar_mul_u( result, k, ed448_base );
+			reg_verify( ( u64* ) &r_after );
+			Assert::IsTrue( r_before.AreEqual( &r_after ), L"Register validation failed" );
+			Assert::AreEqual( s16( 0 ), ret, L"Return code failed known answer test" );
+			CheckEdPoint( result, kx, ky, "known answer", 0 );
+
+			// 2. k of zero, one, order, order + 1, order - 1 ( the negated base point ), all ones
+			zero_u( k );
+			ed448_scalar_mul_u( result, k, ed448_base );
+			CheckEdPoint( result, zero, one, "k of zero", 0 );
+			set_uT64( k, 1ull );
+			ed448_scalar_mul_u( result, k, ed448_base );
+			CheckEdPoint( result, x, y, "k of one", 0 );
+			ed448_scalar_mul_u( result, ed448_order, ed448_base );
+			CheckEdPoint( result, zero, one, "k of order", 0 );
+			add_uT64( k, ed448_order, 1ull );
+			ed448_scalar_mul_u( result, k, ed448_base );
+			CheckEdPoint( result, x, y, "k of order + 1", 0 );
+			sub_uT64( k, ed448_order, 1ull );
+			ed448_scalar_mul_u( result, k, ed448_base );
+			sub_u( k, prime_448, x );
+			CheckEdPoint( result, k, y, "k of order - 1", 0 );
+			for ( int j = 0; j < 8; j++ )
+			{
+				k [ j ] = u64_Max;
+			};
+			EdScalarMulRef( expected, k, ed448_base );
+			ed448_scalar_mul_u( result, k, ed448_base );
+			CheckSameEdPoint( result, expected, "k all ones", 0 );
+
+			// 3. random k of random sizes, random points, against the reference; also in place
+			for ( int i = 0; i < adjtest_run_count; i++ )
+			{
+				RandomFill( k, &seed );
+				ed448_scalar_mul_u( point, k, ed448_base );
+				ScaleEdPoint( point, &seed );
+				RandomFill( k, &seed );
+				shr_u( k, k, u16( RandomU64( &seed ) % 512 ) );
+				EdScalarMulRef( expected, k, point );
+				reg_verify( ( u64* ) &r_before );
+				ret = ed448_scalar_mul_u( result, k, point );
+				reg_verify( ( u64* ) &r_after );
+				Assert::IsTrue( r_before.AreEqual( &r_after ), L"Register validation failed" );
+				Assert::AreEqual( s16( 0 ), ret, _MSGW( L"Return code failed random test on run #" << i ) );
+				CheckSameEdPoint( result, expected, "scalar multiply", i );
+				ed448_scalar_mul_u( point, k, point );
+				CheckSameEdPoint( point, expected, "in place scalar multiply", i );
+			};
+
+			string test_message = _MSGA( "Ed448 scalar multiply function testing.\n\nKnown answer, full 512 bit k,\n"
+				<< "\tk of zero, one, order, order + 1, order - 1, all ones,\n\t"
+				<< adjtest_run_count << " pseudo random scalars of random sizes and points, checked against double and add, also in place.\n" );
+			Logger::WriteMessage( test_message.c_str( ) );
+			Logger::WriteMessage( L"Passed. Tested expected values, return value, and volatile register integrity: each via assert.\n\n" );
+		};
+
+		TEST_METHOD( ui512ed_02_scalar_mul_performance )
+		{
+			// Performance timing tests.
+			// Note: these tests are not pass/fail, they are informational only
+
+			Logger::WriteMessage( L"Ed448 scalar multiply function performance timing test.\n\n" );
+
+			Logger::WriteMessage( L"First run.\n" );
+			perf_stats No1 = Perf_Test_Parms [ 0 ];
+			ui512_Unit_Tests::RunStats( &No1, Ed448Mul );
+
+			Logger::WriteMessage( L"Second run.\n" );
+			perf_stats No2 = Perf_Test_Parms [ 1 ];
+			RunStats( &No2, Ed448Mul );
+
+			Logger::WriteMessage( L"Third run.\n" );
+			perf_stats No3 = Perf_Test_Parms [ 2 ];
+			RunStats( &No3, Ed448Mul );
+		};
+	};
+};
@@ -0,0 +1,841 @@
+//		ui512_unit_tests_modular
+//
+//		File:			ui512_unit_tests_modular.cpp
+//		Author:			John G.Lynch
+//		Legal:			Copyright @2025, per MIT License below
+//		Date:			October 19, 2026
+//
+//		ui512 is a small project to provide basic operations for a variable type of unsigned 512 bit integer.
+//		The basic operations : zero, copy, compare, add, subtract.
+//		Other optional modules provide bit ops and multiply / divide.
+//		It is written in assembly language, using the MASM ( ml64 ) assembler provided as an option within Visual Studio.
+//		( currently using VS Community 2022 17.14.10)
+//		It provides external signatures that allow linkage to C and C++ programs,
+//		where a shell / wrapper could encapsulate the methods as part of an object.
+//		It has assembly time options directing the use of Intel processor extensions : AVX4, AVX2, SIMD, or none :
+//		( Z ( 512 ), Y ( 256 ), or X ( 128 ) registers, or regular Q ( 64bit ) ).
+//		If processor extensions are used, the caller must align the variables declared and passed
+//		on the appropriate byte boundary ( e.g. alignas 64 for 512 )
+//		These modules (in total) are very light-weight ( less than 10K bytes ) and relatively fast,
+//		but is not intended for all processor types or all environments.
+//
+//		Intended use cases :
+//			1.) a "sum of primes" for primes up to 2 ^ 48.
+//			2.) elliptical curve cryptography(ECC)
+//
+//		This sub - project: ui512aTests, is a unit test project that invokes each of the routines in the ui512a assembly.
+//		It runs each assembler proc with pseudo-random values.
+//		It validates ( asserts ) expected and returned results.
+//		It also runs each repeatedly for comparative timings.
+//		It provides a means to invoke and debug.
+//		It illustrates calling the routines from C++.
+
+#include "pch.h"
+#include "CppUnitTest.h"
+#include "ui512_externs.h"
+#include "ui512_unit_tests.h"
+
+#include <cstring>
+#include <sstream>
+#include <format>
+#include <chrono>
+#include "intrin.h"
+
+using namespace std;
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+namespace ui512_Unit_Tests
+{
+	/// <summary>
+	/// Random odd modulus, of a random size from 2 to 512 bits, greater than one
+	/// </summary>
+	static void RandomOddModulus( u64* mod, u64* seed )
+	{
+		RandomFill( mod, seed );
+		u16 shift = u16( RandomU64( seed ) % 511 );
+		shr_u( mod, mod, shift );
+		mod [ 7 ] |= 1ull;
+		if ( compare_uT64( mod, 1ull ) == 0 )
+		{
+			mod [ 7 ] = 3ull;
+		};
+	};
+
+	/// <summary>
+	/// Reference modular exponentiation, square and multiply with the shift and add reference modular multiply
+	/// </summary>
+	static void PowModRef( u64* result, const u64* base, const u64* exponent, const u64* mod )
+	{
+		_UI512( r ) { 0 };
+		_UI512( b ) { 0 };
+		_UI512( q ) { 0 };
+		div_u( q, b, base, mod );
+		set_uT64( r, 1ull );
+		for ( int i = msb_u( exponent ); i >= 0; i-- )
+		{
+			MulModRef( r, r, r, mod );
+			if ( ( exponent [ 7 - i / 64 ] >> ( i % 64 ) ) & 1ull )
+			{
+				MulModRef( r, r, b, mod );
+			};
+		};
+		copy_u( result, r );
+	};
+
+	/// <summary>
+	/// Reference Jacobi symbol, textbook algorithm with remainders from div_u
+	/// </summary>
+	static s16 JacobiRef( const u64* a, const u64* n )
+	{
+		_UI512( x ) { 0 };
+		_UI512( y ) { 0 };
+		_UI512( q ) { 0 };
+		_UI512( t ) { 0 };
+		s16 sign = 1;
+		copy_u( y, n );
+		div_u( q, x, a, y );
+		while ( compare_uT64( x, 0ull ) != 0 )
+		{
+			while ( ( x [ 7 ] & 1ull ) == 0 )
+			{
+				shr_u( x, x, 1 );
+				if ( ( y [ 7 ] & 7ull ) == 3 || ( y [ 7 ] & 7ull ) == 5 )
+				{
+					sign = -sign;
+				};
+			};
+			copy_u( t, x );
+			copy_u( x, y );
+			copy_u( y, t );
+			if ( ( x [ 7 ] & 3ull ) == 3 && ( y [ 7 ] & 3ull ) == 3 )
+			{
+				sign = -sign;
+			};
+			div_u( q, x, x, y );
+		};
+		return ( compare_uT64( y, 1ull ) == 0 ) ? sign : 0;
+	};
+
+	// primes = 1 mod 8, for the Tonelli-Shanks path: P-224 ( p - 1 = q * 2^96 ), secp256k1 group order ( p - 1 = q * 2^6 )
+	alignas ( 64 ) static const u64 prime_p224 [ 8 ] { 0, 0, 0, 0, 0x00000000FFFFFFFFull, 0xFFFFFFFFFFFFFFFFull, 0xFFFFFFFF00000000ull, 0x0000000000000001ull };
+	alignas ( 64 ) static const u64 order_secp256k1 [ 8 ] { 0, 0, 0, 0, 0xFFFFFFFFFFFFFFFFull, 0xFFFFFFFFFFFFFFFEull, 0xBAAEDCE6AF48A03Bull, 0xBFD25E8CD0364141ull };
+
+	TEST_CLASS( ui512_unit_tests_modular )
+	{
+		TEST_METHOD( ui512mod_01_mont_mul )
+		{
+			// mont_init_u and mont_mul_u tests
+			// Note: mult_u, shift, add, subtract, compare must pass testing before these tests (used in reference modular multiply)
+			u64 seed = 0;
+			regs r_before {};
+			regs r_after {};
+			alignas ( 64 ) u64 ctx [ 32 ] { };
+			_UI512( mod ) { 0 };
+			_UI512( num1 ) { 0 };
+			_UI512( num2 ) { 0 };
+			_UI512( one ) { 0 };
+			_UI512( result ) { 0 };
+			_UI512( result2 ) { 0 };
+			_UI512( expected ) { 0 };
+
+			// 1. error cases: even modulus, one, zero
+			set_uT64( mod, 1ull << 40 );
+			Assert::AreEqual( s16( -1 ), mont_init_u( ctx, mod ), L"Return code failed even modulus test." );
+			set_uT64( mod, 1ull );
+			Assert::AreEqual( s16( -1 ), mont_init_u( ctx, mod ), L"Return code failed modulus of one test." );
+			zero_u( mod );
+			Assert::AreEqual( s16( -1 ), mont_init_u( ctx, mod ), L"Return code failed modulus of zero test." );
+
+			// 2. random odd moduli of random sizes, random reduced operands
+			//	mont_mul ( mont_mul ( a, b ), R^2 ) = a * b mod m, checked against shift and add reference
+			//	mont_mul ( a, R mod m ) = a; to Montgomery form and back ( a * R^2 * R^-1, then * 1 * R^-1 ) = a
+			set_uT64( one, 1ull );
+			for ( int i = 0; i < test_run_count; i++ )
+			{
+				RandomOddModulus( mod, &seed );
+				if ( i == 0 )
+				{
+					copy_u( mod, prime_p256 );
+				}
+				else if ( i == 1 )
+				{
+					for ( int j = 0; j < 8; j++ )
+					{
+						mod [ j ] = u64_Max;
+					};
+				};
+				RandomFillMod( num1, mod, &seed );
+				RandomFillMod( num2, mod, &seed );
+				reg_verify( ( u64* ) &r_before );
+				s16 ret = mont_init_u( ctx, mod );
+				reg_verify( ( u64* ) &r_after );
+				Assert::IsTrue( r_before.AreEqual( &r_after ), L"Register validation failed" );
+				Assert::AreEqual( s16( 0 ), ret, _MSGW( L"Return code failed mont_init_u on run #" << i ) );
+
+				reg_verify( ( u64* ) &r_before );
+				ret = mont_mul_u( result, num1, num2, ctx );
+				reg_verify( ( u64* ) &r_after );
+				Assert::IsTrue( r_before.AreEqual( &r_after ), L"Register validation failed" );
+				Assert::AreEqual( s16( 0 ), ret, _MSGW( L"Return code failed mont_mul_u on run #" << i ) );
+				Assert::IsTrue( compare_u( result, mod ) < 0, _MSGW( L"Result not reduced on run #" << i ) );
+				mont_mul_u( result, result, &ctx [ 8 ], ctx );			// times R^2 * R^-1, in place
+				MulModRef( expected, num1, num2, mod );
+				for ( int j = 0; j < 8; j++ )
+				{
+					Assert::AreEqual( expected [ j ], result [ j ], _MSGW( L"Product at word #" << j << " failed on run #" << i ) );
+				};
+
+				mont_mul_u( result, num1, &ctx [ 16 ], ctx );			// times one in Montgomery form
+				mont_mul_u( result2, num1, &ctx [ 8 ], ctx );			// into Montgomery form
+				mont_mul_u( result2, result2, one, ctx );				// and back out
+				for ( int j = 0; j < 8; j++ )
+				{
+					Assert::AreEqual( num1 [ j ], result [ j ], _MSGW( L"Times Montgomery one at word #" << j << " failed on run #" << i ) );
+					Assert::AreEqual( num1 [ j ], result2 [ j ], _MSGW( L"Montgomery round trip at word #" << j << " failed on run #" << i ) );
+				};
+			};
+
+			string test_message = _MSGA( "Montgomery multiply function testing.\n\nEdge cases:\n\teven modulus,\n\tmodulus of one,\n\tmodulus of zero,\n\tP-256 prime,\n\tall ones modulus.\n"
+				<< test_run_count << " times each, with pseudo random moduli and operands: product, times one, and round trip into and out of Montgomery form.\n" );
+			Logger::WriteMessage( test_message.c_str( ) );
+			Logger::WriteMessage( L"Passed. Tested expected values, return value, and volatile register integrity: each via assert.\n\n" );
+		};
+
+		TEST_METHOD( ui512mod_01_mont_mul_performance )
+		{
+			// Performance timing tests.
+			// Note: these tests are not pass/fail, they are informational only
+
+			Logger::WriteMessage( L"Montgomery multiply function performance timing test.\n\n" );
+
+			Logger::WriteMessage( L"First run.\n" );
+			perf_stats No1 = Perf_Test_Parms [ 0 ];
+			ui512_Unit_Tests::RunStats( &No1, MontMul );
+
+			Logger::WriteMessage( L"Second run.\n" );
+			perf_stats No2 = Perf_Test_Parms [ 1 ];
+			RunStats( &No2, MontMul );
+
+			Logger::WriteMessage( L"Third run.\n" );
+			perf_stats No3 = Perf_Test_Parms [ 2 ];
+			RunStats( &No3, MontMul );
+		};
+
+		TEST_METHOD( ui512mod_02_invmod )
+		{
+			// invmod_u tests
+			u64 seed = 0;
+			regs r_before {};
+			regs r_after {};
+			_UI512( mod ) { 0 };
+			_UI512( num1 ) { 0 };
+			_UI512( inverse ) { 0 };
+			_UI512( check ) { 0 };
+			_UI512( one ) { 0 };
+			set_uT64( one, 1ull );
+
+			// 1. error cases: even modulus, modulus of one, zero value, value sharing a factor with the modulus
+			set_uT64( num1, 5ull );
+			set_uT64( mod, 1000ull );
+			Assert::AreEqual( s16( -1 ), invmod_u( inverse, num1, mod ), L"Return code failed even modulus test." );
+			set_uT64( mod, 1ull );
+			Assert::AreEqual( s16( -1 ), invmod_u( inverse, num1, mod ), L"Return code failed modulus of one test." );
+			copy_u( mod, prime_secp256k1 );
+			zero_u( num1 );
+			Assert::AreEqual( s16( -1 ), invmod_u( inverse, num1, mod ), L"Return code failed zero value test." );
+			copy_u( num1, mod );
+			Assert::AreEqual( s16( -1 ), invmod_u( inverse, num1, mod ), L"Return code failed value equal modulus test." );
+			set_uT64( mod, 3ull * 5ull * 7ull * 11ull * 13ull );
+			set_uT64( num1, 7ull * 1000ull );
+			Assert::AreEqual( s16( -1 ), invmod_u( inverse, num1, mod ), L"Return code failed common factor test." );
+
+			// 2. inverse of one is one, inverse of m - 1 is m - 1
+			copy_u( mod, prime_p384 );
+			Assert::AreEqual( s16( 0 ), invmod_u( inverse, one, mod ), L"Return code failed inverse of one test." );
+			for ( int j = 0; j < 8; j++ )
+			{
+				Assert::AreEqual( one [ j ], inverse [ j ], _MSGW( L"Inverse at word #" << j << " failed inverse of one test." ) );
+			};
+			sub_uT64( num1, mod, 1ull );
+			Assert::AreEqual( s16( 0 ), invmod_u( inverse, num1, mod ), L"Return code failed inverse of m - 1 test." );
+			for ( int j = 0; j < 8; j++ )
+			{
+				Assert::AreEqual( num1 [ j ], inverse [ j ], _MSGW( L"Inverse at word #" << j << " failed inverse of m - 1 test." ) );
+			};
+
+			// 3. random values mod the curve primes, and random odd moduli (where an inverse exists, a * a^-1 = 1)
+			const u64* primes [ ] = { prime_secp256k1, prime_p256, prime_p384, prime_25519, prime_448 };
+			int found = 0;
+			for ( int i = 0; i < test_run_count; i++ )
+			{
+				if ( i < 5 * 20 )
+				{
+					copy_u( mod, primes [ i % 5 ] );
+				}
+				else
+				{
+					RandomOddModulus( mod, &seed );
+				};
+				RandomFill( num1, &seed );								// not reduced, invmod_u reduces it
+				reg_verify( ( u64* ) &r_before );
+				s16 ret = invmod_u( inverse, num1, mod );
+				reg_verify( ( u64* ) &r_after );
+				Assert::IsTrue( r_before.AreEqual( &r_after ), L"Register validation failed" );
+				if ( i < 5 * 20 )
+				{
+					Assert::AreEqual( s16( 0 ), ret, _MSGW( L"Return code failed prime modulus test on run #" << i ) );
+				};
+				if ( ret == 0 )
+				{
+					found++;
+					_UI512( q ) { 0 };
+					_UI512( reduced ) { 0 };
+					div_u( q, reduced, num1, mod );
+					MulModRef( check, reduced, inverse, mod );
+					Assert::IsTrue( compare_u( inverse, mod ) < 0, _MSGW( L"Inverse not reduced on run #" << i ) );
+					for ( int j = 0; j < 8; j++ )
+					{
+						Assert::AreEqual( one [ j ], check [ j ], _MSGW( L"a * a^-1 at word #" << j << " failed on run #" << i ) );
+					};
+				}
+				else
+				{
+					Assert::AreEqual( s16( -1 ), ret, _MSGW( L"Return code failed on run #" << i ) );
+				};
+			};
+
+			string test_message = _MSGA( "Modular inverse function testing.\n\nEdge cases:\n\teven modulus,\n\tmodulus of one,\n\tzero,\n\tvalue equal modulus,\n\tcommon factor,\n\tone,\n\tm - 1.\n"
+				<< test_run_count << " pseudo random values, curve primes and random odd moduli; " << found << " had inverses, each checked.\n" );
+			Logger::WriteMessage( test_message.c_str( ) );
+			Logger::WriteMessage( L"Passed. Tested expected values, return value, and volatile register integrity: each via assert.\n\n" );
+		};
+
+		TEST_METHOD( ui512mod_02_invmod_performance )
+		{
+			Logger::WriteMessage( L"Modular inverse function performance timing test.\n\n" );
+
+			Logger::WriteMessage( L"First run.\n" );
+			perf_stats No1 = Perf_Test_Parms [ 0 ];
+			ui512_Unit_Tests::RunStats( &No1, InvMod );
+
+			Logger::WriteMessage( L"Second run.\n" );
+			perf_stats No2 = Perf_Test_Parms [ 1 ];
+			RunStats( &No2, InvMod );
+
+			Logger::WriteMessage( L"Third run.\n" );
+			perf_stats No3 = Perf_Test_Parms [ 2 ];
+			RunStats( &No3, InvMod );
+		};
+
+		TEST_METHOD( ui512mod_03_invmod_batch )
+		{
+			// invmod_u_batch tests
+			u64 seed = 0;
+			regs r_before {};
+			regs r_after {};
+			const int maxcount = 256;
+			alignas ( 64 ) static u64 in [ maxcount * 8 ];
+			alignas ( 64 ) static u64 out [ maxcount * 8 ];
+			_UI512( mod ) { 0 };
+			_UI512( check ) { 0 };
+			_UI512( one ) { 0 };
+			set_uT64( one, 1ull );
+
+			// 1. error cases: even modulus, value with no inverse; count of zero
+			copy_u( mod, prime_p256 );
+			for ( int k = 0; k < 4; k++ )
+			{
+				RandomFillMod( &in [ k * 8 ], mod, &seed );
+			};
+			Assert::AreEqual( s16( 0 ), invmod_u_batch( out, in, 0ull, mod ), L"Return code failed count of zero test." );
+			set_uT64( mod, 1ull << 20 );
+			Assert::AreEqual( s16( -1 ), invmod_u_batch( out, in, 4ull, mod ), L"Return code failed even modulus test." );
+			set_uT64( mod, 3ull * 5ull * 7ull * 11ull * 13ull );
+			for ( int k = 0; k < 4; k++ )
+			{
+				set_uT64( &in [ k * 8 ], 2ull * k + 1 );
+			};
+			set_uT64( &in [ 2 * 8 ], 11ull * 4ull );
+			Assert::AreEqual( s16( -1 ), invmod_u_batch( out, in, 4ull, mod ), L"Return code failed common factor test." );
+
+			// 2. random counts, including one, with some zero values (zero in, zero out), over curve primes and random odd primes
+			const u64* primes [ ] = { prime_secp256k1, prime_p256, prime_p384, prime_25519, prime_448 };
+			const int runs = test_run_count / 10;
+			for ( int i = 0; i < runs; i++ )
+			{
+				copy_u( mod, primes [ i % 5 ] );
+				int count = ( i == 0 ) ? 1 : int( RandomU64( &seed ) % maxcount ) + 1;
+				for ( int k = 0; k < count; k++ )
+				{
+					RandomFillMod( &in [ k * 8 ], mod, &seed );
+					if ( RandomU64( &seed ) % 16 == 0 )
+					{
+						zero_u( &in [ k * 8 ] );
+					};
+				};
+				reg_verify( ( u64* ) &r_before );
+				s16 ret = invmod_u_batch( out, in, u64( count ), mod );
+				reg_verify( ( u64* ) &r_after );
+				Assert::IsTrue( r_before.AreEqual( &r_after ), L"Register validation failed" );
+				Assert::AreEqual( s16( 0 ), ret, _MSGW( L"Return code failed on run #" << i ) );
+				for ( int k = 0; k < count; k++ )
+				{
+					if ( compare_uT64( &in [ k * 8 ], 0ull ) == 0 )
+					{
+						Assert::AreEqual( s16( 0 ), compare_uT64( &out [ k * 8 ], 0ull ), _MSGW( L"Zero value #" << k << " not given zero on run #" << i ) );
+						continue;
+					};
+					MulModRef( check, &in [ k * 8 ], &out [ k * 8 ], mod );
+					for ( int j = 0; j < 8; j++ )
+					{
+						Assert::AreEqual( one [ j ], check [ j ], _MSGW( L"a * a^-1 at word #" << j << " of value #" << k << " failed on run #" << i ) );
+					};
+				};
+			};
+
+			// 3. all zero
+			for ( int k = 0; k < 8; k++ )
+			{
+				zero_u( &in [ k * 8 ] );
+				set_uT64( &out [ k * 8 ], 99ull );
+			};
+			Assert::AreEqual( s16( 0 ), invmod_u_batch( out, in, 8ull, mod ), L"Return code failed all zero test." );
+			for ( int k = 0; k < 8; k++ )
+			{
+				Assert::AreEqual( s16( 0 ), compare_uT64( &out [ k * 8 ], 0ull ), _MSGW( L"All zero test failed at value #" << k ) );
+			};
+
+			// Informational: one batch call compared with one inversion per value
+			copy_u( mod, prime_p256 );
+			for ( int k = 0; k < maxcount; k++ )
+			{
+				RandomFillMod( &in [ k * 8 ], mod, &seed );
+			};
+			u64 start = __rdtsc( );
+			invmod_u_batch( out, in, u64( maxcount ), mod );
+			u64 batch = __rdtsc( ) - start;
+			start = __rdtsc( );
+			for ( int k = 0; k < maxcount; k++ )
+			{
+				invmod_u( &out [ k * 8 ], &in [ k * 8 ], mod );
+			};
+			u64 single = __rdtsc( ) - start;
+
+			string test_message = _MSGA( "Batch modular inverse function testing.\n\nEdge cases:\n\tcount of zero,\n\teven modulus,\n\tcommon factor,\n\tcount of one,\n\tall zero values.\n"
+				<< runs << " pseudo random batches of up to " << maxcount << " values (some zero), over the curve primes, each inverse checked.\n"
+				<< "P-256, " << maxcount << " values: batch " << batch << " cycles, one at a time " << single << " cycles.\n" );
+			Logger::WriteMessage( test_message.c_str( ) );
+			Logger::WriteMessage( L"Passed. Tested expected values, return value, and volatile register integrity: each via assert.\n\n" );
+		};
+
+		TEST_METHOD( ui512mod_04_powmod )
+		{
+			// powmod_u and mont_pow_u tests
+			// Note: mult_u, div_u, shift, add, subtract, compare must pass testing before these tests (used in reference modular exponentiation)
+			u64 seed = 0;
+			regs r_before {};
+			regs r_after {};
+			_UI512( mod ) { 0 };
+			_UI512( base ) { 0 };
+			_UI512( exponent ) { 0 };
+			_UI512( result ) { 0 };
+			_UI512( expected ) { 0 };
+			_UI512( one ) { 0 };
+			set_uT64( one, 1ull );
+
+			// 1. error cases: even modulus, modulus of one
+			set_uT64( base, 3ull );
+			set_uT64( exponent, 5ull );
+			set_uT64( mod, 1ull << 32 );
+			Assert::AreEqual( s16( -1 ), powmod_u( result, base, exponent, mod ), L"Return code failed even modulus test." );
+			set_uT64( mod, 1ull );
+			Assert::AreEqual( s16( -1 ), powmod_u( result, base, exponent, mod ), L"Return code failed modulus of one test." );
+
+			// 2. exponent zero gives one (even for a zero base), zero base gives zero, exponent one gives base
+			copy_u( mod, prime_p256 );
+			zero_u( exponent );
+			zero_u( base );
+			Assert::AreEqual( s16( 0 ), powmod_u( result, base, exponent, mod ), L"Return code failed zero exponent test." );
+			Assert::AreEqual( s16( 0 ), compare_u( result, one ), L"Result failed zero exponent test." );
+			set_uT64( exponent, 12345ull );
+			powmod_u( result, base, exponent, mod );
+			Assert::AreEqual( s16( 0 ), compare_uT64( result, 0ull ), L"Result failed zero base test." );
+			RandomFillMod( base, mod, &seed );
+			set_uT64( exponent, 1ull );
+			powmod_u( result, base, exponent, mod );
+			Assert::AreEqual( s16( 0 ), compare_u( result, base ), L"Result failed exponent of one test." );
+
+			// 3. Fermat: a^( p - 1 ) = 1 for each curve prime
+			const u64* primes [ ] = { prime_secp256k1, prime_p256, prime_p384, prime_25519, prime_448 };
+			for ( int k = 0; k < 5; k++ )
+			{
+				RandomFill( base, &seed );							// not reduced, powmod_u reduces it
+				sub_uT64( exponent, primes [ k ], 1ull );
+				Assert::AreEqual( s16( 0 ), powmod_u( result, base, exponent, primes [ k ] ), _MSGW( L"Return code failed Fermat test #" << k ) );
+				for ( int j = 0; j < 8; j++ )
+				{
+					Assert::AreEqual( one [ j ], result [ j ], _MSGW( L"Result at word #" << j << " failed Fermat test #" << k ) );
+				};
+			};
+
+			// 4. random odd moduli, bases, exponents, checked against square and multiply reference; in place on the base
+			int adjtest_run_count = test_run_count / 10;
+			for ( int i = 0; i < adjtest_run_count; i++ )
+			{
+				RandomOddModulus( mod, &seed );
+				RandomFill( base, &seed );
+				RandomFill( exponent, &seed );
+				shr_u( exponent, exponent, u16( RandomU64( &seed ) % 512 ) );
+				PowModRef( expected, base, exponent, mod );
+				reg_verify( ( u64* ) &r_before );
+				s16 ret = powmod_u( result, base, exponent, mod );
+				reg_verify( ( u64* ) &r_after );
+				Assert::IsTrue( r_before.AreEqual( &r_after ), L"Register validation failed" );
+				Assert::AreEqual( s16( 0 ), ret, _MSGW( L"Return code failed on run #" << i ) );
+				for ( int j = 0; j < 8; j++ )
+				{
+					Assert::AreEqual( expected [ j ], result [ j ], _MSGW( L"Result at word #" << j << " failed on run #" << i ) );
+				};
+				powmod_u( base, base, exponent, mod );
+				for ( int j = 0; j < 8; j++ )
+				{
+					Assert::AreEqual( expected [ j ], base [ j ], _MSGW( L"Result at word #" << j << " failed in place on run #" << i ) );
+				};
+			};
+
+			string test_message = _MSGA( "Modular exponentiation function testing.\n\nEdge cases:\n\teven modulus,\n\tmodulus of one,\n\tzero exponent,\n\tzero base,\n\texponent of one,\n\tFermat a^(p - 1) for the curve primes.\n"
+				<< adjtest_run_count << " pseudo random odd moduli, bases, and exponents, checked against reference, also in place.\n" );
+			Logger::WriteMessage( test_message.c_str( ) );
+			Logger::WriteMessage( L"Passed. Tested expected values, return value, and volatile register integrity: each via assert.\n\n" );
+		};
+
+		TEST_METHOD( ui512mod_04_powmod_performance )
+		{
+			Logger::WriteMessage( L"Modular exponentiation function performance timing test.\n\n" );
+
+			Logger::WriteMessage( L"First run.\n" );
+			perf_stats No1 = Perf_Test_Parms [ 0 ];
+			ui512_Unit_Tests::RunStats( &No1, PowMod );
+
+			Logger::WriteMessage( L"Second run.\n" );
+			perf_stats No2 = Perf_Test_Parms [ 1 ];
+			RunStats( &No2, PowMod );
+
+			Logger::WriteMessage( L"Third run.\n" );
+			perf_stats No3 = Perf_Test_Parms [ 2 ];
+			RunStats( &No3, PowMod );
+		};
+
+		TEST_METHOD( ui512mod_05_sqrtmod )
+		{
+			// sqrtmod_u tests
+			// Note: powmod_u must pass testing before these tests (used for Euler's criterion)
+			u64 seed = 0;
+			regs r_before {};
+			regs r_after {};
+			_UI512( num1 ) { 0 };
+			_UI512( square ) { 0 };
+			_UI512( root ) { 0 };
+			_UI512( check ) { 0 };
+			_UI512( half ) { 0 };
+			_UI512( euler ) { 0 };
+			_UI512( minus_one ) { 0 };
+			_UI512( mod ) { 0 };
+
+			// 1. error cases: even modulus, modulus of one; zero is its own root
+			set_uT64( num1, 4ull );
+			set_uT64( mod, 1ull << 32 );
+			Assert::AreEqual( s16( -1 ), sqrtmod_u( root, num1, mod ), L"Return code failed even modulus test." );
+			set_uT64( mod, 1ull );
+			Assert::AreEqual( s16( -1 ), sqrtmod_u( root, num1, mod ), L"Return code failed modulus of one test." );
+			zero_u( num1 );
+			set_uT64( root, 99ull );
+			Assert::AreEqual( s16( 0 ), sqrtmod_u( root, num1, prime_p256 ), L"Return code failed zero test." );
+			Assert::AreEqual( s16( 0 ), compare_uT64( root, 0ull ), L"Result failed zero test." );
+
+			// 2. small primes of each form: every value checked against Euler's criterion
+			const u64 small [ ] = { 3ull, 7ull, 13ull, 17ull, 41ull, 97ull, 113ull, 257ull, 65537ull };
+			int roots = 0, nonroots = 0;
+			for ( u64 p : small )
+			{
+				set_uT64( mod, p );
+				u64 limit = ( p < 300 ) ? p : 300;
+				for ( u64 a = 1; a < limit; a++ )
+				{
+					set_uT64( num1, a );
+					s16 ret = sqrtmod_u( root, num1, mod );
+					u64 e = 1;											// a^( ( p - 1 ) / 2 ) mod p
+					for ( u64 k = 0; k < ( p - 1 ) / 2; k++ )
+					{
+						e = ( e * a ) % p;
+					};
+					if ( e == 1 )
+					{
+						Assert::AreEqual( s16( 0 ), ret, _MSGW( L"Return code failed square " << a << " mod " << p ) );
+						Assert::AreEqual( a, ( root [ 7 ] * root [ 7 ] ) % p, _MSGW( L"Root failed square " << a << " mod " << p ) );
+					}
+					else
+					{
+						Assert::AreEqual( s16( -1 ), ret, _MSGW( L"Return code failed non-square " << a << " mod " << p ) );
+					};
+				};
+			};
+
+			// 3. large primes: the curve primes ( 3 mod 4 and 5 mod 8 ), P-224 and the secp256k1 order ( 1 mod 8 )
+			//	squares of random values have a root, equal to the value or its negative; other values checked against Euler's criterion
+			const u64* primes [ ] = { prime_secp256k1, prime_p256, prime_p384, prime_25519, prime_448, prime_p224, order_secp256k1 };
+			int adjtest_run_count = test_run_count / 10;
+			for ( int i = 0; i < adjtest_run_count; i++ )
+			{
+				const u64* p = primes [ i % 7 ];
+				RandomFillMod( num1, p, &seed );
+				MulModRef( square, num1, num1, p );
+				reg_verify( ( u64* ) &r_before );
+				s16 ret = sqrtmod_u( root, square, p );
+				reg_verify( ( u64* ) &r_after );
+				Assert::IsTrue( r_before.AreEqual( &r_after ), L"Register validation failed" );
+				Assert::AreEqual( s16( 0 ), ret, _MSGW( L"Return code failed square on run #" << i ) );
+				if ( compare_u( root, num1 ) != 0 )
+				{
+					sub_u( check, p, root );
+					Assert::AreEqual( s16( 0 ), compare_u( check, num1 ), _MSGW( L"Root failed square on run #" << i ) );
+				};
+
+				RandomFillMod( num1, p, &seed );
+				shr_u( half, p, 1 );
+				PowModRef( euler, num1, half, p );
+				sub_uT64( minus_one, p, 1ull );
+				ret = sqrtmod_u( root, num1, p );
+				if ( compare_u( euler, minus_one ) == 0 )
+				{
+					nonroots++;
+					Assert::AreEqual( s16( -1 ), ret, _MSGW( L"Return code failed non-square on run #" << i ) );
+				}
+				else
+				{
+					roots++;
+					Assert::AreEqual( s16( 0 ), ret, _MSGW( L"Return code failed random square on run #" << i ) );
+					MulModRef( check, root, root, p );
+					Assert::AreEqual( s16( 0 ), compare_u( check, num1 ), _MSGW( L"Root failed random square on run #" << i ) );
+				};
+			};
+
+			string test_message = _MSGA( "Modular square root function testing.\n\nEdge cases:\n\teven modulus,\n\tmodulus of one,\n\tzero,\n\tall values mod small primes of each form.\n"
+				<< adjtest_run_count << " squares of pseudo random values mod the curve primes, P-224, and the secp256k1 order, and as many random values: "
+				<< roots << " squares, " << nonroots << " non-squares.\n" );
+			Logger::WriteMessage( test_message.c_str( ) );
+			Logger::WriteMessage( L"Passed. Tested expected values, return value, and volatile register integrity: each via assert.\n\n" );
+		};
+
+		TEST_METHOD( ui512mod_05_sqrtmod_performance )
+		{
+			Logger::WriteMessage( L"Modular square root function performance timing test.\n\n" );
+
+			Logger::WriteMessage( L"First run.\n" );
+			perf_stats No1 = Perf_Test_Parms [ 0 ];
+			ui512_Unit_Tests::RunStats( &No1, SqrtMod );
+
+			Logger::WriteMessage( L"Second run.\n" );
+			perf_stats No2 = Perf_Test_Parms [ 1 ];
+			RunStats( &No2, SqrtMod );
+
+			Logger::WriteMessage( L"Third run.\n" );
+			perf_stats No3 = Perf_Test_Parms [ 2 ];
+			RunStats( &No3, SqrtMod );
+		};
+
+		TEST_METHOD( ui512mod_06_jacobi )
+		{
+			// jacobi_u tests
+			// Note: div_u, powmod_u must pass testing before these tests (used in reference, Euler's criterion)
+			u64 seed = 0;
+			regs r_before {};
+			regs r_after {};
+			_UI512( num1 ) { 0 };
+			_UI512( mod ) { 0 };
+			_UI512( half ) { 0 };
+			_UI512( euler ) { 0 };
+
+			// 1. error cases: even n, zero n
+			set_uT64( num1, 3ull );
+			set_uT64( mod, 10ull );
+			Assert::AreEqual( s16( -2 ), jacobi_u( num1, mod ), L"Return code failed even n test." );
+			zero_u( mod );
+			Assert::AreEqual( s16( -2 ), jacobi_u( num1, mod ), L"Return code failed zero n test." );
+
+			// 2. n of one: always one; a of zero: zero (n > 1); a = n: zero
+			set_uT64( mod, 1ull );
+			RandomFill( num1, &seed );
+			Assert::AreEqual( s16( 1 ), jacobi_u( num1, mod ), L"Failed n of one test." );
+			copy_u( mod, prime_p256 );
+			zero_u( num1 );
+			Assert::AreEqual( s16( 0 ), jacobi_u( num1, mod ), L"Failed zero test." );
+			Assert::AreEqual( s16( 0 ), jacobi_u( mod, mod ), L"Failed a = n test." );
+
+			// 3. all small a, odd n, against reference
+			for ( u64 n = 1; n < 200; n += 2 )
+			{
+				set_uT64( mod, n );
+				for ( u64 a = 0; a < 2 * n + 5; a++ )
+				{
+					set_uT64( num1, a );
+					Assert::AreEqual( JacobiRef( num1, mod ), jacobi_u( num1, mod ), _MSGW( L"Failed ( " << a << " / " << n << " )" ) );
+				};
+			};
+
+			// 4. curve primes: Legendre symbol equals Euler's criterion
+			const u64* primes [ ] = { prime_secp256k1, prime_p256, prime_p384, prime_25519, prime_448 };
+			for ( int i = 0; i < 50; i++ )
+			{
+				const u64* p = primes [ i % 5 ];
+				RandomFillMod( num1, p, &seed );
+				shr_u( half, p, 1 );
+				powmod_u( euler, num1, half, p );
+				s16 expected = ( compare_uT64( euler, 1ull ) == 0 ) ? 1 : -1;
+				Assert::AreEqual( expected, jacobi_u( num1, p ), _MSGW( L"Failed Euler criterion on run #" << i ) );
+			};
+
+			// 5. random a ( any size, some multiples of n ), random odd n of random sizes, against reference
+			for ( int i = 0; i < test_run_count; i++ )
+			{
+				RandomOddModulus( mod, &seed );
+				RandomFill( num1, &seed );
+				shr_u( num1, num1, u16( RandomU64( &seed ) % 512 ) );
+				if ( i % 8 == 0 )
+				{
+					_UI512( ovfl ) { 0 };
+					mult_uT64( num1, ovfl, mod, 3ull * 5ull * 7ull );
+				};
+				reg_verify( ( u64* ) &r_before );
+				s16 ret = jacobi_u( num1, mod );
+				reg_verify( ( u64* ) &r_after );
+				Assert::IsTrue( r_before.AreEqual( &r_after ), L"Register validation failed" );
+				Assert::AreEqual( JacobiRef( num1, mod ), ret, _MSGW( L"Failed on run #" << i ) );
+			};
+
+			string test_message = _MSGA( "Jacobi symbol function testing.\n\nEdge cases:\n\teven n,\n\tzero n,\n\tn of one,\n\tzero a,\n\ta = n,\n\tall small a and odd n.\n"
+				<< "50 pseudo random values mod the curve primes, against Euler's criterion.\n"
+				<< test_run_count << " pseudo random values and odd moduli, against reference.\n" );
+			Logger::WriteMessage( test_message.c_str( ) );
+			Logger::WriteMessage( L"Passed. Tested expected values, return value, and volatile register integrity: each via assert.\n\n" );
+		};
+
+		TEST_METHOD( ui512mod_06_jacobi_performance )
+		{
+			Logger::WriteMessage( L"Jacobi symbol function performance timing test.\n\n" );
+
+			Logger::WriteMessage( L"First run.\n" );
+			perf_stats No1 = Perf_Test_Parms [ 0 ];
+			ui512_Unit_Tests::RunStats( &No1, Jacobi );
+
+			Logger::WriteMessage( L"Second run.\n" );
+			perf_stats No2 = Perf_Test_Parms [ 1 ];
+			RunStats( &No2, Jacobi );
+
+			Logger::WriteMessage( L"Third run.\n" );
+			perf_stats No3 = Perf_Test_Parms [ 2 ];
+			RunStats( &No3, Jacobi );
+		};
+
+		TEST_METHOD( ui512mod_07_crt )
+		{
+			// crt_init_u and crt_reconstruct_u tests
+			// Note: div_uT64, mult_uT64, add_uT64 must pass testing before these tests (residues, and the expected overflow value)
+			u64 seed = 0;
+			regs r_before {};
+			regs r_after {};
+			alignas ( 64 ) crt_ctx ctx { };
+			alignas ( 64 ) u64 residues [ 16 ] { };
+			_UI512( num1 ) { 0 };
+			_UI512( result ) { 0 };
+			_UI512( expected ) { 0 };
+			u64 ovfl = 0;
+			const u64 primes62 [ ] = { 0x3fffffffffffffc7ull, 0x3fffffffffffffa9ull, 0x3fffffffffffff8bull, 0x3fffffffffffff71ull,
+				0x3fffffffffffff67ull, 0x3fffffffffffff59ull, 0x3fffffffffffff55ull, 0x3fffffffffffff3dull, 0x3fffffffffffff35ull };
+			const u64 wide [ ] = { 1ull << 63, ~0ull, ~0ull - 2, ~0ull - 4 };		// coprime, not prime, full width
+
+			// 1. error cases: count of zero and above 16, a modulus below two, moduli not coprime
+			Assert::AreEqual( s16( -1 ), crt_init_u( &ctx, primes62, 0 ), L"Return code failed count of zero test." );
+			Assert::AreEqual( s16( -1 ), crt_init_u( &ctx, primes62, 17 ), L"Return code failed count of 17 test." );
+			const u64 one [ ] = { 7, 1 };
+			Assert::AreEqual( s16( -1 ), crt_init_u( &ctx, one, 2 ), L"Return code failed modulus of one test." );
+			const u64 shared [ ] = { 35, 11, 13, 21 };
+			Assert::AreEqual( s16( -1 ), crt_init_u( &ctx, shared, 4 ), L"Return code failed moduli not coprime test." );
+			const u64 twice [ ] = { primes62 [ 0 ], primes62 [ 1 ], primes62 [ 0 ] };
+			Assert::AreEqual( s16( -1 ), crt_init_u( &ctx, twice, 3 ), L"Return code failed repeated modulus test." );
+
+			// 2. small moduli, every x below their product; a single modulus reduces
+			const u64 small [ ] = { 3, 4, 5, 7 };
+			Assert::AreEqual( s16( 0 ), crt_init_u( &ctx, small, 4 ), L"Return code failed small moduli init." );
+			for ( u64 x = 0; x < 420; x++ )
+			{
+				for ( int i = 0; i < 4; i++ )
+				{
+					residues [ i ] = x % small [ i ] + small [ i ] * ( x % 3 );		// some not reduced
+				};
+				Assert::AreEqual( s16( 0 ), crt_reconstruct_u( result, residues, &ctx ), _MSGW( L"Return code failed small moduli, x " << x ) );
+				Assert::AreEqual( s16( 0 ), compare_uT64( result, x ), _MSGW( L"Result failed small moduli, x " << x ) );
+			};
+			crt_init_u( &ctx, primes62, 1 );
+			residues [ 0 ] = ~0ull;
+			crt_reconstruct_u( result, residues, &ctx );
+			Assert::AreEqual( s16( 0 ), compare_uT64( result, ~0ull % primes62 [ 0 ] ), L"Result failed single modulus test." );
+
+			// 3. random x of any size below 2^512, nine 62 bit primes; below 2^248, four of them; below 2^255, the full width moduli
+			for ( int i = 0; i < test_run_count; i++ )
+			{
+				int sel = i % 3;
+				const u64* mods = ( sel == 2 ) ? wide : primes62;
+				u64 count = ( sel == 0 ) ? 9 : 4;
+				RandomFill( num1, &seed );
+				shr_u( num1, num1, u16( ( sel == 0 ) ? RandomU64( &seed ) % 512 : ( sel == 1 ) ? 264 : 257 ) );
+				Assert::AreEqual( s16( 0 ), crt_init_u( &ctx, mods, count ), _MSGW( L"Return code failed init on run #" << i ) );
+				for ( u64 j = 0; j < count; j++ )
+				{
+					div_uT64( result, &residues [ j ], num1, mods [ j ] );
+				};
+				reg_verify( ( u64* ) &r_before );
+				s16 ret = crt_reconstruct_u( result, residues, &ctx );
+				reg_verify( ( u64* ) &r_after );
+				Assert::IsTrue( r_before.AreEqual( &r_after ), L"Register validation failed" );
+				Assert::AreEqual( s16( 0 ), ret, _MSGW( L"Return code failed on run #" << i ) );
+				Assert::AreEqual( s16( 0 ), compare_u( result, num1 ), _MSGW( L"Result failed on run #" << i ) );
+			};
+
+			// 4. above 2^512: x = P - 1 for the nine 62 bit primes ( P is 558 bits ), out is x mod 2^512
+			crt_init_u( &ctx, primes62, 9 );
+			set_uT64( expected, 1ull );
+			for ( int j = 0; j < 9; j++ )
+			{
+				residues [ j ] = primes62 [ j ] - 1;
+				mult_uT64( expected, &ovfl, expected, primes62 [ j ] );
+			};
+			sub_uT64( expected, expected, 1ull );
+			Assert::AreEqual( s16( 1 ), crt_reconstruct_u( result, residues, &ctx ), L"Return code failed overflow test." );
+			Assert::AreEqual( s16( 0 ), compare_u( result, expected ), L"Result failed overflow test." );
+
+			string test_message = _MSGA( "CRT reconstruction function testing.\n\nEdge cases:\n\tcount of zero and 17,\n\tmodulus of one,\n\tmoduli not coprime,\n"
+				<< "\tevery value below 420 from unreduced residues,\n\ta single modulus,\n\ta value above 2^512.\n"
+				<< test_run_count << " pseudo random values: nine and four 62 bit primes, four full width coprime moduli.\n" );
+			Logger::WriteMessage( test_message.c_str( ) );
+			Logger::WriteMessage( L"Passed. Tested expected values, return value, and volatile register integrity: each via assert.\n\n" );
+		};
+
+		TEST_METHOD( ui512mod_07_crt_performance )
+		{
+			Logger::WriteMessage( L"CRT reconstruction function performance timing test.\n\n" );
+
+			Logger::WriteMessage( L"First run.\n" );
+			perf_stats No1 = Perf_Test_Parms [ 0 ];
+			ui512_Unit_Tests::RunStats( &No1, Crt );
+
+			Logger::WriteMessage( L"Second run.\n" );
+			perf_stats No2 = Perf_Test_Parms [ 1 ];
+			RunStats( &No2, Crt );
+
+			Logger::WriteMessage( L"Third run.\n" );
+			perf_stats No3 = Perf_Test_Parms [ 2 ];
+			RunStats( &No3, Crt );
+		};
+	};
+};
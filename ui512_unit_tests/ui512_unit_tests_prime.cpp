@@ -0,0 +1,1044 @@
+//		ui512_unit_tests_prime
+//
+//		File:			ui512_unit_tests_prime.cpp
+//		Author:			John G.Lynch
+//		Legal:			Copyright @2025, per MIT License below
+//		Date:			October 19, 2026
+//
+//		ui512 is a small project to provide basic operations for a variable type of unsigned 512 bit integer.
+//		The basic operations : zero, copy, compare, add, subtract.
+//		Other optional modules provide bit ops and multiply / divide.
+//		It is written in assembly language, using the MASM ( ml64 ) assembler provided as an option within Visual Studio.
+//		( currently using VS Community 2022 17.14.10)
+//		It provides external signatures that allow linkage to C and C++ programs,
+//		where a shell / wrapper could encapsulate the methods as part of an object.
+//		It has assembly time options directing the use of Intel processor extensions : AVX4, AVX2, SIMD, or none :
+//		( Z ( 512 ), Y ( 256 ), or X ( 128 ) registers, or regular Q ( 64bit ) ).
+//		If processor extensions are used, the caller must align the variables declared and passed
+//		on the appropriate byte boundary ( e.g. alignas 64 for 512 )
+//		These modules (in total) are very light-weight ( less than 10K bytes ) and relatively fast,
+//		but is not intended for all processor types or all environments.
+//
+//		Intended use cases :
+//			1.) a "sum of primes" for primes up to 2 ^ 48.
+//			2.) elliptical curve cryptography(ECC)
+//
+//		This sub - project: ui512aTests, is a unit test project that invokes each of the routines in the ui512a assembly.
+//		It runs each assembler proc with pseudo-random values.
+//		It validates ( asserts ) expected and returned results.
+//		It also runs each repeatedly for comparative timings.
+//		It provides a means to invoke and debug.
+//		It illustrates calling the routines from C++.
+
+#include "pch.h"
+#include "CppUnitTest.h"
+#include "ui512_externs.h"
+#include "ui512_unit_tests.h"
+
+#include <cstring>
+#include <sstream>
+#include <format>
+#include <chrono>
+#include "intrin.h"
+
+using namespace std;
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+namespace ui512_Unit_Tests
+{
+	TEST_CLASS( ui512_unit_tests_prime )
+	{
+		/// <summary>
+		/// Reference strong probable prime test of odd n > 3 to one base, plain powmod_u
+		/// </summary>
+		static bool StrongRef( const u64* n, u64 b )
+		{
+			_UI512( d ) { 0 };
+			_UI512( nm1 ) { 0 };
+			_UI512( base ) { 0 };
+			_UI512( x ) { 0 };
+			_UI512( two ) { 0 };
+			sub_uT64( nm1, n, 1ull );
+			s16 s = lsb_u( nm1 );
+			shr_u( d, nm1, u16( s ) );
+			set_uT64( base, b );
+			set_uT64( two, 2ull );
+			powmod_u( x, base, d, n );
+			if ( compare_uT64( x, 1ull ) == 0 || compare_u( x, nm1 ) == 0 )
+			{
+				return true;
+			};
+			for ( s16 r = 1; r < s; r++ )
+			{
+				powmod_u( x, x, two, n );
+				if ( compare_u( x, nm1 ) == 0 )
+				{
+					return true;
+				};
+			};
+			return false;
+		};
+
+		/// <summary>
+		/// Reference primality: trial division by the primes to 71, then strong tests to those bases (certain below 2^64)
+		/// </summary>
+		static bool IsPrimeRef( const u64* n )
+		{
+			static const u64 bases [ ] = { 2, 3, 5, 7, 11, 13, 17, 19, 23, 29, 31, 37, 41, 43, 47, 53, 59, 61, 67, 71 };
+			_UI512( q ) { 0 };
+			u64 rem = 0;
+			for ( u64 b : bases )
+			{
+				div_uT64( q, &rem, n, b );
+				if ( rem == 0 )
+				{
+					return compare_uT64( n, b ) == 0;
+				};
+			};
+			if ( compare_uT64( n, 1ull ) <= 0 )
+			{
+				return false;
+			};
+			for ( u64 b : bases )
+			{
+				if ( !StrongRef( n, b ) )
+				{
+					return false;
+				};
+			};
+			return true;
+		};
+
+		/// <summary>
+		/// Check is_probable_prime_u on one value, with register verification
+		/// </summary>
+		static void CheckPrime( const u64* n, u64 rounds, s16 expected, const wchar_t* what, u64 run )
+		{
+			regs r_before {};
+			regs r_after {};
+			reg_verify( ( u64* ) &r_before );
+			s16 ret = is_probable_prime_u( n, rounds );
+			reg_verify( ( u64* ) &r_after );
+			Assert::IsTrue( r_before.AreEqual( &r_after ), L"Register validation failed" );
+			Assert::AreEqual( expected, ret,
+				_MSGW( L"Result failed " << what << L", low word " << n [ 7 ] << L", rounds " << rounds << L", run #" << run ) );
+		};
+
+		TEST_METHOD( ui512pr_01_probable_prime )
+		{
+			// is_probable_prime_u tests
+			// Note: div_uT64, powmod_u, mult_u, shifts and compare must pass testing before these tests (used in the reference)
+			u64 seed = 0;
+			_UI512( n ) { 0 };
+			_UI512( a ) { 0 };
+			_UI512( b ) { 0 };
+			_UI512( over ) { 0 };
+
+			// 1. every n below 70000 (across 257^2, where trial division stops deciding) against a sieve
+			const u64 small = 70000;
+			vector<char> sieve( small, 1 );
+			sieve [ 0 ] = sieve [ 1 ] = 0;
+			for ( u64 p = 2; p * p < small; p++ )
+			{
+				if ( sieve [ p ] )
+				{
+					for ( u64 m = p * p; m < small; m += p )
+					{
+						sieve [ m ] = 0;
+					};
+				};
+			};
+			for ( u64 i = 0; i < small; i++ )
+			{
+				set_uT64( n, i );
+				CheckPrime( n, 0, s16( sieve [ i ] ), L"below 70000", i );
+			};
+
+			// 2. random odd values of 16 to 64 bits, and of 256 bits, against the reference
+			const u64 runs = 4000;
+			for ( u64 i = 0; i < runs; i++ )
+			{
+				zero_u( n );
+				n [ 7 ] = ( RandomU64( &seed ) >> ( i % 49 ) ) | 1ull << ( 63 - i % 49 ) | 1ull;
+				CheckPrime( n, i % 3, s16( IsPrimeRef( n ) ), L"random 64 bit", i );
+			};
+			for ( u64 i = 0; i < runs / 4; i++ )
+			{
+				zero_u( n );
+				for ( int j = 4; j < 8; j++ )
+				{
+					n [ j ] = RandomU64( &seed );
+				};
+				n [ 7 ] |= 1ull;
+				CheckPrime( n, 0, s16( IsPrimeRef( n ) ), L"random 256 bit", i );
+			};
+
+			// 3. the curve primes, and Mersenne primes 2^p - 1, with and without further rounds
+			const u64* primes [ ] = { prime_secp256k1, prime_p256, prime_p384, prime_25519, prime_448 };
+			for ( int k = 0; k < 5; k++ )
+			{
+				CheckPrime( primes [ k ], 0, s16( 1 ), L"curve prime", k );
+				CheckPrime( primes [ k ], 10, s16( 1 ), L"curve prime", k );
+				CheckPrime( primes [ k ], 100, s16( 1 ), L"curve prime", k );
+			};
+			const u16 mersenne [ ] = { 13, 17, 19, 31, 61, 89, 107, 127 };
+			for ( u16 p : mersenne )
+			{
+				set_uT64( a, 1ull );
+				shl_u( a, a, p );
+				sub_uT64( n, a, 1ull );
+				CheckPrime( n, 0, s16( 1 ), L"Mersenne prime", p );
+				CheckPrime( n, 53, s16( 1 ), L"Mersenne prime", p );
+			};
+			const u16 mcomposite [ ] = { 11, 23, 29, 37, 67, 101, 257, 509 };
+			for ( u16 p : mcomposite )
+			{
+				set_uT64( a, 1ull );
+				shl_u( a, a, p );
+				sub_uT64( n, a, 1ull );
+				CheckPrime( n, 0, s16( 0 ), L"Mersenne composite", p );
+			};
+			set_uT64( n, 0ull );
+			not_u( n, n );
+			CheckPrime( n, 0, s16( 0 ), L"2^512 - 1", 0 );
+
+			// 4. composites with no factor below 256 that pass the base 2 strong test ( the Lucas test finds them ), and the reverse
+			const u64 spsp2 [ ] = { 873181, 1373653, 1987021, 2284453, 5489641, 8725753, 25326001, 3825123056546413051ull };
+			for ( u64 v : spsp2 )
+			{
+				set_uT64( n, v );
+				Assert::IsTrue( StrongRef( n, 2 ), L"Reference failed base 2 strong pseudoprime" );
+				CheckPrime( n, 0, s16( 0 ), L"base 2 strong pseudoprime", v );
+			};
+			set_uT64( n, 3825123056546413051ull );								// strong pseudoprime to each base below 37
+			CheckPrime( n, 8, s16( 0 ), L"strong pseudoprime to bases 2 thru 23", 0 );
+			set_uT64( a, 399165290221ull );										// 318665857834031151167461, strong pseudoprime to bases to 37
+			set_uT64( b, 798330580441ull );
+			mult_u( n, over, a, b );
+			CheckPrime( n, 0, s16( 0 ), L"strong pseudoprime to bases 2 thru 37", 0 );
+			const u64 slprp [ ] = { 161027, 176399, 189419, 192509, 231703, 288919, 324899, 353219 };
+			for ( u64 v : slprp )
+			{
+				set_uT64( n, v );
+				CheckPrime( n, 0, s16( 0 ), L"strong Lucas pseudoprime", v );
+			};
+			const u64 carmichael [ ] = { 118901521, 172947529, 216821881, 228842209 };	// ( 6k + 1 )( 12k + 1 )( 18k + 1 )
+			for ( u64 v : carmichael )
+			{
+				set_uT64( n, v );
+				CheckPrime( n, 0, s16( 0 ), L"Carmichael number", v );
+			};
+
+			// 5. squares: no Selfridge D. 1093 and 3511 are Wieferich primes, their squares pass the base 2 strong test
+			const u64 roots [ ] = { 1093, 3511, 65537, 4294967291ull };
+			for ( u64 v : roots )
+			{
+				set_uT64( n, v * v );
+				CheckPrime( n, 0, s16( 0 ), L"square of a prime", v );
+			};
+			set_uT64( a, 1ull );
+			shl_u( a, a, 127 );
+			sub_uT64( a, a, 1ull );
+			mult_u( n, over, a, a );
+			CheckPrime( n, 0, s16( 0 ), L"square of 2^127 - 1", 0 );
+			mult_u( n, over, prime_25519, prime_25519 );
+			CheckPrime( n, 0, s16( 0 ), L"square of 2^255 - 19", 0 );
+
+			// 6. products of two large primes, and of a large prime and a small one
+			mult_u( n, over, a, prime_secp256k1 );
+			CheckPrime( n, 0, s16( 0 ), L"( 2^127 - 1 ) * secp256k1 prime", 0 );
+			mult_u( n, over, a, prime_p384 );
+			CheckPrime( n, 0, s16( 0 ), L"( 2^127 - 1 ) * P-384 prime", 0 );
+			mult_uT64( n, over, prime_448, 251ull );
+			CheckPrime( n, 0, s16( 0 ), L"251 * 2^448 - 2^224 - 1", 0 );
+			mult_uT64( n, over, prime_448, 257ull );
+			CheckPrime( n, 0, s16( 0 ), L"257 * 2^448 - 2^224 - 1", 0 );
+
+			string test_message = _MSGA( "Probable prime function testing. Every n below " << small << ", " << runs
+				<< " random 64 bit and " << runs / 4 << " random 256 bit odd values against a reference,\n"
+				<< "curve and Mersenne primes, strong and Lucas pseudoprimes, Carmichael numbers, squares and products of primes.\n" );
+			Logger::WriteMessage( test_message.c_str( ) );
+			Logger::WriteMessage( L"Passed. Tested expected values, return value, and volatile register integrity: each via assert.\n\n" );
+		};
+
+		TEST_METHOD( ui512pr_01_probable_prime_performance )
+		{
+			// Performance timing tests.
+			// Note: these tests are not pass/fail, they are informational only
+
+			Logger::WriteMessage( L"Probable prime function performance timing test.\n\n" );
+
+			Logger::WriteMessage( L"First run.\n" );
+			perf_stats No1 = Perf_Test_Parms [ 0 ];
+			ui512_Unit_Tests::RunStats( &No1, IsPrime );
+
+			Logger::WriteMessage( L"Second run.\n" );
+			perf_stats No2 = Perf_Test_Parms [ 1 ];
+			RunStats( &No2, IsPrime );
+
+			Logger::WriteMessage( L"Third run.\n" );
+			perf_stats No3 = Perf_Test_Parms [ 2 ];
+			RunStats( &No3, IsPrime );
+		};
+
+		/// <summary>
+		/// Reference greatest common divisor, Euclid with div_u
+		/// </summary>
+		static void GcdRef( u64* g, const u64* a, const u64* b )
+		{
+			_UI512( x ) { 0 };
+			_UI512( y ) { 0 };
+			_UI512( q ) { 0 };
+			_UI512( r ) { 0 };
+			copy_u( x, a );
+			copy_u( y, b );
+			while ( compare_uT64( y, 0ull ) != 0 )
+			{
+				div_u( q, r, x, y );
+				copy_u( x, y );
+				copy_u( y, r );
+			};
+			copy_u( g, x );
+		};
+
+		/// <summary>
+		/// Least probable prime not below n ( n odd, above 2 )
+		/// </summary>
+		static void NextPrime( u64* n )
+		{
+			while ( is_probable_prime_u( n, 0 ) != 1 )
+			{
+				add_uT64( n, n, 2ull );
+			};
+		};
+
+		TEST_METHOD( ui512pr_02_gcd )
+		{
+			// gcd_u tests
+			// Note: div_u, mult_u and compare must pass testing before these tests (used in the reference)
+			u64 seed = 0;
+			regs r_before {};
+			regs r_after {};
+			_UI512( a ) { 0 };
+			_UI512( b ) { 0 };
+			_UI512( g ) { 0 };
+			_UI512( result ) { 0 };
+			_UI512( expected ) { 0 };
+			_UI512( over ) { 0 };
+
+			// 1. zero, one, equal values, powers of two
+			zero_u( a );
+			copy_u( b, prime_p256 );
+			Assert::AreEqual( s16( 0 ), gcd_u( result, a, b ), L"Return code failed zero test." );
+			Assert::AreEqual( s16( 0 ), compare_u( result, b ), L"Result failed gcd( 0, b ) test." );
+			gcd_u( result, b, a );
+			Assert::AreEqual( s16( 0 ), compare_u( result, b ), L"Result failed gcd( a, 0 ) test." );
+			gcd_u( result, a, a );
+			Assert::AreEqual( s16( 0 ), compare_uT64( result, 0ull ), L"Result failed gcd( 0, 0 ) test." );
+			set_uT64( a, 1ull );
+			gcd_u( result, a, b );
+			Assert::AreEqual( s16( 0 ), compare_uT64( result, 1ull ), L"Result failed gcd( 1, b ) test." );
+			gcd_u( result, b, b );
+			Assert::AreEqual( s16( 0 ), compare_u( result, b ), L"Result failed gcd( b, b ) test." );
+			set_uT64( a, 1ull );
+			shl_u( a, a, 300 );
+			set_uT64( b, 3ull );
+			shl_u( b, b, 200 );
+			set_uT64( expected, 1ull );
+			shl_u( expected, expected, 200 );
+			gcd_u( result, a, b );
+			Assert::AreEqual( s16( 0 ), compare_u( result, expected ), L"Result failed powers of two test." );
+
+			// 2. random values of random length, with a random common factor, against the reference
+			const u64 runs = 20000;
+			for ( u64 i = 0; i < runs; i++ )
+			{
+				zero_u( a );
+				zero_u( b );
+				zero_u( g );
+				for ( int j = 7 - int( i % 4 ); j < 8; j++ )
+				{
+					a [ j ] = RandomU64( &seed );
+				};
+				for ( int j = 7 - int( ( i / 4 ) % 4 ); j < 8; j++ )
+				{
+					b [ j ] = RandomU64( &seed );
+				};
+				g [ 7 ] = RandomU64( &seed ) >> ( RandomU64( &seed ) % 64 );
+				g [ 6 ] = ( i % 3 == 0 ) ? RandomU64( &seed ) : 0;
+				if ( compare_uT64( g, 0ull ) != 0 )
+				{
+					mult_u( a, over, a, g );
+					mult_u( b, over, b, g );
+				};
+				GcdRef( expected, a, b );
+				reg_verify( ( u64* ) &r_before );
+				s16 ret = gcd_u( result, a, b );
+				reg_verify( ( u64* ) &r_after );
+				Assert::IsTrue( r_before.AreEqual( &r_after ), L"Register validation failed" );
+				Assert::AreEqual( s16( 0 ), ret, _MSGW( L"Return code failed random test on run #" << i ) );
+				for ( int j = 0; j < 8; j++ )
+				{
+					Assert::AreEqual( expected [ j ], result [ j ], _MSGW( L"Result failed random test, word " << j << L", run #" << i ) );
+				};
+			};
+
+			string test_message = _MSGA( "Greatest common divisor function testing. Edge cases, and " << runs
+				<< " pseudo random pairs with a random common factor, against Euclid's algorithm.\n" );
+			Logger::WriteMessage( test_message.c_str( ) );
+			Logger::WriteMessage( L"Passed. Tested expected values, return value, and volatile register integrity: each via assert.\n\n" );
+		};
+
+		TEST_METHOD( ui512pr_02_gcd_performance )
+		{
+			// Performance timing tests.
+			// Note: these tests are not pass/fail, they are informational only
+
+			Logger::WriteMessage( L"Greatest common divisor function performance timing test.\n\n" );
+
+			Logger::WriteMessage( L"First run.\n" );
+			perf_stats No1 = Perf_Test_Parms [ 0 ];
+			ui512_Unit_Tests::RunStats( &No1, Gcd );
+
+			Logger::WriteMessage( L"Second run.\n" );
+			perf_stats No2 = Perf_Test_Parms [ 1 ];
+			RunStats( &No2, Gcd );
+
+			Logger::WriteMessage( L"Third run.\n" );
+			perf_stats No3 = Perf_Test_Parms [ 2 ];
+			RunStats( &No3, Gcd );
+		};
+
+		TEST_METHOD( ui512pr_03_factor_rho )
+		{
+			// factor_rho_u tests
+			// Note: is_probable_prime_u, gcd_u, div_u and mult_u must pass testing before these tests
+			u64 seed = 0;
+			regs r_before {};
+			regs r_after {};
+			_UI512( n ) { 0 };
+			_UI512( p ) { 0 };
+			_UI512( q ) { 0 };
+			_UI512( factor ) { 0 };
+			_UI512( quot ) { 0 };
+			_UI512( rem ) { 0 };
+			_UI512( over ) { 0 };
+
+			// 1. nothing to split: below 4, primes; even n gives 2
+			for ( u64 v : { 0ull, 1ull, 2ull, 3ull, 5ull, 65537ull } )
+			{
+				set_uT64( n, v );
+				Assert::AreEqual( s16( -1 ), factor_rho_u( n, factor ), _MSGW( L"Return code failed, n = " << v ) );
+			};
+			Assert::AreEqual( s16( -1 ), factor_rho_u( prime_p384, factor ), L"Return code failed P-384 prime" );
+			mult_uT64( n, over, prime_p256, 6ull );
+			Assert::AreEqual( s16( 0 ), factor_rho_u( n, factor ), L"Return code failed even n" );
+			Assert::AreEqual( s16( 0 ), compare_uT64( factor, 2ull ), L"Factor failed even n" );
+
+			// 2. small composites, squares, a Carmichael number: any proper factor
+			const u64 small [ ] = { 9, 15, 25, 49, 561, 1373653, 4294967291ull * 4294967291ull, 1000003ull * 4294967311ull };
+			for ( u64 v : small )
+			{
+				set_uT64( n, v );
+				reg_verify( ( u64* ) &r_before );
+				s16 ret = factor_rho_u( n, factor );
+				reg_verify( ( u64* ) &r_after );
+				Assert::IsTrue( r_before.AreEqual( &r_after ), L"Register validation failed" );
+				Assert::AreEqual( s16( 0 ), ret, _MSGW( L"Return code failed, n = " << v ) );
+				Assert::IsTrue( factor [ 7 ] > 1 && factor [ 7 ] < v && v % factor [ 7 ] == 0, _MSGW( L"Factor failed, n = " << v ) );
+				Assert::AreEqual( s16( 0 ), compare_uT64( factor, factor [ 7 ] ), _MSGW( L"Factor failed, upper words, n = " << v ) );
+			};
+
+			// 2a. squares of small primes: a block product reaches zero mod n ( gcd of zero and n ), the backtrack finds p
+			for ( u64 v : { 5ull, 7ull, 11ull, 13ull } )
+			{
+				set_uT64( n, v * v );
+				Assert::AreEqual( s16( 0 ), factor_rho_u( n, factor ), _MSGW( L"Return code failed, n = " << v << L"^2" ) );
+				Assert::AreEqual( s16( 0 ), compare_uT64( factor, v ), _MSGW( L"Factor failed, n = " << v << L"^2" ) );
+			};
+
+			// 3. 100 to 200 bit products of a 16 to 36 bit prime and a 64 to 160 bit prime
+			const int runs = 40;
+			for ( int i = 0; i < runs; i++ )
+			{
+				zero_u( p );
+				zero_u( q );
+				p [ 7 ] = ( RandomU64( &seed ) >> ( 28 + i % 21 ) ) | ( 1ull << ( 35 - i % 21 ) ) | 1ull;
+				NextPrime( p );
+				for ( int j = 5 - ( i % 2 ); j < 8; j++ )
+				{
+					q [ j ] = RandomU64( &seed );
+				};
+				q [ 7 ] |= 1ull;
+				NextPrime( q );
+				mult_u( n, over, p, q );
+				reg_verify( ( u64* ) &r_before );
+				s16 ret = factor_rho_u( n, factor );
+				reg_verify( ( u64* ) &r_after );
+				Assert::IsTrue( r_before.AreEqual( &r_after ), L"Register validation failed" );
+				Assert::AreEqual( s16( 0 ), ret, _MSGW( L"Return code failed semiprime test on run #" << i ) );
+				Assert::IsTrue( compare_u( factor, p ) == 0 || compare_u( factor, q ) == 0,
+					_MSGW( L"Factor failed semiprime test on run #" << i ) );
+			};
+
+			// 4. three factors: a proper factor divides n
+			set_uT64( p, 1000003ull );
+			set_uT64( q, 998244353ull );
+			mult_u( n, over, p, q );
+			mult_u( n, over, n, prime_secp256k1 );
+			Assert::AreEqual( s16( 0 ), factor_rho_u( n, factor ), L"Return code failed three factor test" );
+			div_u( quot, rem, n, factor );
+			Assert::AreEqual( s16( 0 ), compare_uT64( rem, 0ull ), L"Factor failed three factor test, not a divisor" );
+			Assert::IsTrue( compare_uT64( factor, 1ull ) > 0 && compare_u( factor, n ) < 0, L"Factor failed three factor test, not proper" );
+
+			string test_message = _MSGA( "Pollard rho factoring function testing. Edge cases, small composites, squares of small primes, " << runs
+				<< " pseudo random 100 to 200 bit semiprimes with a factor of 16 to 36 bits, and a product of three primes.\n" );
+			Logger::WriteMessage( test_message.c_str( ) );
+			Logger::WriteMessage( L"Passed. Tested expected values, return value, and volatile register integrity: each via assert.\n\n" );
+		};
+
+		TEST_METHOD( ui512pr_03_factor_rho_performance )
+		{
+			// Performance timing tests.
+			// Note: these tests are not pass/fail, they are informational only
+
+			Logger::WriteMessage( L"Pollard rho factoring function performance timing test.\n\n" );
+
+			Logger::WriteMessage( L"First run.\n" );
+			perf_stats No1 = Perf_Test_Parms [ 0 ];
+			ui512_Unit_Tests::RunStats( &No1, FactorRho );
+
+			Logger::WriteMessage( L"Second run.\n" );
+			perf_stats No2 = Perf_Test_Parms [ 1 ];
+			RunStats( &No2, FactorRho );
+
+			Logger::WriteMessage( L"Third run.\n" );
+			perf_stats No3 = Perf_Test_Parms [ 2 ];
+			RunStats( &No3, FactorRho );
+		};
+
+		/// <summary>
+		/// Compare x^k to a: -1, 0 or 1 ( 1 when x^k overflows 512 bits )
+		/// </summary>
+		static s16 PowCompare( const u64* x, u64 k, const u64* a )
+		{
+			_UI512( p ) { 0 };
+			_UI512( over ) { 0 };
+			set_uT64( p, 1ull );
+			for ( u64 i = 0; i < k; i++ )
+			{
+				mult_u( p, over, p, x );
+				if ( compare_uT64( over, 0ull ) != 0 )
+				{
+					return 1;
+				};
+			};
+			return compare_u( p, a );
+		};
+
+		/// <summary>
+		/// Check iroot_u ( isqrt_u for k of two ) on one value: root^k <= a < ( root + 1 )^k, with register verification
+		/// </summary>
+		static void CheckRoot( const u64* a, u64 k, const wchar_t* what, u64 run )
+		{
+			regs r_before {};
+			regs r_after {};
+			_UI512( root ) { 0 };
+			_UI512( next ) { 0 };
+			reg_verify( ( u64* ) &r_before );
+			s16 ret = ( k == 2 ) ? isqrt_u( root, a ) : iroot_u( root, a, k );
+			reg_verify( ( u64* ) &r_after );
+			Assert::IsTrue( r_before.AreEqual( &r_after ), L"Register validation failed" );
+			Assert::AreEqual( s16( 0 ), ret, _MSGW( L"Return code failed " << what << L", k " << k << L", run #" << run ) );
+			Assert::IsTrue( PowCompare( root, k, a ) <= 0, _MSGW( L"Root too large " << what << L", k " << k << L", run #" << run ) );
+			add_uT64( next, root, 1ull );
+			Assert::IsTrue( PowCompare( next, k, a ) > 0, _MSGW( L"Root too small " << what << L", k " << k << L", run #" << run ) );
+		};
+
+		TEST_METHOD( ui512pr_04_isqrt )
+		{
+			// isqrt_u tests
+			// Note: mult_u, div_u, shifts and compare must pass testing before these tests
+			u64 seed = 0;
+			_UI512( a ) { 0 };
+			_UI512( x ) { 0 };
+			_UI512( root ) { 0 };
+			_UI512( over ) { 0 };
+
+			// 1. every a below 2^16, and squares and their neighbours to 2^64
+			for ( u64 i = 0; i < ( 1ull << 16 ); i++ )
+			{
+				set_uT64( a, i );
+				CheckRoot( a, 2, L"below 2^16", i );
+			};
+			for ( u64 i = 0; i < 2000; i++ )
+			{
+				u64 v = RandomU64( &seed ) >> ( 32 + i % 32 );
+				set_uT64( a, v * v );
+				CheckRoot( a, 2, L"square", i );
+				set_uT64( a, v * v - 1 );
+				CheckRoot( a, 2, L"square less one", i );
+				set_uT64( a, v * v + 2 * v );
+				CheckRoot( a, 2, L"square plus 2 root", i );
+			};
+
+			// 2. edges: 2^63 and its neighbours (register path bound), 2^512 - 1, ( 2^256 - 1 )^2
+			set_uT64( a, 1ull << 63 );
+			CheckRoot( a, 2, L"2^63", 0 );
+			set_uT64( a, ( 1ull << 63 ) - 1 );
+			CheckRoot( a, 2, L"2^63 - 1", 0 );
+			set_uT64( a, ~0ull );
+			CheckRoot( a, 2, L"2^64 - 1", 0 );
+			set_uT64( a, 0ull );
+			not_u( a, a );
+			CheckRoot( a, 2, L"2^512 - 1", 0 );
+			isqrt_u( root, a );
+			set_uT64( x, 0ull );
+			not_u( x, x );
+			shr_u( x, x, 256 );
+			Assert::AreEqual( s16( 0 ), compare_u( root, x ), L"Root failed 2^512 - 1" );
+			mult_u( a, over, x, x );
+			CheckRoot( a, 2, L"( 2^256 - 1 )^2", 0 );
+
+			// 3. random values of every length, random squares of up to 256 bits and their neighbours
+			const u64 runs = 20000;
+			for ( u64 i = 0; i < runs; i++ )
+			{
+				zero_u( a );
+				for ( int j = 0; j < 8; j++ )
+				{
+					a [ j ] = RandomU64( &seed );
+				};
+				shr_u( a, a, u16( i % 512 ) );
+				CheckRoot( a, 2, L"random", i );
+				zero_u( x );
+				for ( int j = 4; j < 8; j++ )
+				{
+					x [ j ] = RandomU64( &seed );
+				};
+				shr_u( x, x, u16( i % 256 ) );
+				mult_u( a, over, x, x );
+				CheckRoot( a, 2, L"random square", i );
+				sub_uT64( a, a, 1ull );
+				CheckRoot( a, 2, L"random square less one", i );
+			};
+
+			string test_message = _MSGA( "Integer square root function testing. Every value below 2^16, squares and their neighbours, edge cases, and "
+				<< runs << " pseudo random values and squares of every length.\n" );
+			Logger::WriteMessage( test_message.c_str( ) );
+			Logger::WriteMessage( L"Passed. Tested expected values, return value, and volatile register integrity: each via assert.\n\n" );
+		};
+
+		TEST_METHOD( ui512pr_04_isqrt_performance )
+		{
+			// Performance timing tests.
+			// Note: these tests are not pass/fail, they are informational only
+
+			Logger::WriteMessage( L"Integer square root function performance timing test.\n\n" );
+
+			Logger::WriteMessage( L"First run.\n" );
+			perf_stats No1 = Perf_Test_Parms [ 0 ];
+			ui512_Unit_Tests::RunStats( &No1, Isqrt );
+
+			Logger::WriteMessage( L"Second run.\n" );
+			perf_stats No2 = Perf_Test_Parms [ 1 ];
+			RunStats( &No2, Isqrt );
+
+			Logger::WriteMessage( L"Third run.\n" );
+			perf_stats No3 = Perf_Test_Parms [ 2 ];
+			RunStats( &No3, Isqrt );
+		};
+
+		TEST_METHOD( ui512pr_05_iroot )
+		{
+			// iroot_u tests
+			// Note: isqrt_u, mult_u, div_u, shifts and compare must pass testing before these tests
+			u64 seed = 0;
+			_UI512( a ) { 0 };
+			_UI512( x ) { 0 };
+			_UI512( root ) { 0 };
+			_UI512( over ) { 0 };
+
+			// 1. k of zero, one, two
+			set_uT64( a, 12345ull );
+			Assert::AreEqual( s16( -1 ), iroot_u( root, a, 0 ), L"Return code failed k of zero" );
+			Assert::AreEqual( s16( 0 ), iroot_u( root, prime_p384, 1 ), L"Return code failed k of one" );
+			Assert::AreEqual( s16( 0 ), compare_u( root, prime_p384 ), L"Root failed k of one" );
+			CheckRoot( a, 2, L"k of two", 0 );
+			iroot_u( root, a, 2 );
+			Assert::AreEqual( s16( 0 ), compare_uT64( root, 111ull ), L"Root failed k of two" );
+
+			// 2. every a below 2^12, k of 3 thru 13; zero; k above the msb
+			for ( u64 k = 3; k < 14; k++ )
+			{
+				for ( u64 i = 0; i < ( 1ull << 12 ); i++ )
+				{
+					set_uT64( a, i );
+					CheckRoot( a, k, L"below 2^12", i );
+				};
+			};
+			set_uT64( a, 0ull );
+			not_u( a, a );
+			for ( u64 k : { 3ull, 5ull, 64ull, 100ull, 255ull, 256ull, 511ull, 512ull, 1000ull } )
+			{
+				CheckRoot( a, k, L"2^512 - 1", 0 );
+			};
+
+			// 3. perfect powers, their neighbours, and random values of every length, k of 3 thru 40
+			const u64 runs = 4000;
+			for ( u64 i = 0; i < runs; i++ )
+			{
+				u64 k = 3 + i % 38;
+				zero_u( x );
+				x [ 7 ] = RandomU64( &seed ) >> ( RandomU64( &seed ) % 64 );
+				if ( k < 8 )
+				{
+					x [ 6 ] = RandomU64( &seed ) >> ( 64 - 64 / k );
+				};
+				if ( compare_uT64( x, 1ull ) <= 0 )
+				{
+					set_uT64( x, 2ull );
+				};
+				set_uT64( a, 1ull );
+				bool fits = true;
+				for ( u64 j = 0; j < k && fits; j++ )
+				{
+					mult_u( a, over, a, x );
+					fits = compare_uT64( over, 0ull ) == 0;
+				};
+				if ( fits )
+				{
+					CheckRoot( a, k, L"perfect power", i );
+					iroot_u( root, a, k );
+					Assert::AreEqual( s16( 0 ), compare_u( root, x ), _MSGW( L"Root failed perfect power, run #" << i ) );
+					sub_uT64( a, a, 1ull );
+					CheckRoot( a, k, L"perfect power less one", i );
+				};
+				for ( int j = 0; j < 8; j++ )
+				{
+					a [ j ] = RandomU64( &seed );
+				};
+				shr_u( a, a, u16( i % 512 ) );
+				CheckRoot( a, k, L"random", i );
+			};
+
+			string test_message = _MSGA( "Integer k-th root function testing. Every value below 2^12 for k of 3 thru 13, edge cases, and "
+				<< runs << " pseudo random perfect powers, neighbours, and values of every length for k of 3 thru 40.\n" );
+			Logger::WriteMessage( test_message.c_str( ) );
+			Logger::WriteMessage( L"Passed. Tested expected values, return value, and volatile register integrity: each via assert.\n\n" );
+		};
+
+		TEST_METHOD( ui512pr_05_iroot_performance )
+		{
+			// Performance timing tests.
+			// Note: these tests are not pass/fail, they are informational only
+
+			Logger::WriteMessage( L"Integer k-th root function performance timing test.\n\n" );
+
+			Logger::WriteMessage( L"First run.\n" );
+			perf_stats No1 = Perf_Test_Parms [ 0 ];
+			ui512_Unit_Tests::RunStats( &No1, Iroot );
+
+			Logger::WriteMessage( L"Second run.\n" );
+			perf_stats No2 = Perf_Test_Parms [ 1 ];
+			RunStats( &No2, Iroot );
+
+			Logger::WriteMessage( L"Third run.\n" );
+			perf_stats No3 = Perf_Test_Parms [ 2 ];
+			RunStats( &No3, Iroot );
+		};
+
+		/// <summary>
+		/// Check gen_prime_u for one length: return, exact bit length, primality (reference), and register verification
+		/// </summary>
+		static void CheckGenPrime( u64 bits, u64* state, const wchar_t* what, u64 run )
+		{
+			_UI512( p ) { 0 };
+			regs r_before {};
+			regs r_after {};
+			reg_verify( ( u64* ) &r_before );
+			s16 ret = gen_prime_u( p, bits, SplitMixFill, state );
+			reg_verify( ( u64* ) &r_after );
+			Assert::IsTrue( r_before.AreEqual( &r_after ), L"Register validation failed" );
+			Assert::AreEqual( s16( 0 ), ret, _MSGW( L"Return code failed " << what << L", bits " << bits << L", run #" << run ) );
+			Assert::AreEqual( s16( bits - 1 ), msb_u( p ), _MSGW( L"Bit length failed " << what << L", bits " << bits << L", run #" << run ) );
+			Assert::IsTrue( IsPrimeRef( p ), _MSGW( L"Primality failed " << what << L", bits " << bits << L", run #" << run ) );
+		};
+
+		/// <summary>
+		/// Random source that fails, keeping the count it was asked for
+		/// </summary>
+		static s16 FailingFill( u64* dest, u64 count, void* asked )
+		{
+			*( u64* ) asked = count;
+			return 7;
+		};
+
+		TEST_METHOD( ui512pr_06_gen_prime )
+		{
+			// gen_prime_u tests
+			// Note: is_probable_prime_u, add_uT64, msb_u and the reference primality check must pass testing before these tests
+			_UI512( p ) { 0 };
+			_UI512( q ) { 0 };
+			u64 state = 0;
+
+			// 1. bits out of range, state untouched
+			state = 12345;
+			Assert::AreEqual( s16( -1 ), gen_prime_u( p, 0, SplitMixFill, &state ), L"Return code failed bits of zero" );
+			Assert::AreEqual( s16( -1 ), gen_prime_u( p, 1, SplitMixFill, &state ), L"Return code failed bits of one" );
+			Assert::AreEqual( s16( -1 ), gen_prime_u( p, 513, SplitMixFill, &state ), L"Return code failed bits of 513" );
+			Assert::AreEqual( 12345ull, state, L"State changed on bits out of range" );
+
+			// 1a. the random source asked for ( bits + 63 ) / 64 QWORDS; its failure returned, out untouched
+			for ( u64 bits : { 2ull, 64ull, 65ull, 200ull, 512ull } )
+			{
+				u64 asked = 0;
+				Assert::AreEqual( s16( 7 ), gen_prime_u( p, bits, FailingFill, &asked ), _MSGW( L"Return code failed random failure, bits " << bits ) );
+				Assert::AreEqual( ( bits + 63 ) / 64, asked, _MSGW( L"QWORDS asked failed, bits " << bits ) );
+				Assert::AreEqual( s16( 0 ), compare_uT64( p, 0 ), _MSGW( L"Out changed on random failure, bits " << bits ) );
+			};
+
+			// 2. every length, 2 thru 512, several seeds each
+			for ( u64 bits = 2; bits <= 512; bits++ )
+			{
+				state = bits;
+				for ( u64 i = 0; i < 3; i++ )
+				{
+					CheckGenPrime( bits, &state, L"every length", i );
+				};
+			};
+
+			// 3. the edges of the sieve and of the QWORDS, many times each
+			for ( u64 bits : { 2ull, 3ull, 15ull, 16ull, 17ull, 63ull, 64ull, 65ull, 127ull, 128ull, 129ull, 511ull, 512ull } )
+			{
+				state = ~bits;
+				for ( u64 i = 0; i < 40; i++ )
+				{
+					CheckGenPrime( bits, &state, L"edge lengths", i );
+				};
+			};
+
+			// 4. the same seed, the same prime; the state moves on
+			state = 0x0123456789abcdefull;
+			gen_prime_u( p, 256, SplitMixFill, &state );
+			u64 after = state;
+			state = 0x0123456789abcdefull;
+			gen_prime_u( q, 256, SplitMixFill, &state );
+			Assert::AreEqual( s16( 0 ), compare_u( p, q ), L"Same seed, different prime" );
+			Assert::AreEqual( after, state, L"Same seed, different state after" );
+			Assert::AreNotEqual( 0x0123456789abcdefull, state, L"State not advanced" );
+			gen_prime_u( q, 256, SplitMixFill, &state );
+			Assert::AreNotEqual( s16( 0 ), compare_u( p, q ), L"Next prime the same" );
+
+			string test_message = _MSGA( "Random prime function testing. Out of range lengths, every length 2 thru 512 from three seeds, "
+				<< "edge lengths forty times each, a failing random source, and determinism from the seed.\n" );
+			Logger::WriteMessage( test_message.c_str( ) );
+			Logger::WriteMessage( L"Passed. Tested bit length, primality, return value, and volatile register integrity: each via assert.\n\n" );
+		};
+
+		TEST_METHOD( ui512pr_06_gen_prime_performance )
+		{
+			// Performance timing tests.
+			// Note: these tests are not pass/fail, they are informational only
+
+			Logger::WriteMessage( L"Random prime function performance timing test.\n\n" );
+
+			Logger::WriteMessage( L"First run.\n" );
+			perf_stats No1 = Perf_Test_Parms [ 0 ];
+			ui512_Unit_Tests::RunStats( &No1, GenPrime );
+
+			Logger::WriteMessage( L"Second run.\n" );
+			perf_stats No2 = Perf_Test_Parms [ 1 ];
+			RunStats( &No2, GenPrime );
+
+			Logger::WriteMessage( L"Third run.\n" );
+			perf_stats No3 = Perf_Test_Parms [ 2 ];
+			RunStats( &No3, GenPrime );
+		};
+
+		/// <summary>
+		/// Reference batch gcd, odd values: gcd( x_i, product of the others mod x_i ), the product in Montgomery form
+		/// (a unit times the product, which leaves the gcd alone)
+		/// </summary>
+		static void BatchGcdRef( u64* expected, const u64* values, u64 n, u64 i )
+		{
+			alignas ( 64 ) u64 ctx [ 32 ] { };
+			_UI512( acc ) { 0 };
+			_UI512( q ) { 0 };
+			_UI512( r ) { 0 };
+			const u64* x = values + i * 8;
+			if ( compare_uT64( x, 1ull ) == 0 )
+			{
+				set_uT64( expected, 1ull );
+				return;
+			};
+			mont_init_u( ctx, x );
+			copy_u( acc, ctx + 16 );
+			for ( u64 j = 0; j < n; j++ )
+			{
+				if ( j != i )
+				{
+					div_u( q, r, values + j * 8, x );
+					mont_mul_u( acc, acc, r, ctx );
+				};
+			};
+			gcd_u( expected, x, acc );
+		};
+
+		/// <summary>
+		/// Check batch_gcd_u on one set of values against the reference, with register verification and a guard past the work area
+		/// </summary>
+		static void CheckBatchGcd( const u64* values, u64 n, const wchar_t* what, u64 run )
+		{
+			const u64 guard = 0x5a5a5a5a5a5a5a5aull;
+			alignas ( 64 ) static u64 work [ 8 * 64 * 14 + 16 + 8 ] { };		// batch_gcd_size_u( 64 ), and a guard
+			alignas ( 64 ) static u64 results [ 64 * 8 ] { };
+			u64 size = batch_gcd_size_u( n );
+			work [ size ] = guard;
+			_UI512( expected ) { 0 };
+			regs r_before {};
+			regs r_after {};
+			reg_verify( ( u64* ) &r_before );
+			s16 ret = batch_gcd_u( results, values, n, work );
+			reg_verify( ( u64* ) &r_after );
+			Assert::IsTrue( r_before.AreEqual( &r_after ), L"Register validation failed" );
+			Assert::AreEqual( s16( 0 ), ret, _MSGW( L"Return code failed " << what << L", n " << n << L", run #" << run ) );
+			Assert::AreEqual( guard, work [ size ], _MSGW( L"Work area overrun " << what << L", n " << n << L", run #" << run ) );
+			for ( u64 i = 0; i < n; i++ )
+			{
+				BatchGcdRef( expected, values, n, i );
+				Assert::AreEqual( s16( 0 ), compare_u( results + i * 8, expected ),
+					_MSGW( L"Result failed " << what << L", n " << n << L", value " << i << L", run #" << run ) );
+			};
+		};
+
+		TEST_METHOD( ui512pr_07_batch_gcd )
+		{
+			// batch_gcd_u tests
+			// Note: gcd_u, gen_prime_u, div_u, mult_u and Montgomery multiply must pass testing before these tests (used in the reference)
+			u64 seed = 0;
+			u64 state = 0;
+			_UI512( over ) { 0 };
+			_UI512( work ) { 0 };
+			alignas ( 64 ) u64 values [ 64 * 8 ] { };
+			alignas ( 64 ) u64 results [ 64 * 8 ] { };
+			alignas ( 64 ) u64 primes [ 32 * 8 ] { };
+
+			// 1. n of zero, a zero value, one value; the work area size
+			Assert::AreEqual( s16( -1 ), batch_gcd_u( results, values, 0, work ), L"Return code failed n of zero" );
+			set_uT64( values, 15ull );
+			Assert::AreEqual( s16( -1 ), batch_gcd_u( results, values, 2, work ), L"Return code failed zero value" );
+			Assert::AreEqual( s16( 0 ), batch_gcd_u( results, values, 1, work ), L"Return code failed one value" );
+			Assert::AreEqual( s16( 0 ), compare_uT64( results, 1ull ), L"Result failed one value" );
+			Assert::AreEqual( 80ull, batch_gcd_size_u( 1 ), L"Size failed n of one" );
+			Assert::AreEqual( 160ull, batch_gcd_size_u( 2 ), L"Size failed n of two" );
+			Assert::AreEqual( 16ull * 8 * 12 + 16, batch_gcd_size_u( 9 ), L"Size failed n of nine" );
+
+			// 2. small values, even ones too: 6, 10, 15, 7 give 6, 10, 15, 1
+			const u64 small [ ] = { 6, 10, 15, 7 };
+			const u64 small_gcd [ ] = { 6, 10, 15, 1 };
+			alignas ( 64 ) static u64 small_work [ 8 * 4 * 10 + 16 ] { };		// batch_gcd_size_u( 4 )
+			for ( u64 i = 0; i < 4; i++ )
+			{
+				set_uT64( values + i * 8, small [ i ] );
+			};
+			Assert::AreEqual( s16( 0 ), batch_gcd_u( results, values, 4, small_work ), L"Return code failed small values" );
+			for ( u64 i = 0; i < 4; i++ )
+			{
+				Assert::AreEqual( s16( 0 ), compare_uT64( results + i * 8, small_gcd [ i ] ), _MSGW( L"Result failed small value " << i ) );
+			};
+
+			// 3. products of 64 to 256 bit primes, some primes shared by two or three values, a square, a repeat, a one
+			for ( u64 i = 0; i < 32; i++ )
+			{
+				state = i;
+				gen_prime_u( primes + i * 8, 64 + 64 * ( i % 4 ), SplitMixFill, &state );
+			};
+			const u64 runs = 24;
+			for ( u64 run = 0; run < runs; run++ )
+			{
+				u64 n = 2 + ( RandomU64( &seed ) % 63 );
+				for ( u64 i = 0; i < n; i++ )
+				{
+					u64* x = values + i * 8;
+					mult_u( x, over, primes + ( RandomU64( &seed ) % 32 ) * 8, primes + ( RandomU64( &seed ) % 32 ) * 8 );
+				};
+				if ( n > 3 )
+				{
+					copy_u( values + 8, values );
+					set_uT64( values + 16, 1ull );
+				};
+				CheckBatchGcd( values, n, L"shared primes", run );
+			};
+
+			// 4. random odd values of every length: shared small factors
+			for ( u64 run = 0; run < runs; run++ )
+			{
+				u64 n = 2 + ( RandomU64( &seed ) % 63 );
+				for ( u64 i = 0; i < n; i++ )
+				{
+					u64* x = values + i * 8;
+					for ( int j = 0; j < 8; j++ )
+					{
+						x [ j ] = RandomU64( &seed );
+					};
+					shr_u( x, x, u16( RandomU64( &seed ) % 500 ) );
+					x [ 7 ] |= 1;
+				};
+				CheckBatchGcd( values, n, L"random", run );
+			};
+
+			// 5. a large set, the Karatsuba split at every level above the leaves: 600 products of two of 400 primes of 128 to 256 bits
+			const u64 big_n = 600;
+			alignas ( 64 ) static u64 big_values [ big_n * 8 ] { };
+			alignas ( 64 ) static u64 big_results [ big_n * 8 ] { };
+			alignas ( 64 ) static u64 big_primes [ 400 * 8 ] { };
+			alignas ( 64 ) static u64 big_work [ 8 * 1024 * 18 + 16 + 8 ] { };		// batch_gcd_size_u( 600 ), and a guard
+			_UI512( expected ) { 0 };
+			Assert::AreEqual( 8ull * 1024 * 18 + 16, batch_gcd_size_u( big_n ), L"Size failed n of 600" );
+			for ( u64 i = 0; i < 400; i++ )
+			{
+				state = i + 1000;
+				gen_prime_u( big_primes + i * 8, 128 + 128 * ( i % 2 ), SplitMixFill, &state );
+			};
+			for ( u64 i = 0; i < big_n; i++ )
+			{
+				mult_u( big_values + i * 8, over, big_primes + ( RandomU64( &seed ) % 400 ) * 8, big_primes + ( RandomU64( &seed ) % 400 ) * 8 );
+			};
+			big_work [ 8 * 1024 * 18 + 16 ] = 0x5a5a5a5a5a5a5a5aull;
+			Assert::AreEqual( s16( 0 ), batch_gcd_u( big_results, big_values, big_n, big_work ), L"Return code failed large set" );
+			Assert::AreEqual( 0x5a5a5a5a5a5a5a5aull, big_work [ 8 * 1024 * 18 + 16 ], L"Work area overrun large set" );
+			for ( u64 i = 0; i < big_n; i++ )
+			{
+				BatchGcdRef( expected, big_values, big_n, i );
+				Assert::AreEqual( s16( 0 ), compare_u( big_results + i * 8, expected ), _MSGW( L"Result failed large set, value " << i ) );
+			};
+
+			string test_message = _MSGA( "Batch gcd function testing. Error cases, small values, "
+				<< runs << " sets each of 2 to 64 products of shared primes, and of random odd values of every length, and a set of "
+				<< big_n << ".\n" );
+			Logger::WriteMessage( test_message.c_str( ) );
+			Logger::WriteMessage( L"Passed. Tested expected values, return value, work area bound, and volatile register integrity: each via assert.\n\n" );
+		};
+
+		TEST_METHOD( ui512pr_07_batch_gcd_performance )
+		{
+			// Performance timing tests.
+			// Note: these tests are not pass/fail, they are informational only
+
+			Logger::WriteMessage( L"Batch gcd function performance timing test.\n\n" );
+
+			Logger::WriteMessage( L"First run.\n" );
+			perf_stats No1 = Perf_Test_Parms [ 0 ];
+			ui512_Unit_Tests::RunStats( &No1, BatchGcd );
+
+			Logger::WriteMessage( L"Second run.\n" );
+			perf_stats No2 = Perf_Test_Parms [ 1 ];
+			RunStats( &No2, BatchGcd );
+
+			Logger::WriteMessage( L"Third run.\n" );
+			perf_stats No3 = Perf_Test_Parms [ 2 ];
+			RunStats( &No3, BatchGcd );
+		};
+	};
+};
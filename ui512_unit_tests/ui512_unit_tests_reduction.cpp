@@ -0,0 +1,284 @@
+//		ui512_unit_tests_reduction
+//
+//		File:			ui512_unit_tests_reduction.cpp
+//		Author:			John G.Lynch
+//		Legal:			Copyright @2025, per MIT License below
+//		Date:			October 19, 2026
+//
+//		ui512 is a small project to provide basic operations for a variable type of unsigned 512 bit integer.
+//		The basic operations : zero, copy, compare, add, subtract.
+//		Other optional modules provide bit ops and multiply / divide.
+//		It is written in assembly language, using the MASM ( ml64 ) assembler provided as an option within Visual Studio.
+//		( currently using VS Community 2022 17.14.10)
+//		It provides external signatures that allow linkage to C and C++ programs,
+//		where a shell / wrapper could encapsulate the methods as part of an object.
+//		It has assembly time options directing the use of Intel processor extensions : AVX4, AVX2, SIMD, or none :
+//		( Z ( 512 ), Y ( 256 ), or X ( 128 ) registers, or regular Q ( 64bit ) ).
+//		If processor extensions are used, the caller must align the variables declared and passed
+//		on the appropriate byte boundary ( e.g. alignas 64 for 512 )
+//		These modules (in total) are very light-weight ( less than 10K bytes ) and relatively fast,
+//		but is not intended for all processor types or all environments.
+//
+//		Intended use cases :
+//			1.) a "sum of primes" for primes up to 2 ^ 48.
+//			2.) elliptical curve cryptography(ECC)
+//
+//		This sub - project: ui512aTests, is a unit test project that invokes each of the routines in the ui512a assembly.
+//		It runs each assembler proc with pseudo-random values.
+//		It validates ( asserts ) expected and returned results.
+//		It also runs each repeatedly for comparative timings.
+//		It provides a means to invoke and debug.
+//		It illustrates calling the routines from C++.
+
+#include "pch.h"
+#include "CppUnitTest.h"
+#include "ui512_externs.h"
+#include "ui512_unit_tests.h"
+
+#include <cstring>
+#include <sstream>
+#include <format>
+#include <chrono>
+#include "intrin.h"
+
+using namespace std;
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+namespace ui512_Unit_Tests
+{
+	typedef s16 ( *reduce_fn )( const u64*, const u64*, const u64* );
+
+	/// <summary>
+	/// Common test body for the special-form prime reductions.
+	/// Note: mult_u, div_u, and the add / subtract / compare / shift routines must pass testing before these tests
+	/// </summary>
+	/// <param name="reduce">reduction routine under test</param>
+	/// <param name="prime">its modulus</param>
+	/// <param name="name">name of the modulus, for messages</param>
+	static void ReduceTest( reduce_fn reduce, const u64* prime, const char* name )
+	{
+		u64 seed = 0;
+		regs r_before {};
+		regs r_after {};
+		_UI512( num1 ) { 0 };
+		_UI512( num2 ) { 0 };
+		_UI512( product ) { 0 };
+		_UI512( overflow ) { 0 };
+		_UI512( result ) { 0 };
+		_UI512( expected ) { 0 };
+		_UI512( quotient ) { 0 };
+		const bool fits512 = msb_u( prime ) < 256;			// 256 bit primes: any 512 bit product is accepted
+
+		// 1. zero
+		zero_u( product );
+		zero_u( overflow );
+		zero_u( expected );
+		reg_verify( ( u64* ) &r_before );
+		s16 ret = reduce( result, product, overflow );
+		reg_verify( ( u64* ) &r_after );
+		Assert::IsTrue( r_before.AreEqual( &r_after ), L"Register validation failed" );
+		Assert::AreEqual( s16( 0 ), ret, _MSGW( L"Return code failed zero test, " << name ) );
+		for ( int j = 0; j < 8; j++ )
+		{
+			Assert::AreEqual( expected [ j ], result [ j ], _MSGW( L"Result at word #" << j << " failed zero test, " << name ) );
+		};
+
+		// 2. p itself reduces to zero, p - 1 is unchanged
+		copy_u( product, prime );
+		ret = reduce( result, product, overflow );
+		for ( int j = 0; j < 8; j++ )
+		{
+			Assert::AreEqual( expected [ j ], result [ j ], _MSGW( L"Result at word #" << j << " failed p mod p test, " << name ) );
+		};
+		sub_uT64( product, prime, 1ull );
+		copy_u( expected, product );
+		ret = reduce( result, product, overflow );
+		for ( int j = 0; j < 8; j++ )
+		{
+			Assert::AreEqual( expected [ j ], result [ j ], _MSGW( L"Result at word #" << j << " failed p - 1 test, " << name ) );
+		};
+
+		// 3. largest product of reduced operands: ( p - 1 ) * ( p - 1 ) = 1 mod p
+		sub_uT64( num1, prime, 1ull );
+		mult_u( product, overflow, num1, num1 );
+		set_uT64( expected, 1ull );
+		ret = reduce( result, product, overflow );
+		Assert::AreEqual( s16( 0 ), ret, _MSGW( L"Return code failed (p - 1)^2 test, " << name ) );
+		for ( int j = 0; j < 8; j++ )
+		{
+			Assert::AreEqual( expected [ j ], result [ j ], _MSGW( L"Result at word #" << j << " failed (p - 1)^2 test, " << name ) );
+		};
+
+		// 4. random reduced operands, product reduced, checked against shift and add reference; also in place
+		for ( int i = 0; i < test_run_count; i++ )
+		{
+			RandomFillMod( num1, prime, &seed );
+			RandomFillMod( num2, prime, &seed );
+			mult_u( product, overflow, num1, num2 );
+			MulModRef( expected, num1, num2, prime );
+			reg_verify( ( u64* ) &r_before );
+			ret = reduce( result, product, overflow );
+			reg_verify( ( u64* ) &r_after );
+			Assert::IsTrue( r_before.AreEqual( &r_after ), L"Register validation failed" );
+			Assert::AreEqual( s16( 0 ), ret, _MSGW( L"Return code failed random test, " << name << " on run #" << i ) );
+			for ( int j = 0; j < 8; j++ )
+			{
+				Assert::AreEqual( expected [ j ], result [ j ], _MSGW( L"Result at word #" << j << " failed random test, " << name << " on run #" << i ) );
+			};
+			reduce( product, product, overflow );
+			for ( int j = 0; j < 8; j++ )
+			{
+				Assert::AreEqual( expected [ j ], product [ j ], _MSGW( L"Result at word #" << j << " failed in place test, " << name << " on run #" << i ) );
+			};
+		};
+
+		// 5. 256 bit primes: full range 512 bit values, checked against division remainder
+		if ( fits512 )
+		{
+			zero_u( overflow );
+			for ( int i = 0; i < test_run_count; i++ )
+			{
+				RandomFill( product, &seed );
+				if ( i == 0 )
+				{
+					for ( int j = 0; j < 8; j++ )
+					{
+						product [ j ] = u64_Max;
+					};
+				};
+				div_u( quotient, expected, product, prime );
+				ret = reduce( result, product, overflow );
+				Assert::AreEqual( s16( 0 ), ret, _MSGW( L"Return code failed full range test, " << name << " on run #" << i ) );
+				for ( int j = 0; j < 8; j++ )
+				{
+					Assert::AreEqual( expected [ j ], result [ j ], _MSGW( L"Result at word #" << j << " failed full range test, " << name << " on run #" << i ) );
+				};
+			};
+		};
+
+		string test_message = _MSGA( "Reduction modulo " << name << " function testing.\n\nEdge cases:\n\tzero,\n\tp,\n\tp - 1,\n\t(p - 1)^2.\n"
+			<< test_run_count << " products of pseudo random reduced operands, checked against reference modular multiply, also reduced in place.\n" );
+		if ( fits512 )
+		{
+			test_message += _MSGA( test_run_count << " pseudo random full 512 bit values, checked against division remainder.\n" );
+		};
+		Logger::WriteMessage( test_message.c_str( ) );
+		Logger::WriteMessage( L"Passed. Tested expected values, return value, and volatile register integrity: each via assert.\n\n" );
+	};
+
+	TEST_CLASS( ui512_unit_tests_reduction )
+	{
+		TEST_METHOD( ui512red_01_secp256k1 )
+		{
+			ReduceTest( reduce_secp256k1_u, prime_secp256k1, "secp256k1 (2^256 - 2^32 - 977)" );
+		};
+
+		TEST_METHOD( ui512red_01_secp256k1_performance )
+		{
+			// Performance timing tests.
+			// Note: these tests are not pass/fail, they are informational only
+
+			Logger::WriteMessage( L"Reduce mod secp256k1 function performance timing test.\n\n" );
+
+			Logger::WriteMessage( L"First run.\n" );
+			perf_stats No1 = Perf_Test_Parms [ 0 ];
+			ui512_Unit_Tests::RunStats( &No1, RedK1 );
+
+			Logger::WriteMessage( L"Second run.\n" );
+			perf_stats No2 = Perf_Test_Parms [ 1 ];
+			RunStats( &No2, RedK1 );
+
+			Logger::WriteMessage( L"Third run.\n" );
+			perf_stats No3 = Perf_Test_Parms [ 2 ];
+			RunStats( &No3, RedK1 );
+		};
+
+		TEST_METHOD( ui512red_02_p256 )
+		{
+			ReduceTest( reduce_p256_u, prime_p256, "P-256" );
+		};
+
+		TEST_METHOD( ui512red_02_p256_performance )
+		{
+			Logger::WriteMessage( L"Reduce mod P-256 function performance timing test.\n\n" );
+
+			Logger::WriteMessage( L"First run.\n" );
+			perf_stats No1 = Perf_Test_Parms [ 0 ];
+			ui512_Unit_Tests::RunStats( &No1, RedP256 );
+
+			Logger::WriteMessage( L"Second run.\n" );
+			perf_stats No2 = Perf_Test_Parms [ 1 ];
+			RunStats( &No2, RedP256 );
+
+			Logger::WriteMessage( L"Third run.\n" );
+			perf_stats No3 = Perf_Test_Parms [ 2 ];
+			RunStats( &No3, RedP256 );
+		};
+
+		TEST_METHOD( ui512red_03_p384 )
+		{
+			ReduceTest( reduce_p384_u, prime_p384, "P-384" );
+		};
+
+		TEST_METHOD( ui512red_03_p384_performance )
+		{
+			Logger::WriteMessage( L"Reduce mod P-384 function performance timing test.\n\n" );
+
+			Logger::WriteMessage( L"First run.\n" );
+			perf_stats No1 = Perf_Test_Parms [ 0 ];
+			ui512_Unit_Tests::RunStats( &No1, RedP384 );
+
+			Logger::WriteMessage( L"Second run.\n" );
+			perf_stats No2 = Perf_Test_Parms [ 1 ];
+			RunStats( &No2, RedP384 );
+
+			Logger::WriteMessage( L"Third run.\n" );
+			perf_stats No3 = Perf_Test_Parms [ 2 ];
+			RunStats( &No3, RedP384 );
+		};
+
+		TEST_METHOD( ui512red_04_25519 )
+		{
+			ReduceTest( reduce_25519_u, prime_25519, "2^255 - 19" );
+		};
+
+		TEST_METHOD( ui512red_04_25519_performance )
+		{
+			Logger::WriteMessage( L"Reduce mod 2^255 - 19 function performance timing test.\n\n" );
+
+			Logger::WriteMessage( L"First run.\n" );
+			perf_stats No1 = Perf_Test_Parms [ 0 ];
+			ui512_Unit_Tests::RunStats( &No1, Red25519 );
+
+			Logger::WriteMessage( L"Second run.\n" );
+			perf_stats No2 = Perf_Test_Parms [ 1 ];
+			RunStats( &No2, Red25519 );
+
+			Logger::WriteMessage( L"Third run.\n" );
+			perf_stats No3 = Perf_Test_Parms [ 2 ];
+			RunStats( &No3, Red25519 );
+		};
+
+		TEST_METHOD( ui512red_05_448 )
+		{
+			ReduceTest( reduce_448_u, prime_448, "2^448 - 2^224 - 1" );
+		};
+
+		TEST_METHOD( ui512red_05_448_performance )
+		{
+			Logger::WriteMessage( L"Reduce mod 2^448 - 2^224 - 1 function performance timing test.\n\n" );
+
+			Logger::WriteMessage( L"First run.\n" );
+			perf_stats No1 = Perf_Test_Parms [ 0 ];
+			ui512_Unit_Tests::RunStats( &No1, Red448 );
+
+			Logger::WriteMessage( L"Second run.\n" );
+			perf_stats No2 = Perf_Test_Parms [ 1 ];
+			RunStats( &No2, Red448 );
+
+			Logger::WriteMessage( L"Third run.\n" );
+			perf_stats No3 = Perf_Test_Parms [ 2 ];
+			RunStats( &No3, Red448 );
+		};
+	};
+};
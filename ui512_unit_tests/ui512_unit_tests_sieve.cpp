@@ -0,0 +1,751 @@
+//		ui512_unit_tests_sieve
+//
+//		File:			ui512_unit_tests_sieve.cpp
+//		Author:			John G.Lynch
+//		Legal:			Copyright @2025, per MIT License below
+//		Date:			October 19, 2026
+//
+//		ui512 is a small project to provide basic operations for a variable type of unsigned 512 bit integer.
+//		The basic operations : zero, copy, compare, add, subtract.
+//		Other optional modules provide bit ops and multiply / divide.
+//		It is written in assembly language, using the MASM ( ml64 ) assembler provided as an option within Visual Studio.
+//		( currently using VS Community 2022 17.14.10)
+//		It provides external signatures that allow linkage to C and C++ programs,
+//		where a shell / wrapper could encapsulate the methods as part of an object.
+//		It has assembly time options directing the use of Intel processor extensions : AVX4, AVX2, SIMD, or none :
+//		( Z ( 512 ), Y ( 256 ), or X ( 128 ) registers, or regular Q ( 64bit ) ).
+//		If processor extensions are used, the caller must align the variables declared and passed
+//		on the appropriate byte boundary ( e.g. alignas 64 for 512 )
+//		These modules (in total) are very light-weight ( less than 10K bytes ) and relatively fast,
+//		but is not intended for all processor types or all environments.
+//
+//		Intended use cases :
+//			1.) a "sum of primes" for primes up to 2 ^ 48.
+//			2.) elliptical curve cryptography(ECC)
+//
+//		This sub - project: ui512aTests, is a unit test project that invokes each of the routines in the ui512a assembly.
+//		It runs each assembler proc with pseudo-random values.
+//		It validates ( asserts ) expected and returned results.
+//		It also runs each repeatedly for comparative timings.
+//		It provides a means to invoke and debug.
+//		It illustrates calling the routines from C++.
+
+#include "pch.h"
+#include "CppUnitTest.h"
+#include "ui512_externs.h"
+#include "ui512_unit_tests.h"
+
+#include <cstring>
+#include <sstream>
+#include <format>
+#include <chrono>
+#include <thread>
+#include <atomic>
+#include <fstream>
+#include <filesystem>
+#include "intrin.h"
+
+using namespace std;
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+namespace ui512_Unit_Tests
+{
+	/// <summary>
+	/// Reference sum of primes, lo <= p < hi: a byte per integer, marked by the primes to sqrt( hi ), plain Eratosthenes
+	/// </summary>
+	static void SumPrimesRef( u64* sum, u64 lo, u64 hi )
+	{
+		zero_u( sum );
+		if ( lo >= hi )
+		{
+			return;
+		};
+		u64 r = 1;
+		while ( ( r + 1 ) * ( r + 1 ) < hi )
+		{
+			r++;
+		};
+		vector<char> small( r + 1, 1 );
+		vector<char> window( hi - lo, 1 );
+		for ( u64 p = 2; p <= r; p++ )
+		{
+			if ( !small [ p ] )
+			{
+				continue;
+			};
+			for ( u64 m = p * p; m <= r; m += p )
+			{
+				small [ m ] = 0;
+			};
+			u64 m = ( ( lo + p - 1 ) / p ) * p;
+			m = ( m < p * p ) ? p * p : m;
+			for ( ; m < hi; m += p )
+			{
+				window [ m - lo ] = 0;
+			};
+		};
+		u64 low = 0;
+		u64 high = 0;
+		for ( u64 n = ( lo < 2 ) ? 2 : lo; n < hi; n++ )
+		{
+			if ( window [ n - lo ] )
+			{
+				low += n;
+				high += ( low < n ) ? 1 : 0;
+			};
+		};
+		sum [ 7 ] = low;
+		sum [ 6 ] = high;
+	};
+
+	TEST_CLASS( ui512_unit_tests_sieve )
+	{
+		/// <summary>
+		/// Check sum_primes_u on one range against the reference
+		/// </summary>
+		static void CheckRange( u64 lo, u64 hi, u64* work, const char* what, int run )
+		{
+			regs r_before {};
+			regs r_after {};
+			_UI512( sum ) { 0 };
+			_UI512( expected ) { 0 };
+			SumPrimesRef( expected, lo, hi );
+			reg_verify( ( u64* ) &r_before );
+			s16 ret = sum_primes_u( sum, lo, hi, work );
+			reg_verify( ( u64* ) &r_after );
+			Assert::IsTrue( r_before.AreEqual( &r_after ), L"Register validation failed" );
+			Assert::AreEqual( s16( 0 ), ret, _MSGW( L"Return code failed " << what << L" test on run #" << run ) );
+			for ( int j = 0; j < 8; j++ )
+			{
+				Assert::AreEqual( expected [ j ], sum [ j ],
+					_MSGW( L"Sum failed " << what << L" test, range " << lo << L" to " << hi << L", word " << j << L", run #" << run ) );
+			};
+		};
+
+		TEST_METHOD( ui512sv_01_sum_primes )
+		{
+			// sum_primes_u, sieve_work_size_u tests
+			u64 seed = 0;
+			_UI512( sum ) { 0 };
+			u64 bytes = 0;
+			const u64 limit = 1ull << 52;
+			int adjtest_run_count = test_run_count / 10;
+
+			// 1. work size, and the limit on hi
+			Assert::AreEqual( s16( 0 ), sieve_work_size_u( &bytes, limit ), L"Return code failed work size at 2^52" );
+			Assert::AreEqual( u64( 0 ), bytes % 64, L"Work size not a multiple of 64" );
+			Assert::IsTrue( bytes > 16ull * 3957809ull, L"Work size too small for pi( 2^26 ) sieving primes" );
+			Assert::AreEqual( s16( -1 ), sieve_work_size_u( &bytes, limit + 1 ), L"Return code failed work size above 2^52" );
+			u64* work = AllocSieveWork( 1ull << 40 );
+			Assert::AreEqual( s16( -1 ), sum_primes_u( sum, 0, limit + 1, work ), L"Return code failed hi above 2^52" );
+
+			// 2. empty and tiny ranges, the primes below the wheel ( 2, 3, 5 ), every range with ends below 256
+			sum [ 7 ] = 12345;
+			Assert::AreEqual( s16( 0 ), sum_primes_u( sum, 100, 100, work ), L"Return code failed empty range" );
+			Assert::AreEqual( u64( 0 ), sum [ 7 ], L"Sum failed empty range" );
+			Assert::AreEqual( s16( 0 ), sum_primes_u( sum, 200, 100, work ), L"Return code failed lo above hi" );
+			Assert::AreEqual( u64( 0 ), sum [ 7 ], L"Sum failed lo above hi" );
+			for ( u64 lo = 0; lo < 256; lo++ )
+			{
+				for ( u64 hi = lo; hi < 256; hi++ )
+				{
+					CheckRange( lo, hi, work, "small range", int( lo * 256 + hi ) );
+				};
+			};
+
+			// 3. ranges below 2^24 of random ends and sizes, crossing segments ( 983,040 integers each )
+			for ( int i = 0; i < adjtest_run_count; i++ )
+			{
+				u64 lo = RandomU64( &seed ) % ( 1ull << 24 );
+				u64 hi = lo + RandomU64( &seed ) % ( 1ull << ( RandomU64( &seed ) % 22 ) );
+				CheckRange( lo, hi, work, "random range", i );
+			};
+			CheckRange( 0, 30 * 32768, work, "one segment", 0 );
+			CheckRange( 1, 30 * 32768 + 1, work, "one segment and one", 0 );
+			CheckRange( 30 * 32768 - 7, 2 * 30 * 32768 + 7, work, "segment boundaries", 0 );
+			CheckRange( 0, 1024 * 1024 + 1, work, "sieving primes to 1024", 0 );
+			CheckRange( 0, 1024 * 1024 + 2, work, "sieving primes past 1024", 0 );
+
+			// 4. windows near 2^32, 2^40 ( sieving primes found by the sieve ), and at 2^52
+			for ( int i = 0; i < adjtest_run_count / 10; i++ )
+			{
+				u64 lo = ( 1ull << 40 ) - RandomU64( &seed ) % ( 1ull << 32 );
+				u64 hi = lo + RandomU64( &seed ) % ( 1ull << 20 );
+				hi = ( hi > ( 1ull << 40 ) ) ? ( 1ull << 40 ) : hi;
+				CheckRange( lo, hi, work, "window below 2^40", i );
+			};
+			CheckRange( ( 1ull << 32 ) - 1000000, ( 1ull << 32 ) + 1000000, work, "window at 2^32", 0 );
+			CheckRange( ( 1ull << 40 ) - 2 * 30 * 32768, 1ull << 40, work, "window to 2^40", 0 );
+			FreeSieveWork( work );
+			work = AllocSieveWork( limit );
+			CheckRange( limit - 100000, limit, work, "window to 2^52", 0 );
+			FreeSieveWork( work );
+
+			string test_message = _MSGA( "Sum of primes function testing.\n\nWork size, hi above 2^52 rejected,\n"
+				<< "\tempty ranges, every range with ends below 256,\n\t"
+				<< adjtest_run_count << " pseudo random ranges below 2^24, across segment boundaries,\n\t"
+				<< adjtest_run_count / 10 << " pseudo random windows below 2^40, windows at 2^32, to 2^40 and to 2^52,\n"
+				<< "\teach checked against a plain Sieve of Eratosthenes.\n" );
+			Logger::WriteMessage( test_message.c_str( ) );
+			Logger::WriteMessage( L"Passed. Tested expected values, return value, and volatile register integrity: each via assert.\n\n" );
+		};
+
+		TEST_METHOD( ui512sv_02_sum_primes_benchmark )
+		{
+			// Sum of the primes below 2^32, and of those in the last 2^32 integers below 2^40, timed, checked against known sums
+			// ( computed independently, Lucy_Hedgehog prime sum ). Extrapolates the time for all primes below 2^40.
+			// Note: the timings are informational only
+			_UI512( sum ) { 0 };
+			_UI512( expected ) { 0 };
+			u64* work = AllocSieveWork( 1ull << 40 );
+
+			auto start = chrono::steady_clock::now( );
+			s16 ret = sum_primes_u( sum, 0, 1ull << 32, work );
+			double secs32 = chrono::duration<double>( chrono::steady_clock::now( ) - start ).count( );
+			Assert::AreEqual( s16( 0 ), ret, L"Return code failed sum below 2^32" );
+			expected [ 7 ] = 425649736193687430ull;
+			for ( int j = 0; j < 8; j++ )
+			{
+				Assert::AreEqual( expected [ j ], sum [ j ], _MSGW( L"Sum failed below 2^32, word " << j ) );
+			};
+
+			start = chrono::steady_clock::now( );
+			ret = sum_primes_u( sum, ( 1ull << 40 ) - ( 1ull << 32 ), 1ull << 40, work );
+			double secs40 = chrono::duration<double>( chrono::steady_clock::now( ) - start ).count( );
+			Assert::AreEqual( s16( 0 ), ret, L"Return code failed sum of the window to 2^40" );
+			expected [ 7 ] = 0x3732DE6752E86CA1ull;
+			expected [ 6 ] = 0x9ull;
+			for ( int j = 0; j < 8; j++ )
+			{
+				Assert::AreEqual( expected [ j ], sum [ j ], _MSGW( L"Sum failed window to 2^40, word " << j ) );
+			};
+			FreeSieveWork( work );
+
+			string test_message = _MSGA( "Sum of primes benchmark.\n\n"
+				<< "\tprimes below 2^32: " << secs32 << " seconds\n"
+				<< "\tprimes from 2^40 - 2^32 to 2^40: " << secs40 << " seconds, all primes below 2^40 ( 256 such ranges ) about "
+				<< secs40 * 256.0 << " seconds on one thread\n" );
+			Logger::WriteMessage( test_message.c_str( ) );
+			Logger::WriteMessage( L"Passed. Tested expected values and return values: each via assert.\n\n" );
+		};
+
+		/// <summary>
+		/// Run a parallel sum of primes, threads workers each on its own thread, and check it against sum_primes_u on the whole range
+		/// </summary>
+		static void CheckParallel( u64 lo, u64 hi, u64 chunk, u64 threads, const char* what )
+		{
+			vector<sieve_worker> workers( threads );
+			alignas ( 64 ) u64 sum [ 16 ];
+			_UI512( expected ) { 0 };
+			for ( u64 i = 0; i < threads; i++ )
+			{
+				workers [ i ].work = AllocSieveWork( hi );
+			};
+			sieve_job job { lo, hi, chunk, 0, threads, workers.data( ), 0, 0 };
+			Assert::AreEqual( s16( 0 ), sum_primes_init_u( &job ), _MSGW( L"Return code failed init, " << what ) );
+			vector<thread> running;
+			vector<s16> rets( threads, -2 );
+			for ( u64 i = 0; i < threads; i++ )
+			{
+				running.emplace_back( [ &job, &rets, i ]( ) { rets [ i ] = sum_primes_worker_u( &job, i ); } );
+			};
+			u64 chunks = 0;
+			for ( u64 i = 0; i < threads; i++ )
+			{
+				running [ i ].join( );
+				Assert::AreEqual( s16( 0 ), rets [ i ], _MSGW( L"Return code failed worker " << i << L", " << what ) );
+				chunks += workers [ i ].chunks;
+			};
+			Assert::AreEqual( job.nchunks, chunks, _MSGW( L"Chunks summed failed, " << what ) );
+			Assert::AreEqual( s16( 0 ), sum_primes_combine_u( sum, &job ), _MSGW( L"Return code failed combine, " << what ) );
+			sum_primes_u( expected, lo, hi, workers [ 0 ].work );
+			for ( int j = 0; j < 8; j++ )
+			{
+				Assert::AreEqual( u64( 0 ), sum [ j ], _MSGW( L"Sum failed high half, " << what << L", word " << j ) );
+				Assert::AreEqual( expected [ j ], sum [ 8 + j ], _MSGW( L"Sum failed, " << what << L", word " << j ) );
+			};
+			for ( u64 i = 0; i < threads; i++ )
+			{
+				FreeSieveWork( workers [ i ].work );
+			};
+		};
+
+		TEST_METHOD( ui512sv_03_parallel )
+		{
+			// sum_primes_init_u, sum_primes_worker_u, sum_primes_combine_u tests
+			// Note: ui512sv_01 must pass before these tests (sum_primes_u is the reference)
+			regs r_before {};
+			regs r_after {};
+			alignas ( 64 ) u64 sum [ 16 ];
+			vector<sieve_worker> workers( 4 );
+			u64* work = AllocSieveWork( 1ull << 32 );
+			for ( auto& w : workers )
+			{
+				w.work = work;
+			};
+			u64 threads = thread::hardware_concurrency( );
+			threads = ( threads < 2 ) ? 2 : threads;
+
+			// 1. init: rejected jobs, chunks dealt out evenly, default and clamped chunks
+			sieve_job job { 0, ( 1ull << 52 ) + 1, 0, 0, 4, workers.data( ), 0, 0 };
+			Assert::AreEqual( s16( -1 ), sum_primes_init_u( &job ), L"Return code failed init, hi above 2^52" );
+			job = { 0, 1ull << 33, 1, 0, 4, workers.data( ), 0, 0 };
+			Assert::AreEqual( s16( -1 ), sum_primes_init_u( &job ), L"Return code failed init, too many chunks" );
+			job = { 0, 1000, 0, 0, 0, workers.data( ), 0, 0 };
+			Assert::AreEqual( s16( -1 ), sum_primes_init_u( &job ), L"Return code failed init, no workers" );
+			job = { 100, 1100, 100, 0, 3, workers.data( ), 0, 0 };
+			Assert::AreEqual( s16( 0 ), sum_primes_init_u( &job ), L"Return code failed init" );
+			Assert::AreEqual( u64( 10 ), job.nchunks, L"Chunks failed init" );
+			Assert::AreEqual( ( 3ull << 32 ) | 0ull, workers [ 0 ].range, L"Range failed init, worker 0" );
+			Assert::AreEqual( ( 6ull << 32 ) | 3ull, workers [ 1 ].range, L"Range failed init, worker 1" );
+			Assert::AreEqual( ( 10ull << 32 ) | 6ull, workers [ 2 ].range, L"Range failed init, worker 2" );
+			job = { 0, 1ull << 40, 0, 0, 4, workers.data( ), 0, 0 };
+			Assert::AreEqual( s16( 0 ), sum_primes_init_u( &job ), L"Return code failed init, default chunk" );
+			Assert::AreEqual( u64( 30 * 32768 * 1024 ), job.chunk, L"Chunk failed init, default" );
+			job = { 0, 5000, 1ull << 20, 0, 4, workers.data( ), 0, 0 };
+			Assert::AreEqual( s16( 0 ), sum_primes_init_u( &job ), L"Return code failed init, chunk above range" );
+			Assert::AreEqual( u64( 5000 ), job.chunk, L"Chunk failed init, clamped" );
+			Assert::AreEqual( u64( 1 ), job.nchunks, L"Chunks failed init, clamped" );
+			Assert::AreEqual( s16( -1 ), sum_primes_worker_u( &job, 4 ), L"Return code failed worker index" );
+
+			// 2. one thread runs worker 0 alone: its own chunks, then all the others', stolen
+			job = { 1ull << 30, ( 1ull << 30 ) + ( 1ull << 24 ), 1ull << 18, 0, 4, workers.data( ), 0, 0 };
+			sum_primes_init_u( &job );
+			reg_verify( ( u64* ) &r_before );
+			s16 ret = sum_primes_worker_u( &job, 0 );
+			reg_verify( ( u64* ) &r_after );
+			Assert::IsTrue( r_before.AreEqual( &r_after ), L"Register validation failed" );
+			Assert::AreEqual( s16( 0 ), ret, L"Return code failed lone worker" );
+			Assert::AreEqual( job.nchunks, workers [ 0 ].chunks, L"Chunks failed lone worker" );
+			Assert::IsTrue( workers [ 0 ].steals >= 3, L"Steals failed lone worker" );
+			for ( int i = 1; i < 4; i++ )
+			{
+				Assert::AreEqual( u64( 0 ), workers [ i ].chunks, L"Chunks failed idle worker" );
+				Assert::IsTrue( u32( workers [ i ].range ) >= u32( workers [ i ].range >> 32 ), L"Range failed idle worker" );
+			};
+			reg_verify( ( u64* ) &r_before );
+			ret = sum_primes_combine_u( sum, &job );
+			reg_verify( ( u64* ) &r_after );
+			Assert::IsTrue( r_before.AreEqual( &r_after ), L"Register validation failed" );
+			Assert::AreEqual( s16( 0 ), ret, L"Return code failed combine" );
+			_UI512( expected ) { 0 };
+			sum_primes_u( expected, job.lo, job.hi, work );
+			for ( int j = 0; j < 8; j++ )
+			{
+				Assert::AreEqual( expected [ j ], sum [ 8 + j ], _MSGW( L"Sum failed lone worker, word " << j ) );
+			};
+
+			// 3. combine: the carry out of the low half goes to the high half
+			for ( auto& w : workers )
+			{
+				for ( int j = 0; j < 8; j++ )
+				{
+					w.sum [ j ] = u64_Max;
+				};
+			};
+			sum_primes_combine_u( sum, &job );
+			Assert::AreEqual( u64( 3 ), sum [ 7 ], L"Combine failed carry, high half" );
+			Assert::AreEqual( u64_Max - 3, sum [ 15 ], L"Combine failed carry, low half" );
+			for ( int j = 8; j < 15; j++ )
+			{
+				Assert::AreEqual( u64_Max, sum [ j ], L"Combine failed carry, low half" );
+			};
+			FreeSieveWork( work );
+
+			// 4. on threads: one, two, as many as the processor runs, more workers than chunks, uneven chunks
+			CheckParallel( 0, 1ull << 24, 1ull << 20, 1, "one thread" );
+			CheckParallel( 1000000007, 1000000007 + ( 1ull << 26 ), 1000003, 2, "two threads" );
+			CheckParallel( 1ull << 32, ( 1ull << 32 ) + ( 1ull << 27 ), 1ull << 20, threads, "hardware threads" );
+			CheckParallel( 0, 3000000, 1000000, 8, "more workers than chunks" );
+			CheckParallel( 7, 8, 0, 3, "one integer" );
+
+			// 5. the last 2^32 integers below 2^40, timed, against the known sum ( Lucy_Hedgehog prime sum )
+			{
+				vector<sieve_worker> pool( threads );
+				for ( auto& w : pool )
+				{
+					w.work = AllocSieveWork( 1ull << 40 );
+				};
+				job = { ( 1ull << 40 ) - ( 1ull << 32 ), 1ull << 40, 0, 0, threads, pool.data( ), 0, 0 };
+				auto start = chrono::steady_clock::now( );
+				sum_primes_init_u( &job );
+				vector<thread> running;
+				for ( u64 i = 0; i < threads; i++ )
+				{
+					running.emplace_back( [ &job, i ]( ) { sum_primes_worker_u( &job, i ); } );
+				};
+				for ( auto& t : running )
+				{
+					t.join( );
+				};
+				sum_primes_combine_u( sum, &job );
+				double secs = chrono::duration<double>( chrono::steady_clock::now( ) - start ).count( );
+				Assert::AreEqual( 0x3732DE6752E86CA1ull, sum [ 15 ], L"Sum failed window to 2^40, parallel" );
+				Assert::AreEqual( 0x9ull, sum [ 14 ], L"Sum failed window to 2^40, parallel" );
+				u64 steals = 0;
+				for ( auto& w : pool )
+				{
+					steals += w.steals;
+					FreeSieveWork( w.work );
+				};
+				string timing = _MSGA( "Window 2^40 - 2^32 to 2^40 on " << threads << " threads: " << secs << " seconds, "
+					<< steals << " steals, all primes below 2^40 about " << secs * 256.0 << " seconds\n" );
+				Logger::WriteMessage( timing.c_str( ) );
+			};
+
+			string test_message = _MSGA( "Parallel sum of primes function testing.\n\nInit: rejected jobs, chunks dealt out, default and clamped chunk,\n"
+				<< "\tone thread running all the workers' chunks ( stealing ), combine carry into the high half,\n"
+				<< "\tone, two, " << threads << " threads, more workers than chunks, one integer, checked against sum_primes_u,\n"
+				<< "\tthe last 2^32 integers below 2^40, checked against the known sum.\n" );
+			Logger::WriteMessage( test_message.c_str( ) );
+			Logger::WriteMessage( L"Passed. Tested expected values, return value, and volatile register integrity: each via assert.\n\n" );
+		};
+
+		TEST_METHOD( ui512sv_01_sum_primes_performance )
+		{
+			// Performance timing tests.
+			// Note: these tests are not pass/fail, they are informational only
+
+			Logger::WriteMessage( L"Sum of primes function performance timing test.\n\n" );
+
+			Logger::WriteMessage( L"First run.\n" );
+			perf_stats No1 = Perf_Test_Parms [ 0 ];
+			ui512_Unit_Tests::RunStats( &No1, SumPrimes );
+
+			Logger::WriteMessage( L"Second run.\n" );
+			perf_stats No2 = Perf_Test_Parms [ 1 ];
+			RunStats( &No2, SumPrimes );
+
+			Logger::WriteMessage( L"Third run.\n" );
+			perf_stats No3 = Perf_Test_Parms [ 2 ];
+			RunStats( &No3, SumPrimes );
+		};
+
+		TEST_METHOD( ui512sv_04_lucy )
+		{
+			// sum_primes_lucy_u, lucy_work_size_u tests
+			// Note: ui512sv_01 must pass before these tests (sum_primes_u is the reference)
+			u64 seed = 0;
+			regs r_before {};
+			regs r_after {};
+			_UI512( sum ) { 0 };
+			_UI512( expected ) { 0 };
+			u64 bytes = 0;
+			int adjtest_run_count = test_run_count / 10;
+
+			// 1. work size, and the limit on hi
+			Assert::AreEqual( s16( 0 ), lucy_work_size_u( &bytes, 1ull << 40 ), L"Return code failed work size at 2^40" );
+			Assert::AreEqual( ( 1ull << 20 ) * 32, bytes, L"Work size failed at 2^40" );
+			Assert::AreEqual( s16( -1 ), lucy_work_size_u( &bytes, ( 1ull << 52 ) + 1 ), L"Return code failed work size above 2^52" );
+			lucy_work_size_u( &bytes, 1ull << 40 );
+			u64* work = ( u64* ) ::operator new ( size_t( bytes ), std::align_val_t( 64 ) );
+			u64* sieve_work = AllocSieveWork( 1ull << 32 );
+			Assert::AreEqual( s16( -1 ), sum_primes_lucy_u( sum, ( 1ull << 52 ) + 1, work ), L"Return code failed hi above 2^52" );
+
+			// 2. every hi to 2000, then random hi below 2^26, and squares and their neighbours ( the last small value )
+			for ( u64 hi = 0; hi <= 2000; hi++ )
+			{
+				sum_primes_u( expected, 0, hi, sieve_work );
+				reg_verify( ( u64* ) &r_before );
+				s16 ret = sum_primes_lucy_u( sum, hi, work );
+				reg_verify( ( u64* ) &r_after );
+				Assert::IsTrue( r_before.AreEqual( &r_after ), L"Register validation failed" );
+				Assert::AreEqual( s16( 0 ), ret, _MSGW( L"Return code failed small hi test, hi " << hi ) );
+				for ( int j = 0; j < 8; j++ )
+				{
+					Assert::AreEqual( expected [ j ], sum [ j ], _MSGW( L"Sum failed small hi test, hi " << hi << L", word " << j ) );
+				};
+			};
+			for ( int i = 0; i < adjtest_run_count; i++ )
+			{
+				u64 hi = RandomU64( &seed ) % ( 1ull << 26 );
+				if ( i % 4 != 0 )
+				{
+					u64 k = 2 + RandomU64( &seed ) % 8000;
+					hi = k * k + ( i % 4 ) - 2;
+				};
+				sum_primes_u( expected, 0, hi, sieve_work );
+				s16 ret = sum_primes_lucy_u( sum, hi, work );
+				Assert::AreEqual( s16( 0 ), ret, _MSGW( L"Return code failed random test on run #" << i ) );
+				for ( int j = 0; j < 8; j++ )
+				{
+					Assert::AreEqual( expected [ j ], sum [ j ], _MSGW( L"Sum failed random test, hi " << hi << L", word " << j << L", run #" << i ) );
+				};
+			};
+
+			// 3. known sums ( computed independently ), below 2^32 and 2^40, timed
+			auto start = chrono::steady_clock::now( );
+			sum_primes_lucy_u( sum, 1ull << 32, work );
+			double secs32 = chrono::duration<double>( chrono::steady_clock::now( ) - start ).count( );
+			zero_u( expected );
+			expected [ 7 ] = 425649736193687430ull;
+			for ( int j = 0; j < 8; j++ )
+			{
+				Assert::AreEqual( expected [ j ], sum [ j ], _MSGW( L"Sum failed below 2^32, word " << j ) );
+			};
+			start = chrono::steady_clock::now( );
+			sum_primes_lucy_u( sum, 1ull << 40, work );
+			double secs40 = chrono::duration<double>( chrono::steady_clock::now( ) - start ).count( );
+			expected [ 7 ] = 0xFB59606E262F7B77ull;
+			expected [ 6 ] = 0x4B3ull;
+			for ( int j = 0; j < 8; j++ )
+			{
+				Assert::AreEqual( expected [ j ], sum [ j ], _MSGW( L"Sum failed below 2^40, word " << j ) );
+			};
+			::operator delete ( ( void* ) work, std::align_val_t( 64 ) );
+			FreeSieveWork( sieve_work );
+
+			string test_message = _MSGA( "Sum of primes ( Lucy_Hedgehog ) function testing.\n\nWork size, hi above 2^52 rejected,\n"
+				<< "\tevery hi to 2000, " << adjtest_run_count << " pseudo random hi below 2^26 and squares, checked against sum_primes_u,\n"
+				<< "\tbelow 2^32 ( " << secs32 << " seconds ) and 2^40 ( " << secs40 << " seconds ), checked against known sums;\n"
+				<< "\tat O( hi^(3/4) ), 2^48 about " << secs40 * 64.0 << " seconds.\n" );
+			Logger::WriteMessage( test_message.c_str( ) );
+			Logger::WriteMessage( L"Passed. Tested expected values, return value, and volatile register integrity: each via assert.\n\n" );
+		};
+
+		TEST_METHOD( ui512sv_04_lucy_performance )
+		{
+			// Performance timing tests.
+			// Note: these tests are not pass/fail, they are informational only
+
+			Logger::WriteMessage( L"Sum of primes ( Lucy_Hedgehog ) function performance timing test.\n\n" );
+
+			Logger::WriteMessage( L"First run.\n" );
+			perf_stats No1 = Perf_Test_Parms [ 0 ];
+			ui512_Unit_Tests::RunStats( &No1, LucySum );
+
+			Logger::WriteMessage( L"Second run.\n" );
+			perf_stats No2 = Perf_Test_Parms [ 1 ];
+			RunStats( &No2, LucySum );
+
+			Logger::WriteMessage( L"Third run.\n" );
+			perf_stats No3 = Perf_Test_Parms [ 2 ];
+			RunStats( &No3, LucySum );
+		};
+
+		TEST_METHOD( ui512sv_05_checkpoint )
+		{
+			// sum_primes_checkpoint_u, sum_primes_resume_u tests
+			// Note: ui512sv_01 and ui512sv_03 must pass before these tests
+			regs r_before {};
+			regs r_after {};
+			const u64 count = 4;
+			const u64 lo = 1000000007, hi = lo + ( 1ull << 27 );
+			alignas ( 64 ) u64 image [ 8 + 16 * count ];
+			alignas ( 64 ) u64 loaded [ 8 + 16 * count ];
+			alignas ( 64 ) u64 bad [ 8 + 16 * count ];
+			alignas ( 64 ) u64 sum [ 16 ];
+			vector<sieve_worker> workers( count );
+			for ( auto& w : workers )
+			{
+				w.work = AllocSieveWork( hi );
+			};
+
+			// 1. start on threads, stop after some chunks, and save
+			sieve_job job { lo, hi, 1ull << 20, 0, count, workers.data( ), 0, 0 };
+			Assert::AreEqual( s16( 0 ), sum_primes_init_u( &job ), L"Return code failed init" );
+			vector<thread> running;
+			vector<s16> rets( count, -2 );
+			for ( u64 i = 0; i < count; i++ )
+			{
+				running.emplace_back( [ &job, &rets, i ]( ) { rets [ i ] = sum_primes_worker_u( &job, i ); } );
+			};
+			u64 done = 0;
+			while ( done < 16 && done < job.nchunks )
+			{
+				this_thread::yield( );
+				done = 0;
+				for ( auto& w : workers )
+				{
+					done += atomic_ref<u64>( w.chunks ).load( );
+				};
+			};
+			atomic_ref<u64>( job.stop ).store( 1 );
+			done = 0;
+			for ( u64 i = 0; i < count; i++ )
+			{
+				running [ i ].join( );
+				Assert::IsTrue( rets [ i ] == 0 || rets [ i ] == 1, _MSGW( L"Return code failed stopped worker " << i ) );
+				done += workers [ i ].chunks;
+			};
+			reg_verify( ( u64* ) &r_before );
+			s16 ret = sum_primes_checkpoint_u( image, &job );
+			reg_verify( ( u64* ) &r_after );
+			Assert::IsTrue( r_before.AreEqual( &r_after ), L"Register validation failed" );
+			Assert::AreEqual( s16( 0 ), ret, L"Return code failed checkpoint" );
+			for ( u64 i = 0; i < count; i++ )
+			{
+				Assert::AreEqual( u64( 0 ), image [ 8 + 16 * i + 9 ], L"Checkpoint failed, work address saved" );
+			};
+
+			// 2. to a file, as a caller would: write a new file, then rename it over the last checkpoint
+			filesystem::path path = filesystem::temp_directory_path( ) / "ui512sv_05.ckpt";
+			filesystem::path temp = path;
+			temp += ".tmp";
+			{
+				ofstream out( temp, ios::binary | ios::trunc );
+				out.write( ( const char* ) image, sizeof( image ) );
+				out.flush( );
+				Assert::IsTrue( out.good( ), L"Checkpoint file write failed" );
+			};
+			filesystem::rename( temp, path );
+			{
+				ifstream in( path, ios::binary );
+				in.read( ( char* ) loaded, sizeof( loaded ) );
+				Assert::IsTrue( in.gcount( ) == sizeof( loaded ), L"Checkpoint file read failed" );
+			};
+			filesystem::remove( path );
+
+			// 3. resume into fresh workers, finish, and check against sum_primes_u
+			vector<sieve_worker> again( count );
+			for ( u64 i = 0; i < count; i++ )
+			{
+				again [ i ].work = workers [ i ].work;
+			};
+			sieve_job resumed { 0, 0, 0, 0, count, again.data( ), 1, 0 };
+			reg_verify( ( u64* ) &r_before );
+			ret = sum_primes_resume_u( &resumed, loaded );
+			reg_verify( ( u64* ) &r_after );
+			Assert::IsTrue( r_before.AreEqual( &r_after ), L"Register validation failed" );
+			Assert::AreEqual( s16( 0 ), ret, L"Return code failed resume" );
+			Assert::AreEqual( lo, resumed.lo, L"Resume failed lo" );
+			Assert::AreEqual( hi, resumed.hi, L"Resume failed hi" );
+			Assert::AreEqual( job.chunk, resumed.chunk, L"Resume failed chunk" );
+			Assert::AreEqual( job.nchunks, resumed.nchunks, L"Resume failed chunks" );
+			Assert::AreEqual( u64( 0 ), resumed.stop, L"Resume failed stop" );
+			for ( u64 i = 0; i < count; i++ )
+			{
+				Assert::AreEqual( workers [ i ].range, again [ i ].range, L"Resume failed range" );
+				Assert::AreEqual( workers [ i ].chunks, again [ i ].chunks, L"Resume failed worker chunks" );
+				Assert::IsTrue( again [ i ].work == workers [ i ].work, L"Resume failed, work address changed" );
+			};
+			running.clear( );
+			for ( u64 i = 0; i < count; i++ )
+			{
+				running.emplace_back( [ &resumed, &rets, i ]( ) { rets [ i ] = sum_primes_worker_u( &resumed, i ); } );
+			};
+			u64 chunks = 0;
+			for ( u64 i = 0; i < count; i++ )
+			{
+				running [ i ].join( );
+				Assert::AreEqual( s16( 0 ), rets [ i ], _MSGW( L"Return code failed resumed worker " << i ) );
+				chunks += again [ i ].chunks;
+			};
+			Assert::AreEqual( resumed.nchunks, chunks, L"Chunks summed failed, resumed" );
+			sum_primes_combine_u( sum, &resumed );
+			_UI512( expected ) { 0 };
+			sum_primes_u( expected, lo, hi, workers [ 0 ].work );
+			for ( int j = 0; j < 8; j++ )
+			{
+				Assert::AreEqual( u64( 0 ), sum [ j ], _MSGW( L"Sum failed high half, resumed, word " << j ) );
+				Assert::AreEqual( expected [ j ], sum [ 8 + j ], _MSGW( L"Sum failed, resumed, word " << j ) );
+			};
+
+			// 4. rejected images: a changed byte, another version, another count of workers, not a checkpoint
+			memcpy( bad, image, sizeof( image ) );
+			( ( u8* ) bad ) [ 64 + 128 + 5 ] ^= 0x10;
+			Assert::AreEqual( s16( -1 ), sum_primes_resume_u( &resumed, bad ), L"Return code failed resume, changed byte" );
+			memcpy( bad, image, sizeof( image ) );
+			bad [ 1 ] = 2;
+			Assert::AreEqual( s16( -1 ), sum_primes_resume_u( &resumed, bad ), L"Return code failed resume, version" );
+			memcpy( bad, image, sizeof( image ) );
+			bad [ 0 ] = 0;
+			Assert::AreEqual( s16( -1 ), sum_primes_resume_u( &resumed, bad ), L"Return code failed resume, magic" );
+			resumed.count = count - 1;
+			Assert::AreEqual( s16( -1 ), sum_primes_resume_u( &resumed, image ), L"Return code failed resume, count of workers" );
+			resumed.count = count;
+			Assert::AreEqual( s16( 0 ), sum_primes_resume_u( &resumed, image ), L"Return code failed resume, original image" );
+
+			for ( auto& w : workers )
+			{
+				FreeSieveWork( w.work );
+			};
+			string test_message = _MSGA( "Checkpoint and resume function testing.\n\nStopped " << count << " workers after " << done << " of "
+				<< job.nchunks << " chunks, saved, written to a file and renamed, read back, resumed into fresh workers,\n"
+				<< "\tfinished and checked against sum_primes_u; changed byte, version, magic, and count of workers rejected.\n" );
+			Logger::WriteMessage( test_message.c_str( ) );
+			Logger::WriteMessage( L"Passed. Tested expected values, return value, and volatile register integrity: each via assert.\n\n" );
+		};
+
+		TEST_METHOD( ui512sv_06_presieve )
+		{
+			// presieve_u tests
+			regs r_before {};
+			regs r_after {};
+			u64 seed = 0;
+			const u64 maxblocks = 20;
+			alignas ( 64 ) u64 seg [ maxblocks * 8 + 8 ];
+			const u64 residues [ 8 ] = { 1, 7, 11, 13, 17, 19, 23, 29 };
+			const u64 small [ 8 ] = { 7, 11, 13, 17, 19, 23, 29, 31 };
+			u64 firsts [ 24 ] = { 0, 1, 2, 63, 76, 77, 221, 437, 899, 77 * 221, 1000003, ( 1ull << 47 ) / 30, ( 1ull << 52 ) / 30 - maxblocks * 64 };
+			for ( int i = 13; i < 24; i++ )
+			{
+				firsts [ i ] = RandomU64( &seed ) >> 12;
+			};
+			int runs = 0;
+			for ( u64 first : firsts )
+			{
+				for ( u64 blocks = 0; blocks <= maxblocks; blocks += ( blocks < 3 ) ? 1 : 7 )
+				{
+					memset( seg, 0x5A, sizeof( seg ) );
+					u64 count = u64_Max;
+					reg_verify( ( u64* ) &r_before );
+					s16 ret = presieve_u( seg, first, blocks, &count );
+					reg_verify( ( u64* ) &r_after );
+					Assert::IsTrue( r_before.AreEqual( &r_after ), L"Register validation failed" );
+					Assert::AreEqual( s16( 0 ), ret, L"Return code failed" );
+					const u8* bytes = ( const u8* ) seg;
+					u64 expected = 0;
+					for ( u64 k = 0; k < blocks * 64; k++ )
+					{
+						u8 want = 0;
+						for ( int b = 0; b < 8; b++ )
+						{
+							u64 n = 30 * ( first + k ) + residues [ b ];
+							bool keep = true;
+							for ( u64 p : small )
+							{
+								keep = keep && ( n == p || n % p != 0 );
+							};
+							if ( keep )
+							{
+								want |= u8( 1 << b );
+								expected++;
+							};
+						};
+						Assert::AreEqual( want, bytes [ k ], _MSGW( L"Pattern failed, first " << first << L", byte " << k ) );
+					};
+					Assert::AreEqual( u8( 0x5A ), bytes [ blocks * 64 ], _MSGW( L"Pre-sieve wrote past its blocks, first " << first ) );
+					Assert::AreEqual( expected, count, _MSGW( L"Count failed, first " << first << L", blocks " << blocks ) );
+					runs++;
+				};
+			};
+
+			string test_message = _MSGA( "Pre-sieve function testing.\n\n" << runs << " runs: first bytes 0, 1 ( the primes 7 to 31 themselves ), "
+				<< "at and around the pattern periods, near 2^47 and 2^52, random; 0 to " << maxblocks << " blocks,\n"
+				<< "\teach byte checked against trial division by 7 to 31, the count of bits set, no write past the blocks.\n" );
+			Logger::WriteMessage( test_message.c_str( ) );
+			Logger::WriteMessage( L"Passed. Tested expected values, return value, and volatile register integrity: each via assert.\n\n" );
+		};
+
+		TEST_METHOD( ui512sv_06_presieve_performance )
+		{
+			// Performance timing tests.
+			// Note: these tests are not pass/fail, they are informational only
+
+			Logger::WriteMessage( L"Pre-sieve function performance timing test.\n\n" );
+
+			Logger::WriteMessage( L"First run.\n" );
+			perf_stats No1 = Perf_Test_Parms [ 0 ];
+			ui512_Unit_Tests::RunStats( &No1, Presieve );
+
+			Logger::WriteMessage( L"Second run.\n" );
+			perf_stats No2 = Perf_Test_Parms [ 1 ];
+			RunStats( &No2, Presieve );
+
+			Logger::WriteMessage( L"Third run.\n" );
+			perf_stats No3 = Perf_Test_Parms [ 2 ];
+			RunStats( &No3, Presieve );
+		};
+	};
+};
@@ -270,5 +270,95 @@ namespace ui512_Unit_Tests
 			perf_stats No3 = Perf_Test_Parms[2];
 			RunStats(&No3, lsb);
 		};
+
+		TEST_METHOD(ui512bits_05_popcount)
+		{
+			// exercises whichever path the library was assembled with: the scalar POPCNT tree by default,
+			// the VPOPCNTQ path only with __UseZ and __UsePOPCNTDQ both set in ui512_compile_time_options.inc
+			_UI512(num1) { 0 };
+			_UI512(nobit) { 0 };
+			_UI512(allbits) { ~0ull, ~0ull, ~0ull, ~0ull, ~0ull, ~0ull, ~0ull, ~0ull };
+			_UI512(choosebit) { 0, 9, 0, 0, 0, 0x8000000000000000, 0xff, 0 };
+			u64 seed = 0;
+			regs r_before{};
+			regs r_after{};
+			s16 count = 0;
+			s16 expectedcount = 0;
+
+			Assert::AreEqual(s16(0), popcount_u(nobit), L"Count failed no bits");
+			Assert::AreEqual(s16(512), popcount_u(allbits), L"Count failed all bits");
+			Assert::AreEqual(s16(11), popcount_u(choosebit), L"Count failed chosen bits");
+
+			// every single bit, then bits added one at a time
+			for (int j = 0; j < 8; j++)
+			{
+				for (int k = 0; k < 64; k++)
+				{
+					num1[j] = 1ull << k;
+					Assert::AreEqual(s16(1), popcount_u(num1), L"Count failed single bit");
+					num1[j] = 0;
+				};
+			};
+			for (int j = 0; j < 8; j++)
+			{
+				for (int k = 0; k < 64; k++)
+				{
+					num1[j] |= 1ull << k;
+					Assert::AreEqual(s16(j * 64 + k + 1), popcount_u(num1), L"Count failed accumulated bits");
+				};
+			};
+
+			for (int i = 0; i < test_run_count; i++)
+			{
+				expectedcount = 0;
+				for (int j = 0; j < 8; j++)
+				{
+					num1[j] = RandomU64(&seed);
+					if (i % 3 == 1)
+					{
+						num1[j] &= RandomU64(&seed);
+					}
+					else if (i % 3 == 2)
+					{
+						num1[j] |= RandomU64(&seed);
+					};
+					for (u64 v = num1[j]; v != 0; v &= v - 1)
+					{
+						expectedcount++;
+					};
+				};
+				reg_verify((u64*)&r_before);
+				count = popcount_u(num1);
+				reg_verify((u64*)&r_after);
+				Assert::AreEqual(expectedcount, count);
+				Assert::IsTrue(r_before.AreEqual(&r_after), L"Register validation failed");
+			};
+
+			string test_message = "Population count function testing. Ran tests " + to_string(test_run_count) + " times, each with pseudo random values, sparse and dense. Every bit location checked.\n";
+			Logger::WriteMessage(test_message.c_str());
+			Logger::WriteMessage(L"Passed. Register integrity checked, tested expected values via assert.\n");
+		};
+
+		TEST_METHOD(ui512bits_06_popcount_performance)
+		{
+			// Performance timing tests.
+			// Ref: "Essentials of Modern Business Statistics", 7th Ed, by Anderson, Sweeney, Williams, Camm, Cochran. South-Western, 2015
+			// Sections 3.2, 3.3, 3.4
+			// Note: these tests are not pass/fail, they are informational only
+
+			Logger::WriteMessage(L"Population count function performance timing test.\n\n");
+
+			Logger::WriteMessage(L"First run.\n");
+			perf_stats No1 = Perf_Test_Parms[0];
+			ui512_Unit_Tests::RunStats(&No1, popcount);
+
+			Logger::WriteMessage(L"Second run.\n");
+			perf_stats No2 = Perf_Test_Parms[1];
+			RunStats(&No2, popcount);
+
+			Logger::WriteMessage(L"Third run.\n");
+			perf_stats No3 = Perf_Test_Parms[2];
+			RunStats(&No3, popcount);
+		};
 	};
 };
@@ -0,0 +1,225 @@
+//		ui512_unit_tests_x25519
+//
+//		File:			ui512_unit_tests_x25519.cpp
+//		Author:			John G.Lynch
+//		Legal:			Copyright @2025, per MIT License below
+//		Date:			October 19, 2026
+//
+//		ui512 is a small project to provide basic operations for a variable type of unsigned 512 bit integer.
+//		The basic operations : zero, copy, compare, add, subtract.
+//		Other optional modules provide bit ops and multiply / divide.
+//		It is written in assembly language, using the MASM ( ml64 ) assembler provided as an option within Visual Studio.
+//		( currently using VS Community 2022 17.14.10)
+//		It provides external signatures that allow linkage to C and C++ programs,
+//		where a shell / wrapper could encapsulate the methods as part of an object.
+//		It has assembly time options directing the use of Intel processor extensions : AVX4, AVX2, SIMD, or none :
+//		( Z ( 512 ), Y ( 256 ), or X ( 128 ) registers, or regular Q ( 64bit ) ).
+//		If processor extensions are used, the caller must align the variables declared and passed
+//		on the appropriate byte boundary ( e.g. alignas 64 for 512 )
+//		These modules (in total) are very light-weight ( less than 10K bytes ) and relatively fast,
+//		but is not intended for all processor types or all environments.
+//
+//		Intended use cases :
+//			1.) a "sum of primes" for primes up to 2 ^ 48.
+//			2.) elliptical curve cryptography(ECC)
+//
+//		This sub - project: ui512aTests, is a unit test project that invokes each of the routines in the ui512a assembly.
+//		It runs each assembler proc with pseudo-random values.
+//		It validates ( asserts ) expected and returned results.
+//		It also runs each repeatedly for comparative timings.
+//		It provides a means to invoke and debug.
+//		It illustrates calling the routines from C++.
+
+#include "pch.h"
+#include "CppUnitTest.h"
+#include "ui512_externs.h"
+#include "ui512_unit_tests.h"
+
+#include <cstring>
+#include <sstream>
+#include <format>
+#include <chrono>
+#include "intrin.h"
+
+using namespace std;
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+namespace ui512_Unit_Tests
+{
+	/// <summary>
+	/// ui512 from the hex of 32 little-endian bytes (as written in RFC 7748), into the low four QWORDS
+	/// </summary>
+	static void FromLittleEndian( u64* value, const char* hex )
+	{
+		for ( int j = 0; j < 8; j++ )
+		{
+			value [ j ] = 0;
+		};
+		for ( int b = 0; b < 32; b++ )
+		{
+			u64 byte = 0;
+			for ( int d = 0; d < 2; d++ )
+			{
+				const char ch = hex [ 2 * b + d ];
+				byte = byte * 16 + u64( ( ch <= '9' ) ? ch - '0' : ( ch | 0x20 ) - 'a' + 10 );
+			};
+			value [ 7 - b / 8 ] |= byte << ( 8 * ( b % 8 ) );
+		};
+	};
+
+	/// <summary>
+	/// Assert result matches expected, given as hex of 32 little-endian bytes
+	/// </summary>
+	static void CheckX25519( const u64* result, const char* expected_hex, const char* test, int run )
+	{
+		_UI512( expected ) { 0 };
+		FromLittleEndian( expected, expected_hex );
+		for ( int j = 0; j < 8; j++ )
+		{
+			Assert::AreEqual( expected [ j ], result [ j ], _MSGW( L"Result at word #" << j << " failed " << test << " test on run #" << run ) );
+		};
+	};
+
+	TEST_CLASS( ui512_unit_tests_x25519 )
+	{
+		TEST_METHOD( ui512x25519_01_known_answer )
+		{
+			// x25519_u tests, RFC 7748 section 5.2 and 6.1 vectors
+			// Note: mult_uT64 and reduce_25519_u must pass testing before these tests
+			regs r_before {};
+			regs r_after {};
+			_UI512( scalar ) { 0 };
+			_UI512( u ) { 0 };
+			_UI512( result ) { 0 };
+
+			// 1. the two single function vectors
+			FromLittleEndian( scalar, "a546e36bf0527c9d3b16154b82465edd62144c0ac1fc5a18506a2244ba449ac4" );
+			FromLittleEndian( u, "e6db6867583030db3594c1a424b15f7c726624ec26b3353b10a903a6d0ab1c4c" );
+			reg_verify( ( u64* ) &r_before );
+			s16 ret = x25519_u( result, scalar, u );
+			reg_verify( ( u64* ) &r_after );
+			Assert::IsTrue( r_before.AreEqual( &r_after ), L"Register validation failed" );
+			Assert::AreEqual( s16( 0 ), ret, L"Return code failed first vector test" );
+			CheckX25519( result, "c3da55379de9c6908e94ea4df28d084f32eccf03491c71f754b4075577a28552", "first vector", 0 );
+			FromLittleEndian( scalar, "4b66e9d4d1b4673c5ad22691957d6af5c11b6421e0ea01d42ca4169e7918ba0d" );
+			FromLittleEndian( u, "e5210f12786811d3f4b7959d0538ae2c31dbe7106fc03c3efc4cd549c715a493" );	// bit 255 set, to be ignored
+			ret = x25519_u( result, scalar, u );
+			Assert::AreEqual( s16( 0 ), ret, L"Return code failed second vector test" );
+			CheckX25519( result, "95cbde9476e8907d7aade45cb4b873f88b595a68799fa152e6f8f7647aac7957", "second vector", 0 );
+
+			// 2. iterated: k = x25519( k, u ), u = old k, from k = u = 9; after 1 and 1000 iterations
+			_UI512( k ) { 0 };
+			_UI512( next ) { 0 };
+			set_uT64( k, 9ull );
+			set_uT64( u, 9ull );
+			for ( int i = 1; i <= 1000; i++ )
+			{
+				x25519_u( next, k, u );
+				copy_u( u, k );
+				copy_u( k, next );
+				if ( i == 1 )
+				{
+					CheckX25519( k, "422c8e7a6227d7bca1350b3e2bb7279f7897b87bb6854b783c60e80311ae3079", "one iteration", i );
+				};
+			};
+			CheckX25519( k, "684cf59ba83309552800ef566f2f4d3c1c3887c49360e3875f2eb94d99532c51", "1000 iterations", 1000 );
+
+			// 3. Diffie-Hellman: public keys from the base point ( u = 9 ), shared secret both ways
+			_UI512( alice ) { 0 };
+			_UI512( bob ) { 0 };
+			_UI512( alice_public ) { 0 };
+			_UI512( bob_public ) { 0 };
+			FromLittleEndian( alice, "77076d0a7318a57d3c16c17251b26645df4c2f87ebc0992ab177fba51db92c2a" );
+			FromLittleEndian( bob, "5dab087e624a8a4b79e17f8b83800ee66f3bb1292618b6fd1c2f8b27ff88e0eb" );
+			set_uT64( u, 9ull );
+			x25519_u( alice_public, alice, u );
+			CheckX25519( alice_public, "8520f0098930a754748b7ddcb43ef75a0dbf3a0d26381af4eba4a98eaa9b4e6a", "Alice public key", 0 );
+			x25519_u( bob_public, bob, u );
+			CheckX25519( bob_public, "de9edb7d7b7dc1b4d35b61c2ece435373f8343c85b78674dadfc7e146f882b4f", "Bob public key", 0 );
+			x25519_u( result, alice, bob_public );
+			CheckX25519( result, "4a5d9d5ba4ce2de1728e3bf480350f25e07e21c947d19e3376f09b3c1e161742", "Alice shared secret", 0 );
+			x25519_u( bob_public, bob, alice_public );											// in place
+			CheckX25519( bob_public, "4a5d9d5ba4ce2de1728e3bf480350f25e07e21c947d19e3376f09b3c1e161742", "Bob shared secret, in place", 0 );
+
+			string test_message = _MSGA( "X25519 function testing.\n\nRFC 7748 vectors:\n\ttwo single function vectors ( second with u bit 255 set ),\n"
+				<< "\titerated 1 and 1000 times,\n\tDiffie-Hellman public keys and shared secret, both ways, also in place.\n" );
+			Logger::WriteMessage( test_message.c_str( ) );
+			Logger::WriteMessage( L"Passed. Tested expected values, return value, and volatile register integrity: each via assert.\n\n" );
+		};
+
+		TEST_METHOD( ui512x25519_02_exchange )
+		{
+			// x25519_u tests, random key pairs agree; small order u; non-canonical u
+			u64 seed = 0;
+			_UI512( a ) { 0 };
+			_UI512( b ) { 0 };
+			_UI512( base ) { 0 };
+			_UI512( a_public ) { 0 };
+			_UI512( b_public ) { 0 };
+			_UI512( a_shared ) { 0 };
+			_UI512( b_shared ) { 0 };
+			_UI512( u ) { 0 };
+			int adjtest_run_count = test_run_count / 50;
+			set_uT64( base, 9ull );
+
+			// 1. random scalars ( unclamped, all 512 bits filled: only the low 256 are referenced ): a ( b G ) = b ( a G )
+			for ( int i = 0; i < adjtest_run_count; i++ )
+			{
+				RandomFill( a, &seed );
+				RandomFill( b, &seed );
+				Assert::AreEqual( s16( 0 ), x25519_u( a_public, a, base ), _MSGW( L"Return code failed public key test on run #" << i ) );
+				x25519_u( b_public, b, base );
+				x25519_u( a_shared, a, b_public );
+				x25519_u( b_shared, b, a_public );
+				for ( int j = 0; j < 8; j++ )
+				{
+					Assert::AreEqual( a_shared [ j ], b_shared [ j ], _MSGW( L"Shared secret at word #" << j << " failed exchange test on run #" << i ) );
+				};
+				Assert::AreEqual( s16( -1 ), compare_u( a_shared, prime_25519 ), _MSGW( L"Result not reduced on run #" << i ) );
+			};
+
+			// 2. u of zero and of one ( small order ): result zero, return -1
+			zero_u( u );
+			Assert::AreEqual( s16( -1 ), x25519_u( a_shared, a, u ), L"Return code failed u of zero test" );
+			Assert::AreEqual( s16( 0 ), compare_uT64( a_shared, 0ull ), L"Result failed u of zero test" );
+			set_uT64( u, 1ull );
+			Assert::AreEqual( s16( -1 ), x25519_u( a_shared, a, u ), L"Return code failed u of one test" );
+			Assert::AreEqual( s16( 0 ), compare_uT64( a_shared, 0ull ), L"Result failed u of one test" );
+
+			// 3. non-canonical u: u + p gives the same result as u
+			set_uT64( u, 9ull );
+			x25519_u( a_public, a, u );
+			add_u( u, u, prime_25519 );
+			x25519_u( b_public, a, u );
+			for ( int j = 0; j < 8; j++ )
+			{
+				Assert::AreEqual( a_public [ j ], b_public [ j ], _MSGW( L"Result at word #" << j << " failed non-canonical u test" ) );
+			};
+
+			string test_message = _MSGA( "X25519 key exchange testing.\n\n" << adjtest_run_count << " pseudo random scalar pairs, shared secrets agree and are reduced.\n"
+				<< "u of zero, one: zero result, return -1.\nu + p as u.\n" );
+			Logger::WriteMessage( test_message.c_str( ) );
+			Logger::WriteMessage( L"Passed. Tested expected values, return value: each via assert.\n\n" );
+		};
+
+		TEST_METHOD( ui512x25519_02_exchange_performance )
+		{
+			// Performance timing tests.
+			// Note: these tests are not pass/fail, they are informational only
+
+			Logger::WriteMessage( L"X25519 function performance timing test.\n\n" );
+
+			Logger::WriteMessage( L"First run.\n" );
+			perf_stats No1 = Perf_Test_Parms [ 0 ];
+			ui512_Unit_Tests::RunStats( &No1, X25519 );
+
+			Logger::WriteMessage( L"Second run.\n" );
+			perf_stats No2 = Perf_Test_Parms [ 1 ];
+			RunStats( &No2, X25519 );
+
+			Logger::WriteMessage( L"Third run.\n" );
+			perf_stats No3 = Perf_Test_Parms [ 2 ];
+			RunStats( &No3, X25519 );
+		};
+	};
+};
@@ -0,0 +1,433 @@
+;
+;			ui512_x25519
+;
+;--------------------------------------------------------------------------------------------------------------------------------------------------------------
+;
+;			File:			ui512_x25519.asm
+;			Author:			John G. Lynch
+;			Legal:			Copyright @2025, per MIT License below
+;			Date:			October 19, 2026
+;
+;			X25519 Diffie-Hellman function (RFC 7748): the Montgomery ladder on Curve25519, x coordinate only, p = 2^255 - 19.
+;
+;			Field elements use a 4 limb layout inside the ui512: the value is in the low order four QWORDS ( words 4 thru 7 ),
+;			the leading four QWORDS are zero, so an element can be handed to any of the ui512 routines as is.
+;			Within the ladder elements are kept below 2^256, not necessarily below p (2^256 = 38 mod p, so a carry out of
+;			the top limb is folded back in as 38); the result is fully reduced once, at the end.
+;
+;			The field kernels (multiply, add, subtract, conditional swap) are specialized to the four limbs, with no loops and no
+;			branches on the data. The multiply by a24 = 121665 is done by mult_uT64, and reduced by reduce_25519_u.
+;			Every ladder step is the same fixed sequence of kernels; the scalar bit selects only the swap mask.
+
+				INCLUDE			ui512_legalnotes.inc
+				INCLUDE			ui512_compile_time_options.inc
+				INCLUDE			ui512_macros.inc
+				INCLUDE			ui512_externs.inc
+.NOLISTIF
+				OPTION			CASEMAP:NONE
+
+;--------------------------------------------------------------------------------------------------------------------------------------------------------------
+;			Field operations on locals ( low four QWORDS of each ), for x25519_u
+;
+;			X_Mul			-	dest = a * b, via the X_Mul25519 kernel; all but RBP and RSP are used and not restored
+;			X_Sqr			-	dest = a^2
+;			X_SqrN			-	a = a^( 2^n ), n squarings, count kept in l_Ptr.cnt
+;			X_Add			-	dest = a + b, carry folded back as 38 (twice at most, the second cannot carry)
+;			X_Sub			-	dest = a - b, borrow folded back as - 38 (twice at most, the second cannot borrow)
+;			X_CSwap			-	swap a and b if mask (in R8) is all ones, leave them if zero; R9 thru R11, RAX, RDX used
+;
+X_Mul			MACRO			dest:REQ, a:REQ, b:REQ
+				LEA				RCX, dest
+				LEA				R8, a
+				LEA				R9, b
+				CALL			X_Mul25519
+				ENDM
+
+X_Sqr			MACRO			dest:REQ, a:REQ
+				X_Mul			dest, a, a
+				ENDM
+
+X_SqrN			MACRO			a:REQ, n:REQ
+				LOCAL			sqr
+				MOV				l_Ptr.cnt, n
+sqr:			X_Sqr			a, a
+				DEC				l_Ptr.cnt
+				JNZ				sqr
+				ENDM
+
+X_Add			MACRO			dest:REQ, a:REQ, b:REQ
+				LEA				R8, a
+				LEA				R9, b
+				LEA				RCX, dest
+				MOV				R10, Q_PTR [ R8 ] [ 7 * 8 ]
+				MOV				R11, Q_PTR [ R8 ] [ 6 * 8 ]
+				MOV				RDX, Q_PTR [ R8 ] [ 5 * 8 ]
+				MOV				R8, Q_PTR [ R8 ] [ 4 * 8 ]
+				ADD				R10, Q_PTR [ R9 ] [ 7 * 8 ]
+				ADC				R11, Q_PTR [ R9 ] [ 6 * 8 ]
+				ADC				RDX, Q_PTR [ R9 ] [ 5 * 8 ]
+				ADC				R8, Q_PTR [ R9 ] [ 4 * 8 ]
+				Fold38			ADD, ADC
+				ENDM
+
+X_Sub			MACRO			dest:REQ, a:REQ, b:REQ
+				LEA				R8, a
+				LEA				R9, b
+				LEA				RCX, dest
+				MOV				R10, Q_PTR [ R8 ] [ 7 * 8 ]
+				MOV				R11, Q_PTR [ R8 ] [ 6 * 8 ]
+				MOV				RDX, Q_PTR [ R8 ] [ 5 * 8 ]
+				MOV				R8, Q_PTR [ R8 ] [ 4 * 8 ]
+				SUB				R10, Q_PTR [ R9 ] [ 7 * 8 ]
+				SBB				R11, Q_PTR [ R9 ] [ 6 * 8 ]
+				SBB				RDX, Q_PTR [ R9 ] [ 5 * 8 ]
+				SBB				R8, Q_PTR [ R9 ] [ 4 * 8 ]
+				Fold38			SUB, SBB
+				ENDM
+
+;			Fold a carry (or borrow) out of R8:RDX:R11:R10 back in as 38, and store at RCX; RAX used
+Fold38			MACRO			op:REQ, opc:REQ
+				SBB				RAX, RAX
+				AND				EAX, 38
+				op				R10, RAX
+				opc				R11, 0
+				opc				RDX, 0
+				opc				R8, 0
+				SBB				RAX, RAX
+				AND				EAX, 38
+				op				R10, RAX
+				MOV				Q_PTR [ RCX ] [ 7 * 8 ], R10
+				MOV				Q_PTR [ RCX ] [ 6 * 8 ], R11
+				MOV				Q_PTR [ RCX ] [ 5 * 8 ], RDX
+				MOV				Q_PTR [ RCX ] [ 4 * 8 ], R8
+				ENDM
+
+X_CSwap			MACRO			a:REQ, b:REQ
+				LEA				R9, a
+				LEA				R10, b
+				FOR				idx, < 7, 6, 5, 4 >
+				MOV				RAX, Q_PTR [ R9 ] [ idx * 8 ]
+				MOV				RDX, Q_PTR [ R10 ] [ idx * 8 ]
+				MOV				R11, RAX
+				XOR				R11, RDX
+				AND				R11, R8
+				XOR				RAX, R11
+				XOR				RDX, R11
+				MOV				Q_PTR [ R9 ] [ idx * 8 ], RAX
+				MOV				Q_PTR [ R10 ] [ idx * 8 ], RDX
+				ENDM
+				ENDM
+
+ui512_x25519	SEGMENT			PARA 'CODE'
+
+;--------------------------------------------------------------------------------------------------------------------------------------------------------------
+;			X_Mul25519		-	field multiply kernel, dest = a * b (mod p), result below 2^256
+;			dest			-	Address of element to receive the product (in RCX)
+;			a, b			-	Addresses of elements (in R8, R9), may be the same, may be dest
+;
+;			Note: internal to x25519_u, not a public procedure. It uses the non-volatile registers RBX, RSI, RDI, R12 thru R15,
+;			saved once by x25519_u, rather than saving them on each of the several thousand calls.
+;			Schoolbook 4 x 4 limb product, row by row, into R10 thru R15, RBX, RDI; then the high four limbs times 38 folded into the
+;			low four, then the carry limb times 38, then any final carry as 38 (which cannot carry again).
+;
+				ALIGN			16
+X_Mul25519		PROC			PRIVATE
+				MOV				RAX, Q_PTR [ R8 ] [ 7 * 8 ]
+				MUL				Q_PTR [ R9 ] [ 7 * 8 ]
+				MOV				R10, RAX
+				MOV				RSI, RDX
+				MOV				RAX, Q_PTR [ R8 ] [ 6 * 8 ]
+				MUL				Q_PTR [ R9 ] [ 7 * 8 ]
+				ADD				RAX, RSI
+				ADC				RDX, 0
+				MOV				R11, RAX
+				MOV				RSI, RDX
+				MOV				RAX, Q_PTR [ R8 ] [ 5 * 8 ]
+				MUL				Q_PTR [ R9 ] [ 7 * 8 ]
+				ADD				RAX, RSI
+				ADC				RDX, 0
+				MOV				R12, RAX
+				MOV				RSI, RDX
+				MOV				RAX, Q_PTR [ R8 ] [ 4 * 8 ]
+				MUL				Q_PTR [ R9 ] [ 7 * 8 ]
+				ADD				RAX, RSI
+				ADC				RDX, 0
+				MOV				R13, RAX
+				MOV				R14, RDX
+				MOV				RAX, Q_PTR [ R8 ] [ 7 * 8 ]
+				MUL				Q_PTR [ R9 ] [ 6 * 8 ]
+				ADD				R11, RAX
+				ADC				RDX, 0
+				MOV				RSI, RDX
+				MOV				RAX, Q_PTR [ R8 ] [ 6 * 8 ]
+				MUL				Q_PTR [ R9 ] [ 6 * 8 ]
+				ADD				RAX, RSI
+				ADC				RDX, 0
+				ADD				R12, RAX
+				ADC				RDX, 0
+				MOV				RSI, RDX
+				MOV				RAX, Q_PTR [ R8 ] [ 5 * 8 ]
+				MUL				Q_PTR [ R9 ] [ 6 * 8 ]
+				ADD				RAX, RSI
+				ADC				RDX, 0
+				ADD				R13, RAX
+				ADC				RDX, 0
+				MOV				RSI, RDX
+				MOV				RAX, Q_PTR [ R8 ] [ 4 * 8 ]
+				MUL				Q_PTR [ R9 ] [ 6 * 8 ]
+				ADD				RAX, RSI
+				ADC				RDX, 0
+				ADD				R14, RAX
+				ADC				RDX, 0
+				MOV				R15, RDX
+				MOV				RAX, Q_PTR [ R8 ] [ 7 * 8 ]
+				MUL				Q_PTR [ R9 ] [ 5 * 8 ]
+				ADD				R12, RAX
+				ADC				RDX, 0
+				MOV				RSI, RDX
+				MOV				RAX, Q_PTR [ R8 ] [ 6 * 8 ]
+				MUL				Q_PTR [ R9 ] [ 5 * 8 ]
+				ADD				RAX, RSI
+				ADC				RDX, 0
+				ADD				R13, RAX
+				ADC				RDX, 0
+				MOV				RSI, RDX
+				MOV				RAX, Q_PTR [ R8 ] [ 5 * 8 ]
+				MUL				Q_PTR [ R9 ] [ 5 * 8 ]
+				ADD				RAX, RSI
+				ADC				RDX, 0
+				ADD				R14, RAX
+				ADC				RDX, 0
+				MOV				RSI, RDX
+				MOV				RAX, Q_PTR [ R8 ] [ 4 * 8 ]
+				MUL				Q_PTR [ R9 ] [ 5 * 8 ]
+				ADD				RAX, RSI
+				ADC				RDX, 0
+				ADD				R15, RAX
+				ADC				RDX, 0
+				MOV				RBX, RDX
+				MOV				RAX, Q_PTR [ R8 ] [ 7 * 8 ]
+				MUL				Q_PTR [ R9 ] [ 4 * 8 ]
+				ADD				R13, RAX
+				ADC				RDX, 0
+				MOV				RSI, RDX
+				MOV				RAX, Q_PTR [ R8 ] [ 6 * 8 ]
+				MUL				Q_PTR [ R9 ] [ 4 * 8 ]
+				ADD				RAX, RSI
+				ADC				RDX, 0
+				ADD				R14, RAX
+				ADC				RDX, 0
+				MOV				RSI, RDX
+				MOV				RAX, Q_PTR [ R8 ] [ 5 * 8 ]
+				MUL				Q_PTR [ R9 ] [ 4 * 8 ]
+				ADD				RAX, RSI
+				ADC				RDX, 0
+				ADD				R15, RAX
+				ADC				RDX, 0
+				MOV				RSI, RDX
+				MOV				RAX, Q_PTR [ R8 ] [ 4 * 8 ]
+				MUL				Q_PTR [ R9 ] [ 4 * 8 ]
+				ADD				RAX, RSI
+				ADC				RDX, 0
+				ADD				RBX, RAX
+				ADC				RDX, 0
+				MOV				RDI, RDX
+				MOV				EAX, 38								; fold: low + high * 38
+				MUL				R14
+				ADD				R10, RAX
+				ADC				RDX, 0
+				MOV				RSI, RDX
+				MOV				EAX, 38
+				MUL				R15
+				ADD				RAX, RSI
+				ADC				RDX, 0
+				ADD				R11, RAX
+				ADC				RDX, 0
+				MOV				RSI, RDX
+				MOV				EAX, 38
+				MUL				RBX
+				ADD				RAX, RSI
+				ADC				RDX, 0
+				ADD				R12, RAX
+				ADC				RDX, 0
+				MOV				RSI, RDX
+				MOV				EAX, 38
+				MUL				RDI
+				ADD				RAX, RSI
+				ADC				RDX, 0
+				ADD				R13, RAX
+				ADC				RDX, 0
+				MOV				RSI, RDX
+				IMUL			RSI, RSI, 38						; carry limb, times 38
+				ADD				R10, RSI
+				ADC				R11, 0
+				ADC				R12, 0
+				ADC				R13, 0
+				SBB				RAX, RAX
+				AND				EAX, 38
+				ADD				R10, RAX
+				MOV				Q_PTR [ RCX ] [ 7 * 8 ], R10
+				MOV				Q_PTR [ RCX ] [ 6 * 8 ], R11
+				MOV				Q_PTR [ RCX ] [ 5 * 8 ], R12
+				MOV				Q_PTR [ RCX ] [ 4 * 8 ], R13
+				RET
+X_Mul25519		ENDP
+
+;--------------------------------------------------------------------------------------------------------------------------------------------------------------
+;			EXTERNDEF		x25519_u:PROC				; s16 x25519_u( u64* out, u64* scalar, u64* u );
+;			x25519_u		-	X25519 function (RFC 7748), out = u coordinate of scalar times the point with u coordinate u
+;			Prototype:		-	s16 x25519_u( u64* out, u64* scalar, u64* u );
+;			out				-	Address of 8 QWORDS to receive the result (in RCX), fully reduced, may be the same as u or scalar
+;			scalar			-	Address of 8 QWORDS, the scalar (in RDX), as decoded from its 32 little-endian bytes; clamped here
+;			u				-	Address of 8 QWORDS, the u coordinate (in R8), as decoded from its 32 bytes; bit 255 is ignored
+;			returns			-	(0) for success, (-1) if the result is zero (u of small order), (GP_Fault) for mis-aligned parameter address
+;
+;			Note: with scalar of 9 ( the base point ), out is the public key for the scalar; with the peer's public key, the shared secret.
+;			Only the low order four QWORDS of scalar and u are referenced. The caller should reject a shared secret of zero ( return -1 ).
+;			255 ladder steps, each: two conditional swaps, 4 multiplies, 4 squares, the a24 multiply, 4 adds, 4 subtracts,
+;			then one inversion by Fermat ( 254 squares, 11 multiplies ). Run time does not depend on the scalar.
+;
+x25519_Locals	STRUCT
+k				QWORD			8 dup (?)							; clamped scalar
+x1				QWORD			8 dup (?)
+x2				QWORD			8 dup (?)
+z2				QWORD			8 dup (?)
+x3				QWORD			8 dup (?)
+z3				QWORD			8 dup (?)
+ta				QWORD			8 dup (?)							; A = x2 + z2, then AA, later inversion temporaries
+tb				QWORD			8 dup (?)							; B = x2 - z2, then BB
+tc				QWORD			8 dup (?)							; C = x3 + z3, then DA + CB
+td				QWORD			8 dup (?)							; D = x3 - z3, then DA - CB
+da				QWORD			8 dup (?)
+cb				QWORD			8 dup (?)
+te				QWORD			8 dup (?)							; E = AA - BB
+prod			QWORD			8 dup (?)							; a24 E, and its overflow
+ovf				QWORD			8 dup (?)
+bit				QWORD			?									; ladder bit, 254 down to 0
+swap			QWORD			?
+cnt				QWORD			?
+pad				QWORD			5 dup (?)
+x25519_Locals	ENDS
+
+				Proc_w_Local	x25519_u, x25519_Locals, RBX, RSI, RDI, R12, R13, R14, R15
+
+				CheckAlign		RCX, @@exit							; (out) Result
+				CheckAlign		RDX, @@exit							; (in) Scalar
+				CheckAlign		R8, @@exit							; (in) u
+				FOR				v, < k, x1, x2, z2, x3, z3, ta, tb, tc, td, da, cb, te, prod, ovf >
+				LEA				R9, l_Ptr.v
+				Zero512Q		R9
+				ENDM
+				FOR				idx, < 7, 6, 5, 4 >					; k = scalar, x1 = x3 = u
+				MOV				RAX, Q_PTR [ RDX ] [ idx * 8 ]
+				MOV				Q_PTR l_Ptr.k [ idx * 8 ], RAX
+				MOV				RAX, Q_PTR [ R8 ] [ idx * 8 ]
+				MOV				Q_PTR l_Ptr.x1 [ idx * 8 ], RAX
+				MOV				Q_PTR l_Ptr.x3 [ idx * 8 ], RAX
+				ENDM
+				AND				Q_PTR l_Ptr.k [ 7 * 8 ], -8			; clamp: clear bits 0 - 2 and 255, set 254
+				BTR				Q_PTR l_Ptr.k [ 4 * 8 ], 63
+				BTS				Q_PTR l_Ptr.k [ 4 * 8 ], 62
+				BTR				Q_PTR l_Ptr.x1 [ 4 * 8 ], 63		; u: ignore bit 255
+				BTR				Q_PTR l_Ptr.x3 [ 4 * 8 ], 63
+				MOV				Q_PTR l_Ptr.x2 [ 7 * 8 ], 1			; x2 = 1, z2 = 0, z3 = 1
+				MOV				Q_PTR l_Ptr.z3 [ 7 * 8 ], 1
+				MOV				l_Ptr.swap, 0
+				MOV				l_Ptr.bit, 254
+
+@@ladder:		MOV				RCX, l_Ptr.bit						; k_t, bit t of the scalar
+				MOV				RAX, RCX
+				SHR				RAX, 6
+				NEG				RAX
+				LEA				RDX, l_Ptr.k
+				MOV				RDX, Q_PTR [ RDX + RAX * 8 + 7 * 8 ]
+				SHR				RDX, CL
+				AND				EDX, 1
+				MOV				R8, l_Ptr.swap						; swap ^= k_t, as a mask
+				XOR				R8, RDX
+				MOV				l_Ptr.swap, RDX
+				NEG				R8
+				X_CSwap			l_Ptr.x2, l_Ptr.x3
+				X_CSwap			l_Ptr.z2, l_Ptr.z3
+
+				X_Add			l_Ptr.ta, l_Ptr.x2, l_Ptr.z2		; A = x2 + z2
+				X_Sub			l_Ptr.tb, l_Ptr.x2, l_Ptr.z2		; B = x2 - z2
+				X_Add			l_Ptr.tc, l_Ptr.x3, l_Ptr.z3		; C = x3 + z3
+				X_Sub			l_Ptr.td, l_Ptr.x3, l_Ptr.z3		; D = x3 - z3
+				X_Mul			l_Ptr.da, l_Ptr.td, l_Ptr.ta		; DA = D A
+				X_Mul			l_Ptr.cb, l_Ptr.tc, l_Ptr.tb		; CB = C B
+				X_Sqr			l_Ptr.ta, l_Ptr.ta					; AA = A^2
+				X_Sqr			l_Ptr.tb, l_Ptr.tb					; BB = B^2
+				X_Sub			l_Ptr.te, l_Ptr.ta, l_Ptr.tb		; E = AA - BB
+				X_Add			l_Ptr.tc, l_Ptr.da, l_Ptr.cb
+				X_Sub			l_Ptr.td, l_Ptr.da, l_Ptr.cb
+				X_Sqr			l_Ptr.x3, l_Ptr.tc					; x3 = ( DA + CB )^2
+				X_Sqr			l_Ptr.td, l_Ptr.td
+				X_Mul			l_Ptr.z3, l_Ptr.x1, l_Ptr.td		; z3 = x1 ( DA - CB )^2
+				X_Mul			l_Ptr.x2, l_Ptr.ta, l_Ptr.tb		; x2 = AA BB
+				LEA				RCX, l_Ptr.prod						; a24 E
+				LEA				RDX, l_Ptr.ovf
+				LEA				R8, l_Ptr.te
+				MOV				R9D, 121665
+				CALL			mult_uT64
+				LEA				RCX, l_Ptr.prod
+				MOV				RDX, RCX
+				LEA				R8, l_Ptr.ovf
+				CALL			reduce_25519_u
+				X_Add			l_Ptr.prod, l_Ptr.prod, l_Ptr.ta	; AA + a24 E
+				X_Mul			l_Ptr.z2, l_Ptr.te, l_Ptr.prod		; z2 = E ( AA + a24 E )
+				DEC				l_Ptr.bit
+				JNS				@@ladder
+
+				MOV				R8, l_Ptr.swap
+				NEG				R8
+				X_CSwap			l_Ptr.x2, l_Ptr.x3
+				X_CSwap			l_Ptr.z2, l_Ptr.z3
+
+; 1 / z2 = z2^( p - 2 ), p - 2 = 2^255 - 21
+				X_Sqr			l_Ptr.ta, l_Ptr.z2					; ta = z^2
+				X_Sqr			l_Ptr.tb, l_Ptr.ta
+				X_Sqr			l_Ptr.tb, l_Ptr.tb					; tb = z^8
+				X_Mul			l_Ptr.tb, l_Ptr.tb, l_Ptr.z2		; tb = z^9
+				X_Mul			l_Ptr.ta, l_Ptr.ta, l_Ptr.tb		; ta = z^11
+				X_Sqr			l_Ptr.tc, l_Ptr.ta
+				X_Mul			l_Ptr.tb, l_Ptr.tc, l_Ptr.tb		; tb = z^( 2^5 - 1 )
+				X_Mul			l_Ptr.tc, l_Ptr.tb, l_Ptr.tb		; square, 5 times
+				X_SqrN			l_Ptr.tc, 4
+				X_Mul			l_Ptr.tb, l_Ptr.tc, l_Ptr.tb		; tb = z^( 2^10 - 1 )
+				X_Sqr			l_Ptr.tc, l_Ptr.tb
+				X_SqrN			l_Ptr.tc, 9
+				X_Mul			l_Ptr.tc, l_Ptr.tc, l_Ptr.tb		; tc = z^( 2^20 - 1 )
+				X_Sqr			l_Ptr.td, l_Ptr.tc
+				X_SqrN			l_Ptr.td, 19
+				X_Mul			l_Ptr.td, l_Ptr.td, l_Ptr.tc		; td = z^( 2^40 - 1 )
+				X_SqrN			l_Ptr.td, 10
+				X_Mul			l_Ptr.tb, l_Ptr.td, l_Ptr.tb		; tb = z^( 2^50 - 1 )
+				X_Sqr			l_Ptr.tc, l_Ptr.tb
+				X_SqrN			l_Ptr.tc, 49
+				X_Mul			l_Ptr.tc, l_Ptr.tc, l_Ptr.tb		; tc = z^( 2^100 - 1 )
+				X_Sqr			l_Ptr.td, l_Ptr.tc
+				X_SqrN			l_Ptr.td, 99
+				X_Mul			l_Ptr.td, l_Ptr.td, l_Ptr.tc		; td = z^( 2^200 - 1 )
+				X_SqrN			l_Ptr.td, 50
+				X_Mul			l_Ptr.td, l_Ptr.td, l_Ptr.tb		; td = z^( 2^250 - 1 )
+				X_SqrN			l_Ptr.td, 5
+				X_Mul			l_Ptr.td, l_Ptr.td, l_Ptr.ta		; td = z^( 2^255 - 21 )
+
+				X_Mul			l_Ptr.x2, l_Ptr.x2, l_Ptr.td		; x2 / z2, then fully reduced
+				LEA				R8, l_Ptr.ovf						; high half is zero
+				Zero512Q		R8
+				MOV				RCX, RCXHome
+				LEA				RDX, l_Ptr.x2
+				CALL			reduce_25519_u
+				MOV				RCX, RCXHome
+				TestZero512		RCX
+				JZ				@@zero
+				XOR				EAX, EAX							; return zero
+				JMP				@@exit
+@@zero:			MOV				EAX, retcode_neg_one
+@@exit:			Local_Exit		R15, R14, R13, R12, RDI, RSI, RBX
+x25519_u		ENDP
+
+ui512_x25519	ENDS
+				END													; end of module